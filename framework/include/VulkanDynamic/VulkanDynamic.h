@@ -30,6 +30,20 @@
 extern "C" {
 #endif // __cplusplus
 
+#if defined(VULKANDYNAMIC_STATIC) && (defined(__GNUC__) || defined(__clang__))
+    #define VULKANDYNAMIC_API static __attribute__((unused))
+#elif defined(VULKANDYNAMIC_STATIC)
+    #define VULKANDYNAMIC_API static
+#else
+    #define VULKANDYNAMIC_API
+#endif // VULKANDYNAMIC_STATIC
+
+#if defined(_MSC_VER)
+    #define VULKANDYNAMIC_CACHE_ALIGNED __declspec(align(64))
+#else
+    #define VULKANDYNAMIC_CACHE_ALIGNED __attribute__((aligned(64)))
+#endif // _MSC_VER
+
 #define VULKANDYNAMIC_DECLARE_FUNCTION(function) PFN_vk##function function
 
 //---------------------------------------------------------------------------------------
@@ -38,8 +52,8 @@ extern "C" {
 
 VK_DEFINE_HANDLE(VulkanDynamicLoader);
 
-VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateLoader(VulkanDynamicLoader* loader);
-VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyLoader(VulkanDynamicLoader loader);
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateLoader(VulkanDynamicLoader* loader);
+VULKANDYNAMIC_API VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyLoader(VulkanDynamicLoader loader);
 
 typedef struct VulkanDynamicLoaderDispatch
 {
@@ -54,7 +68,7 @@ typedef struct VulkanDynamicLoaderDispatch
 
 } VulkanDynamicLoaderDispatch;
 
-VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetLoaderDispatch(const VulkanDynamicLoader loader, VulkanDynamicLoaderDispatch* loaderDispatch);
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetLoaderDispatch(const VulkanDynamicLoader loader, VulkanDynamicLoaderDispatch* loaderDispatch);
 
 //---------------------------------------------------------------------------------------
 // Instance
@@ -252,7 +266,144 @@ typedef struct VulkanDynamicInstanceDispatch
 #endif // VK_QNX_screen_surface
 } VulkanDynamicInstanceDispatch;
 
-VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetInstanceDispatch(VkInstance instance, const VulkanDynamicLoaderDispatch* loaderDispatch, VulkanDynamicInstanceDispatch* instanceDispatch);
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetInstanceDispatch(VkInstance instance, const VulkanDynamicLoaderDispatch* loaderDispatch, VulkanDynamicInstanceDispatch* instanceDispatch);
+
+//---------------------------------------------------------------------------------------
+// Physical Device
+//
+// The entry points of VulkanDynamicInstanceDispatch taking a VkPhysicalDevice, gathered
+// into one small table for adapter selection and capability queries. Through the
+// Vulkan loader they are the same trampolines as in the instance table: the loader must
+// unwrap the physical device handle, and it does not export the driver-side
+// vk_icdGetPhysicalDeviceProcAddr. Only on Apple, where VulkanDynamicCreateLoader opens
+// MoltenVK directly, are entries resolved through that export and call the driver
+// without a trampoline.
+//---------------------------------------------------------------------------------------
+
+typedef struct VulkanDynamicPhysicalDeviceDispatch
+{
+    // Vulkan Core 1.0
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceFeatures);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceFormatProperties);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceImageFormatProperties);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceProperties);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceQueueFamilyProperties);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceMemoryProperties);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CreateDevice);
+    VULKANDYNAMIC_DECLARE_FUNCTION(EnumerateDeviceExtensionProperties);
+    VULKANDYNAMIC_DECLARE_FUNCTION(EnumerateDeviceLayerProperties);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceSparseImageFormatProperties);
+
+    // Vulkan Core 1.1
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceFeatures2);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceProperties2);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceFormatProperties2);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceImageFormatProperties2);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceQueueFamilyProperties2);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceMemoryProperties2);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceSparseImageFormatProperties2);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceExternalBufferProperties);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceExternalFenceProperties);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceExternalSemaphoreProperties);
+
+#if defined(VK_KHR_surface)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceSurfaceSupportKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceSurfaceCapabilitiesKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceSurfaceFormatsKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceSurfacePresentModesKHR);
+#endif // VK_KHR_surface
+
+#if defined(VK_KHR_display)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceDisplayPropertiesKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceDisplayPlanePropertiesKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetDisplayPlaneSupportedDisplaysKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetDisplayModePropertiesKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CreateDisplayModeKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetDisplayPlaneCapabilitiesKHR);
+#endif // VK_KHR_display
+
+#if defined(VK_KHR_xlib_surface)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceXlibPresentationSupportKHR);
+#endif // VK_KHR_xlib_surface
+
+#if defined(VK_KHR_xcb_surface)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceXcbPresentationSupportKHR);
+#endif // VK_KHR_xcb_surface
+
+#if defined(VK_KHR_wayland_surface)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceWaylandPresentationSupportKHR);
+#endif // VK_KHR_wayland_surface
+
+#if defined(VK_KHR_win32_surface)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceWin32PresentationSupportKHR);
+#endif // VK_KHR_win32_surface
+
+#if defined(VK_NV_external_memory_capabilities)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceExternalImageFormatPropertiesNV);
+#endif // VK_NV_external_memory_capabilities
+
+#if defined(VK_KHR_get_physical_device_properties2)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceFeatures2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceProperties2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceFormatProperties2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceImageFormatProperties2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceQueueFamilyProperties2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceMemoryProperties2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceSparseImageFormatProperties2KHR);
+#endif // VK_KHR_get_physical_device_properties2
+
+#if defined(VK_KHR_external_memory_capabilities)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceExternalBufferPropertiesKHR);
+#endif // VK_KHR_external_memory_capabilities
+
+#if defined(VK_KHR_external_semaphore_capabilities)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceExternalSemaphorePropertiesKHR);
+#endif // VK_KHR_external_semaphore_capabilities
+
+#if defined(VK_EXT_direct_mode_display)
+    VULKANDYNAMIC_DECLARE_FUNCTION(ReleaseDisplayEXT);
+#endif // VK_EXT_direct_mode_display
+
+#if defined(VK_EXT_acquire_xlib_display)
+    VULKANDYNAMIC_DECLARE_FUNCTION(AcquireXlibDisplayEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetRandROutputDisplayEXT);
+#endif // VK_EXT_acquire_xlib_display
+
+#if defined(VK_EXT_display_surface_counter)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceSurfaceCapabilities2EXT);
+#endif // VK_EXT_display_surface_counter
+
+#if defined(VK_KHR_external_fence_capabilities)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceExternalFencePropertiesKHR);
+#endif // VK_KHR_external_fence_capabilities
+
+#if defined(VK_KHR_get_surface_capabilities2)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceSurfaceCapabilities2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceSurfaceFormats2KHR);
+#endif // VK_KHR_get_surface_capabilities2
+
+#if defined(VK_KHR_get_display_properties2)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceDisplayProperties2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceDisplayPlaneProperties2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetDisplayModeProperties2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetDisplayPlaneCapabilities2KHR);
+#endif // VK_KHR_get_display_properties2
+
+#if defined(VK_EXT_acquire_drm_display)
+    VULKANDYNAMIC_DECLARE_FUNCTION(AcquireDrmDisplayEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetDrmDisplayEXT);
+#endif // VK_EXT_acquire_drm_display
+
+#if defined(VK_EXT_directfb_surface)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceDirectFBPresentationSupportEXT);
+#endif // VK_EXT_directfb_surface
+
+#if defined(VK_QNX_screen_surface)
+    VULKANDYNAMIC_DECLARE_FUNCTION(GetPhysicalDeviceScreenPresentationSupportQNX);
+#endif // VK_QNX_screen_surface
+} VulkanDynamicPhysicalDeviceDispatch;
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetPhysicalDeviceDispatch(VkInstance instance, const VulkanDynamicLoader loader, const VulkanDynamicInstanceDispatch* instanceDispatch, VulkanDynamicPhysicalDeviceDispatch* physicalDeviceDispatch);
 
 //---------------------------------------------------------------------------------------
 // Device
@@ -936,10 +1087,362 @@ typedef struct VulkanDynamicDeviceDispatch
 #endif // VK_KHR_push_descriptor || VK_KHR_descriptor_update_template
 } VulkanDynamicDeviceDispatch;
 
-VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetDeviceDispatch(VkDevice device, const VulkanDynamicInstanceDispatch* instanceDispatch, VulkanDynamicDeviceDispatch* deviceDispatch);
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetDeviceDispatch(VkDevice device, const VulkanDynamicInstanceDispatch* instanceDispatch, VulkanDynamicDeviceDispatch* deviceDispatch);
+
+//---------------------------------------------------------------------------------------
+// Command Buffer
+//
+// Only the vkCmd* entry points of VulkanDynamicDeviceDispatch, packed densely and
+// aligned to a cache line, for threads that do nothing but record command buffers.
+// The table holds about 150 pointers, but a thread only loads the lines it calls
+// through: the common core commands fill the first four lines, widely used extensions
+// follow, and rare vendor entries sit at the end, costing address space, not cache.
+//---------------------------------------------------------------------------------------
+
+typedef struct VULKANDYNAMIC_CACHE_ALIGNED VulkanDynamicCommandBufferDispatch
+{
+    // Vulkan Core 1.0, hot: bind, draw, dispatch, barrier and render pass entries first,
+    // eight to a cache line, so a recording loop touches the first four lines only.
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBindPipeline);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBindDescriptorSets);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBindVertexBuffers);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBindIndexBuffer);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdPushConstants);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDraw);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawIndexed);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetViewport);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetScissor);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawIndirect);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawIndexedIndirect);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDispatch);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDispatchIndirect);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdPipelineBarrier);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBeginRenderPass);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdNextSubpass);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdEndRenderPass);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdExecuteCommands);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetDepthBias);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetStencilReference);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetBlendConstants);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetLineWidth);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetDepthBounds);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetStencilCompareMask);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetStencilWriteMask);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyBuffer);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyBufferToImage);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyImage);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyImageToBuffer);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBlitImage);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdUpdateBuffer);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdFillBuffer);
+
+    // Vulkan Core 1.0, cold
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdClearColorImage);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdClearDepthStencilImage);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdClearAttachments);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdResolveImage);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetEvent);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdResetEvent);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdWaitEvents);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBeginQuery);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdEndQuery);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdResetQueryPool);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdWriteTimestamp);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyQueryPoolResults);
+
+    // Vulkan Core 1.1
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetDeviceMask);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDispatchBase);
+
+    // Vulkan Core 1.2
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawIndirectCount);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawIndexedIndirectCount);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBeginRenderPass2);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdNextSubpass2);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdEndRenderPass2);
+
+#if defined(VK_KHR_dynamic_rendering)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdEndRenderingKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBeginRenderingKHR);
+#endif // VK_KHR_dynamic_rendering
+
+#if defined(VK_KHR_push_descriptor)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdPushDescriptorSetKHR);
+#endif // VK_KHR_push_descriptor
+
+#if defined(VK_KHR_draw_indirect_count)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawIndirectCountKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawIndexedIndirectCountKHR);
+#endif // VK_KHR_draw_indirect_count
+
+#if defined(VK_EXT_extended_dynamic_state)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetCullModeEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBindVertexBuffers2EXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetFrontFaceEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetPrimitiveTopologyEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetViewportWithCountEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetScissorWithCountEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetDepthTestEnableEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetDepthWriteEnableEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetDepthBoundsTestEnableEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetDepthCompareOpEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetStencilTestEnableEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetStencilOpEXT);
+#endif // VK_EXT_extended_dynamic_state
+
+#if defined(VK_KHR_synchronization2)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetEvent2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdPipelineBarrier2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdResetEvent2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdWaitEvents2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdWriteTimestamp2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdWriteBufferMarker2AMD);
+#endif // VK_KHR_synchronization2
+
+#if defined(VK_EXT_extended_dynamic_state2)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetPatchControlPointsEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetRasterizerDiscardEnableEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetDepthBiasEnableEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetLogicOpEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetPrimitiveRestartEnableEXT);
+#endif // VK_EXT_extended_dynamic_state2
+
+#if defined(VK_EXT_multi_draw)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawMultiEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawMultiIndexedEXT);
+#endif // VK_EXT_multi_draw
+
+#if defined(VK_KHR_push_descriptor) || defined(VK_KHR_descriptor_update_template)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdPushDescriptorSetWithTemplateKHR);
+#endif // VK_KHR_push_descriptor || VK_KHR_descriptor_update_template
+
+    // Rarely used vendor and special-purpose entries
+
+#if defined(VK_EXT_debug_marker)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDebugMarkerBeginEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDebugMarkerEndEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDebugMarkerInsertEXT);
+#endif // VK_EXT_debug_marker
+
+#if defined(VK_KHR_video_queue)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBeginVideoCodingKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdEndVideoCodingKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdControlVideoCodingKHR);
+#endif // VK_KHR_video_queue
+
+#if defined(VK_KHR_video_decode_queue)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDecodeVideoKHR);
+#endif // VK_KHR_video_decode_queue
+
+#if defined(VK_EXT_transform_feedback)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawIndirectByteCountEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBindTransformFeedbackBuffersEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdEndTransformFeedbackEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBeginTransformFeedbackEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdEndQueryIndexedEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBeginQueryIndexedEXT);
+#endif // VK_EXT_transform_feedback
+
+#if defined(VK_NVX_binary_import)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCuLaunchKernelNVX);
+#endif // VK_NVX_binary_import
+
+#if defined(VK_AMD_draw_indirect_count)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawIndirectCountAMD);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawIndexedIndirectCountAMD);
+#endif // VK_AMD_draw_indirect_count
+
+#if defined(VK_KHR_device_group)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetDeviceMaskKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDispatchBaseKHR);
+#endif // VK_KHR_device_group
+
+#if defined(VK_EXT_conditional_rendering)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdEndConditionalRenderingEXT);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBeginConditionalRenderingEXT);
+#endif // VK_EXT_conditional_rendering
+
+#if defined(VK_NV_clip_space_w_scaling)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetViewportWScalingNV);
+#endif // VK_NV_clip_space_w_scaling
+
+#if defined(VK_EXT_discard_rectangles)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetDiscardRectangleEXT);
+#endif // VK_EXT_discard_rectangles
+
+#if defined(VK_KHR_create_renderpass2)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdEndRenderPass2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdNextSubpass2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBeginRenderPass2KHR);
+#endif // VK_KHR_create_renderpass2
+
+#if defined(VK_EXT_sample_locations)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetSampleLocationsEXT);
+#endif // VK_EXT_sample_locations
+
+#if defined(VK_KHR_acceleration_structure)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBuildAccelerationStructuresKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdWriteAccelerationStructuresPropertiesKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBuildAccelerationStructuresIndirectKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyAccelerationStructureKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyAccelerationStructureToMemoryKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyMemoryToAccelerationStructureKHR);
+#endif // VK_KHR_acceleration_structure
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdTraceRaysKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdTraceRaysIndirectKHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetRayTracingPipelineStackSizeKHR);
+#endif // VK_KHR_ray_tracing_pipeline
+
+#if defined(VK_NV_shading_rate_image)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBindShadingRateImageNV);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetCoarseSampleOrderNV);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetViewportShadingRatePaletteNV);
+#endif // VK_NV_shading_rate_image
+
+#if defined(VK_NV_ray_tracing)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyAccelerationStructureNV);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBuildAccelerationStructureNV);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdTraceRaysNV);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdWriteAccelerationStructuresPropertiesNV);
+#endif // VK_NV_ray_tracing
+
+#if defined(VK_AMD_buffer_marker)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdWriteBufferMarkerAMD);
+#endif // VK_AMD_buffer_marker
+
+#if defined(VK_NV_mesh_shader)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawMeshTasksNV);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawMeshTasksIndirectNV);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdDrawMeshTasksIndirectCountNV);
+#endif // VK_NV_mesh_shader
+
+#if defined(VK_NV_scissor_exclusive)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetExclusiveScissorNV);
+#endif // VK_NV_scissor_exclusive
+
+#if defined(VK_NV_device_diagnostic_checkpoints)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetCheckpointNV);
+#endif // VK_NV_device_diagnostic_checkpoints
+
+#if defined(VK_INTEL_performance_query)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetPerformanceStreamMarkerINTEL);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetPerformanceMarkerINTEL);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetPerformanceOverrideINTEL);
+#endif // VK_INTEL_performance_query
+
+#if defined(VK_KHR_fragment_shading_rate)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetFragmentShadingRateKHR);
+#endif // VK_KHR_fragment_shading_rate
+
+#if defined(VK_EXT_line_rasterization)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetLineStippleEXT);
+#endif // VK_EXT_line_rasterization
+
+#if defined(VK_NV_device_generated_commands)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdPreprocessGeneratedCommandsNV);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdExecuteGeneratedCommandsNV);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBindPipelineShaderGroupNV);
+#endif // VK_NV_device_generated_commands
+
+#if defined(VK_KHR_video_encode_queue)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdEncodeVideoKHR);
+#endif // VK_KHR_video_encode_queue
+
+#if defined(VK_NV_fragment_shading_rate_enums)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetFragmentShadingRateEnumNV);
+#endif // VK_NV_fragment_shading_rate_enums
+
+#if defined(VK_KHR_copy_commands2)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyBuffer2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyImage2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyBufferToImage2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdCopyImageToBuffer2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBlitImage2KHR);
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdResolveImage2KHR);
+#endif // VK_KHR_copy_commands2
+
+#if defined(VK_EXT_vertex_input_dynamic_state)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetVertexInputEXT);
+#endif // VK_EXT_vertex_input_dynamic_state
+
+#if defined(VK_HUAWEI_subpass_shading)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSubpassShadingHUAWEI);
+#endif // VK_HUAWEI_subpass_shading
+
+#if defined(VK_HUAWEI_invocation_mask)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdBindInvocationMaskHUAWEI);
+#endif // VK_HUAWEI_invocation_mask
+
+#if defined(VK_EXT_color_write_enable)
+    VULKANDYNAMIC_DECLARE_FUNCTION(CmdSetColorWriteEnableEXT);
+#endif // VK_EXT_color_write_enable
+} VulkanDynamicCommandBufferDispatch;
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetCommandBufferDispatch(const VulkanDynamicDeviceDispatch* deviceDispatch, VulkanDynamicCommandBufferDispatch* commandBufferDispatch);
+
+//---------------------------------------------------------------------------------------
+// Resolution Statistics
+//
+// Successful VulkanDynamicGet*Dispatch calls per tier, the time spent in them and how
+// many entry points the latest call resolved.
+//---------------------------------------------------------------------------------------
+
+typedef enum VulkanDynamicTier
+{
+    VULKANDYNAMIC_TIER_LOADER,
+    VULKANDYNAMIC_TIER_INSTANCE,
+    VULKANDYNAMIC_TIER_PHYSICAL_DEVICE,
+    VULKANDYNAMIC_TIER_DEVICE,
+    VULKANDYNAMIC_TIER_COMMAND_BUFFER,
+    VULKANDYNAMIC_TIER_COUNT
+} VulkanDynamicTier;
+
+typedef struct VulkanDynamicResolutionStatistics
+{
+    uint64_t resolveCount;
+    uint64_t resolveNanoseconds;
+    uint64_t resolvedFunctionCount;
+    uint64_t functionCount;
+} VulkanDynamicResolutionStatistics;
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetResolutionStatistics(VulkanDynamicTier tier, VulkanDynamicResolutionStatistics* statistics);
 
 #if defined(__cplusplus)
 }
 #endif // __cplusplus
 
 #endif // __VULKANDYNAMIC_H__
+
+//---------------------------------------------------------------------------------------
+// Implementation
+//
+// Define VULKANDYNAMIC_IMPLEMENTATION in exactly one translation unit before including
+// this header to compile the resolvers and the platform SharedLibrary code into it; the
+// other translation units include the header alone and link against that copy.
+// With VULKANDYNAMIC_STATIC the definitions are static instead: define both macros in
+// every translation unit that calls the library, and each gets a private copy the
+// compiler is free to inline and specialize.
+//---------------------------------------------------------------------------------------
+
+#if defined(VULKANDYNAMIC_IMPLEMENTATION) && !defined(__VULKANDYNAMIC_IMPLEMENTATION__)
+#define __VULKANDYNAMIC_IMPLEMENTATION__
+
+#if defined(_WIN32)
+    #include <Platform/Win32/Clock.c>
+    #include <Platform/Win32/SharedLibrary.c>
+#else
+    #include <Platform/Posix/Clock.c>
+    #include <Platform/Posix/SharedLibrary.c>
+#endif // _WIN32
+
+#include <VulkanDynamic.c>
+
+#include <VulkanDynamicInterpose.c>
+
+#if !defined(VULKANDYNAMIC_STATIC)
+    #include <VulkanDynamicGlobal.c>
+#endif // !VULKANDYNAMIC_STATIC
+
+#endif // VULKANDYNAMIC_IMPLEMENTATION
@@ -133,6 +133,25 @@ namespace VulkanDynamic
         InstanceDispatch() noexcept = default;
     };
 
+    //------------------------------------------------------------------------------------
+    // Physical Device
+    //------------------------------------------------------------------------------------
+
+    struct PhysicalDeviceDispatch : ::VulkanDynamicPhysicalDeviceDispatch
+    {
+        explicit PhysicalDeviceDispatch(::VkInstance instance, const Loader& loader, const InstanceDispatch& instanceDispatch, ::VkResult& result) noexcept : PhysicalDeviceDispatch{}
+        {
+            result = ::VulkanDynamicGetPhysicalDeviceDispatch(instance, loader, &instanceDispatch, this);
+        }
+
+        explicit PhysicalDeviceDispatch(::VkInstance instance, const Loader& loader, const InstanceDispatch& instanceDispatch) noexcept : PhysicalDeviceDispatch{}
+        {
+            ::VulkanDynamicGetPhysicalDeviceDispatch(instance, loader, &instanceDispatch, this);
+        }
+
+        PhysicalDeviceDispatch() noexcept = default;
+    };
+
     //------------------------------------------------------------------------------------
     // Device
     //------------------------------------------------------------------------------------
@@ -151,6 +170,25 @@ namespace VulkanDynamic
 
         DeviceDispatch() noexcept = default;
     };
+
+    //------------------------------------------------------------------------------------
+    // Command Buffer
+    //------------------------------------------------------------------------------------
+
+    struct CommandBufferDispatch : ::VulkanDynamicCommandBufferDispatch
+    {
+        explicit CommandBufferDispatch(const DeviceDispatch& deviceDispatch, ::VkResult& result) noexcept : CommandBufferDispatch{}
+        {
+            result = ::VulkanDynamicGetCommandBufferDispatch(&deviceDispatch, this);
+        }
+
+        explicit CommandBufferDispatch(const DeviceDispatch& deviceDispatch) noexcept : CommandBufferDispatch{}
+        {
+            ::VulkanDynamicGetCommandBufferDispatch(&deviceDispatch, this);
+        }
+
+        CommandBufferDispatch() noexcept = default;
+    };
 } // namespace VulkanDynamic
 
 #endif // __VULKANDYNAMIC_HPP__
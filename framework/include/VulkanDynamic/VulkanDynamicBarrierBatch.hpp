@@ -0,0 +1,531 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_BARRIER_BATCH_HPP__
+#define __VULKANDYNAMIC_BARRIER_BATCH_HPP__
+
+#include "VulkanDynamicHandles.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace VulkanDynamic
+{
+    namespace Detail
+    {
+        // Stages that stand for other stages: meta stages, and the stages only
+        // synchronization2 can name, which split or group legacy ones.
+        constexpr ::uint64_t ImplicitPipelineStages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT
+            | VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT | VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_ALL_COMMANDS_BIT | ~0xFFFFFFFFull;
+
+        // Synchronization scopes of one barrier, in synchronization2 widths.
+        struct BarrierScopes
+        {
+            ::uint64_t srcStageMask;
+            ::uint64_t srcAccessMask;
+            ::uint64_t dstStageMask;
+            ::uint64_t dstAccessMask;
+
+            void Merge(const BarrierScopes& other) noexcept
+            {
+                srcStageMask |= other.srcStageMask;
+                srcAccessMask |= other.srcAccessMask;
+                dstStageMask |= other.dstStageMask;
+                dstAccessMask |= other.dstAccessMask;
+            }
+
+            // Whether a later barrier with these scopes depends on `earlier` through an
+            // execution dependency chain. Implicit stages are assumed to chain.
+            bool ChainsAfter(const BarrierScopes& earlier) const noexcept
+            {
+                return (earlier.dstStageMask & srcStageMask)
+                    || ((earlier.dstStageMask & ImplicitPipelineStages) && srcStageMask)
+                    || ((srcStageMask & ImplicitPipelineStages) && earlier.dstStageMask);
+            }
+        };
+
+        struct BufferBarrier
+        {
+            BarrierScopes scopes;
+            ::uint32_t srcQueueFamilyIndex;
+            ::uint32_t dstQueueFamilyIndex;
+            ::VkBuffer buffer;
+            ::VkDeviceSize offset;
+            ::VkDeviceSize size;
+        };
+
+        struct ImageBarrier
+        {
+            BarrierScopes scopes;
+            ::VkImageLayout oldLayout;
+            ::VkImageLayout newLayout;
+            ::uint32_t srcQueueFamilyIndex;
+            ::uint32_t dstQueueFamilyIndex;
+            ::VkImage image;
+            ::VkImageSubresourceRange subresourceRange;
+        };
+
+        // Whether [first, first + count) and [otherFirst, otherFirst + otherCount) intersect,
+        // with `remaining` standing for a count reaching the end of the resource.
+        template<typename T>
+        inline bool RangesOverlap(T first, T count, T otherFirst, T otherCount, T remaining) noexcept
+        {
+            return (count == remaining || otherFirst < first + count) && (otherCount == remaining || first < otherFirst + otherCount);
+        }
+    } // namespace Detail
+
+    struct BarrierBatchStatistics
+    {
+        ::uint64_t batchedCallCount;
+        ::uint64_t emittedCallCount;
+        ::uint64_t mergedBarrierCount;
+        ::uint64_t droppedTransitionCount;
+    };
+
+    //------------------------------------------------------------------------------------
+    // Barrier Batch
+    //------------------------------------------------------------------------------------
+
+    // Collects the barriers of vkCmdPipelineBarrier and vkCmdPipelineBarrier2KHR calls for
+    // one command buffer and emits them as a single call at Flush(). Global memory barriers
+    // merge into one; barriers on the same buffer range or image subresource range merge
+    // into one with the union of their scopes, and consecutive layout transitions collapse
+    // into a single transition, dropping the intermediate layouts. A batch is flushed early
+    // when a barrier overlaps a pending one it cannot merge with, as barriers of one call
+    // are unordered, and when the dependency flags change. Barriers with pNext chains are
+    // issued unbatched, after flushing.
+    //
+    // Barriers that an earlier batched barrier chains into inherit its source scopes, so
+    // the single call synchronizes at least as much as the calls it replaces. Callers must
+    // flush before recording commands that depend on the batched barriers; the destructor
+    // flushes what is left.
+    class BarrierBatch : public Detail::DispatchHandle<::VkCommandBuffer, DeviceDispatch>
+    {
+    public:
+        explicit BarrierBatch(::VkCommandBuffer commandBuffer, const DeviceDispatch& deviceDispatch) noexcept
+            : DispatchHandle{ commandBuffer, &deviceDispatch }
+        {
+        }
+
+        BarrierBatch(const BarrierBatch&) noexcept = delete;
+
+        ~BarrierBatch() noexcept
+        {
+            Flush();
+        }
+
+        BarrierBatch& operator=(const BarrierBatch&) noexcept = delete;
+
+        void CmdPipelineBarrier(::VkPipelineStageFlags srcStageMask, ::VkPipelineStageFlags dstStageMask, ::VkDependencyFlags dependencyFlags,
+            ::uint32_t memoryBarrierCount, const ::VkMemoryBarrier* pMemoryBarriers,
+            ::uint32_t bufferMemoryBarrierCount, const ::VkBufferMemoryBarrier* pBufferMemoryBarriers,
+            ::uint32_t imageMemoryBarrierCount, const ::VkImageMemoryBarrier* pImageMemoryBarriers)
+        {
+            if (HasNext(memoryBarrierCount, pMemoryBarriers) || HasNext(bufferMemoryBarrierCount, pBufferMemoryBarriers) || HasNext(imageMemoryBarrierCount, pImageMemoryBarriers))
+            {
+                Flush();
+                dispatch_->CmdPipelineBarrier(handle_, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers,
+                    bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+                ++statistics_.emittedCallCount;
+                return;
+            }
+
+            Begin(dependencyFlags);
+
+            // An execution dependency without barriers travels as an empty memory barrier.
+            if (memoryBarrierCount + bufferMemoryBarrierCount + imageMemoryBarrierCount == 0)
+            {
+                AddMemoryBarrier(Detail::BarrierScopes{ srcStageMask, 0, dstStageMask, 0 });
+            }
+
+            for (::uint32_t index = 0; index < memoryBarrierCount; ++index)
+            {
+                const ::VkMemoryBarrier& barrier = pMemoryBarriers[index];
+                AddMemoryBarrier(Detail::BarrierScopes{ srcStageMask, barrier.srcAccessMask, dstStageMask, barrier.dstAccessMask });
+            }
+
+            for (::uint32_t index = 0; index < bufferMemoryBarrierCount; ++index)
+            {
+                const ::VkBufferMemoryBarrier& barrier = pBufferMemoryBarriers[index];
+                AddBufferBarrier(Detail::BufferBarrier{ { srcStageMask, barrier.srcAccessMask, dstStageMask, barrier.dstAccessMask },
+                    barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex, barrier.buffer, barrier.offset, barrier.size });
+            }
+
+            for (::uint32_t index = 0; index < imageMemoryBarrierCount; ++index)
+            {
+                const ::VkImageMemoryBarrier& barrier = pImageMemoryBarriers[index];
+                AddImageBarrier(Detail::ImageBarrier{ { srcStageMask, barrier.srcAccessMask, dstStageMask, barrier.dstAccessMask },
+                    barrier.oldLayout, barrier.newLayout, barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex, barrier.image, barrier.subresourceRange });
+            }
+        }
+
+#if defined(VK_KHR_synchronization2)
+        void CmdPipelineBarrier2KHR(const ::VkDependencyInfoKHR* pDependencyInfo)
+        {
+            const ::VkDependencyInfoKHR& info = *pDependencyInfo;
+            if (info.pNext || HasNext(info.memoryBarrierCount, info.pMemoryBarriers) || HasNext(info.bufferMemoryBarrierCount, info.pBufferMemoryBarriers)
+                || HasNext(info.imageMemoryBarrierCount, info.pImageMemoryBarriers))
+            {
+                Flush();
+                dispatch_->CmdPipelineBarrier2KHR(handle_, pDependencyInfo);
+                ++statistics_.emittedCallCount;
+                return;
+            }
+
+            Begin(info.dependencyFlags);
+            synchronization2_ = true;
+
+            for (::uint32_t index = 0; index < info.memoryBarrierCount; ++index)
+            {
+                const ::VkMemoryBarrier2KHR& barrier = info.pMemoryBarriers[index];
+                AddMemoryBarrier(Detail::BarrierScopes{ barrier.srcStageMask, barrier.srcAccessMask, barrier.dstStageMask, barrier.dstAccessMask });
+            }
+
+            for (::uint32_t index = 0; index < info.bufferMemoryBarrierCount; ++index)
+            {
+                const ::VkBufferMemoryBarrier2KHR& barrier = info.pBufferMemoryBarriers[index];
+                AddBufferBarrier(Detail::BufferBarrier{ { barrier.srcStageMask, barrier.srcAccessMask, barrier.dstStageMask, barrier.dstAccessMask },
+                    barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex, barrier.buffer, barrier.offset, barrier.size });
+            }
+
+            for (::uint32_t index = 0; index < info.imageMemoryBarrierCount; ++index)
+            {
+                const ::VkImageMemoryBarrier2KHR& barrier = info.pImageMemoryBarriers[index];
+                AddImageBarrier(Detail::ImageBarrier{ { barrier.srcStageMask, barrier.srcAccessMask, barrier.dstStageMask, barrier.dstAccessMask },
+                    barrier.oldLayout, barrier.newLayout, barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex, barrier.image, barrier.subresourceRange });
+            }
+        }
+#endif // VK_KHR_synchronization2
+
+        // Emits the pending barriers as one vkCmdPipelineBarrier2KHR call if any of them came
+        // through it, and as one vkCmdPipelineBarrier call otherwise.
+        void Flush()
+        {
+            if (!pending_)
+            {
+                return;
+            }
+
+#if defined(VK_KHR_synchronization2)
+            if (synchronization2_)
+            {
+                EmitSynchronization2();
+            }
+            else
+#endif // VK_KHR_synchronization2
+            {
+                EmitLegacy();
+            }
+
+            ++statistics_.emittedCallCount;
+
+            pending_ = false;
+            synchronization2_ = false;
+            memoryBarrier_ = Detail::BarrierScopes{};
+            hasMemoryBarrier_ = false;
+            bufferBarriers_.clear();
+            imageBarriers_.clear();
+        }
+
+        const BarrierBatchStatistics& Statistics() const noexcept
+        {
+            return statistics_;
+        }
+
+    private:
+        template<typename Barrier>
+        static bool HasNext(::uint32_t count, const Barrier* barriers) noexcept
+        {
+            for (::uint32_t index = 0; index < count; ++index)
+            {
+                if (barriers[index].pNext)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        static bool TransfersOwnership(::uint32_t srcQueueFamilyIndex, ::uint32_t dstQueueFamilyIndex) noexcept
+        {
+            return srcQueueFamilyIndex != dstQueueFamilyIndex;
+        }
+
+        void Begin(::VkDependencyFlags dependencyFlags)
+        {
+            if (pending_ && dependencyFlags != dependencyFlags_)
+            {
+                Flush();
+            }
+
+            dependencyFlags_ = dependencyFlags;
+            pending_ = true;
+            ++statistics_.batchedCallCount;
+        }
+
+        // Barriers of one call are unordered: emits the pending ones, which have to execute
+        // first, and keeps batching the current call.
+        void Split()
+        {
+            const bool synchronization2 = synchronization2_;
+            Flush();
+
+            pending_ = true;
+            synchronization2_ = synchronization2;
+        }
+
+        // Adds the source scopes of every pending barrier `scopes` chains after.
+        Detail::BarrierScopes Chain(Detail::BarrierScopes scopes) const noexcept
+        {
+            Detail::BarrierScopes inherited{};
+            if (hasMemoryBarrier_ && scopes.ChainsAfter(memoryBarrier_))
+            {
+                inherited.Merge(memoryBarrier_);
+            }
+
+            for (const Detail::BufferBarrier& barrier : bufferBarriers_)
+            {
+                if (scopes.ChainsAfter(barrier.scopes))
+                {
+                    inherited.Merge(barrier.scopes);
+                }
+            }
+
+            for (const Detail::ImageBarrier& barrier : imageBarriers_)
+            {
+                if (scopes.ChainsAfter(barrier.scopes))
+                {
+                    inherited.Merge(barrier.scopes);
+                }
+            }
+
+            scopes.srcStageMask |= inherited.srcStageMask;
+            scopes.srcAccessMask |= inherited.srcAccessMask;
+            return scopes;
+        }
+
+        void AddMemoryBarrier(const Detail::BarrierScopes& scopes)
+        {
+            const Detail::BarrierScopes chained = Chain(scopes);
+            statistics_.mergedBarrierCount += hasMemoryBarrier_ ? 1 : 0;
+
+            memoryBarrier_.Merge(chained);
+            hasMemoryBarrier_ = true;
+        }
+
+        void AddBufferBarrier(Detail::BufferBarrier barrier)
+        {
+            barrier.scopes = Chain(barrier.scopes);
+
+            for (Detail::BufferBarrier& pending : bufferBarriers_)
+            {
+                if (pending.buffer != barrier.buffer || !Detail::RangesOverlap<::VkDeviceSize>(pending.offset, pending.size, barrier.offset, barrier.size, VK_WHOLE_SIZE))
+                {
+                    continue;
+                }
+
+                if (TransfersOwnership(pending.srcQueueFamilyIndex, pending.dstQueueFamilyIndex) || TransfersOwnership(barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex))
+                {
+                    Split();
+                    break;
+                }
+
+                const ::VkDeviceSize begin = pending.offset < barrier.offset ? pending.offset : barrier.offset;
+                const ::VkDeviceSize pendingEnd = pending.size == VK_WHOLE_SIZE ? VK_WHOLE_SIZE : pending.offset + pending.size;
+                const ::VkDeviceSize barrierEnd = barrier.size == VK_WHOLE_SIZE ? VK_WHOLE_SIZE : barrier.offset + barrier.size;
+                const ::VkDeviceSize end = pendingEnd > barrierEnd ? pendingEnd : barrierEnd;
+
+                pending.offset = begin;
+                pending.size = end == VK_WHOLE_SIZE ? VK_WHOLE_SIZE : end - begin;
+                pending.scopes.Merge(barrier.scopes);
+                ++statistics_.mergedBarrierCount;
+                return;
+            }
+
+            bufferBarriers_.push_back(barrier);
+        }
+
+        void AddImageBarrier(Detail::ImageBarrier barrier)
+        {
+            barrier.scopes = Chain(barrier.scopes);
+
+            const ::VkImageSubresourceRange& range = barrier.subresourceRange;
+            for (Detail::ImageBarrier& pending : imageBarriers_)
+            {
+                const ::VkImageSubresourceRange& pendingRange = pending.subresourceRange;
+                if (pending.image != barrier.image || !(pendingRange.aspectMask & range.aspectMask)
+                    || !Detail::RangesOverlap<::uint32_t>(pendingRange.baseMipLevel, pendingRange.levelCount, range.baseMipLevel, range.levelCount, VK_REMAINING_MIP_LEVELS)
+                    || !Detail::RangesOverlap<::uint32_t>(pendingRange.baseArrayLayer, pendingRange.layerCount, range.baseArrayLayer, range.layerCount, VK_REMAINING_ARRAY_LAYERS))
+                {
+                    continue;
+                }
+
+                const bool sameRange = pendingRange.aspectMask == range.aspectMask && pendingRange.baseMipLevel == range.baseMipLevel && pendingRange.levelCount == range.levelCount
+                    && pendingRange.baseArrayLayer == range.baseArrayLayer && pendingRange.layerCount == range.layerCount;
+                const bool follows = barrier.oldLayout == pending.newLayout || barrier.oldLayout == VK_IMAGE_LAYOUT_UNDEFINED;
+                if (!sameRange || !follows || TransfersOwnership(pending.srcQueueFamilyIndex, pending.dstQueueFamilyIndex)
+                    || TransfersOwnership(barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex))
+                {
+                    Split();
+                    break;
+                }
+
+                const int transitions = (pending.oldLayout != pending.newLayout ? 1 : 0) + (barrier.oldLayout != barrier.newLayout ? 1 : 0);
+
+                // Discarding the contents discards them for the merged transition too.
+                pending.oldLayout = barrier.oldLayout == VK_IMAGE_LAYOUT_UNDEFINED ? VK_IMAGE_LAYOUT_UNDEFINED : pending.oldLayout;
+                pending.newLayout = barrier.newLayout;
+                pending.scopes.Merge(barrier.scopes);
+
+                const int remaining = pending.oldLayout != pending.newLayout ? 1 : 0;
+                statistics_.droppedTransitionCount += static_cast<::uint64_t>(transitions > remaining ? transitions - remaining : 0);
+                ++statistics_.mergedBarrierCount;
+                return;
+            }
+
+            imageBarriers_.push_back(barrier);
+        }
+
+        void EmitLegacy()
+        {
+            ::VkPipelineStageFlags srcStageMask = static_cast<::VkPipelineStageFlags>(memoryBarrier_.srcStageMask);
+            ::VkPipelineStageFlags dstStageMask = static_cast<::VkPipelineStageFlags>(memoryBarrier_.dstStageMask);
+
+            ::VkMemoryBarrier memoryBarrier{};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.srcAccessMask = static_cast<::VkAccessFlags>(memoryBarrier_.srcAccessMask);
+            memoryBarrier.dstAccessMask = static_cast<::VkAccessFlags>(memoryBarrier_.dstAccessMask);
+            const ::uint32_t memoryBarrierCount = hasMemoryBarrier_ && (memoryBarrier.srcAccessMask || memoryBarrier.dstAccessMask) ? 1 : 0;
+
+            legacyBufferBarriers_.clear();
+            for (const Detail::BufferBarrier& barrier : bufferBarriers_)
+            {
+                ::VkBufferMemoryBarrier bufferBarrier{};
+                bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+                bufferBarrier.srcAccessMask = static_cast<::VkAccessFlags>(barrier.scopes.srcAccessMask);
+                bufferBarrier.dstAccessMask = static_cast<::VkAccessFlags>(barrier.scopes.dstAccessMask);
+                bufferBarrier.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+                bufferBarrier.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+                bufferBarrier.buffer = barrier.buffer;
+                bufferBarrier.offset = barrier.offset;
+                bufferBarrier.size = barrier.size;
+                legacyBufferBarriers_.push_back(bufferBarrier);
+
+                srcStageMask |= static_cast<::VkPipelineStageFlags>(barrier.scopes.srcStageMask);
+                dstStageMask |= static_cast<::VkPipelineStageFlags>(barrier.scopes.dstStageMask);
+            }
+
+            legacyImageBarriers_.clear();
+            for (const Detail::ImageBarrier& barrier : imageBarriers_)
+            {
+                ::VkImageMemoryBarrier imageBarrier{};
+                imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+                imageBarrier.srcAccessMask = static_cast<::VkAccessFlags>(barrier.scopes.srcAccessMask);
+                imageBarrier.dstAccessMask = static_cast<::VkAccessFlags>(barrier.scopes.dstAccessMask);
+                imageBarrier.oldLayout = barrier.oldLayout;
+                imageBarrier.newLayout = barrier.newLayout;
+                imageBarrier.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+                imageBarrier.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+                imageBarrier.image = barrier.image;
+                imageBarrier.subresourceRange = barrier.subresourceRange;
+                legacyImageBarriers_.push_back(imageBarrier);
+
+                srcStageMask |= static_cast<::VkPipelineStageFlags>(barrier.scopes.srcStageMask);
+                dstStageMask |= static_cast<::VkPipelineStageFlags>(barrier.scopes.dstStageMask);
+            }
+
+            dispatch_->CmdPipelineBarrier(handle_, srcStageMask, dstStageMask, dependencyFlags_, memoryBarrierCount, &memoryBarrier,
+                static_cast<::uint32_t>(legacyBufferBarriers_.size()), legacyBufferBarriers_.data(),
+                static_cast<::uint32_t>(legacyImageBarriers_.size()), legacyImageBarriers_.data());
+        }
+
+#if defined(VK_KHR_synchronization2)
+        void EmitSynchronization2()
+        {
+            ::VkMemoryBarrier2KHR memoryBarrier{};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+            memoryBarrier.srcStageMask = memoryBarrier_.srcStageMask;
+            memoryBarrier.srcAccessMask = memoryBarrier_.srcAccessMask;
+            memoryBarrier.dstStageMask = memoryBarrier_.dstStageMask;
+            memoryBarrier.dstAccessMask = memoryBarrier_.dstAccessMask;
+
+            bufferBarriers2_.clear();
+            for (const Detail::BufferBarrier& barrier : bufferBarriers_)
+            {
+                ::VkBufferMemoryBarrier2KHR bufferBarrier{};
+                bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
+                bufferBarrier.srcStageMask = barrier.scopes.srcStageMask;
+                bufferBarrier.srcAccessMask = barrier.scopes.srcAccessMask;
+                bufferBarrier.dstStageMask = barrier.scopes.dstStageMask;
+                bufferBarrier.dstAccessMask = barrier.scopes.dstAccessMask;
+                bufferBarrier.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+                bufferBarrier.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+                bufferBarrier.buffer = barrier.buffer;
+                bufferBarrier.offset = barrier.offset;
+                bufferBarrier.size = barrier.size;
+                bufferBarriers2_.push_back(bufferBarrier);
+            }
+
+            imageBarriers2_.clear();
+            for (const Detail::ImageBarrier& barrier : imageBarriers_)
+            {
+                ::VkImageMemoryBarrier2KHR imageBarrier{};
+                imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+                imageBarrier.srcStageMask = barrier.scopes.srcStageMask;
+                imageBarrier.srcAccessMask = barrier.scopes.srcAccessMask;
+                imageBarrier.dstStageMask = barrier.scopes.dstStageMask;
+                imageBarrier.dstAccessMask = barrier.scopes.dstAccessMask;
+                imageBarrier.oldLayout = barrier.oldLayout;
+                imageBarrier.newLayout = barrier.newLayout;
+                imageBarrier.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+                imageBarrier.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+                imageBarrier.image = barrier.image;
+                imageBarrier.subresourceRange = barrier.subresourceRange;
+                imageBarriers2_.push_back(imageBarrier);
+            }
+
+            ::VkDependencyInfoKHR dependencyInfo{};
+            dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+            dependencyInfo.dependencyFlags = dependencyFlags_;
+            dependencyInfo.memoryBarrierCount = hasMemoryBarrier_ ? 1 : 0;
+            dependencyInfo.pMemoryBarriers = &memoryBarrier;
+            dependencyInfo.bufferMemoryBarrierCount = static_cast<::uint32_t>(bufferBarriers2_.size());
+            dependencyInfo.pBufferMemoryBarriers = bufferBarriers2_.data();
+            dependencyInfo.imageMemoryBarrierCount = static_cast<::uint32_t>(imageBarriers2_.size());
+            dependencyInfo.pImageMemoryBarriers = imageBarriers2_.data();
+
+            dispatch_->CmdPipelineBarrier2KHR(handle_, &dependencyInfo);
+        }
+#endif // VK_KHR_synchronization2
+
+    private:
+        bool pending_{ false };
+        bool synchronization2_{ false };
+        ::VkDependencyFlags dependencyFlags_{ 0 };
+        Detail::BarrierScopes memoryBarrier_{};
+        bool hasMemoryBarrier_{ false };
+        ::std::vector<Detail::BufferBarrier> bufferBarriers_;
+        ::std::vector<Detail::ImageBarrier> imageBarriers_;
+        ::std::vector<::VkBufferMemoryBarrier> legacyBufferBarriers_;
+        ::std::vector<::VkImageMemoryBarrier> legacyImageBarriers_;
+#if defined(VK_KHR_synchronization2)
+        ::std::vector<::VkBufferMemoryBarrier2KHR> bufferBarriers2_;
+        ::std::vector<::VkImageMemoryBarrier2KHR> imageBarriers2_;
+#endif // VK_KHR_synchronization2
+        BarrierBatchStatistics statistics_{};
+    };
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_BARRIER_BATCH_HPP__
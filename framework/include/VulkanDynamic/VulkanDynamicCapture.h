@@ -0,0 +1,94 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_CAPTURE_H__
+#define __VULKANDYNAMIC_CAPTURE_H__
+
+// API call capture: while a capture is running, every entry point of a captured device
+// table appends its function identifier and arguments to a memory-mapped, append-only
+// file. Structures, arrays and known pNext structures are copied deeply; entry points
+// whose arguments cannot be serialized (object creation with allocation callbacks,
+// output handles, opaque pointers) are recorded as uncaptured calls without arguments,
+// and so are calls whose pNext chains hold structures the capture does not know.
+// Each thread buffers its records and appends them to the file in chunks; every record
+// carries a process-wide sequence number, and replay re-issues records in that order.
+// A process that dies mid-capture still leaves a readable prefix of complete chunks.
+//
+// There is one captured table per process, forwarding to `next`; capturing a second,
+// different `next` fails with VK_ERROR_TOO_MANY_OBJECTS.
+//
+// VulkanDynamicReplayCapture re-issues a capture through any device table. Handles are
+// replayed with their captured values, so replay targets stand-in drivers that do not
+// dereference them, e.g. to measure driver-call and dispatch overhead without a GPU.
+// Replaying into a real driver passes it handles it never created.
+
+#include "VulkanDynamic.h"
+#include "VulkanDynamicFunctions.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+#define VULKANDYNAMIC_CAPTURE_MAGIC 0x43444B56u // "VKDC"
+#define VULKANDYNAMIC_CAPTURE_VERSION 2
+#define VULKANDYNAMIC_CAPTURE_UNCAPTURED_BIT 0x80000000u
+
+// File layout: a VulkanDynamicCaptureHeader followed by records, each a
+// VulkanDynamicCaptureRecord and `size` bytes of arguments padded to 8 bytes. Records
+// are grouped by thread; `sequence` orders the calls of all threads.
+typedef struct VulkanDynamicCaptureHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t pointerSize;
+    uint32_t deviceFunctionCount;
+    uint64_t size;
+    uint64_t recordCount;
+    uint64_t uncapturedCallCount;
+    uint64_t droppedStructureCount;
+} VulkanDynamicCaptureHeader;
+
+typedef struct VulkanDynamicCaptureRecord
+{
+    uint32_t functionId;
+    uint32_t size;
+    uint64_t sequence;
+} VulkanDynamicCaptureRecord;
+
+typedef struct VulkanDynamicReplayStatistics
+{
+    uint64_t callCount;
+    uint64_t skippedCallCount;
+    uint64_t nanoseconds;
+} VulkanDynamicReplayStatistics;
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCaptureDeviceDispatch(const VulkanDynamicDeviceDispatch* next, VulkanDynamicDeviceDispatch* capturedDispatch);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicBeginCapture(const char* fileName);
+
+// Returns VK_INCOMPLETE when the capture does not replay every captured call as issued:
+// pNext structures were dropped (see droppedStructureCount) or the file could not grow.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicEndCapture(void);
+
+// Replays the capture `iterations` times. Records are decoded even where `dispatch` lacks
+// the entry point; such calls and uncaptured calls count as skipped. Returns
+// VK_ERROR_INCOMPATIBLE_DRIVER for captures of another build or architecture and
+// VK_INCOMPLETE if the capture ends in a truncated record.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicReplayCapture(const char* fileName, const VulkanDynamicDeviceDispatch* dispatch, uint32_t iterations, VulkanDynamicReplayStatistics* statistics);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_CAPTURE_H__
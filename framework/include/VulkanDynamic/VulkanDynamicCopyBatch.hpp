@@ -0,0 +1,317 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_COPY_BATCH_HPP__
+#define __VULKANDYNAMIC_COPY_BATCH_HPP__
+
+#include "VulkanDynamicHandles.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace VulkanDynamic
+{
+    namespace Detail
+    {
+        struct PendingBufferCopy
+        {
+            ::VkBuffer srcBuffer;
+            ::VkBuffer dstBuffer;
+            ::VkBufferCopy region;
+
+            // Regions that can merge are consecutive in this order: same buffers, same
+            // distance between source and destination, ascending destination.
+            bool operator<(const PendingBufferCopy& other) const noexcept
+            {
+                if (srcBuffer != other.srcBuffer)
+                {
+                    return ::std::less<::VkBuffer>{}(srcBuffer, other.srcBuffer);
+                }
+
+                if (dstBuffer != other.dstBuffer)
+                {
+                    return ::std::less<::VkBuffer>{}(dstBuffer, other.dstBuffer);
+                }
+
+                const ::VkDeviceSize delta = region.srcOffset - region.dstOffset;
+                const ::VkDeviceSize otherDelta = other.region.srcOffset - other.region.dstOffset;
+                if (delta != otherDelta)
+                {
+                    return delta < otherDelta;
+                }
+
+                return region.dstOffset < other.region.dstOffset;
+            }
+        };
+
+        struct PendingBufferImageCopy
+        {
+            ::VkBuffer srcBuffer;
+            ::VkImage dstImage;
+            ::VkImageLayout dstImageLayout;
+            ::VkBufferImageCopy region;
+
+            bool operator<(const PendingBufferImageCopy& other) const noexcept
+            {
+                if (srcBuffer != other.srcBuffer)
+                {
+                    return ::std::less<::VkBuffer>{}(srcBuffer, other.srcBuffer);
+                }
+
+                if (dstImage != other.dstImage)
+                {
+                    return ::std::less<::VkImage>{}(dstImage, other.dstImage);
+                }
+
+                if (dstImageLayout != other.dstImageLayout)
+                {
+                    return dstImageLayout < other.dstImageLayout;
+                }
+
+                if (region.bufferOffset != other.region.bufferOffset)
+                {
+                    return region.bufferOffset < other.region.bufferOffset;
+                }
+
+                return ::std::memcmp(&region, &other.region, sizeof(region)) < 0;
+            }
+
+            bool SameTarget(const PendingBufferImageCopy& other) const noexcept
+            {
+                return srcBuffer == other.srcBuffer && dstImage == other.dstImage && dstImageLayout == other.dstImageLayout;
+            }
+        };
+    } // namespace Detail
+
+    struct CopyBatchStatistics
+    {
+        ::uint64_t batchedCallCount;
+        ::uint64_t emittedCallCount;
+        ::uint64_t batchedRegionCount;
+        ::uint64_t emittedRegionCount;
+    };
+
+    //------------------------------------------------------------------------------------
+    // Copy Batch
+    //------------------------------------------------------------------------------------
+
+    // Collects the regions of vkCmdCopyBuffer, vkCmdCopyBufferToImage and their
+    // VK_KHR_copy_commands2 variants for one command buffer and emits one call per source
+    // and destination pair at Flush(). Buffer regions are sorted, and regions that overlap
+    // or touch in both buffers with the same source to destination distance merge into one.
+    // Buffer to image regions are sorted and exact duplicates dropped; they are not merged,
+    // as that needs the texel size of the image format.
+    //
+    // Copies between barriers are not ordered with respect to each other, so batching them
+    // does not change what the device may do. Callers must flush before the barriers that
+    // make the copies available; the destructor flushes what is left. Copies within one
+    // buffer and regions with pNext chains are issued unbatched. Batches are emitted through
+    // the core entry points, which the copy_commands2 ones are equivalent to without pNext
+    // chains.
+    class CopyBatch : public Detail::DispatchHandle<::VkCommandBuffer, DeviceDispatch>
+    {
+    public:
+        explicit CopyBatch(::VkCommandBuffer commandBuffer, const DeviceDispatch& deviceDispatch) noexcept
+            : DispatchHandle{ commandBuffer, &deviceDispatch }
+        {
+        }
+
+        CopyBatch(const CopyBatch&) noexcept = delete;
+
+        ~CopyBatch() noexcept
+        {
+            Flush();
+        }
+
+        CopyBatch& operator=(const CopyBatch&) noexcept = delete;
+
+        void CmdCopyBuffer(::VkBuffer srcBuffer, ::VkBuffer dstBuffer, ::uint32_t regionCount, const ::VkBufferCopy* pRegions)
+        {
+            if (srcBuffer == dstBuffer)
+            {
+                dispatch_->CmdCopyBuffer(handle_, srcBuffer, dstBuffer, regionCount, pRegions);
+                ++statistics_.emittedCallCount;
+                return;
+            }
+
+            for (::uint32_t index = 0; index < regionCount; ++index)
+            {
+                bufferCopies_.push_back(Detail::PendingBufferCopy{ srcBuffer, dstBuffer, pRegions[index] });
+            }
+
+            ++statistics_.batchedCallCount;
+            statistics_.batchedRegionCount += regionCount;
+        }
+
+        void CmdCopyBufferToImage(::VkBuffer srcBuffer, ::VkImage dstImage, ::VkImageLayout dstImageLayout, ::uint32_t regionCount, const ::VkBufferImageCopy* pRegions)
+        {
+            for (::uint32_t index = 0; index < regionCount; ++index)
+            {
+                bufferImageCopies_.push_back(Detail::PendingBufferImageCopy{ srcBuffer, dstImage, dstImageLayout, pRegions[index] });
+            }
+
+            ++statistics_.batchedCallCount;
+            statistics_.batchedRegionCount += regionCount;
+        }
+
+#if defined(VK_KHR_copy_commands2)
+        void CmdCopyBuffer2KHR(const ::VkCopyBufferInfo2KHR* pCopyBufferInfo)
+        {
+            const ::VkCopyBufferInfo2KHR& info = *pCopyBufferInfo;
+            if (info.pNext || HasNext(info.regionCount, info.pRegions) || info.srcBuffer == info.dstBuffer)
+            {
+                dispatch_->CmdCopyBuffer2KHR(handle_, pCopyBufferInfo);
+                ++statistics_.emittedCallCount;
+                return;
+            }
+
+            for (::uint32_t index = 0; index < info.regionCount; ++index)
+            {
+                const ::VkBufferCopy2KHR& region = info.pRegions[index];
+                bufferCopies_.push_back(Detail::PendingBufferCopy{ info.srcBuffer, info.dstBuffer, ::VkBufferCopy{ region.srcOffset, region.dstOffset, region.size } });
+            }
+
+            ++statistics_.batchedCallCount;
+            statistics_.batchedRegionCount += info.regionCount;
+        }
+
+        void CmdCopyBufferToImage2KHR(const ::VkCopyBufferToImageInfo2KHR* pCopyBufferToImageInfo)
+        {
+            const ::VkCopyBufferToImageInfo2KHR& info = *pCopyBufferToImageInfo;
+            if (info.pNext || HasNext(info.regionCount, info.pRegions))
+            {
+                dispatch_->CmdCopyBufferToImage2KHR(handle_, pCopyBufferToImageInfo);
+                ++statistics_.emittedCallCount;
+                return;
+            }
+
+            for (::uint32_t index = 0; index < info.regionCount; ++index)
+            {
+                const ::VkBufferImageCopy2KHR& region = info.pRegions[index];
+                bufferImageCopies_.push_back(Detail::PendingBufferImageCopy{ info.srcBuffer, info.dstImage, info.dstImageLayout,
+                    ::VkBufferImageCopy{ region.bufferOffset, region.bufferRowLength, region.bufferImageHeight, region.imageSubresource, region.imageOffset, region.imageExtent } });
+            }
+
+            ++statistics_.batchedCallCount;
+            statistics_.batchedRegionCount += info.regionCount;
+        }
+#endif // VK_KHR_copy_commands2
+
+        void Flush()
+        {
+            FlushBufferCopies();
+            FlushBufferImageCopies();
+        }
+
+        const CopyBatchStatistics& Statistics() const noexcept
+        {
+            return statistics_;
+        }
+
+    private:
+        template<typename Region>
+        static bool HasNext(::uint32_t count, const Region* regions) noexcept
+        {
+            for (::uint32_t index = 0; index < count; ++index)
+            {
+                if (regions[index].pNext)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void FlushBufferCopies()
+        {
+            ::std::sort(bufferCopies_.begin(), bufferCopies_.end());
+
+            for (::size_t begin = 0; begin < bufferCopies_.size();)
+            {
+                const Detail::PendingBufferCopy& first = bufferCopies_[begin];
+
+                bufferRegions_.clear();
+                ::size_t end = begin;
+                for (; end < bufferCopies_.size() && bufferCopies_[end].srcBuffer == first.srcBuffer && bufferCopies_[end].dstBuffer == first.dstBuffer; ++end)
+                {
+                    const ::VkBufferCopy& region = bufferCopies_[end].region;
+                    if (!bufferRegions_.empty())
+                    {
+                        // Sorted by distance then destination: a mergeable region starts
+                        // within or right after the previous one.
+                        ::VkBufferCopy& previous = bufferRegions_.back();
+                        if (previous.srcOffset - previous.dstOffset == region.srcOffset - region.dstOffset && region.dstOffset <= previous.dstOffset + previous.size)
+                        {
+                            const ::VkDeviceSize regionEnd = region.dstOffset + region.size;
+                            previous.size = regionEnd > previous.dstOffset + previous.size ? regionEnd - previous.dstOffset : previous.size;
+                            continue;
+                        }
+                    }
+
+                    bufferRegions_.push_back(region);
+                }
+
+                dispatch_->CmdCopyBuffer(handle_, first.srcBuffer, first.dstBuffer, static_cast<::uint32_t>(bufferRegions_.size()), bufferRegions_.data());
+                ++statistics_.emittedCallCount;
+                statistics_.emittedRegionCount += bufferRegions_.size();
+
+                begin = end;
+            }
+
+            bufferCopies_.clear();
+        }
+
+        void FlushBufferImageCopies()
+        {
+            ::std::sort(bufferImageCopies_.begin(), bufferImageCopies_.end());
+
+            for (::size_t begin = 0; begin < bufferImageCopies_.size();)
+            {
+                const Detail::PendingBufferImageCopy& first = bufferImageCopies_[begin];
+
+                bufferImageRegions_.clear();
+                ::size_t end = begin;
+                for (; end < bufferImageCopies_.size() && bufferImageCopies_[end].SameTarget(first); ++end)
+                {
+                    const ::VkBufferImageCopy& region = bufferImageCopies_[end].region;
+                    if (bufferImageRegions_.empty() || ::std::memcmp(&bufferImageRegions_.back(), &region, sizeof(region)) != 0)
+                    {
+                        bufferImageRegions_.push_back(region);
+                    }
+                }
+
+                dispatch_->CmdCopyBufferToImage(handle_, first.srcBuffer, first.dstImage, first.dstImageLayout, static_cast<::uint32_t>(bufferImageRegions_.size()), bufferImageRegions_.data());
+                ++statistics_.emittedCallCount;
+                statistics_.emittedRegionCount += bufferImageRegions_.size();
+
+                begin = end;
+            }
+
+            bufferImageCopies_.clear();
+        }
+
+    private:
+        ::std::vector<Detail::PendingBufferCopy> bufferCopies_;
+        ::std::vector<Detail::PendingBufferImageCopy> bufferImageCopies_;
+        ::std::vector<::VkBufferCopy> bufferRegions_;
+        ::std::vector<::VkBufferImageCopy> bufferImageRegions_;
+        CopyBatchStatistics statistics_{};
+    };
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_COPY_BATCH_HPP__
@@ -0,0 +1,67 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_DEFERRED_H__
+#define __VULKANDYNAMIC_DEFERRED_H__
+
+// Deferred command recording. VulkanDynamicGetDeferredCommandBufferDispatch fills a
+// command buffer table whose entry points encode their arguments into a command arena
+// instead of calling the driver; pass the arena, cast to VkCommandBuffer, as their
+// command buffer. Encoding makes no Vulkan calls and takes no locks, so an arena must only
+// be used by one thread at a time: workers each record into their own arenas, and one
+// thread later replays every arena into a real command buffer.
+//
+// Arguments are copied deeply like captured calls (see VulkanDynamicCapture.h), so the
+// caller's structures and arrays may be reused as soon as an entry point returns. Entry
+// points whose arguments cannot be copied, and the few commands that return a VkResult,
+// are left NULL in the deferred table.
+
+#include "VulkanDynamic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VK_DEFINE_HANDLE(VulkanDynamicCommandArena);
+
+typedef struct VulkanDynamicCommandArenaStatistics
+{
+    uint64_t commandCount;
+    uint64_t size;
+    uint64_t droppedStructureCount;
+} VulkanDynamicCommandArenaStatistics;
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateCommandArena(VulkanDynamicCommandArena* arena);
+
+// Discards the recorded commands and keeps the arena's memory for the next recording.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicResetCommandArena(VulkanDynamicCommandArena arena);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyCommandArena(VulkanDynamicCommandArena arena);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetCommandArenaStatistics(VulkanDynamicCommandArena arena, VulkanDynamicCommandArenaStatistics* statistics);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetDeferredCommandBufferDispatch(VulkanDynamicCommandBufferDispatch* deferredDispatch);
+
+// Issues the recorded commands, in order, to `commandBuffer` through `dispatch`. The arena
+// is left intact and may be replayed again. Returns VK_ERROR_EXTENSION_NOT_PRESENT, after
+// replaying the commands before it, at the first command `dispatch` has no entry point for,
+// and VK_ERROR_INITIALIZATION_FAILED, without calling the driver for it, at the first
+// command whose arguments do not decode.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicReplayCommandArena(VulkanDynamicCommandArena arena, const VulkanDynamicCommandBufferDispatch* dispatch, VkCommandBuffer commandBuffer);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_DEFERRED_H__
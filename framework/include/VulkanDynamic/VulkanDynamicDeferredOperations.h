@@ -0,0 +1,73 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_DEFERRED_OPERATIONS_H__
+#define __VULKANDYNAMIC_DEFERRED_OPERATIONS_H__
+
+// Deferred host operation scheduling for VK_KHR_deferred_host_operations. Commands such as
+// vkCreateRayTracingPipelinesKHR, vkBuildAccelerationStructuresKHR and the host
+// acceleration structure copies return VK_OPERATION_DEFERRED_KHR when given a deferred
+// operation; VulkanDynamicScheduleDeferredOperation then has a pool of threads join it,
+// up to vkGetDeferredOperationMaxConcurrencyKHR threads at a time, and calls the callback
+// with the operation's result once no thread is joined to it any more. A join that fails
+// completes the operation too, and the callback receives the join's error when the
+// operation reports no result of its own.
+//
+// Each thread keeps its own queue of operations to join and takes from the others' when
+// it runs out. A thread joined to an operation offers it to another thread before joining
+// while the operation allows more concurrency, so operations spread over the pool instead
+// of occupying one thread each. Operations that report VK_THREAD_IDLE_KHR are joined
+// again after the thread's other operations, and a thread with nothing else to join backs
+// off for increasing intervals, up to about a millisecond.
+
+#include "VulkanDynamic.h"
+
+#if defined(VK_KHR_deferred_host_operations)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VK_DEFINE_HANDLE(VulkanDynamicDeferredOperationScheduler);
+
+// Called on a scheduler thread with vkGetDeferredOperationResultKHR's result. The
+// operation is no longer used by the scheduler and may be destroyed in the callback.
+typedef void (VKAPI_PTR* PFN_VulkanDynamicDeferredOperationCallback)(void* userData, VkDeferredOperationKHR operation, VkResult result);
+
+typedef struct VulkanDynamicDeferredOperationSchedulerStatistics
+{
+    uint64_t completedCount;
+    uint64_t joinCount;
+    uint64_t stealCount;
+} VulkanDynamicDeferredOperationSchedulerStatistics;
+
+// `threadCount` 0 starts a thread per hardware thread. `dispatch` must stay valid until
+// the scheduler is destroyed.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateDeferredOperationScheduler(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, uint32_t threadCount, VulkanDynamicDeferredOperationScheduler* scheduler);
+
+// Waits for the scheduled operations to complete, then stops the threads.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyDeferredOperationScheduler(VulkanDynamicDeferredOperationScheduler scheduler);
+
+// `operation` must have been passed to a command that returned VK_OPERATION_DEFERRED_KHR.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicScheduleDeferredOperation(VulkanDynamicDeferredOperationScheduler scheduler, VkDeferredOperationKHR operation, PFN_VulkanDynamicDeferredOperationCallback callback, void* userData);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetDeferredOperationSchedulerStatistics(VulkanDynamicDeferredOperationScheduler scheduler, VulkanDynamicDeferredOperationSchedulerStatistics* statistics);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // VK_KHR_deferred_host_operations
+
+#endif // __VULKANDYNAMIC_DEFERRED_OPERATIONS_H__
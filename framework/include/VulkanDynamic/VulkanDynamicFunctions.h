@@ -0,0 +1,2118 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_FUNCTIONS_H__
+#define __VULKANDYNAMIC_FUNCTIONS_H__
+
+// X-macro lists of the entry points held by each dispatch table, in table order.
+// VULKANDYNAMIC_<TIER>_FUNCTIONS_<BLOCK>(function) expands `function(Name)` for every
+// entry point of a core version or extension block, and expands to nothing when the
+// extension is not known to the Vulkan headers. VULKANDYNAMIC_<TIER>_FUNCTIONS(function)
+// expands all blocks of a tier.
+
+#include "VulkanDynamic.h"
+
+//---------------------------------------------------------------------------------------
+// Loader
+//---------------------------------------------------------------------------------------
+
+// Vulkan Core 1.0
+#define VULKANDYNAMIC_LOADER_FUNCTIONS_VERSION_1_0(function) \
+    function(GetInstanceProcAddr) \
+    function(CreateInstance) \
+    function(EnumerateInstanceExtensionProperties) \
+    function(EnumerateInstanceLayerProperties)
+
+// Vulkan Core 1.1
+#define VULKANDYNAMIC_LOADER_FUNCTIONS_VERSION_1_1(function) \
+    function(EnumerateInstanceVersion)
+
+#define VULKANDYNAMIC_LOADER_FUNCTIONS(function) \
+    VULKANDYNAMIC_LOADER_FUNCTIONS_VERSION_1_0(function) \
+    VULKANDYNAMIC_LOADER_FUNCTIONS_VERSION_1_1(function)
+
+//---------------------------------------------------------------------------------------
+// Instance
+//---------------------------------------------------------------------------------------
+
+// Vulkan Core 1.0
+#define VULKANDYNAMIC_INSTANCE_FUNCTIONS_VERSION_1_0(function) \
+    function(GetInstanceProcAddr) \
+    function(GetDeviceProcAddr) \
+    function(DestroyInstance) \
+    function(EnumeratePhysicalDevices) \
+    function(GetPhysicalDeviceFeatures) \
+    function(GetPhysicalDeviceFormatProperties) \
+    function(GetPhysicalDeviceImageFormatProperties) \
+    function(GetPhysicalDeviceProperties) \
+    function(GetPhysicalDeviceQueueFamilyProperties) \
+    function(GetPhysicalDeviceMemoryProperties) \
+    function(CreateDevice) \
+    function(EnumerateDeviceExtensionProperties) \
+    function(EnumerateDeviceLayerProperties) \
+    function(GetPhysicalDeviceSparseImageFormatProperties)
+
+// Vulkan Core 1.1
+#define VULKANDYNAMIC_INSTANCE_FUNCTIONS_VERSION_1_1(function) \
+    function(EnumeratePhysicalDeviceGroups) \
+    function(GetPhysicalDeviceFeatures2) \
+    function(GetPhysicalDeviceProperties2) \
+    function(GetPhysicalDeviceFormatProperties2) \
+    function(GetPhysicalDeviceImageFormatProperties2) \
+    function(GetPhysicalDeviceQueueFamilyProperties2) \
+    function(GetPhysicalDeviceMemoryProperties2) \
+    function(GetPhysicalDeviceSparseImageFormatProperties2) \
+    function(GetPhysicalDeviceExternalBufferProperties) \
+    function(GetPhysicalDeviceExternalFenceProperties) \
+    function(GetPhysicalDeviceExternalSemaphoreProperties)
+
+#if defined(VK_KHR_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_surface(function) \
+        function(DestroySurfaceKHR) \
+        function(GetPhysicalDeviceSurfaceSupportKHR) \
+        function(GetPhysicalDeviceSurfaceCapabilitiesKHR) \
+        function(GetPhysicalDeviceSurfaceFormatsKHR) \
+        function(GetPhysicalDeviceSurfacePresentModesKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_surface(function)
+#endif // VK_KHR_surface
+
+#if defined(VK_KHR_display)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_display(function) \
+        function(GetPhysicalDeviceDisplayPropertiesKHR) \
+        function(GetPhysicalDeviceDisplayPlanePropertiesKHR) \
+        function(GetDisplayPlaneSupportedDisplaysKHR) \
+        function(GetDisplayModePropertiesKHR) \
+        function(CreateDisplayModeKHR) \
+        function(GetDisplayPlaneCapabilitiesKHR) \
+        function(CreateDisplayPlaneSurfaceKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_display(function)
+#endif // VK_KHR_display
+
+#if defined(VK_KHR_xlib_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_xlib_surface(function) \
+        function(CreateXlibSurfaceKHR) \
+        function(GetPhysicalDeviceXlibPresentationSupportKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_xlib_surface(function)
+#endif // VK_KHR_xlib_surface
+
+#if defined(VK_KHR_xcb_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_xcb_surface(function) \
+        function(CreateXcbSurfaceKHR) \
+        function(GetPhysicalDeviceXcbPresentationSupportKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_xcb_surface(function)
+#endif // VK_KHR_xcb_surface
+
+#if defined(VK_KHR_wayland_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_wayland_surface(function) \
+        function(CreateWaylandSurfaceKHR) \
+        function(GetPhysicalDeviceWaylandPresentationSupportKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_wayland_surface(function)
+#endif // VK_KHR_wayland_surface
+
+#if defined(VK_KHR_android_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_android_surface(function) \
+        function(CreateAndroidSurfaceKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_android_surface(function)
+#endif // VK_KHR_android_surface
+
+#if defined(VK_KHR_win32_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_win32_surface(function) \
+        function(CreateWin32SurfaceKHR) \
+        function(GetPhysicalDeviceWin32PresentationSupportKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_win32_surface(function)
+#endif // VK_KHR_win32_surface
+
+#if defined(VK_EXT_debug_report)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_debug_report(function) \
+        function(CreateDebugReportCallbackEXT) \
+        function(DestroyDebugReportCallbackEXT) \
+        function(DebugReportMessageEXT)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_debug_report(function)
+#endif // VK_EXT_debug_report
+
+#if defined(VK_GGP_stream_descriptor_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_GGP_stream_descriptor_surface(function) \
+        function(CreateStreamDescriptorSurfaceGGP)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_GGP_stream_descriptor_surface(function)
+#endif // VK_GGP_stream_descriptor_surface
+
+#if defined(VK_NV_external_memory_capabilities)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_NV_external_memory_capabilities(function) \
+        function(GetPhysicalDeviceExternalImageFormatPropertiesNV)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_NV_external_memory_capabilities(function)
+#endif // VK_NV_external_memory_capabilities
+
+#if defined(VK_KHR_get_physical_device_properties2)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_get_physical_device_properties2(function) \
+        function(GetPhysicalDeviceFeatures2KHR) \
+        function(GetPhysicalDeviceProperties2KHR) \
+        function(GetPhysicalDeviceFormatProperties2KHR) \
+        function(GetPhysicalDeviceImageFormatProperties2KHR) \
+        function(GetPhysicalDeviceQueueFamilyProperties2KHR) \
+        function(GetPhysicalDeviceMemoryProperties2KHR) \
+        function(GetPhysicalDeviceSparseImageFormatProperties2KHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_get_physical_device_properties2(function)
+#endif // VK_KHR_get_physical_device_properties2
+
+#if defined(VK_NN_vi_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_NN_vi_surface(function) \
+        function(CreateViSurfaceNN)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_NN_vi_surface(function)
+#endif // VK_NN_vi_surface
+
+#if defined(VK_KHR_device_group_creation)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_device_group_creation(function) \
+        function(EnumeratePhysicalDeviceGroupsKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_device_group_creation(function)
+#endif // VK_KHR_device_group_creation
+
+#if defined(VK_KHR_external_memory_capabilities)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_external_memory_capabilities(function) \
+        function(GetPhysicalDeviceExternalBufferPropertiesKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_external_memory_capabilities(function)
+#endif // VK_KHR_external_memory_capabilities
+
+#if defined(VK_KHR_external_semaphore_capabilities)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_external_semaphore_capabilities(function) \
+        function(GetPhysicalDeviceExternalSemaphorePropertiesKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_external_semaphore_capabilities(function)
+#endif // VK_KHR_external_semaphore_capabilities
+
+#if defined(VK_EXT_direct_mode_display)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_direct_mode_display(function) \
+        function(ReleaseDisplayEXT)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_direct_mode_display(function)
+#endif // VK_EXT_direct_mode_display
+
+#if defined(VK_EXT_acquire_xlib_display)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_acquire_xlib_display(function) \
+        function(AcquireXlibDisplayEXT) \
+        function(GetRandROutputDisplayEXT)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_acquire_xlib_display(function)
+#endif // VK_EXT_acquire_xlib_display
+
+#if defined(VK_EXT_display_surface_counter)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_display_surface_counter(function) \
+        function(GetPhysicalDeviceSurfaceCapabilities2EXT)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_display_surface_counter(function)
+#endif // VK_EXT_display_surface_counter
+
+#if defined(VK_KHR_external_fence_capabilities)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_external_fence_capabilities(function) \
+        function(GetPhysicalDeviceExternalFencePropertiesKHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_external_fence_capabilities(function)
+#endif // VK_KHR_external_fence_capabilities
+
+#if defined(VK_KHR_get_surface_capabilities2)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_get_surface_capabilities2(function) \
+        function(GetPhysicalDeviceSurfaceCapabilities2KHR) \
+        function(GetPhysicalDeviceSurfaceFormats2KHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_get_surface_capabilities2(function)
+#endif // VK_KHR_get_surface_capabilities2
+
+#if defined(VK_KHR_get_display_properties2)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_get_display_properties2(function) \
+        function(GetPhysicalDeviceDisplayProperties2KHR) \
+        function(GetPhysicalDeviceDisplayPlaneProperties2KHR) \
+        function(GetDisplayModeProperties2KHR) \
+        function(GetDisplayPlaneCapabilities2KHR)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_get_display_properties2(function)
+#endif // VK_KHR_get_display_properties2
+
+#if defined(VK_MVK_ios_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_MVK_ios_surface(function) \
+        function(CreateIOSSurfaceMVK)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_MVK_ios_surface(function)
+#endif // VK_MVK_ios_surface
+
+#if defined(VK_MVK_macos_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_MVK_macos_surface(function) \
+        function(CreateMacOSSurfaceMVK)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_MVK_macos_surface(function)
+#endif // VK_MVK_macos_surface
+
+#if defined(VK_EXT_debug_utils)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_debug_utils(function) \
+        function(SetDebugUtilsObjectNameEXT) \
+        function(SetDebugUtilsObjectTagEXT) \
+        function(QueueBeginDebugUtilsLabelEXT) \
+        function(QueueEndDebugUtilsLabelEXT) \
+        function(QueueInsertDebugUtilsLabelEXT) \
+        function(CmdBeginDebugUtilsLabelEXT) \
+        function(CmdEndDebugUtilsLabelEXT) \
+        function(CmdInsertDebugUtilsLabelEXT) \
+        function(CreateDebugUtilsMessengerEXT) \
+        function(DestroyDebugUtilsMessengerEXT) \
+        function(SubmitDebugUtilsMessageEXT)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_debug_utils(function)
+#endif // VK_EXT_debug_utils
+
+#if defined(VK_FUCHSIA_imagepipe_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_FUCHSIA_imagepipe_surface(function) \
+        function(CreateImagePipeSurfaceFUCHSIA)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_FUCHSIA_imagepipe_surface(function)
+#endif // VK_FUCHSIA_imagepipe_surface
+
+#if defined(VK_EXT_metal_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_metal_surface(function) \
+        function(CreateMetalSurfaceEXT)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_metal_surface(function)
+#endif // VK_EXT_metal_surface
+
+#if defined(VK_EXT_headless_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_headless_surface(function) \
+        function(CreateHeadlessSurfaceEXT)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_headless_surface(function)
+#endif // VK_EXT_headless_surface
+
+#if defined(VK_EXT_acquire_drm_display)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_acquire_drm_display(function) \
+        function(AcquireDrmDisplayEXT) \
+        function(GetDrmDisplayEXT)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_acquire_drm_display(function)
+#endif // VK_EXT_acquire_drm_display
+
+#if defined(VK_EXT_directfb_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_directfb_surface(function) \
+        function(CreateDirectFBSurfaceEXT) \
+        function(GetPhysicalDeviceDirectFBPresentationSupportEXT)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_directfb_surface(function)
+#endif // VK_EXT_directfb_surface
+
+#if defined(VK_QNX_screen_surface)
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_QNX_screen_surface(function) \
+        function(CreateScreenSurfaceQNX) \
+        function(GetPhysicalDeviceScreenPresentationSupportQNX)
+#else
+    #define VULKANDYNAMIC_INSTANCE_FUNCTIONS_QNX_screen_surface(function)
+#endif // VK_QNX_screen_surface
+
+#define VULKANDYNAMIC_INSTANCE_FUNCTIONS(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_VERSION_1_0(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_VERSION_1_1(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_display(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_xlib_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_xcb_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_wayland_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_android_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_win32_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_debug_report(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_GGP_stream_descriptor_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_NV_external_memory_capabilities(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_get_physical_device_properties2(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_NN_vi_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_device_group_creation(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_external_memory_capabilities(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_external_semaphore_capabilities(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_direct_mode_display(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_acquire_xlib_display(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_display_surface_counter(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_external_fence_capabilities(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_get_surface_capabilities2(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_KHR_get_display_properties2(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_MVK_ios_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_MVK_macos_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_debug_utils(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_FUCHSIA_imagepipe_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_metal_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_headless_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_acquire_drm_display(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_EXT_directfb_surface(function) \
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS_QNX_screen_surface(function)
+
+//---------------------------------------------------------------------------------------
+// Physical Device
+//---------------------------------------------------------------------------------------
+
+// Vulkan Core 1.0
+#define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_VERSION_1_0(function) \
+    function(GetPhysicalDeviceFeatures) \
+    function(GetPhysicalDeviceFormatProperties) \
+    function(GetPhysicalDeviceImageFormatProperties) \
+    function(GetPhysicalDeviceProperties) \
+    function(GetPhysicalDeviceQueueFamilyProperties) \
+    function(GetPhysicalDeviceMemoryProperties) \
+    function(CreateDevice) \
+    function(EnumerateDeviceExtensionProperties) \
+    function(EnumerateDeviceLayerProperties) \
+    function(GetPhysicalDeviceSparseImageFormatProperties)
+
+// Vulkan Core 1.1
+#define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_VERSION_1_1(function) \
+    function(GetPhysicalDeviceFeatures2) \
+    function(GetPhysicalDeviceProperties2) \
+    function(GetPhysicalDeviceFormatProperties2) \
+    function(GetPhysicalDeviceImageFormatProperties2) \
+    function(GetPhysicalDeviceQueueFamilyProperties2) \
+    function(GetPhysicalDeviceMemoryProperties2) \
+    function(GetPhysicalDeviceSparseImageFormatProperties2) \
+    function(GetPhysicalDeviceExternalBufferProperties) \
+    function(GetPhysicalDeviceExternalFenceProperties) \
+    function(GetPhysicalDeviceExternalSemaphoreProperties)
+
+#if defined(VK_KHR_surface)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_surface(function) \
+        function(GetPhysicalDeviceSurfaceSupportKHR) \
+        function(GetPhysicalDeviceSurfaceCapabilitiesKHR) \
+        function(GetPhysicalDeviceSurfaceFormatsKHR) \
+        function(GetPhysicalDeviceSurfacePresentModesKHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_surface(function)
+#endif // VK_KHR_surface
+
+#if defined(VK_KHR_display)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_display(function) \
+        function(GetPhysicalDeviceDisplayPropertiesKHR) \
+        function(GetPhysicalDeviceDisplayPlanePropertiesKHR) \
+        function(GetDisplayPlaneSupportedDisplaysKHR) \
+        function(GetDisplayModePropertiesKHR) \
+        function(CreateDisplayModeKHR) \
+        function(GetDisplayPlaneCapabilitiesKHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_display(function)
+#endif // VK_KHR_display
+
+#if defined(VK_KHR_xlib_surface)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_xlib_surface(function) \
+        function(GetPhysicalDeviceXlibPresentationSupportKHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_xlib_surface(function)
+#endif // VK_KHR_xlib_surface
+
+#if defined(VK_KHR_xcb_surface)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_xcb_surface(function) \
+        function(GetPhysicalDeviceXcbPresentationSupportKHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_xcb_surface(function)
+#endif // VK_KHR_xcb_surface
+
+#if defined(VK_KHR_wayland_surface)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_wayland_surface(function) \
+        function(GetPhysicalDeviceWaylandPresentationSupportKHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_wayland_surface(function)
+#endif // VK_KHR_wayland_surface
+
+#if defined(VK_KHR_win32_surface)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_win32_surface(function) \
+        function(GetPhysicalDeviceWin32PresentationSupportKHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_win32_surface(function)
+#endif // VK_KHR_win32_surface
+
+#if defined(VK_NV_external_memory_capabilities)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_NV_external_memory_capabilities(function) \
+        function(GetPhysicalDeviceExternalImageFormatPropertiesNV)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_NV_external_memory_capabilities(function)
+#endif // VK_NV_external_memory_capabilities
+
+#if defined(VK_KHR_get_physical_device_properties2)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_get_physical_device_properties2(function) \
+        function(GetPhysicalDeviceFeatures2KHR) \
+        function(GetPhysicalDeviceProperties2KHR) \
+        function(GetPhysicalDeviceFormatProperties2KHR) \
+        function(GetPhysicalDeviceImageFormatProperties2KHR) \
+        function(GetPhysicalDeviceQueueFamilyProperties2KHR) \
+        function(GetPhysicalDeviceMemoryProperties2KHR) \
+        function(GetPhysicalDeviceSparseImageFormatProperties2KHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_get_physical_device_properties2(function)
+#endif // VK_KHR_get_physical_device_properties2
+
+#if defined(VK_KHR_external_memory_capabilities)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_external_memory_capabilities(function) \
+        function(GetPhysicalDeviceExternalBufferPropertiesKHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_external_memory_capabilities(function)
+#endif // VK_KHR_external_memory_capabilities
+
+#if defined(VK_KHR_external_semaphore_capabilities)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_external_semaphore_capabilities(function) \
+        function(GetPhysicalDeviceExternalSemaphorePropertiesKHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_external_semaphore_capabilities(function)
+#endif // VK_KHR_external_semaphore_capabilities
+
+#if defined(VK_EXT_direct_mode_display)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_direct_mode_display(function) \
+        function(ReleaseDisplayEXT)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_direct_mode_display(function)
+#endif // VK_EXT_direct_mode_display
+
+#if defined(VK_EXT_acquire_xlib_display)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_acquire_xlib_display(function) \
+        function(AcquireXlibDisplayEXT) \
+        function(GetRandROutputDisplayEXT)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_acquire_xlib_display(function)
+#endif // VK_EXT_acquire_xlib_display
+
+#if defined(VK_EXT_display_surface_counter)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_display_surface_counter(function) \
+        function(GetPhysicalDeviceSurfaceCapabilities2EXT)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_display_surface_counter(function)
+#endif // VK_EXT_display_surface_counter
+
+#if defined(VK_KHR_external_fence_capabilities)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_external_fence_capabilities(function) \
+        function(GetPhysicalDeviceExternalFencePropertiesKHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_external_fence_capabilities(function)
+#endif // VK_KHR_external_fence_capabilities
+
+#if defined(VK_KHR_get_surface_capabilities2)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_get_surface_capabilities2(function) \
+        function(GetPhysicalDeviceSurfaceCapabilities2KHR) \
+        function(GetPhysicalDeviceSurfaceFormats2KHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_get_surface_capabilities2(function)
+#endif // VK_KHR_get_surface_capabilities2
+
+#if defined(VK_KHR_get_display_properties2)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_get_display_properties2(function) \
+        function(GetPhysicalDeviceDisplayProperties2KHR) \
+        function(GetPhysicalDeviceDisplayPlaneProperties2KHR) \
+        function(GetDisplayModeProperties2KHR) \
+        function(GetDisplayPlaneCapabilities2KHR)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_get_display_properties2(function)
+#endif // VK_KHR_get_display_properties2
+
+#if defined(VK_EXT_acquire_drm_display)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_acquire_drm_display(function) \
+        function(AcquireDrmDisplayEXT) \
+        function(GetDrmDisplayEXT)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_acquire_drm_display(function)
+#endif // VK_EXT_acquire_drm_display
+
+#if defined(VK_EXT_directfb_surface)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_directfb_surface(function) \
+        function(GetPhysicalDeviceDirectFBPresentationSupportEXT)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_directfb_surface(function)
+#endif // VK_EXT_directfb_surface
+
+#if defined(VK_QNX_screen_surface)
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_QNX_screen_surface(function) \
+        function(GetPhysicalDeviceScreenPresentationSupportQNX)
+#else
+    #define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_QNX_screen_surface(function)
+#endif // VK_QNX_screen_surface
+
+#define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_VERSION_1_0(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_VERSION_1_1(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_surface(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_display(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_xlib_surface(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_xcb_surface(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_wayland_surface(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_win32_surface(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_NV_external_memory_capabilities(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_get_physical_device_properties2(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_external_memory_capabilities(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_external_semaphore_capabilities(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_direct_mode_display(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_acquire_xlib_display(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_display_surface_counter(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_external_fence_capabilities(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_get_surface_capabilities2(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_KHR_get_display_properties2(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_acquire_drm_display(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_EXT_directfb_surface(function) \
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS_QNX_screen_surface(function)
+
+//---------------------------------------------------------------------------------------
+// Device
+//---------------------------------------------------------------------------------------
+
+// Vulkan Core 1.0
+#define VULKANDYNAMIC_DEVICE_FUNCTIONS_VERSION_1_0(function) \
+    function(GetDeviceProcAddr) \
+    function(DestroyDevice) \
+    function(GetDeviceQueue) \
+    function(QueueSubmit) \
+    function(QueueWaitIdle) \
+    function(DeviceWaitIdle) \
+    function(AllocateMemory) \
+    function(FreeMemory) \
+    function(MapMemory) \
+    function(UnmapMemory) \
+    function(FlushMappedMemoryRanges) \
+    function(InvalidateMappedMemoryRanges) \
+    function(GetDeviceMemoryCommitment) \
+    function(BindBufferMemory) \
+    function(BindImageMemory) \
+    function(GetBufferMemoryRequirements) \
+    function(GetImageMemoryRequirements) \
+    function(GetImageSparseMemoryRequirements) \
+    function(QueueBindSparse) \
+    function(CreateFence) \
+    function(DestroyFence) \
+    function(ResetFences) \
+    function(GetFenceStatus) \
+    function(WaitForFences) \
+    function(CreateSemaphore) \
+    function(DestroySemaphore) \
+    function(CreateEvent) \
+    function(DestroyEvent) \
+    function(GetEventStatus) \
+    function(SetEvent) \
+    function(ResetEvent) \
+    function(CreateQueryPool) \
+    function(DestroyQueryPool) \
+    function(GetQueryPoolResults) \
+    function(CreateBuffer) \
+    function(DestroyBuffer) \
+    function(CreateBufferView) \
+    function(DestroyBufferView) \
+    function(CreateImage) \
+    function(DestroyImage) \
+    function(GetImageSubresourceLayout) \
+    function(CreateImageView) \
+    function(DestroyImageView) \
+    function(CreateShaderModule) \
+    function(DestroyShaderModule) \
+    function(CreatePipelineCache) \
+    function(DestroyPipelineCache) \
+    function(GetPipelineCacheData) \
+    function(MergePipelineCaches) \
+    function(CreateGraphicsPipelines) \
+    function(CreateComputePipelines) \
+    function(DestroyPipeline) \
+    function(CreatePipelineLayout) \
+    function(DestroyPipelineLayout) \
+    function(CreateSampler) \
+    function(DestroySampler) \
+    function(CreateDescriptorSetLayout) \
+    function(DestroyDescriptorSetLayout) \
+    function(CreateDescriptorPool) \
+    function(DestroyDescriptorPool) \
+    function(ResetDescriptorPool) \
+    function(AllocateDescriptorSets) \
+    function(FreeDescriptorSets) \
+    function(UpdateDescriptorSets) \
+    function(CreateFramebuffer) \
+    function(DestroyFramebuffer) \
+    function(CreateRenderPass) \
+    function(DestroyRenderPass) \
+    function(GetRenderAreaGranularity) \
+    function(CreateCommandPool) \
+    function(DestroyCommandPool) \
+    function(ResetCommandPool) \
+    function(AllocateCommandBuffers) \
+    function(FreeCommandBuffers) \
+    function(BeginCommandBuffer) \
+    function(EndCommandBuffer) \
+    function(ResetCommandBuffer) \
+    function(CmdBindPipeline) \
+    function(CmdSetViewport) \
+    function(CmdSetScissor) \
+    function(CmdSetLineWidth) \
+    function(CmdSetDepthBias) \
+    function(CmdSetBlendConstants) \
+    function(CmdSetDepthBounds) \
+    function(CmdSetStencilCompareMask) \
+    function(CmdSetStencilWriteMask) \
+    function(CmdSetStencilReference) \
+    function(CmdBindDescriptorSets) \
+    function(CmdBindIndexBuffer) \
+    function(CmdBindVertexBuffers) \
+    function(CmdDraw) \
+    function(CmdDrawIndexed) \
+    function(CmdDrawIndirect) \
+    function(CmdDrawIndexedIndirect) \
+    function(CmdDispatch) \
+    function(CmdDispatchIndirect) \
+    function(CmdCopyBuffer) \
+    function(CmdCopyImage) \
+    function(CmdBlitImage) \
+    function(CmdCopyBufferToImage) \
+    function(CmdCopyImageToBuffer) \
+    function(CmdUpdateBuffer) \
+    function(CmdFillBuffer) \
+    function(CmdClearColorImage) \
+    function(CmdClearDepthStencilImage) \
+    function(CmdClearAttachments) \
+    function(CmdResolveImage) \
+    function(CmdSetEvent) \
+    function(CmdResetEvent) \
+    function(CmdWaitEvents) \
+    function(CmdPipelineBarrier) \
+    function(CmdBeginQuery) \
+    function(CmdEndQuery) \
+    function(CmdResetQueryPool) \
+    function(CmdWriteTimestamp) \
+    function(CmdCopyQueryPoolResults) \
+    function(CmdPushConstants) \
+    function(CmdBeginRenderPass) \
+    function(CmdNextSubpass) \
+    function(CmdEndRenderPass) \
+    function(CmdExecuteCommands)
+
+// Vulkan Core 1.1
+#define VULKANDYNAMIC_DEVICE_FUNCTIONS_VERSION_1_1(function) \
+    function(BindBufferMemory2) \
+    function(BindImageMemory2) \
+    function(GetDeviceGroupPeerMemoryFeatures) \
+    function(CmdSetDeviceMask) \
+    function(CmdDispatchBase) \
+    function(GetImageMemoryRequirements2) \
+    function(GetBufferMemoryRequirements2) \
+    function(GetImageSparseMemoryRequirements2) \
+    function(TrimCommandPool) \
+    function(GetDeviceQueue2) \
+    function(CreateSamplerYcbcrConversion) \
+    function(DestroySamplerYcbcrConversion) \
+    function(CreateDescriptorUpdateTemplate) \
+    function(DestroyDescriptorUpdateTemplate) \
+    function(UpdateDescriptorSetWithTemplate) \
+    function(GetDescriptorSetLayoutSupport)
+
+// Vulkan Core 1.2
+#define VULKANDYNAMIC_DEVICE_FUNCTIONS_VERSION_1_2(function) \
+    function(CmdDrawIndirectCount) \
+    function(CmdDrawIndexedIndirectCount) \
+    function(CreateRenderPass2) \
+    function(CmdBeginRenderPass2) \
+    function(CmdNextSubpass2) \
+    function(CmdEndRenderPass2) \
+    function(ResetQueryPool) \
+    function(GetSemaphoreCounterValue) \
+    function(WaitSemaphores) \
+    function(SignalSemaphore) \
+    function(GetBufferDeviceAddress) \
+    function(GetBufferOpaqueCaptureAddress) \
+    function(GetDeviceMemoryOpaqueCaptureAddress)
+
+#if defined(VK_KHR_swapchain)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_swapchain(function) \
+        function(CreateSwapchainKHR) \
+        function(DestroySwapchainKHR) \
+        function(QueuePresentKHR) \
+        function(AcquireNextImageKHR) \
+        function(GetSwapchainImagesKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_swapchain(function)
+#endif // VK_KHR_swapchain
+
+#if defined(VK_KHR_display_swapchain)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_display_swapchain(function) \
+        function(CreateSharedSwapchainsKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_display_swapchain(function)
+#endif // VK_KHR_display_swapchain
+
+#if defined(VK_EXT_debug_marker)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_debug_marker(function) \
+        function(DebugMarkerSetObjectTagEXT) \
+        function(DebugMarkerSetObjectNameEXT) \
+        function(CmdDebugMarkerBeginEXT) \
+        function(CmdDebugMarkerEndEXT) \
+        function(CmdDebugMarkerInsertEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_debug_marker(function)
+#endif // VK_EXT_debug_marker
+
+#if defined(VK_KHR_video_queue)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_video_queue(function) \
+        function(GetPhysicalDeviceVideoCapabilitiesKHR) \
+        function(UpdateVideoSessionParametersKHR) \
+        function(GetPhysicalDeviceVideoFormatPropertiesKHR) \
+        function(CreateVideoSessionParametersKHR) \
+        function(CreateVideoSessionKHR) \
+        function(BindVideoSessionMemoryKHR) \
+        function(DestroyVideoSessionKHR) \
+        function(GetVideoSessionMemoryRequirementsKHR) \
+        function(DestroyVideoSessionParametersKHR) \
+        function(CmdBeginVideoCodingKHR) \
+        function(CmdEndVideoCodingKHR) \
+        function(CmdControlVideoCodingKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_video_queue(function)
+#endif // VK_KHR_video_queue
+
+#if defined(VK_KHR_video_decode_queue)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_video_decode_queue(function) \
+        function(CmdDecodeVideoKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_video_decode_queue(function)
+#endif // VK_KHR_video_decode_queue
+
+#if defined(VK_EXT_transform_feedback)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_transform_feedback(function) \
+        function(CmdDrawIndirectByteCountEXT) \
+        function(CmdBindTransformFeedbackBuffersEXT) \
+        function(CmdEndTransformFeedbackEXT) \
+        function(CmdBeginTransformFeedbackEXT) \
+        function(CmdEndQueryIndexedEXT) \
+        function(CmdBeginQueryIndexedEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_transform_feedback(function)
+#endif // VK_EXT_transform_feedback
+
+#if defined(VK_NVX_binary_import)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NVX_binary_import(function) \
+        function(CreateCuFunctionNVX) \
+        function(CreateCuModuleNVX) \
+        function(CmdCuLaunchKernelNVX) \
+        function(DestroyCuFunctionNVX) \
+        function(DestroyCuModuleNVX)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NVX_binary_import(function)
+#endif // VK_NVX_binary_import
+
+#if defined(VK_NVX_image_view_handle)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NVX_image_view_handle(function) \
+        function(GetImageViewHandleNVX) \
+        function(GetImageViewAddressNVX)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NVX_image_view_handle(function)
+#endif // VK_NVX_image_view_handle
+
+#if defined(VK_AMD_draw_indirect_count)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_draw_indirect_count(function) \
+        function(CmdDrawIndirectCountAMD) \
+        function(CmdDrawIndexedIndirectCountAMD)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_draw_indirect_count(function)
+#endif // VK_AMD_draw_indirect_count
+
+#if defined(VK_AMD_shader_info)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_shader_info(function) \
+        function(GetShaderInfoAMD)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_shader_info(function)
+#endif // VK_AMD_shader_info
+
+#if defined(VK_KHR_dynamic_rendering)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_dynamic_rendering(function) \
+        function(CmdEndRenderingKHR) \
+        function(CmdBeginRenderingKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_dynamic_rendering(function)
+#endif // VK_KHR_dynamic_rendering
+
+#if defined(VK_NV_external_memory_win32)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_external_memory_win32(function) \
+        function(GetMemoryWin32HandleNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_external_memory_win32(function)
+#endif // VK_NV_external_memory_win32
+
+#if defined(VK_KHR_device_group)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_device_group(function) \
+        function(GetDeviceGroupPeerMemoryFeaturesKHR) \
+        function(CmdSetDeviceMaskKHR) \
+        function(CmdDispatchBaseKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_device_group(function)
+#endif // VK_KHR_device_group
+
+#if defined(VK_KHR_maintenance1)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_maintenance1(function) \
+        function(TrimCommandPoolKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_maintenance1(function)
+#endif // VK_KHR_maintenance1
+
+#if defined(VK_KHR_external_memory_win32)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_memory_win32(function) \
+        function(GetMemoryWin32HandleKHR) \
+        function(GetMemoryWin32HandlePropertiesKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_memory_win32(function)
+#endif // VK_KHR_external_memory_win32
+
+#if defined(VK_KHR_external_memory_fd)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_memory_fd(function) \
+        function(GetMemoryFdKHR) \
+        function(GetMemoryFdPropertiesKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_memory_fd(function)
+#endif // VK_KHR_external_memory_fd
+
+#if defined(VK_KHR_external_semaphore_win32)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_semaphore_win32(function) \
+        function(ImportSemaphoreWin32HandleKHR) \
+        function(GetSemaphoreWin32HandleKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_semaphore_win32(function)
+#endif // VK_KHR_external_semaphore_win32
+
+#if defined(VK_KHR_external_semaphore_fd)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_semaphore_fd(function) \
+        function(ImportSemaphoreFdKHR) \
+        function(GetSemaphoreFdKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_semaphore_fd(function)
+#endif // VK_KHR_external_semaphore_fd
+
+#if defined(VK_KHR_push_descriptor)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_push_descriptor(function) \
+        function(CmdPushDescriptorSetKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_push_descriptor(function)
+#endif // VK_KHR_push_descriptor
+
+#if defined(VK_EXT_conditional_rendering)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_conditional_rendering(function) \
+        function(CmdEndConditionalRenderingEXT) \
+        function(CmdBeginConditionalRenderingEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_conditional_rendering(function)
+#endif // VK_EXT_conditional_rendering
+
+#if defined(VK_KHR_descriptor_update_template)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_descriptor_update_template(function) \
+        function(CreateDescriptorUpdateTemplateKHR) \
+        function(DestroyDescriptorUpdateTemplateKHR) \
+        function(UpdateDescriptorSetWithTemplateKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_descriptor_update_template(function)
+#endif // VK_KHR_descriptor_update_template
+
+#if defined(VK_NV_clip_space_w_scaling)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_clip_space_w_scaling(function) \
+        function(CmdSetViewportWScalingNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_clip_space_w_scaling(function)
+#endif // VK_NV_clip_space_w_scaling
+
+#if defined(VK_EXT_display_control)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_display_control(function) \
+        function(GetSwapchainCounterEXT) \
+        function(DisplayPowerControlEXT) \
+        function(RegisterDeviceEventEXT) \
+        function(RegisterDisplayEventEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_display_control(function)
+#endif // VK_EXT_display_control
+
+#if defined(VK_GOOGLE_display_timing)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_GOOGLE_display_timing(function) \
+        function(GetRefreshCycleDurationGOOGLE) \
+        function(GetPastPresentationTimingGOOGLE)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_GOOGLE_display_timing(function)
+#endif // VK_GOOGLE_display_timing
+
+#if defined(VK_EXT_discard_rectangles)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_discard_rectangles(function) \
+        function(CmdSetDiscardRectangleEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_discard_rectangles(function)
+#endif // VK_EXT_discard_rectangles
+
+#if defined(VK_EXT_hdr_metadata)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_hdr_metadata(function) \
+        function(SetHdrMetadataEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_hdr_metadata(function)
+#endif // VK_EXT_hdr_metadata
+
+#if defined(VK_KHR_create_renderpass2)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_create_renderpass2(function) \
+        function(CreateRenderPass2KHR) \
+        function(CmdEndRenderPass2KHR) \
+        function(CmdNextSubpass2KHR) \
+        function(CmdBeginRenderPass2KHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_create_renderpass2(function)
+#endif // VK_KHR_create_renderpass2
+
+#if defined(VK_KHR_shared_presentable_image)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_shared_presentable_image(function) \
+        function(GetSwapchainStatusKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_shared_presentable_image(function)
+#endif // VK_KHR_shared_presentable_image
+
+#if defined(VK_KHR_external_fence_win32)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_fence_win32(function) \
+        function(ImportFenceWin32HandleKHR) \
+        function(GetFenceWin32HandleKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_fence_win32(function)
+#endif // VK_KHR_external_fence_win32
+
+#if defined(VK_KHR_external_fence_fd)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_fence_fd(function) \
+        function(ImportFenceFdKHR) \
+        function(GetFenceFdKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_fence_fd(function)
+#endif // VK_KHR_external_fence_fd
+
+#if defined(VK_KHR_performance_query)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_performance_query(function) \
+        function(EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR) \
+        function(AcquireProfilingLockKHR) \
+        function(GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR) \
+        function(ReleaseProfilingLockKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_performance_query(function)
+#endif // VK_KHR_performance_query
+
+#if defined(VK_ANDROID_external_memory_android_hardware_buffer)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_ANDROID_external_memory_android_hardware_buffer(function) \
+        function(GetAndroidHardwareBufferPropertiesANDROID) \
+        function(GetMemoryAndroidHardwareBufferANDROID)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_ANDROID_external_memory_android_hardware_buffer(function)
+#endif // VK_ANDROID_external_memory_android_hardware_buffer
+
+#if defined(VK_EXT_sample_locations)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_sample_locations(function) \
+        function(CmdSetSampleLocationsEXT) \
+        function(GetPhysicalDeviceMultisamplePropertiesEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_sample_locations(function)
+#endif // VK_EXT_sample_locations
+
+#if defined(VK_KHR_get_memory_requirements2)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_get_memory_requirements2(function) \
+        function(GetImageMemoryRequirements2KHR) \
+        function(GetBufferMemoryRequirements2KHR) \
+        function(GetImageSparseMemoryRequirements2KHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_get_memory_requirements2(function)
+#endif // VK_KHR_get_memory_requirements2
+
+#if defined(VK_KHR_acceleration_structure)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_acceleration_structure(function) \
+        function(CreateAccelerationStructureKHR) \
+        function(DestroyAccelerationStructureKHR) \
+        function(CmdBuildAccelerationStructuresKHR) \
+        function(CopyAccelerationStructureKHR) \
+        function(BuildAccelerationStructuresKHR) \
+        function(CmdWriteAccelerationStructuresPropertiesKHR) \
+        function(CmdBuildAccelerationStructuresIndirectKHR) \
+        function(CopyMemoryToAccelerationStructureKHR) \
+        function(CopyAccelerationStructureToMemoryKHR) \
+        function(WriteAccelerationStructuresPropertiesKHR) \
+        function(CmdCopyAccelerationStructureKHR) \
+        function(CmdCopyAccelerationStructureToMemoryKHR) \
+        function(CmdCopyMemoryToAccelerationStructureKHR) \
+        function(GetAccelerationStructureDeviceAddressKHR) \
+        function(GetDeviceAccelerationStructureCompatibilityKHR) \
+        function(GetAccelerationStructureBuildSizesKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_acceleration_structure(function)
+#endif // VK_KHR_acceleration_structure
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_ray_tracing_pipeline(function) \
+        function(CmdTraceRaysKHR) \
+        function(GetRayTracingShaderGroupHandlesKHR) \
+        function(CreateRayTracingPipelinesKHR) \
+        function(GetRayTracingCaptureReplayShaderGroupHandlesKHR) \
+        function(CmdTraceRaysIndirectKHR) \
+        function(GetRayTracingShaderGroupStackSizeKHR) \
+        function(CmdSetRayTracingPipelineStackSizeKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_ray_tracing_pipeline(function)
+#endif // VK_KHR_ray_tracing_pipeline
+
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_sampler_ycbcr_conversion(function) \
+        function(CreateSamplerYcbcrConversionKHR) \
+        function(DestroySamplerYcbcrConversionKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_sampler_ycbcr_conversion(function)
+#endif // VK_KHR_sampler_ycbcr_conversion
+
+#if defined(VK_KHR_bind_memory2)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_bind_memory2(function) \
+        function(BindBufferMemory2KHR) \
+        function(BindImageMemory2KHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_bind_memory2(function)
+#endif // VK_KHR_bind_memory2
+
+#if defined(VK_EXT_image_drm_format_modifier)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_image_drm_format_modifier(function) \
+        function(GetImageDrmFormatModifierPropertiesEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_image_drm_format_modifier(function)
+#endif // VK_EXT_image_drm_format_modifier
+
+#if defined(VK_EXT_validation_cache)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_validation_cache(function) \
+        function(GetValidationCacheDataEXT) \
+        function(CreateValidationCacheEXT) \
+        function(DestroyValidationCacheEXT) \
+        function(MergeValidationCachesEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_validation_cache(function)
+#endif // VK_EXT_validation_cache
+
+#if defined(VK_NV_shading_rate_image)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_shading_rate_image(function) \
+        function(CmdBindShadingRateImageNV) \
+        function(CmdSetCoarseSampleOrderNV) \
+        function(CmdSetViewportShadingRatePaletteNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_shading_rate_image(function)
+#endif // VK_NV_shading_rate_image
+
+#if defined(VK_NV_ray_tracing)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_ray_tracing(function) \
+        function(CreateRayTracingPipelinesNV) \
+        function(CreateAccelerationStructureNV) \
+        function(BindAccelerationStructureMemoryNV) \
+        function(DestroyAccelerationStructureNV) \
+        function(CmdCopyAccelerationStructureNV) \
+        function(GetAccelerationStructureMemoryRequirementsNV) \
+        function(CmdBuildAccelerationStructureNV) \
+        function(CmdTraceRaysNV) \
+        function(GetRayTracingShaderGroupHandlesNV) \
+        function(GetAccelerationStructureHandleNV) \
+        function(CmdWriteAccelerationStructuresPropertiesNV) \
+        function(CompileDeferredNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_ray_tracing(function)
+#endif // VK_NV_ray_tracing
+
+#if defined(VK_KHR_maintenance3)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_maintenance3(function) \
+        function(GetDescriptorSetLayoutSupportKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_maintenance3(function)
+#endif // VK_KHR_maintenance3
+
+#if defined(VK_KHR_draw_indirect_count)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_draw_indirect_count(function) \
+        function(CmdDrawIndirectCountKHR) \
+        function(CmdDrawIndexedIndirectCountKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_draw_indirect_count(function)
+#endif // VK_KHR_draw_indirect_count
+
+#if defined(VK_EXT_external_memory_host)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_external_memory_host(function) \
+        function(GetMemoryHostPointerPropertiesEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_external_memory_host(function)
+#endif // VK_EXT_external_memory_host
+
+#if defined(VK_AMD_buffer_marker)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_buffer_marker(function) \
+        function(CmdWriteBufferMarkerAMD)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_buffer_marker(function)
+#endif // VK_AMD_buffer_marker
+
+#if defined(VK_EXT_calibrated_timestamps)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_calibrated_timestamps(function) \
+        function(GetPhysicalDeviceCalibrateableTimeDomainsEXT) \
+        function(GetCalibratedTimestampsEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_calibrated_timestamps(function)
+#endif // VK_EXT_calibrated_timestamps
+
+#if defined(VK_NV_mesh_shader)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_mesh_shader(function) \
+        function(CmdDrawMeshTasksNV) \
+        function(CmdDrawMeshTasksIndirectNV) \
+        function(CmdDrawMeshTasksIndirectCountNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_mesh_shader(function)
+#endif // VK_NV_mesh_shader
+
+#if defined(VK_NV_scissor_exclusive)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_scissor_exclusive(function) \
+        function(CmdSetExclusiveScissorNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_scissor_exclusive(function)
+#endif // VK_NV_scissor_exclusive
+
+#if defined(VK_NV_device_diagnostic_checkpoints)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_device_diagnostic_checkpoints(function) \
+        function(CmdSetCheckpointNV) \
+        function(GetQueueCheckpointDataNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_device_diagnostic_checkpoints(function)
+#endif // VK_NV_device_diagnostic_checkpoints
+
+#if defined(VK_KHR_timeline_semaphore)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_timeline_semaphore(function) \
+        function(GetSemaphoreCounterValueKHR) \
+        function(SignalSemaphoreKHR) \
+        function(WaitSemaphoresKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_timeline_semaphore(function)
+#endif // VK_KHR_timeline_semaphore
+
+#if defined(VK_INTEL_performance_query)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_INTEL_performance_query(function) \
+        function(InitializePerformanceApiINTEL) \
+        function(UninitializePerformanceApiINTEL) \
+        function(AcquirePerformanceConfigurationINTEL) \
+        function(CmdSetPerformanceStreamMarkerINTEL) \
+        function(CmdSetPerformanceMarkerINTEL) \
+        function(CmdSetPerformanceOverrideINTEL) \
+        function(QueueSetPerformanceConfigurationINTEL) \
+        function(ReleasePerformanceConfigurationINTEL) \
+        function(GetPerformanceParameterINTEL)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_INTEL_performance_query(function)
+#endif // VK_INTEL_performance_query
+
+#if defined(VK_AMD_display_native_hdr)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_display_native_hdr(function) \
+        function(SetLocalDimmingAMD)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_display_native_hdr(function)
+#endif // VK_AMD_display_native_hdr
+
+#if defined(VK_KHR_fragment_shading_rate)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_fragment_shading_rate(function) \
+        function(GetPhysicalDeviceFragmentShadingRatesKHR) \
+        function(CmdSetFragmentShadingRateKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_fragment_shading_rate(function)
+#endif // VK_KHR_fragment_shading_rate
+
+#if defined(VK_EXT_buffer_device_address)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_buffer_device_address(function) \
+        function(GetBufferDeviceAddressEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_buffer_device_address(function)
+#endif // VK_EXT_buffer_device_address
+
+#if defined(VK_EXT_tooling_info)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_tooling_info(function) \
+        function(GetPhysicalDeviceToolPropertiesEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_tooling_info(function)
+#endif // VK_EXT_tooling_info
+
+#if defined(VK_KHR_present_wait)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_present_wait(function) \
+        function(WaitForPresentKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_present_wait(function)
+#endif // VK_KHR_present_wait
+
+#if defined(VK_NV_cooperative_matrix)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_cooperative_matrix(function) \
+        function(GetPhysicalDeviceCooperativeMatrixPropertiesNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_cooperative_matrix(function)
+#endif // VK_NV_cooperative_matrix
+
+#if defined(VK_NV_coverage_reduction_mode)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_coverage_reduction_mode(function) \
+        function(GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_coverage_reduction_mode(function)
+#endif // VK_NV_coverage_reduction_mode
+
+#if defined(VK_EXT_full_screen_exclusive)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_full_screen_exclusive(function) \
+        function(GetPhysicalDeviceSurfacePresentModes2EXT) \
+        function(AcquireFullScreenExclusiveModeEXT) \
+        function(ReleaseFullScreenExclusiveModeEXT) \
+        function(GetDeviceGroupSurfacePresentModes2EXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_full_screen_exclusive(function)
+#endif // VK_EXT_full_screen_exclusive
+
+#if defined(VK_KHR_buffer_device_address)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_buffer_device_address(function) \
+        function(GetDeviceMemoryOpaqueCaptureAddressKHR) \
+        function(GetBufferDeviceAddressKHR) \
+        function(GetBufferOpaqueCaptureAddressKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_buffer_device_address(function)
+#endif // VK_KHR_buffer_device_address
+
+#if defined(VK_EXT_line_rasterization)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_line_rasterization(function) \
+        function(CmdSetLineStippleEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_line_rasterization(function)
+#endif // VK_EXT_line_rasterization
+
+#if defined(VK_EXT_host_query_reset)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_host_query_reset(function) \
+        function(ResetQueryPoolEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_host_query_reset(function)
+#endif // VK_EXT_host_query_reset
+
+#if defined(VK_EXT_extended_dynamic_state)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_extended_dynamic_state(function) \
+        function(CmdSetCullModeEXT) \
+        function(CmdBindVertexBuffers2EXT) \
+        function(CmdSetFrontFaceEXT) \
+        function(CmdSetPrimitiveTopologyEXT) \
+        function(CmdSetViewportWithCountEXT) \
+        function(CmdSetScissorWithCountEXT) \
+        function(CmdSetDepthTestEnableEXT) \
+        function(CmdSetDepthWriteEnableEXT) \
+        function(CmdSetDepthBoundsTestEnableEXT) \
+        function(CmdSetDepthCompareOpEXT) \
+        function(CmdSetStencilTestEnableEXT) \
+        function(CmdSetStencilOpEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_extended_dynamic_state(function)
+#endif // VK_EXT_extended_dynamic_state
+
+#if defined(VK_KHR_deferred_host_operations)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_deferred_host_operations(function) \
+        function(DeferredOperationJoinKHR) \
+        function(CreateDeferredOperationKHR) \
+        function(DestroyDeferredOperationKHR) \
+        function(GetDeferredOperationResultKHR) \
+        function(GetDeferredOperationMaxConcurrencyKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_deferred_host_operations(function)
+#endif // VK_KHR_deferred_host_operations
+
+#if defined(VK_KHR_pipeline_executable_properties)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_pipeline_executable_properties(function) \
+        function(GetPipelineExecutableInternalRepresentationsKHR) \
+        function(GetPipelineExecutablePropertiesKHR) \
+        function(GetPipelineExecutableStatisticsKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_pipeline_executable_properties(function)
+#endif // VK_KHR_pipeline_executable_properties
+
+#if defined(VK_NV_device_generated_commands)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_device_generated_commands(function) \
+        function(DestroyIndirectCommandsLayoutNV) \
+        function(GetGeneratedCommandsMemoryRequirementsNV) \
+        function(CmdPreprocessGeneratedCommandsNV) \
+        function(CmdExecuteGeneratedCommandsNV) \
+        function(CmdBindPipelineShaderGroupNV) \
+        function(CreateIndirectCommandsLayoutNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_device_generated_commands(function)
+#endif // VK_NV_device_generated_commands
+
+#if defined(VK_EXT_private_data)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_private_data(function) \
+        function(SetPrivateDataEXT) \
+        function(CreatePrivateDataSlotEXT) \
+        function(DestroyPrivateDataSlotEXT) \
+        function(GetPrivateDataEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_private_data(function)
+#endif // VK_EXT_private_data
+
+#if defined(VK_KHR_video_encode_queue)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_video_encode_queue(function) \
+        function(CmdEncodeVideoKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_video_encode_queue(function)
+#endif // VK_KHR_video_encode_queue
+
+#if defined(VK_KHR_synchronization2)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_synchronization2(function) \
+        function(CmdSetEvent2KHR) \
+        function(CmdPipelineBarrier2KHR) \
+        function(CmdResetEvent2KHR) \
+        function(GetQueueCheckpointData2NV) \
+        function(CmdWaitEvents2KHR) \
+        function(CmdWriteTimestamp2KHR) \
+        function(QueueSubmit2KHR) \
+        function(CmdWriteBufferMarker2AMD)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_synchronization2(function)
+#endif // VK_KHR_synchronization2
+
+#if defined(VK_NV_fragment_shading_rate_enums)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_fragment_shading_rate_enums(function) \
+        function(CmdSetFragmentShadingRateEnumNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_fragment_shading_rate_enums(function)
+#endif // VK_NV_fragment_shading_rate_enums
+
+#if defined(VK_KHR_copy_commands2)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_copy_commands2(function) \
+        function(CmdCopyBuffer2KHR) \
+        function(CmdCopyImage2KHR) \
+        function(CmdCopyBufferToImage2KHR) \
+        function(CmdCopyImageToBuffer2KHR) \
+        function(CmdBlitImage2KHR) \
+        function(CmdResolveImage2KHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_copy_commands2(function)
+#endif // VK_KHR_copy_commands2
+
+#if defined(VK_NV_acquire_winrt_display)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_acquire_winrt_display(function) \
+        function(AcquireWinrtDisplayNV) \
+        function(GetWinrtDisplayNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_acquire_winrt_display(function)
+#endif // VK_NV_acquire_winrt_display
+
+#if defined(VK_EXT_vertex_input_dynamic_state)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_vertex_input_dynamic_state(function) \
+        function(CmdSetVertexInputEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_vertex_input_dynamic_state(function)
+#endif // VK_EXT_vertex_input_dynamic_state
+
+#if defined(VK_FUCHSIA_external_memory)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_FUCHSIA_external_memory(function) \
+        function(GetMemoryZirconHandleFUCHSIA) \
+        function(GetMemoryZirconHandlePropertiesFUCHSIA)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_FUCHSIA_external_memory(function)
+#endif // VK_FUCHSIA_external_memory
+
+#if defined(VK_FUCHSIA_external_semaphore)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_FUCHSIA_external_semaphore(function) \
+        function(ImportSemaphoreZirconHandleFUCHSIA) \
+        function(GetSemaphoreZirconHandleFUCHSIA)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_FUCHSIA_external_semaphore(function)
+#endif // VK_FUCHSIA_external_semaphore
+
+#if defined(VK_FUCHSIA_buffer_collection)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_FUCHSIA_buffer_collection(function) \
+        function(CreateBufferCollectionFUCHSIA) \
+        function(SetBufferCollectionImageConstraintsFUCHSIA) \
+        function(DestroyBufferCollectionFUCHSIA) \
+        function(SetBufferCollectionBufferConstraintsFUCHSIA) \
+        function(GetBufferCollectionPropertiesFUCHSIA)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_FUCHSIA_buffer_collection(function)
+#endif // VK_FUCHSIA_buffer_collection
+
+#if defined(VK_HUAWEI_subpass_shading)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_HUAWEI_subpass_shading(function) \
+        function(GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI) \
+        function(CmdSubpassShadingHUAWEI)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_HUAWEI_subpass_shading(function)
+#endif // VK_HUAWEI_subpass_shading
+
+#if defined(VK_HUAWEI_invocation_mask)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_HUAWEI_invocation_mask(function) \
+        function(CmdBindInvocationMaskHUAWEI)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_HUAWEI_invocation_mask(function)
+#endif // VK_HUAWEI_invocation_mask
+
+#if defined(VK_NV_external_memory_rdma)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_external_memory_rdma(function) \
+        function(GetMemoryRemoteAddressNV)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_external_memory_rdma(function)
+#endif // VK_NV_external_memory_rdma
+
+#if defined(VK_EXT_extended_dynamic_state2)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_extended_dynamic_state2(function) \
+        function(CmdSetPatchControlPointsEXT) \
+        function(CmdSetRasterizerDiscardEnableEXT) \
+        function(CmdSetDepthBiasEnableEXT) \
+        function(CmdSetLogicOpEXT) \
+        function(CmdSetPrimitiveRestartEnableEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_extended_dynamic_state2(function)
+#endif // VK_EXT_extended_dynamic_state2
+
+#if defined(VK_EXT_color_write_enable)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_color_write_enable(function) \
+        function(CmdSetColorWriteEnableEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_color_write_enable(function)
+#endif // VK_EXT_color_write_enable
+
+#if defined(VK_EXT_multi_draw)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_multi_draw(function) \
+        function(CmdDrawMultiEXT) \
+        function(CmdDrawMultiIndexedEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_multi_draw(function)
+#endif // VK_EXT_multi_draw
+
+#if defined(VK_EXT_pageable_device_local_memory)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_pageable_device_local_memory(function) \
+        function(SetDeviceMemoryPriorityEXT)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_pageable_device_local_memory(function)
+#endif // VK_EXT_pageable_device_local_memory
+
+#if defined(VK_KHR_maintenance4)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_maintenance4(function) \
+        function(GetDeviceBufferMemoryRequirementsKHR) \
+        function(GetDeviceImageSparseMemoryRequirementsKHR) \
+        function(GetDeviceImageMemoryRequirementsKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_maintenance4(function)
+#endif // VK_KHR_maintenance4
+
+#if defined(VK_KHR_device_group) || defined(VK_KHR_swapchain)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_device_group_KHR_swapchain(function) \
+        function(GetDeviceGroupPresentCapabilitiesKHR) \
+        function(GetDeviceGroupSurfacePresentModesKHR) \
+        function(GetPhysicalDevicePresentRectanglesKHR) \
+        function(AcquireNextImage2KHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_device_group_KHR_swapchain(function)
+#endif // VK_KHR_device_group || VK_KHR_swapchain
+
+#if defined(VK_KHR_push_descriptor) || defined(VK_KHR_descriptor_update_template)
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_push_descriptor_KHR_descriptor_update_template(function) \
+        function(CmdPushDescriptorSetWithTemplateKHR)
+#else
+    #define VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_push_descriptor_KHR_descriptor_update_template(function)
+#endif // VK_KHR_push_descriptor || VK_KHR_descriptor_update_template
+
+#define VULKANDYNAMIC_DEVICE_FUNCTIONS(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_VERSION_1_0(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_VERSION_1_1(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_VERSION_1_2(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_swapchain(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_display_swapchain(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_debug_marker(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_video_queue(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_video_decode_queue(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_transform_feedback(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NVX_binary_import(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NVX_image_view_handle(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_draw_indirect_count(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_shader_info(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_dynamic_rendering(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_external_memory_win32(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_device_group(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_maintenance1(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_memory_win32(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_memory_fd(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_semaphore_win32(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_semaphore_fd(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_push_descriptor(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_conditional_rendering(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_descriptor_update_template(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_clip_space_w_scaling(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_display_control(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_GOOGLE_display_timing(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_discard_rectangles(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_hdr_metadata(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_create_renderpass2(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_shared_presentable_image(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_fence_win32(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_external_fence_fd(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_performance_query(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_ANDROID_external_memory_android_hardware_buffer(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_sample_locations(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_get_memory_requirements2(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_acceleration_structure(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_ray_tracing_pipeline(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_sampler_ycbcr_conversion(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_bind_memory2(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_image_drm_format_modifier(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_validation_cache(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_shading_rate_image(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_ray_tracing(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_maintenance3(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_draw_indirect_count(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_external_memory_host(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_buffer_marker(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_calibrated_timestamps(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_mesh_shader(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_scissor_exclusive(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_device_diagnostic_checkpoints(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_timeline_semaphore(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_INTEL_performance_query(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_AMD_display_native_hdr(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_fragment_shading_rate(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_buffer_device_address(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_tooling_info(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_present_wait(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_cooperative_matrix(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_coverage_reduction_mode(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_full_screen_exclusive(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_buffer_device_address(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_line_rasterization(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_host_query_reset(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_extended_dynamic_state(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_deferred_host_operations(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_pipeline_executable_properties(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_device_generated_commands(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_private_data(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_video_encode_queue(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_synchronization2(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_fragment_shading_rate_enums(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_copy_commands2(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_acquire_winrt_display(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_vertex_input_dynamic_state(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_FUCHSIA_external_memory(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_FUCHSIA_external_semaphore(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_FUCHSIA_buffer_collection(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_HUAWEI_subpass_shading(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_HUAWEI_invocation_mask(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_NV_external_memory_rdma(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_extended_dynamic_state2(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_color_write_enable(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_multi_draw(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_EXT_pageable_device_local_memory(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_maintenance4(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_device_group_KHR_swapchain(function) \
+    VULKANDYNAMIC_DEVICE_FUNCTIONS_KHR_push_descriptor_KHR_descriptor_update_template(function)
+
+//---------------------------------------------------------------------------------------
+// Command Buffer
+//---------------------------------------------------------------------------------------
+
+// Vulkan Core 1.0
+#define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_VERSION_1_0(function) \
+    function(CmdBindPipeline) \
+    function(CmdSetViewport) \
+    function(CmdSetScissor) \
+    function(CmdSetLineWidth) \
+    function(CmdSetDepthBias) \
+    function(CmdSetBlendConstants) \
+    function(CmdSetDepthBounds) \
+    function(CmdSetStencilCompareMask) \
+    function(CmdSetStencilWriteMask) \
+    function(CmdSetStencilReference) \
+    function(CmdBindDescriptorSets) \
+    function(CmdBindIndexBuffer) \
+    function(CmdBindVertexBuffers) \
+    function(CmdDraw) \
+    function(CmdDrawIndexed) \
+    function(CmdDrawIndirect) \
+    function(CmdDrawIndexedIndirect) \
+    function(CmdDispatch) \
+    function(CmdDispatchIndirect) \
+    function(CmdCopyBuffer) \
+    function(CmdCopyImage) \
+    function(CmdBlitImage) \
+    function(CmdCopyBufferToImage) \
+    function(CmdCopyImageToBuffer) \
+    function(CmdUpdateBuffer) \
+    function(CmdFillBuffer) \
+    function(CmdClearColorImage) \
+    function(CmdClearDepthStencilImage) \
+    function(CmdClearAttachments) \
+    function(CmdResolveImage) \
+    function(CmdSetEvent) \
+    function(CmdResetEvent) \
+    function(CmdWaitEvents) \
+    function(CmdPipelineBarrier) \
+    function(CmdBeginQuery) \
+    function(CmdEndQuery) \
+    function(CmdResetQueryPool) \
+    function(CmdWriteTimestamp) \
+    function(CmdCopyQueryPoolResults) \
+    function(CmdPushConstants) \
+    function(CmdBeginRenderPass) \
+    function(CmdNextSubpass) \
+    function(CmdEndRenderPass) \
+    function(CmdExecuteCommands)
+
+// Vulkan Core 1.1
+#define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_VERSION_1_1(function) \
+    function(CmdSetDeviceMask) \
+    function(CmdDispatchBase)
+
+// Vulkan Core 1.2
+#define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_VERSION_1_2(function) \
+    function(CmdDrawIndirectCount) \
+    function(CmdDrawIndexedIndirectCount) \
+    function(CmdBeginRenderPass2) \
+    function(CmdNextSubpass2) \
+    function(CmdEndRenderPass2)
+
+#if defined(VK_EXT_debug_marker)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_debug_marker(function) \
+        function(CmdDebugMarkerBeginEXT) \
+        function(CmdDebugMarkerEndEXT) \
+        function(CmdDebugMarkerInsertEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_debug_marker(function)
+#endif // VK_EXT_debug_marker
+
+#if defined(VK_KHR_video_queue)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_video_queue(function) \
+        function(CmdBeginVideoCodingKHR) \
+        function(CmdEndVideoCodingKHR) \
+        function(CmdControlVideoCodingKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_video_queue(function)
+#endif // VK_KHR_video_queue
+
+#if defined(VK_KHR_video_decode_queue)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_video_decode_queue(function) \
+        function(CmdDecodeVideoKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_video_decode_queue(function)
+#endif // VK_KHR_video_decode_queue
+
+#if defined(VK_EXT_transform_feedback)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_transform_feedback(function) \
+        function(CmdDrawIndirectByteCountEXT) \
+        function(CmdBindTransformFeedbackBuffersEXT) \
+        function(CmdEndTransformFeedbackEXT) \
+        function(CmdBeginTransformFeedbackEXT) \
+        function(CmdEndQueryIndexedEXT) \
+        function(CmdBeginQueryIndexedEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_transform_feedback(function)
+#endif // VK_EXT_transform_feedback
+
+#if defined(VK_NVX_binary_import)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NVX_binary_import(function) \
+        function(CmdCuLaunchKernelNVX)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NVX_binary_import(function)
+#endif // VK_NVX_binary_import
+
+#if defined(VK_AMD_draw_indirect_count)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_AMD_draw_indirect_count(function) \
+        function(CmdDrawIndirectCountAMD) \
+        function(CmdDrawIndexedIndirectCountAMD)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_AMD_draw_indirect_count(function)
+#endif // VK_AMD_draw_indirect_count
+
+#if defined(VK_KHR_dynamic_rendering)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_dynamic_rendering(function) \
+        function(CmdEndRenderingKHR) \
+        function(CmdBeginRenderingKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_dynamic_rendering(function)
+#endif // VK_KHR_dynamic_rendering
+
+#if defined(VK_KHR_device_group)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_device_group(function) \
+        function(CmdSetDeviceMaskKHR) \
+        function(CmdDispatchBaseKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_device_group(function)
+#endif // VK_KHR_device_group
+
+#if defined(VK_KHR_push_descriptor)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_push_descriptor(function) \
+        function(CmdPushDescriptorSetKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_push_descriptor(function)
+#endif // VK_KHR_push_descriptor
+
+#if defined(VK_EXT_conditional_rendering)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_conditional_rendering(function) \
+        function(CmdEndConditionalRenderingEXT) \
+        function(CmdBeginConditionalRenderingEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_conditional_rendering(function)
+#endif // VK_EXT_conditional_rendering
+
+#if defined(VK_NV_clip_space_w_scaling)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_clip_space_w_scaling(function) \
+        function(CmdSetViewportWScalingNV)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_clip_space_w_scaling(function)
+#endif // VK_NV_clip_space_w_scaling
+
+#if defined(VK_EXT_discard_rectangles)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_discard_rectangles(function) \
+        function(CmdSetDiscardRectangleEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_discard_rectangles(function)
+#endif // VK_EXT_discard_rectangles
+
+#if defined(VK_KHR_create_renderpass2)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_create_renderpass2(function) \
+        function(CmdEndRenderPass2KHR) \
+        function(CmdNextSubpass2KHR) \
+        function(CmdBeginRenderPass2KHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_create_renderpass2(function)
+#endif // VK_KHR_create_renderpass2
+
+#if defined(VK_EXT_sample_locations)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_sample_locations(function) \
+        function(CmdSetSampleLocationsEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_sample_locations(function)
+#endif // VK_EXT_sample_locations
+
+#if defined(VK_KHR_acceleration_structure)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_acceleration_structure(function) \
+        function(CmdBuildAccelerationStructuresKHR) \
+        function(CmdWriteAccelerationStructuresPropertiesKHR) \
+        function(CmdBuildAccelerationStructuresIndirectKHR) \
+        function(CmdCopyAccelerationStructureKHR) \
+        function(CmdCopyAccelerationStructureToMemoryKHR) \
+        function(CmdCopyMemoryToAccelerationStructureKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_acceleration_structure(function)
+#endif // VK_KHR_acceleration_structure
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_ray_tracing_pipeline(function) \
+        function(CmdTraceRaysKHR) \
+        function(CmdTraceRaysIndirectKHR) \
+        function(CmdSetRayTracingPipelineStackSizeKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_ray_tracing_pipeline(function)
+#endif // VK_KHR_ray_tracing_pipeline
+
+#if defined(VK_NV_shading_rate_image)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_shading_rate_image(function) \
+        function(CmdBindShadingRateImageNV) \
+        function(CmdSetCoarseSampleOrderNV) \
+        function(CmdSetViewportShadingRatePaletteNV)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_shading_rate_image(function)
+#endif // VK_NV_shading_rate_image
+
+#if defined(VK_NV_ray_tracing)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_ray_tracing(function) \
+        function(CmdCopyAccelerationStructureNV) \
+        function(CmdBuildAccelerationStructureNV) \
+        function(CmdTraceRaysNV) \
+        function(CmdWriteAccelerationStructuresPropertiesNV)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_ray_tracing(function)
+#endif // VK_NV_ray_tracing
+
+#if defined(VK_KHR_draw_indirect_count)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_draw_indirect_count(function) \
+        function(CmdDrawIndirectCountKHR) \
+        function(CmdDrawIndexedIndirectCountKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_draw_indirect_count(function)
+#endif // VK_KHR_draw_indirect_count
+
+#if defined(VK_AMD_buffer_marker)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_AMD_buffer_marker(function) \
+        function(CmdWriteBufferMarkerAMD)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_AMD_buffer_marker(function)
+#endif // VK_AMD_buffer_marker
+
+#if defined(VK_NV_mesh_shader)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_mesh_shader(function) \
+        function(CmdDrawMeshTasksNV) \
+        function(CmdDrawMeshTasksIndirectNV) \
+        function(CmdDrawMeshTasksIndirectCountNV)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_mesh_shader(function)
+#endif // VK_NV_mesh_shader
+
+#if defined(VK_NV_scissor_exclusive)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_scissor_exclusive(function) \
+        function(CmdSetExclusiveScissorNV)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_scissor_exclusive(function)
+#endif // VK_NV_scissor_exclusive
+
+#if defined(VK_NV_device_diagnostic_checkpoints)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_device_diagnostic_checkpoints(function) \
+        function(CmdSetCheckpointNV)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_device_diagnostic_checkpoints(function)
+#endif // VK_NV_device_diagnostic_checkpoints
+
+#if defined(VK_INTEL_performance_query)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_INTEL_performance_query(function) \
+        function(CmdSetPerformanceStreamMarkerINTEL) \
+        function(CmdSetPerformanceMarkerINTEL) \
+        function(CmdSetPerformanceOverrideINTEL)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_INTEL_performance_query(function)
+#endif // VK_INTEL_performance_query
+
+#if defined(VK_KHR_fragment_shading_rate)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_fragment_shading_rate(function) \
+        function(CmdSetFragmentShadingRateKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_fragment_shading_rate(function)
+#endif // VK_KHR_fragment_shading_rate
+
+#if defined(VK_EXT_line_rasterization)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_line_rasterization(function) \
+        function(CmdSetLineStippleEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_line_rasterization(function)
+#endif // VK_EXT_line_rasterization
+
+#if defined(VK_EXT_extended_dynamic_state)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_extended_dynamic_state(function) \
+        function(CmdSetCullModeEXT) \
+        function(CmdBindVertexBuffers2EXT) \
+        function(CmdSetFrontFaceEXT) \
+        function(CmdSetPrimitiveTopologyEXT) \
+        function(CmdSetViewportWithCountEXT) \
+        function(CmdSetScissorWithCountEXT) \
+        function(CmdSetDepthTestEnableEXT) \
+        function(CmdSetDepthWriteEnableEXT) \
+        function(CmdSetDepthBoundsTestEnableEXT) \
+        function(CmdSetDepthCompareOpEXT) \
+        function(CmdSetStencilTestEnableEXT) \
+        function(CmdSetStencilOpEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_extended_dynamic_state(function)
+#endif // VK_EXT_extended_dynamic_state
+
+#if defined(VK_NV_device_generated_commands)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_device_generated_commands(function) \
+        function(CmdPreprocessGeneratedCommandsNV) \
+        function(CmdExecuteGeneratedCommandsNV) \
+        function(CmdBindPipelineShaderGroupNV)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_device_generated_commands(function)
+#endif // VK_NV_device_generated_commands
+
+#if defined(VK_KHR_video_encode_queue)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_video_encode_queue(function) \
+        function(CmdEncodeVideoKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_video_encode_queue(function)
+#endif // VK_KHR_video_encode_queue
+
+#if defined(VK_KHR_synchronization2)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_synchronization2(function) \
+        function(CmdSetEvent2KHR) \
+        function(CmdPipelineBarrier2KHR) \
+        function(CmdResetEvent2KHR) \
+        function(CmdWaitEvents2KHR) \
+        function(CmdWriteTimestamp2KHR) \
+        function(CmdWriteBufferMarker2AMD)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_synchronization2(function)
+#endif // VK_KHR_synchronization2
+
+#if defined(VK_NV_fragment_shading_rate_enums)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_fragment_shading_rate_enums(function) \
+        function(CmdSetFragmentShadingRateEnumNV)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_fragment_shading_rate_enums(function)
+#endif // VK_NV_fragment_shading_rate_enums
+
+#if defined(VK_KHR_copy_commands2)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_copy_commands2(function) \
+        function(CmdCopyBuffer2KHR) \
+        function(CmdCopyImage2KHR) \
+        function(CmdCopyBufferToImage2KHR) \
+        function(CmdCopyImageToBuffer2KHR) \
+        function(CmdBlitImage2KHR) \
+        function(CmdResolveImage2KHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_copy_commands2(function)
+#endif // VK_KHR_copy_commands2
+
+#if defined(VK_EXT_vertex_input_dynamic_state)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_vertex_input_dynamic_state(function) \
+        function(CmdSetVertexInputEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_vertex_input_dynamic_state(function)
+#endif // VK_EXT_vertex_input_dynamic_state
+
+#if defined(VK_HUAWEI_subpass_shading)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_HUAWEI_subpass_shading(function) \
+        function(CmdSubpassShadingHUAWEI)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_HUAWEI_subpass_shading(function)
+#endif // VK_HUAWEI_subpass_shading
+
+#if defined(VK_HUAWEI_invocation_mask)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_HUAWEI_invocation_mask(function) \
+        function(CmdBindInvocationMaskHUAWEI)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_HUAWEI_invocation_mask(function)
+#endif // VK_HUAWEI_invocation_mask
+
+#if defined(VK_EXT_extended_dynamic_state2)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_extended_dynamic_state2(function) \
+        function(CmdSetPatchControlPointsEXT) \
+        function(CmdSetRasterizerDiscardEnableEXT) \
+        function(CmdSetDepthBiasEnableEXT) \
+        function(CmdSetLogicOpEXT) \
+        function(CmdSetPrimitiveRestartEnableEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_extended_dynamic_state2(function)
+#endif // VK_EXT_extended_dynamic_state2
+
+#if defined(VK_EXT_color_write_enable)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_color_write_enable(function) \
+        function(CmdSetColorWriteEnableEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_color_write_enable(function)
+#endif // VK_EXT_color_write_enable
+
+#if defined(VK_EXT_multi_draw)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_multi_draw(function) \
+        function(CmdDrawMultiEXT) \
+        function(CmdDrawMultiIndexedEXT)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_multi_draw(function)
+#endif // VK_EXT_multi_draw
+
+#if defined(VK_KHR_push_descriptor) || defined(VK_KHR_descriptor_update_template)
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_push_descriptor_KHR_descriptor_update_template(function) \
+        function(CmdPushDescriptorSetWithTemplateKHR)
+#else
+    #define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_push_descriptor_KHR_descriptor_update_template(function)
+#endif // VK_KHR_push_descriptor || VK_KHR_descriptor_update_template
+
+#define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_VERSION_1_0(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_VERSION_1_1(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_VERSION_1_2(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_debug_marker(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_video_queue(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_video_decode_queue(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_transform_feedback(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NVX_binary_import(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_AMD_draw_indirect_count(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_dynamic_rendering(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_device_group(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_push_descriptor(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_conditional_rendering(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_clip_space_w_scaling(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_discard_rectangles(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_create_renderpass2(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_sample_locations(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_acceleration_structure(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_ray_tracing_pipeline(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_shading_rate_image(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_ray_tracing(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_draw_indirect_count(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_AMD_buffer_marker(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_mesh_shader(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_scissor_exclusive(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_device_diagnostic_checkpoints(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_INTEL_performance_query(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_fragment_shading_rate(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_line_rasterization(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_extended_dynamic_state(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_device_generated_commands(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_video_encode_queue(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_synchronization2(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_NV_fragment_shading_rate_enums(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_copy_commands2(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_vertex_input_dynamic_state(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_HUAWEI_subpass_shading(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_HUAWEI_invocation_mask(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_extended_dynamic_state2(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_color_write_enable(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_EXT_multi_draw(function) \
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS_KHR_push_descriptor_KHR_descriptor_update_template(function)
+
+//---------------------------------------------------------------------------------------
+// Function Identifiers
+//---------------------------------------------------------------------------------------
+
+// Dense per-tier indices of the entry points, in table order.
+
+#define VULKANDYNAMIC_LOADER_FUNCTION_ID(function) VULKANDYNAMIC_LOADER_FUNCTION_ID_##function,
+
+typedef enum VulkanDynamicLoaderFunctionId
+{
+    VULKANDYNAMIC_LOADER_FUNCTIONS(VULKANDYNAMIC_LOADER_FUNCTION_ID)
+    VULKANDYNAMIC_LOADER_FUNCTION_ID_COUNT
+} VulkanDynamicLoaderFunctionId;
+
+#undef VULKANDYNAMIC_LOADER_FUNCTION_ID
+
+#define VULKANDYNAMIC_INSTANCE_FUNCTION_ID(function) VULKANDYNAMIC_INSTANCE_FUNCTION_ID_##function,
+
+typedef enum VulkanDynamicInstanceFunctionId
+{
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS(VULKANDYNAMIC_INSTANCE_FUNCTION_ID)
+    VULKANDYNAMIC_INSTANCE_FUNCTION_ID_COUNT
+} VulkanDynamicInstanceFunctionId;
+
+#undef VULKANDYNAMIC_INSTANCE_FUNCTION_ID
+
+#define VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTION_ID(function) VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTION_ID_##function,
+
+typedef enum VulkanDynamicPhysicalDeviceFunctionId
+{
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS(VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTION_ID)
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTION_ID_COUNT
+} VulkanDynamicPhysicalDeviceFunctionId;
+
+#undef VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTION_ID
+
+#define VULKANDYNAMIC_DEVICE_FUNCTION_ID(function) VULKANDYNAMIC_DEVICE_FUNCTION_ID_##function,
+
+typedef enum VulkanDynamicDeviceFunctionId
+{
+    VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_DEVICE_FUNCTION_ID)
+    VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT
+} VulkanDynamicDeviceFunctionId;
+
+#undef VULKANDYNAMIC_DEVICE_FUNCTION_ID
+
+#define VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID(function) VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_##function,
+
+typedef enum VulkanDynamicCommandBufferFunctionId
+{
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID)
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_COUNT
+} VulkanDynamicCommandBufferFunctionId;
+
+#undef VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID
+
+// Returns the `vk*` name of an entry point, or NULL for an out-of-range identifier.
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VULKANDYNAMIC_API VKAPI_ATTR const char* VKAPI_CALL VulkanDynamicGetLoaderFunctionName(uint32_t functionId);
+VULKANDYNAMIC_API VKAPI_ATTR const char* VKAPI_CALL VulkanDynamicGetInstanceFunctionName(uint32_t functionId);
+VULKANDYNAMIC_API VKAPI_ATTR const char* VKAPI_CALL VulkanDynamicGetPhysicalDeviceFunctionName(uint32_t functionId);
+VULKANDYNAMIC_API VKAPI_ATTR const char* VKAPI_CALL VulkanDynamicGetDeviceFunctionName(uint32_t functionId);
+VULKANDYNAMIC_API VKAPI_ATTR const char* VKAPI_CALL VulkanDynamicGetCommandBufferFunctionName(uint32_t functionId);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_FUNCTIONS_H__
@@ -0,0 +1,2844 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_GLOBAL_H__
+#define __VULKANDYNAMIC_GLOBAL_H__
+
+// Global function compatibility mode: every `vk*` entry point is a static inline function
+// forwarding to a process-global dispatch table, so legacy call sites compile unchanged
+// and device calls still skip the loader trampoline. They are real functions, not macros:
+// `&vkCreateDevice` is a valid PFN_vkCreateDevice and later headers are left untouched.
+// Because the functions always exist, test the table entry (for example
+// `VulkanDynamicGlobalLoaderDispatch.EnumerateInstanceVersion`) rather than the `vk*` name
+// to find out whether an entry point was resolved. Initialize the loader, instance and
+// device tables in that order; define VULKANDYNAMIC_GLOBAL_NO_FUNCTIONS to keep only the
+// tables.
+
+#include "VulkanDynamic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+extern VulkanDynamicLoaderDispatch VulkanDynamicGlobalLoaderDispatch;
+extern VulkanDynamicInstanceDispatch VulkanDynamicGlobalInstanceDispatch;
+extern VulkanDynamicDeviceDispatch VulkanDynamicGlobalDeviceDispatch;
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInitializeGlobalLoaderDispatch(const VulkanDynamicLoader loader);
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInitializeGlobalInstanceDispatch(VkInstance instance);
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInitializeGlobalDeviceDispatch(VkDevice device);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicSetGlobalLoaderDispatch(const VulkanDynamicLoaderDispatch* loaderDispatch);
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicSetGlobalInstanceDispatch(const VulkanDynamicInstanceDispatch* instanceDispatch);
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicSetGlobalDeviceDispatch(const VulkanDynamicDeviceDispatch* deviceDispatch);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_GLOBAL_H__
+
+#if !defined(VULKANDYNAMIC_GLOBAL_NO_FUNCTIONS) && !defined(__VULKANDYNAMIC_GLOBAL_FUNCTIONS__)
+#define __VULKANDYNAMIC_GLOBAL_FUNCTIONS__
+
+#if defined(_MSC_VER)
+    #define VULKANDYNAMIC_INLINE __inline
+#else
+    #define VULKANDYNAMIC_INLINE inline
+#endif // _MSC_VER
+
+//---------------------------------------------------------------------------------------
+// Loader
+//---------------------------------------------------------------------------------------
+
+// Vulkan Core 1.0
+static VULKANDYNAMIC_INLINE VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName)
+{
+    return VulkanDynamicGlobalLoaderDispatch.GetInstanceProcAddr(instance, pName);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance)
+{
+    return VulkanDynamicGlobalLoaderDispatch.CreateInstance(pCreateInfo, pAllocator, pInstance);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties)
+{
+    return VulkanDynamicGlobalLoaderDispatch.EnumerateInstanceExtensionProperties(pLayerName, pPropertyCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties)
+{
+    return VulkanDynamicGlobalLoaderDispatch.EnumerateInstanceLayerProperties(pPropertyCount, pProperties);
+}
+
+// Vulkan Core 1.1
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceVersion(uint32_t* pApiVersion)
+{
+    return VulkanDynamicGlobalLoaderDispatch.EnumerateInstanceVersion(pApiVersion);
+}
+
+//---------------------------------------------------------------------------------------
+// Instance
+//---------------------------------------------------------------------------------------
+
+// Vulkan Core 1.0
+static VULKANDYNAMIC_INLINE VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char* pName)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetDeviceProcAddr(device, pName);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalInstanceDispatch.DestroyInstance(instance, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices)
+{
+    return VulkanDynamicGlobalInstanceDispatch.EnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceFeatures(physicalDevice, pFeatures);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceProperties(physicalDevice, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.EnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.EnumerateDeviceLayerProperties(physicalDevice, pPropertyCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+}
+
+// Vulkan Core 1.1
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDeviceGroups(VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.EnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2* pProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceProperties2(physicalDevice, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFormatProperties2(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2* pFormatProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceImageFormatProperties2(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo, VkImageFormatProperties2* pImageFormatProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceQueueFamilyProperties2(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2* pQueueFamilyProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceMemoryProperties2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceSparseImageFormatProperties2(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo, uint32_t* pPropertyCount, VkSparseImageFormatProperties2* pProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceExternalBufferProperties(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo, VkExternalBufferProperties* pExternalBufferProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceExternalFenceProperties(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo, VkExternalFenceProperties* pExternalFenceProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceExternalSemaphoreProperties(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo, VkExternalSemaphoreProperties* pExternalSemaphoreProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+}
+
+#if defined(VK_KHR_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalInstanceDispatch.DestroySurfaceKHR(instance, surface, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
+}
+#endif // VK_KHR_surface
+
+#if defined(VK_KHR_display)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDisplayPlaneSurfaceKHR(VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif // VK_KHR_display
+
+#if defined(VK_KHR_xlib_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display* dpy, VisualID visualID)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
+}
+#endif // VK_KHR_xlib_surface
+
+#if defined(VK_KHR_xcb_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceXcbPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, xcb_connection_t* connection, xcb_visualid_t visual_id)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
+}
+#endif // VK_KHR_xcb_surface
+
+#if defined(VK_KHR_wayland_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceWaylandPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct wl_display* display)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
+}
+#endif // VK_KHR_wayland_surface
+
+#if defined(VK_KHR_android_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif // VK_KHR_android_surface
+
+#if defined(VK_KHR_win32_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceWin32PresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
+}
+#endif // VK_KHR_win32_surface
+
+#if defined(VK_EXT_debug_report)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalInstanceDispatch.DestroyDebugReportCallbackEXT(instance, callback, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, const char* pLayerPrefix, const char* pMessage)
+{
+    VulkanDynamicGlobalInstanceDispatch.DebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+}
+#endif // VK_EXT_debug_report
+
+#if defined(VK_GGP_stream_descriptor_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateStreamDescriptorSurfaceGGP(VkInstance instance, const VkStreamDescriptorSurfaceCreateInfoGGP* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif // VK_GGP_stream_descriptor_surface
+
+#if defined(VK_NV_external_memory_capabilities)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceExternalImageFormatPropertiesNV(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkExternalMemoryHandleTypeFlagsNV externalHandleType, VkExternalImageFormatPropertiesNV* pExternalImageFormatProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
+}
+#endif // VK_NV_external_memory_capabilities
+
+#if defined(VK_KHR_get_physical_device_properties2)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFeatures2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2* pProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFormatProperties2KHR(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2* pFormatProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceImageFormatProperties2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo, VkImageFormatProperties2* pImageFormatProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceQueueFamilyProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2* pQueueFamilyProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceMemoryProperties2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceSparseImageFormatProperties2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo, uint32_t* pPropertyCount, VkSparseImageFormatProperties2* pProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+}
+#endif // VK_KHR_get_physical_device_properties2
+
+#if defined(VK_NN_vi_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateViSurfaceNN(VkInstance instance, const VkViSurfaceCreateInfoNN* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif // VK_NN_vi_surface
+
+#if defined(VK_KHR_device_group_creation)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDeviceGroupsKHR(VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.EnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+}
+#endif // VK_KHR_device_group_creation
+
+#if defined(VK_KHR_external_memory_capabilities)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceExternalBufferPropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo, VkExternalBufferProperties* pExternalBufferProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+}
+#endif // VK_KHR_external_memory_capabilities
+
+#if defined(VK_KHR_external_semaphore_capabilities)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo, VkExternalSemaphoreProperties* pExternalSemaphoreProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+}
+#endif // VK_KHR_external_semaphore_capabilities
+
+#if defined(VK_EXT_direct_mode_display)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkReleaseDisplayEXT(VkPhysicalDevice physicalDevice, VkDisplayKHR display)
+{
+    return VulkanDynamicGlobalInstanceDispatch.ReleaseDisplayEXT(physicalDevice, display);
+}
+#endif // VK_EXT_direct_mode_display
+
+#if defined(VK_EXT_acquire_xlib_display)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAcquireXlibDisplayEXT(VkPhysicalDevice physicalDevice, Display* dpy, VkDisplayKHR display)
+{
+    return VulkanDynamicGlobalInstanceDispatch.AcquireXlibDisplayEXT(physicalDevice, dpy, display);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetRandROutputDisplayEXT(VkPhysicalDevice physicalDevice, Display* dpy, RROutput rrOutput, VkDisplayKHR* pDisplay)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
+}
+#endif // VK_EXT_acquire_xlib_display
+
+#if defined(VK_EXT_display_surface_counter)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceCapabilities2EXT(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilities2EXT* pSurfaceCapabilities)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
+}
+#endif // VK_EXT_display_surface_counter
+
+#if defined(VK_KHR_external_fence_capabilities)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceExternalFencePropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo, VkExternalFenceProperties* pExternalFenceProperties)
+{
+    VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+}
+#endif // VK_KHR_external_fence_capabilities
+
+#if defined(VK_KHR_get_surface_capabilities2)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceCapabilities2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceFormats2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+}
+#endif // VK_KHR_get_surface_capabilities2
+
+#if defined(VK_KHR_get_display_properties2)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceDisplayProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayProperties2KHR* pProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceDisplayPlaneProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlaneProperties2KHR* pProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayModeProperties2KHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModeProperties2KHR* pProperties)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayPlaneCapabilities2KHR(VkPhysicalDevice physicalDevice, const VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo, VkDisplayPlaneCapabilities2KHR* pCapabilities)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
+}
+#endif // VK_KHR_get_display_properties2
+
+#if defined(VK_MVK_ios_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateIOSSurfaceMVK(VkInstance instance, const VkIOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif // VK_MVK_ios_surface
+
+#if defined(VK_MVK_macos_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateMacOSSurfaceMVK(VkInstance instance, const VkMacOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif // VK_MVK_macos_surface
+
+#if defined(VK_EXT_debug_utils)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkSetDebugUtilsObjectNameEXT(VkDevice device, const VkDebugUtilsObjectNameInfoEXT* pNameInfo)
+{
+    return VulkanDynamicGlobalInstanceDispatch.SetDebugUtilsObjectNameEXT(device, pNameInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkSetDebugUtilsObjectTagEXT(VkDevice device, const VkDebugUtilsObjectTagInfoEXT* pTagInfo)
+{
+    return VulkanDynamicGlobalInstanceDispatch.SetDebugUtilsObjectTagEXT(device, pTagInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkQueueBeginDebugUtilsLabelEXT(VkQueue queue, const VkDebugUtilsLabelEXT* pLabelInfo)
+{
+    VulkanDynamicGlobalInstanceDispatch.QueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkQueueEndDebugUtilsLabelEXT(VkQueue queue)
+{
+    VulkanDynamicGlobalInstanceDispatch.QueueEndDebugUtilsLabelEXT(queue);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkQueueInsertDebugUtilsLabelEXT(VkQueue queue, const VkDebugUtilsLabelEXT* pLabelInfo)
+{
+    VulkanDynamicGlobalInstanceDispatch.QueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo)
+{
+    VulkanDynamicGlobalInstanceDispatch.CmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer)
+{
+    VulkanDynamicGlobalInstanceDispatch.CmdEndDebugUtilsLabelEXT(commandBuffer);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo)
+{
+    VulkanDynamicGlobalInstanceDispatch.CmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDebugUtilsMessengerEXT(VkInstance instance, const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugUtilsMessengerEXT* pMessenger)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT messenger, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalInstanceDispatch.DestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkSubmitDebugUtilsMessageEXT(VkInstance instance, VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT messageTypes, const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData)
+{
+    VulkanDynamicGlobalInstanceDispatch.SubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
+}
+#endif // VK_EXT_debug_utils
+
+#if defined(VK_FUCHSIA_imagepipe_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateImagePipeSurfaceFUCHSIA(VkInstance instance, const VkImagePipeSurfaceCreateInfoFUCHSIA* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif // VK_FUCHSIA_imagepipe_surface
+
+#if defined(VK_EXT_metal_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateMetalSurfaceEXT(VkInstance instance, const VkMetalSurfaceCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif // VK_EXT_metal_surface
+
+#if defined(VK_EXT_headless_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateHeadlessSurfaceEXT(VkInstance instance, const VkHeadlessSurfaceCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif // VK_EXT_headless_surface
+
+#if defined(VK_EXT_acquire_drm_display)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAcquireDrmDisplayEXT(VkPhysicalDevice physicalDevice, int32_t drmFd, VkDisplayKHR display)
+{
+    return VulkanDynamicGlobalInstanceDispatch.AcquireDrmDisplayEXT(physicalDevice, drmFd, display);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDrmDisplayEXT(VkPhysicalDevice physicalDevice, int32_t drmFd, uint32_t connectorId, VkDisplayKHR* display)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetDrmDisplayEXT(physicalDevice, drmFd, connectorId, display);
+}
+#endif // VK_EXT_acquire_drm_display
+
+#if defined(VK_EXT_directfb_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDirectFBSurfaceEXT(VkInstance instance, const VkDirectFBSurfaceCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceDirectFBPresentationSupportEXT(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, IDirectFB* dfb)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
+}
+#endif // VK_EXT_directfb_surface
+
+#if defined(VK_QNX_screen_surface)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateScreenSurfaceQNX(VkInstance instance, const VkScreenSurfaceCreateInfoQNX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    return VulkanDynamicGlobalInstanceDispatch.CreateScreenSurfaceQNX(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceScreenPresentationSupportQNX(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct _screen_window* window)
+{
+    return VulkanDynamicGlobalInstanceDispatch.GetPhysicalDeviceScreenPresentationSupportQNX(physicalDevice, queueFamilyIndex, window);
+}
+#endif // VK_QNX_screen_surface
+
+//---------------------------------------------------------------------------------------
+// Device
+//---------------------------------------------------------------------------------------
+
+// Vulkan Core 1.0
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyDevice(device, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
+{
+    return VulkanDynamicGlobalDeviceDispatch.QueueSubmit(queue, submitCount, pSubmits, fence);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkQueueWaitIdle(VkQueue queue)
+{
+    return VulkanDynamicGlobalDeviceDispatch.QueueWaitIdle(queue);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkDeviceWaitIdle(VkDevice device)
+{
+    return VulkanDynamicGlobalDeviceDispatch.DeviceWaitIdle(device);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory)
+{
+    return VulkanDynamicGlobalDeviceDispatch.AllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.FreeMemory(device, memory, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
+{
+    return VulkanDynamicGlobalDeviceDispatch.MapMemory(device, memory, offset, size, flags, ppData);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkUnmapMemory(VkDevice device, VkDeviceMemory memory)
+{
+    VulkanDynamicGlobalDeviceDispatch.UnmapMemory(device, memory);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+    return VulkanDynamicGlobalDeviceDispatch.FlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+    return VulkanDynamicGlobalDeviceDispatch.InvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+    return VulkanDynamicGlobalDeviceDispatch.BindBufferMemory(device, buffer, memory, memoryOffset);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+    return VulkanDynamicGlobalDeviceDispatch.BindImageMemory(device, image, memory, memoryOffset);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetImageMemoryRequirements(device, image, pMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence)
+{
+    return VulkanDynamicGlobalDeviceDispatch.QueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateFence(device, pCreateInfo, pAllocator, pFence);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyFence(device, fence, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ResetFences(device, fenceCount, pFences);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetFenceStatus(VkDevice device, VkFence fence)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetFenceStatus(device, fence);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout)
+{
+    return VulkanDynamicGlobalDeviceDispatch.WaitForFences(device, fenceCount, pFences, waitAll, timeout);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroySemaphore(device, semaphore, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateEvent(device, pCreateInfo, pAllocator, pEvent);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyEvent(device, event, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetEventStatus(VkDevice device, VkEvent event)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetEventStatus(device, event);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkSetEvent(VkDevice device, VkEvent event)
+{
+    return VulkanDynamicGlobalDeviceDispatch.SetEvent(device, event);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkResetEvent(VkDevice device, VkEvent event)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ResetEvent(device, event);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyQueryPool(device, queryPool, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyBuffer(device, buffer, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateBufferView(device, pCreateInfo, pAllocator, pView);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyBufferView(device, bufferView, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateImage(device, pCreateInfo, pAllocator, pImage);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyImage(device, image, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetImageSubresourceLayout(device, image, pSubresource, pLayout);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateImageView(device, pCreateInfo, pAllocator, pView);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyImageView(device, imageView, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyShaderModule(device, shaderModule, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyPipelineCache(device, pipelineCache, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPipelineCacheData(device, pipelineCache, pDataSize, pData);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches)
+{
+    return VulkanDynamicGlobalDeviceDispatch.MergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyPipeline(device, pipeline, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyPipelineLayout(device, pipelineLayout, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateSampler(device, pCreateInfo, pAllocator, pSampler);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroySampler(device, sampler, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyDescriptorPool(device, descriptorPool, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ResetDescriptorPool(device, descriptorPool, flags);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets)
+{
+    return VulkanDynamicGlobalDeviceDispatch.AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets)
+{
+    return VulkanDynamicGlobalDeviceDispatch.FreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies)
+{
+    VulkanDynamicGlobalDeviceDispatch.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyFramebuffer(device, framebuffer, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyRenderPass(device, renderPass, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetRenderAreaGranularity(device, renderPass, pGranularity);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyCommandPool(device, commandPool, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ResetCommandPool(device, commandPool, flags);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers)
+{
+    return VulkanDynamicGlobalDeviceDispatch.AllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+    VulkanDynamicGlobalDeviceDispatch.FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.BeginCommandBuffer(commandBuffer, pBeginInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkEndCommandBuffer(VkCommandBuffer commandBuffer)
+{
+    return VulkanDynamicGlobalDeviceDispatch.EndCommandBuffer(commandBuffer);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ResetCommandBuffer(commandBuffer, flags);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetLineWidth(commandBuffer, lineWidth);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4])
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetBlendConstants(commandBuffer, blendConstants);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetStencilReference(commandBuffer, faceMask, reference);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetEvent(commandBuffer, event, stageMask);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdResetEvent(commandBuffer, event, stageMask);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBeginQuery(commandBuffer, queryPool, query, flags);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdEndQuery(commandBuffer, queryPool, query);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdNextSubpass(commandBuffer, contents);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEndRenderPass(VkCommandBuffer commandBuffer)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdEndRenderPass(commandBuffer);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+}
+
+// Vulkan Core 1.1
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkBindBufferMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo* pBindInfos)
+{
+    return VulkanDynamicGlobalDeviceDispatch.BindBufferMemory2(device, bindInfoCount, pBindInfos);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkBindImageMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo* pBindInfos)
+{
+    return VulkanDynamicGlobalDeviceDispatch.BindImageMemory2(device, bindInfoCount, pBindInfos);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDeviceGroupPeerMemoryFeatures(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags* pPeerMemoryFeatures)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetDeviceMask(commandBuffer, deviceMask);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetImageMemoryRequirements2(VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetBufferMemoryRequirements2(VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetImageSparseMemoryRequirements2(VkDevice device, const VkImageSparseMemoryRequirementsInfo2* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkTrimCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags)
+{
+    VulkanDynamicGlobalDeviceDispatch.TrimCommandPool(device, commandPool, flags);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDeviceQueue2(device, pQueueInfo, pQueue);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateSamplerYcbcrConversion(VkDevice device, const VkSamplerYcbcrConversionCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversion* pYcbcrConversion)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroySamplerYcbcrConversion(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorUpdateTemplate(VkDevice device, const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void* pData)
+{
+    VulkanDynamicGlobalDeviceDispatch.UpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDescriptorSetLayoutSupport(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupport* pSupport)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
+}
+
+// Vulkan Core 1.2
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfo* pSubpassBeginInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo, const VkSubpassEndInfo* pSubpassEndInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount)
+{
+    VulkanDynamicGlobalDeviceDispatch.ResetQueryPool(device, queryPool, firstQuery, queryCount);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t* pValue)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetSemaphoreCounterValue(device, semaphore, pValue);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout)
+{
+    return VulkanDynamicGlobalDeviceDispatch.WaitSemaphores(device, pWaitInfo, timeout);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkSignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.SignalSemaphore(device, pSignalInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkDeviceAddress VKAPI_CALL vkGetBufferDeviceAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetBufferDeviceAddress(device, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR uint64_t VKAPI_CALL vkGetBufferOpaqueCaptureAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetBufferOpaqueCaptureAddress(device, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR uint64_t VKAPI_CALL vkGetDeviceMemoryOpaqueCaptureAddress(VkDevice device, const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
+}
+
+#if defined(VK_KHR_swapchain)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroySwapchainKHR(device, swapchain, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.QueuePresentKHR(queue, pPresentInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex)
+{
+    return VulkanDynamicGlobalDeviceDispatch.AcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+}
+#endif // VK_KHR_swapchain
+
+#if defined(VK_KHR_display_swapchain)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+}
+#endif // VK_KHR_display_swapchain
+
+#if defined(VK_EXT_debug_marker)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkDebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarkerObjectTagInfoEXT* pTagInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.DebugMarkerSetObjectTagEXT(device, pTagInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkDebugMarkerSetObjectNameEXT(VkDevice device, const VkDebugMarkerObjectNameInfoEXT* pNameInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.DebugMarkerSetObjectNameEXT(device, pNameInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDebugMarkerEndEXT(commandBuffer);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+}
+#endif // VK_EXT_debug_marker
+
+#if defined(VK_KHR_video_queue)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceVideoCapabilitiesKHR(VkPhysicalDevice physicalDevice, const VkVideoProfileKHR* pVideoProfile, VkVideoCapabilitiesKHR* pCapabilities)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPhysicalDeviceVideoCapabilitiesKHR(physicalDevice, pVideoProfile, pCapabilities);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkUpdateVideoSessionParametersKHR(VkDevice device, VkVideoSessionParametersKHR videoSessionParameters, const VkVideoSessionParametersUpdateInfoKHR* pUpdateInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.UpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceVideoFormatPropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceVideoFormatInfoKHR* pVideoFormatInfo, uint32_t* pVideoFormatPropertyCount, VkVideoFormatPropertiesKHR* pVideoFormatProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPhysicalDeviceVideoFormatPropertiesKHR(physicalDevice, pVideoFormatInfo, pVideoFormatPropertyCount, pVideoFormatProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateVideoSessionParametersKHR(VkDevice device, const VkVideoSessionParametersCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkVideoSessionParametersKHR* pVideoSessionParameters)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateVideoSessionKHR(VkDevice device, const VkVideoSessionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkVideoSessionKHR* pVideoSession)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkBindVideoSessionMemoryKHR(VkDevice device, VkVideoSessionKHR videoSession, uint32_t videoSessionBindMemoryCount, const VkVideoBindMemoryKHR* pVideoSessionBindMemories)
+{
+    return VulkanDynamicGlobalDeviceDispatch.BindVideoSessionMemoryKHR(device, videoSession, videoSessionBindMemoryCount, pVideoSessionBindMemories);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyVideoSessionKHR(VkDevice device, VkVideoSessionKHR videoSession, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyVideoSessionKHR(device, videoSession, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetVideoSessionMemoryRequirementsKHR(VkDevice device, VkVideoSessionKHR videoSession, uint32_t* pVideoSessionMemoryRequirementsCount, VkVideoGetMemoryPropertiesKHR* pVideoSessionMemoryRequirements)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetVideoSessionMemoryRequirementsKHR(device, videoSession, pVideoSessionMemoryRequirementsCount, pVideoSessionMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyVideoSessionParametersKHR(VkDevice device, VkVideoSessionParametersKHR videoSessionParameters, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoBeginCodingInfoKHR* pBeginInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoEndCodingInfoKHR* pEndCodingInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdControlVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoCodingControlInfoKHR* pCodingControlInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
+}
+#endif // VK_KHR_video_queue
+
+#if defined(VK_KHR_video_decode_queue)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR* pFrameInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDecodeVideoKHR(commandBuffer, pFrameInfo);
+}
+#endif // VK_KHR_video_decode_queue
+
+#if defined(VK_EXT_transform_feedback)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndirectByteCountEXT(VkCommandBuffer commandBuffer, uint32_t instanceCount, uint32_t firstInstance, VkBuffer counterBuffer, VkDeviceSize counterBufferOffset, uint32_t counterOffset, uint32_t vertexStride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBindTransformFeedbackBuffersEXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBeginTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, uint32_t index)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags, uint32_t index)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
+}
+#endif // VK_EXT_transform_feedback
+
+#if defined(VK_NVX_binary_import)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateCuFunctionNVX(VkDevice device, const VkCuFunctionCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCuFunctionNVX* pFunction)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateCuModuleNVX(VkDevice device, const VkCuModuleCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCuModuleNVX* pModule)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, const VkCuLaunchInfoNVX* pLaunchInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyCuFunctionNVX(VkDevice device, VkCuFunctionNVX function, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyCuFunctionNVX(device, function, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyCuModuleNVX(VkDevice device, VkCuModuleNVX module, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyCuModuleNVX(device, module, pAllocator);
+}
+#endif // VK_NVX_binary_import
+
+#if defined(VK_NVX_image_view_handle)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR uint32_t VKAPI_CALL vkGetImageViewHandleNVX(VkDevice device, const VkImageViewHandleInfoNVX* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetImageViewHandleNVX(device, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetImageViewAddressNVX(VkDevice device, VkImageView imageView, VkImageViewAddressPropertiesNVX* pProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetImageViewAddressNVX(device, imageView, pProperties);
+}
+#endif // VK_NVX_image_view_handle
+
+#if defined(VK_AMD_draw_indirect_count)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+#endif // VK_AMD_draw_indirect_count
+
+#if defined(VK_AMD_shader_info)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetShaderInfoAMD(VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage, VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+}
+#endif // VK_AMD_shader_info
+
+#if defined(VK_KHR_dynamic_rendering)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEndRenderingKHR(VkCommandBuffer commandBuffer)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdEndRenderingKHR(commandBuffer);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfoKHR* pRenderingInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
+}
+#endif // VK_KHR_dynamic_rendering
+
+#if defined(VK_NV_external_memory_win32)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetMemoryWin32HandleNV(VkDevice device, VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE* pHandle)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetMemoryWin32HandleNV(device, memory, handleType, pHandle);
+}
+#endif // VK_NV_external_memory_win32
+
+#if defined(VK_KHR_device_group)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDeviceGroupPeerMemoryFeaturesKHR(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags* pPeerMemoryFeatures)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetDeviceMaskKHR(commandBuffer, deviceMask);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+}
+#endif // VK_KHR_device_group
+
+#if defined(VK_KHR_maintenance1)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkTrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags)
+{
+    VulkanDynamicGlobalDeviceDispatch.TrimCommandPoolKHR(device, commandPool, flags);
+}
+#endif // VK_KHR_maintenance1
+
+#if defined(VK_KHR_external_memory_win32)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetMemoryWin32HandleKHR(VkDevice device, const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetMemoryWin32HandlePropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, HANDLE handle, VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
+}
+#endif // VK_KHR_external_memory_win32
+
+#if defined(VK_KHR_external_memory_fd)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetMemoryFdKHR(device, pGetFdInfo, pFd);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
+}
+#endif // VK_KHR_external_memory_fd
+
+#if defined(VK_KHR_external_semaphore_win32)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkImportSemaphoreWin32HandleKHR(VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreWin32HandleKHR(VkDevice device, const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+}
+#endif // VK_KHR_external_semaphore_win32
+
+#if defined(VK_KHR_external_semaphore_fd)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkImportSemaphoreFdKHR(VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetSemaphoreFdKHR(device, pGetFdInfo, pFd);
+}
+#endif // VK_KHR_external_semaphore_fd
+
+#if defined(VK_KHR_push_descriptor)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+}
+#endif // VK_KHR_push_descriptor
+
+#if defined(VK_EXT_conditional_rendering)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdEndConditionalRenderingEXT(commandBuffer);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBeginConditionalRenderingEXT(VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
+}
+#endif // VK_EXT_conditional_rendering
+
+#if defined(VK_KHR_descriptor_update_template)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorUpdateTemplateKHR(VkDevice device, const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void* pData)
+{
+    VulkanDynamicGlobalDeviceDispatch.UpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
+}
+#endif // VK_KHR_descriptor_update_template
+
+#if defined(VK_NV_clip_space_w_scaling)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV* pViewportWScalings)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+}
+#endif // VK_NV_clip_space_w_scaling
+
+#if defined(VK_EXT_display_control)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkDisplayPowerControlEXT(VkDevice device, VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.DisplayPowerControlEXT(device, display, pDisplayPowerInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkRegisterDeviceEventEXT(VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
+{
+    return VulkanDynamicGlobalDeviceDispatch.RegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkRegisterDisplayEventEXT(VkDevice device, VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
+{
+    return VulkanDynamicGlobalDeviceDispatch.RegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
+}
+#endif // VK_EXT_display_control
+
+#if defined(VK_GOOGLE_display_timing)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetRefreshCycleDurationGOOGLE(VkDevice device, VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPastPresentationTimingGOOGLE(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pPresentationTimingCount, VkPastPresentationTimingGOOGLE* pPresentationTimings)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+}
+#endif // VK_GOOGLE_display_timing
+
+#if defined(VK_EXT_discard_rectangles)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+}
+#endif // VK_EXT_discard_rectangles
+
+#if defined(VK_EXT_hdr_metadata)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkSetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata)
+{
+    VulkanDynamicGlobalDeviceDispatch.SetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
+}
+#endif // VK_EXT_hdr_metadata
+
+#if defined(VK_KHR_create_renderpass2)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo, const VkSubpassEndInfo* pSubpassEndInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfo* pSubpassBeginInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+}
+#endif // VK_KHR_create_renderpass2
+
+#if defined(VK_KHR_shared_presentable_image)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainStatusKHR(VkDevice device, VkSwapchainKHR swapchain)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetSwapchainStatusKHR(device, swapchain);
+}
+#endif // VK_KHR_shared_presentable_image
+
+#if defined(VK_KHR_external_fence_win32)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkImportFenceWin32HandleKHR(VkDevice device, const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetFenceWin32HandleKHR(VkDevice device, const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+}
+#endif // VK_KHR_external_fence_win32
+
+#if defined(VK_KHR_external_fence_fd)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ImportFenceFdKHR(device, pImportFenceFdInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetFenceFdKHR(device, pGetFdInfo, pFd);
+}
+#endif // VK_KHR_external_fence_fd
+
+#if defined(VK_KHR_performance_query)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, uint32_t* pCounterCount, VkPerformanceCounterKHR* pCounters, VkPerformanceCounterDescriptionKHR* pCounterDescriptions)
+{
+    return VulkanDynamicGlobalDeviceDispatch.EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAcquireProfilingLockKHR(VkDevice device, const VkAcquireProfilingLockInfoKHR* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.AcquireProfilingLockKHR(device, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(VkPhysicalDevice physicalDevice, const VkQueryPoolPerformanceCreateInfoKHR* pPerformanceQueryCreateInfo, uint32_t* pNumPasses)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkReleaseProfilingLockKHR(VkDevice device)
+{
+    VulkanDynamicGlobalDeviceDispatch.ReleaseProfilingLockKHR(device);
+}
+#endif // VK_KHR_performance_query
+
+#if defined(VK_ANDROID_external_memory_android_hardware_buffer)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetAndroidHardwareBufferPropertiesANDROID(VkDevice device, const struct AHardwareBuffer* buffer, VkAndroidHardwareBufferPropertiesANDROID* pProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetMemoryAndroidHardwareBufferANDROID(VkDevice device, const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo, struct AHardwareBuffer** pBuffer)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
+}
+#endif // VK_ANDROID_external_memory_android_hardware_buffer
+
+#if defined(VK_EXT_sample_locations)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceMultisamplePropertiesEXT(VkPhysicalDevice physicalDevice, VkSampleCountFlagBits samples, VkMultisamplePropertiesEXT* pMultisampleProperties)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
+}
+#endif // VK_EXT_sample_locations
+
+#if defined(VK_KHR_get_memory_requirements2)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetImageMemoryRequirements2KHR(VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetBufferMemoryRequirements2KHR(VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetImageSparseMemoryRequirements2KHR(VkDevice device, const VkImageSparseMemoryRequirementsInfo2* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+#endif // VK_KHR_get_memory_requirements2
+
+#if defined(VK_KHR_acceleration_structure)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateAccelerationStructureKHR(VkDevice device, const VkAccelerationStructureCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureKHR* pAccelerationStructure)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyAccelerationStructureKHR(VkDevice device, VkAccelerationStructureKHR accelerationStructure, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCopyAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureInfoKHR* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CopyAccelerationStructureKHR(device, deferredOperation, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkBuildAccelerationStructuresKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos)
+{
+    return VulkanDynamicGlobalDeviceDispatch.BuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdWriteAccelerationStructuresPropertiesKHR(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBuildAccelerationStructuresIndirectKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkDeviceAddress* pIndirectDeviceAddresses, const uint32_t* pIndirectStrides, const uint32_t* const* ppMaxPrimitiveCounts)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCopyMemoryToAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCopyAccelerationStructureToMemoryKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkWriteAccelerationStructuresPropertiesKHR(VkDevice device, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkQueryType queryType, size_t dataSize, void* pData, size_t stride)
+{
+    return VulkanDynamicGlobalDeviceDispatch.WriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureInfoKHR* pInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyAccelerationStructureToMemoryKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkDeviceAddress VKAPI_CALL vkGetAccelerationStructureDeviceAddressKHR(VkDevice device, const VkAccelerationStructureDeviceAddressInfoKHR* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetAccelerationStructureDeviceAddressKHR(device, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDeviceAccelerationStructureCompatibilityKHR(VkDevice device, const VkAccelerationStructureVersionInfoKHR* pVersionInfo, VkAccelerationStructureCompatibilityKHR* pCompatibility)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetAccelerationStructureBuildSizesKHR(VkDevice device, VkAccelerationStructureBuildTypeKHR buildType, const VkAccelerationStructureBuildGeometryInfoKHR* pBuildInfo, const uint32_t* pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR* pSizeInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
+}
+#endif // VK_KHR_acceleration_structure
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdTraceRaysKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, uint32_t width, uint32_t height, uint32_t depth)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetRayTracingShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateRayTracingPipelinesKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkDeviceSize VKAPI_CALL vkGetRayTracingShaderGroupStackSizeKHR(VkDevice device, VkPipeline pipeline, uint32_t group, VkShaderGroupShaderKHR groupShader)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer, uint32_t pipelineStackSize)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
+}
+#endif // VK_KHR_ray_tracing_pipeline
+
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateSamplerYcbcrConversionKHR(VkDevice device, const VkSamplerYcbcrConversionCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversion* pYcbcrConversion)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
+}
+#endif // VK_KHR_sampler_ycbcr_conversion
+
+#if defined(VK_KHR_bind_memory2)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo* pBindInfos)
+{
+    return VulkanDynamicGlobalDeviceDispatch.BindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkBindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo* pBindInfos)
+{
+    return VulkanDynamicGlobalDeviceDispatch.BindImageMemory2KHR(device, bindInfoCount, pBindInfos);
+}
+#endif // VK_KHR_bind_memory2
+
+#if defined(VK_EXT_image_drm_format_modifier)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetImageDrmFormatModifierPropertiesEXT(VkDevice device, VkImage image, VkImageDrmFormatModifierPropertiesEXT* pProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
+}
+#endif // VK_EXT_image_drm_format_modifier
+
+#if defined(VK_EXT_validation_cache)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize, void* pData)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetValidationCacheDataEXT(device, validationCache, pDataSize, pData);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkValidationCacheEXT* pValidationCache)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateValidationCacheEXT(device, pCreateInfo, pAllocator, pValidationCache);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyValidationCacheEXT(device, validationCache, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkMergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount, const VkValidationCacheEXT* pSrcCaches)
+{
+    return VulkanDynamicGlobalDeviceDispatch.MergeValidationCachesEXT(device, dstCache, srcCacheCount, pSrcCaches);
+}
+#endif // VK_EXT_validation_cache
+
+#if defined(VK_NV_shading_rate_image)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuffer, VkCoarseSampleOrderTypeNV sampleOrderType, uint32_t customSampleOrderCount, const VkCoarseSampleOrderCustomNV* pCustomSampleOrders)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetViewportShadingRatePaletteNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkShadingRatePaletteNV* pShadingRatePalettes)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+}
+#endif // VK_NV_shading_rate_image
+
+#if defined(VK_NV_ray_tracing)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateRayTracingPipelinesNV(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateAccelerationStructureNV(VkDevice device, const VkAccelerationStructureCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureNV* pAccelerationStructure)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkBindAccelerationStructureMemoryNV(VkDevice device, uint32_t bindInfoCount, const VkBindAccelerationStructureMemoryInfoNV* pBindInfos)
+{
+    return VulkanDynamicGlobalDeviceDispatch.BindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyAccelerationStructureNV(VkDevice device, VkAccelerationStructureNV accelerationStructure, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkCopyAccelerationStructureModeKHR mode)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetAccelerationStructureMemoryRequirementsNV(VkDevice device, const VkAccelerationStructureMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBuildAccelerationStructureNV(VkCommandBuffer commandBuffer, const VkAccelerationStructureInfoNV* pInfo, VkBuffer instanceData, VkDeviceSize instanceOffset, VkBool32 update, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkBuffer scratch, VkDeviceSize scratchOffset)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffer raygenShaderBindingTableBuffer, VkDeviceSize raygenShaderBindingOffset, VkBuffer missShaderBindingTableBuffer, VkDeviceSize missShaderBindingOffset, VkDeviceSize missShaderBindingStride, VkBuffer hitShaderBindingTableBuffer, VkDeviceSize hitShaderBindingOffset, VkDeviceSize hitShaderBindingStride, VkBuffer callableShaderBindingTableBuffer, VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride, uint32_t width, uint32_t height, uint32_t depth)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetRayTracingShaderGroupHandlesNV(VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetAccelerationStructureHandleNV(VkDevice device, VkAccelerationStructureNV accelerationStructure, size_t dataSize, void* pData)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdWriteAccelerationStructuresPropertiesNV(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureNV* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCompileDeferredNV(VkDevice device, VkPipeline pipeline, uint32_t shader)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CompileDeferredNV(device, pipeline, shader);
+}
+#endif // VK_NV_ray_tracing
+
+#if defined(VK_KHR_maintenance3)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDescriptorSetLayoutSupportKHR(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupport* pSupport)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
+}
+#endif // VK_KHR_maintenance3
+
+#if defined(VK_KHR_draw_indirect_count)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexedIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+#endif // VK_KHR_draw_indirect_count
+
+#if defined(VK_EXT_external_memory_host)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetMemoryHostPointerPropertiesEXT(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+}
+#endif // VK_EXT_external_memory_host
+
+#if defined(VK_AMD_buffer_marker)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+}
+#endif // VK_AMD_buffer_marker
+
+#if defined(VK_EXT_calibrated_timestamps)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(VkPhysicalDevice physicalDevice, uint32_t* pTimeDomainCount, VkTimeDomainEXT* pTimeDomains)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetCalibratedTimestampsEXT(VkDevice device, uint32_t timestampCount, const VkCalibratedTimestampInfoEXT* pTimestampInfos, uint64_t* pTimestamps, uint64_t* pMaxDeviation)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+}
+#endif // VK_EXT_calibrated_timestamps
+
+#if defined(VK_NV_mesh_shader)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount, uint32_t firstTask)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawMeshTasksIndirectCountNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+#endif // VK_NV_mesh_shader
+
+#if defined(VK_NV_scissor_exclusive)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor, uint32_t exclusiveScissorCount, const VkRect2D* pExclusiveScissors)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+}
+#endif // VK_NV_scissor_exclusive
+
+#if defined(VK_NV_device_diagnostic_checkpoints)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void* pCheckpointMarker)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetQueueCheckpointDataNV(VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointDataNV* pCheckpointData)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
+}
+#endif // VK_NV_device_diagnostic_checkpoints
+
+#if defined(VK_KHR_timeline_semaphore)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore semaphore, uint64_t* pValue)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetSemaphoreCounterValueKHR(device, semaphore, pValue);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkSignalSemaphoreKHR(VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.SignalSemaphoreKHR(device, pSignalInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout)
+{
+    return VulkanDynamicGlobalDeviceDispatch.WaitSemaphoresKHR(device, pWaitInfo, timeout);
+}
+#endif // VK_KHR_timeline_semaphore
+
+#if defined(VK_INTEL_performance_query)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkInitializePerformanceApiINTEL(VkDevice device, const VkInitializePerformanceApiInfoINTEL* pInitializeInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.InitializePerformanceApiINTEL(device, pInitializeInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkUninitializePerformanceApiINTEL(VkDevice device)
+{
+    VulkanDynamicGlobalDeviceDispatch.UninitializePerformanceApiINTEL(device);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAcquirePerformanceConfigurationINTEL(VkDevice device, const VkPerformanceConfigurationAcquireInfoINTEL* pAcquireInfo, VkPerformanceConfigurationINTEL* pConfiguration)
+{
+    return VulkanDynamicGlobalDeviceDispatch.AcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCmdSetPerformanceStreamMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceStreamMarkerInfoINTEL* pMarkerInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCmdSetPerformanceMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceMarkerInfoINTEL* pMarkerInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCmdSetPerformanceOverrideINTEL(VkCommandBuffer commandBuffer, const VkPerformanceOverrideInfoINTEL* pOverrideInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkQueueSetPerformanceConfigurationINTEL(VkQueue queue, VkPerformanceConfigurationINTEL configuration)
+{
+    return VulkanDynamicGlobalDeviceDispatch.QueueSetPerformanceConfigurationINTEL(queue, configuration);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkReleasePerformanceConfigurationINTEL(VkDevice device, VkPerformanceConfigurationINTEL configuration)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ReleasePerformanceConfigurationINTEL(device, configuration);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPerformanceParameterINTEL(VkDevice device, VkPerformanceParameterTypeINTEL parameter, VkPerformanceValueINTEL* pValue)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPerformanceParameterINTEL(device, parameter, pValue);
+}
+#endif // VK_INTEL_performance_query
+
+#if defined(VK_AMD_display_native_hdr)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkSetLocalDimmingAMD(VkDevice device, VkSwapchainKHR swapChain, VkBool32 localDimmingEnable)
+{
+    VulkanDynamicGlobalDeviceDispatch.SetLocalDimmingAMD(device, swapChain, localDimmingEnable);
+}
+#endif // VK_AMD_display_native_hdr
+
+#if defined(VK_KHR_fragment_shading_rate)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceFragmentShadingRatesKHR(VkPhysicalDevice physicalDevice, uint32_t* pFragmentShadingRateCount, VkPhysicalDeviceFragmentShadingRateKHR* pFragmentShadingRates)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetFragmentShadingRateKHR(VkCommandBuffer commandBuffer, const VkExtent2D* pFragmentSize, const VkFragmentShadingRateCombinerOpKHR combinerOps[2])
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
+}
+#endif // VK_KHR_fragment_shading_rate
+
+#if defined(VK_EXT_buffer_device_address)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkDeviceAddress VKAPI_CALL vkGetBufferDeviceAddressEXT(VkDevice device, const VkBufferDeviceAddressInfo* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetBufferDeviceAddressEXT(device, pInfo);
+}
+#endif // VK_EXT_buffer_device_address
+
+#if defined(VK_EXT_tooling_info)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceToolPropertiesEXT(VkPhysicalDevice physicalDevice, uint32_t* pToolCount, VkPhysicalDeviceToolPropertiesEXT* pToolProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
+}
+#endif // VK_EXT_tooling_info
+
+#if defined(VK_KHR_present_wait)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkWaitForPresentKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout)
+{
+    return VulkanDynamicGlobalDeviceDispatch.WaitForPresentKHR(device, swapchain, presentId, timeout);
+}
+#endif // VK_KHR_present_wait
+
+#if defined(VK_NV_cooperative_matrix)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkCooperativeMatrixPropertiesNV* pProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
+}
+#endif // VK_NV_cooperative_matrix
+
+#if defined(VK_NV_coverage_reduction_mode)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(VkPhysicalDevice physicalDevice, uint32_t* pCombinationCount, VkFramebufferMixedSamplesCombinationNV* pCombinations)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
+}
+#endif // VK_NV_coverage_reduction_mode
+
+#if defined(VK_EXT_full_screen_exclusive)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfacePresentModes2EXT(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAcquireFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain)
+{
+    return VulkanDynamicGlobalDeviceDispatch.AcquireFullScreenExclusiveModeEXT(device, swapchain);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkReleaseFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ReleaseFullScreenExclusiveModeEXT(device, swapchain);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDeviceGroupSurfacePresentModes2EXT(VkDevice device, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkDeviceGroupPresentModeFlagsKHR* pModes)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
+}
+#endif // VK_EXT_full_screen_exclusive
+
+#if defined(VK_KHR_buffer_device_address)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR uint64_t VKAPI_CALL vkGetDeviceMemoryOpaqueCaptureAddressKHR(VkDevice device, const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkDeviceAddress VKAPI_CALL vkGetBufferDeviceAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetBufferDeviceAddressKHR(device, pInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR uint64_t VKAPI_CALL vkGetBufferOpaqueCaptureAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo* pInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetBufferOpaqueCaptureAddressKHR(device, pInfo);
+}
+#endif // VK_KHR_buffer_device_address
+
+#if defined(VK_EXT_line_rasterization)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor, uint16_t lineStipplePattern)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
+}
+#endif // VK_EXT_line_rasterization
+
+#if defined(VK_EXT_host_query_reset)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount)
+{
+    VulkanDynamicGlobalDeviceDispatch.ResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
+}
+#endif // VK_EXT_host_query_reset
+
+#if defined(VK_EXT_extended_dynamic_state)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetCullModeEXT(commandBuffer, cullMode);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes, const VkDeviceSize* pStrides)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetFrontFaceEXT(commandBuffer, frontFace);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport* pViewports)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+}
+#endif // VK_EXT_extended_dynamic_state
+
+#if defined(VK_KHR_deferred_host_operations)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkDeferredOperationJoinKHR(VkDevice device, VkDeferredOperationKHR operation)
+{
+    return VulkanDynamicGlobalDeviceDispatch.DeferredOperationJoinKHR(device, operation);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateDeferredOperationKHR(VkDevice device, const VkAllocationCallbacks* pAllocator, VkDeferredOperationKHR* pDeferredOperation)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyDeferredOperationKHR(VkDevice device, VkDeferredOperationKHR operation, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyDeferredOperationKHR(device, operation, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDeferredOperationResultKHR(VkDevice device, VkDeferredOperationKHR operation)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetDeferredOperationResultKHR(device, operation);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR uint32_t VKAPI_CALL vkGetDeferredOperationMaxConcurrencyKHR(VkDevice device, VkDeferredOperationKHR operation)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetDeferredOperationMaxConcurrencyKHR(device, operation);
+}
+#endif // VK_KHR_deferred_host_operations
+
+#if defined(VK_KHR_pipeline_executable_properties)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPipelineExecutableInternalRepresentationsKHR(VkDevice device, const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pInternalRepresentationCount, VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPipelineExecutablePropertiesKHR(VkDevice device, const VkPipelineInfoKHR* pPipelineInfo, uint32_t* pExecutableCount, VkPipelineExecutablePropertiesKHR* pProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPipelineExecutableStatisticsKHR(VkDevice device, const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pStatisticCount, VkPipelineExecutableStatisticKHR* pStatistics)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
+}
+#endif // VK_KHR_pipeline_executable_properties
+
+#if defined(VK_NV_device_generated_commands)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyIndirectCommandsLayoutNV(VkDevice device, VkIndirectCommandsLayoutNV indirectCommandsLayout, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetGeneratedCommandsMemoryRequirementsNV(VkDevice device, const VkGeneratedCommandsMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2* pMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdPreprocessGeneratedCommandsNV(VkCommandBuffer commandBuffer, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline, uint32_t groupIndex)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateIndirectCommandsLayoutNV(VkDevice device, const VkIndirectCommandsLayoutCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkIndirectCommandsLayoutNV* pIndirectCommandsLayout)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+}
+#endif // VK_NV_device_generated_commands
+
+#if defined(VK_EXT_private_data)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkSetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t data)
+{
+    return VulkanDynamicGlobalDeviceDispatch.SetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreatePrivateDataSlotEXT(VkDevice device, const VkPrivateDataSlotCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPrivateDataSlotEXT* pPrivateDataSlot)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyPrivateDataSlotEXT(VkDevice device, VkPrivateDataSlotEXT privateDataSlot, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t* pData)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
+}
+#endif // VK_EXT_private_data
+
+#if defined(VK_KHR_video_encode_queue)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR* pEncodeInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
+}
+#endif // VK_KHR_video_encode_queue
+
+#if defined(VK_KHR_synchronization2)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfoKHR* pDependencyInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* pDependencyInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2KHR stageMask)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdResetEvent2KHR(commandBuffer, event, stageMask);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetQueueCheckpointData2NV(VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointData2NV* pCheckpointData)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, const VkDependencyInfoKHR* pDependencyInfos)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkQueryPool queryPool, uint32_t query)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits, VkFence fence)
+{
+    return VulkanDynamicGlobalDeviceDispatch.QueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
+}
+#endif // VK_KHR_synchronization2
+
+#if defined(VK_NV_fragment_shading_rate_enums)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetFragmentShadingRateEnumNV(VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate, const VkFragmentShadingRateCombinerOpKHR combinerOps[2])
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
+}
+#endif // VK_NV_fragment_shading_rate_enums
+
+#if defined(VK_KHR_copy_commands2)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR* pCopyBufferInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyImage2KHR(VkCommandBuffer commandBuffer, const VkCopyImageInfo2KHR* pCopyImageInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2KHR* pCopyBufferToImageInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2KHR* pCopyImageToBufferInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBlitImage2KHR(VkCommandBuffer commandBuffer, const VkBlitImageInfo2KHR* pBlitImageInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdResolveImage2KHR(VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR* pResolveImageInfo)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
+}
+#endif // VK_KHR_copy_commands2
+
+#if defined(VK_NV_acquire_winrt_display)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAcquireWinrtDisplayNV(VkPhysicalDevice physicalDevice, VkDisplayKHR display)
+{
+    return VulkanDynamicGlobalDeviceDispatch.AcquireWinrtDisplayNV(physicalDevice, display);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetWinrtDisplayNV(VkPhysicalDevice physicalDevice, uint32_t deviceRelativeId, VkDisplayKHR* pDisplay)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetWinrtDisplayNV(physicalDevice, deviceRelativeId, pDisplay);
+}
+#endif // VK_NV_acquire_winrt_display
+
+#if defined(VK_EXT_vertex_input_dynamic_state)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetVertexInputEXT(VkCommandBuffer commandBuffer, uint32_t vertexBindingDescriptionCount, const VkVertexInputBindingDescription2EXT* pVertexBindingDescriptions, uint32_t vertexAttributeDescriptionCount, const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+}
+#endif // VK_EXT_vertex_input_dynamic_state
+
+#if defined(VK_FUCHSIA_external_memory)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetMemoryZirconHandleFUCHSIA(VkDevice device, const VkMemoryGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo, zx_handle_t* pZirconHandle)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetMemoryZirconHandlePropertiesFUCHSIA(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, zx_handle_t zirconHandle, VkMemoryZirconHandlePropertiesFUCHSIA* pMemoryZirconHandleProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
+}
+#endif // VK_FUCHSIA_external_memory
+
+#if defined(VK_FUCHSIA_external_semaphore)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkImportSemaphoreZirconHandleFUCHSIA(VkDevice device, const VkImportSemaphoreZirconHandleInfoFUCHSIA* pImportSemaphoreZirconHandleInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.ImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreZirconHandleFUCHSIA(VkDevice device, const VkSemaphoreGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo, zx_handle_t* pZirconHandle)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+}
+#endif // VK_FUCHSIA_external_semaphore
+
+#if defined(VK_FUCHSIA_buffer_collection)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkCreateBufferCollectionFUCHSIA(VkDevice device, const VkBufferCollectionCreateInfoFUCHSIA* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferCollectionFUCHSIA* pCollection)
+{
+    return VulkanDynamicGlobalDeviceDispatch.CreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkSetBufferCollectionImageConstraintsFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, const VkImageConstraintsInfoFUCHSIA* pImageConstraintsInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.SetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkDestroyBufferCollectionFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, const VkAllocationCallbacks* pAllocator)
+{
+    VulkanDynamicGlobalDeviceDispatch.DestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkSetBufferCollectionBufferConstraintsFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, const VkBufferConstraintsInfoFUCHSIA* pBufferConstraintsInfo)
+{
+    return VulkanDynamicGlobalDeviceDispatch.SetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetBufferCollectionPropertiesFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, VkBufferCollectionPropertiesFUCHSIA* pProperties)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
+}
+#endif // VK_FUCHSIA_buffer_collection
+
+#if defined(VK_HUAWEI_subpass_shading)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(VkDevice device, VkRenderPass renderpass, VkExtent2D* pMaxWorkgroupSize)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSubpassShadingHUAWEI(commandBuffer);
+}
+#endif // VK_HUAWEI_subpass_shading
+
+#if defined(VK_HUAWEI_invocation_mask)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
+}
+#endif // VK_HUAWEI_invocation_mask
+
+#if defined(VK_NV_external_memory_rdma)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetMemoryRemoteAddressNV(VkDevice device, const VkMemoryGetRemoteAddressInfoNV* pMemoryGetRemoteAddressInfo, VkRemoteAddressNV* pAddress)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
+}
+#endif // VK_NV_external_memory_rdma
+
+#if defined(VK_EXT_extended_dynamic_state2)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer, uint32_t patchControlPoints)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetLogicOpEXT(commandBuffer, logicOp);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
+}
+#endif // VK_EXT_extended_dynamic_state2
+
+#if defined(VK_EXT_color_write_enable)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkBool32* pColorWriteEnables)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
+}
+#endif // VK_EXT_color_write_enable
+
+#if defined(VK_EXT_multi_draw)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawIndexedInfoEXT* pIndexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride, const int32_t* pVertexOffset)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
+}
+#endif // VK_EXT_multi_draw
+
+#if defined(VK_EXT_pageable_device_local_memory)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkSetDeviceMemoryPriorityEXT(VkDevice device, VkDeviceMemory memory, float priority)
+{
+    VulkanDynamicGlobalDeviceDispatch.SetDeviceMemoryPriorityEXT(device, memory, priority);
+}
+#endif // VK_EXT_pageable_device_local_memory
+
+#if defined(VK_KHR_maintenance4)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDeviceBufferMemoryRequirementsKHR(VkDevice device, const VkDeviceBufferMemoryRequirementsKHR* pInfo, VkMemoryRequirements2* pMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDeviceImageSparseMemoryRequirementsKHR(VkDevice device, const VkDeviceImageMemoryRequirementsKHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkGetDeviceImageMemoryRequirementsKHR(VkDevice device, const VkDeviceImageMemoryRequirementsKHR* pInfo, VkMemoryRequirements2* pMemoryRequirements)
+{
+    VulkanDynamicGlobalDeviceDispatch.GetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
+}
+#endif // VK_KHR_maintenance4
+
+#if defined(VK_KHR_device_group) || defined(VK_KHR_swapchain)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDeviceGroupPresentCapabilitiesKHR(VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetDeviceGroupSurfacePresentModesKHR(VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR* pModes)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDevicePresentRectanglesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pRectCount, VkRect2D* pRects)
+{
+    return VulkanDynamicGlobalDeviceDispatch.GetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
+}
+
+static VULKANDYNAMIC_INLINE VKAPI_ATTR VkResult VKAPI_CALL vkAcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex)
+{
+    return VulkanDynamicGlobalDeviceDispatch.AcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
+}
+#endif // VK_KHR_device_group || VK_KHR_swapchain
+
+#if defined(VK_KHR_push_descriptor) || defined(VK_KHR_descriptor_update_template)
+static VULKANDYNAMIC_INLINE VKAPI_ATTR void VKAPI_CALL vkCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplate descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void* pData)
+{
+    VulkanDynamicGlobalDeviceDispatch.CmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+}
+#endif // VK_KHR_push_descriptor || VK_KHR_descriptor_update_template
+
+#endif // !VULKANDYNAMIC_GLOBAL_NO_FUNCTIONS
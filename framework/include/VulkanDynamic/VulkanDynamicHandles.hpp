@@ -0,0 +1,439 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_HANDLES_HPP__
+#define __VULKANDYNAMIC_HANDLES_HPP__
+
+#include "VulkanDynamic.hpp"
+#include "VulkanDynamicFunctions.h"
+
+#include <type_traits>
+#include <utility>
+
+// Declares an inline member forwarding to the dispatch table with the wrapped handle bound
+// as the first argument. Entry points whose first parameter is not the wrapped handle type
+// are removed from overload resolution.
+#define VULKANDYNAMIC_HANDLE_FORWARD_FUNCTION(function) \
+    template<typename... Args> \
+    auto function(Args&&... args) const -> decltype(::std::declval<const Dispatch&>().function(::std::declval<const Handle&>(), ::std::forward<Args>(args)...)) \
+    { \
+        return dispatch_->function(handle_, ::std::forward<Args>(args)...); \
+    }
+
+// Forwarder for the owning Instance and Device wrappers. Their destructors destroy the
+// wrapped handle, so DestroyInstance and DestroyDevice are not forwarded: calling either
+// through the wrapper would destroy the handle twice.
+#define VULKANDYNAMIC_OWNING_HANDLE_FORWARD_FUNCTION(function) \
+    template<typename... Args> \
+    auto function(Args&&... args) const -> typename ::std::enable_if<::VulkanDynamic::Detail::IsForwardedByOwner(#function), \
+        decltype(::std::declval<const Dispatch&>().function(::std::declval<const Handle&>(), ::std::forward<Args>(args)...))>::type \
+    { \
+        return dispatch_->function(handle_, ::std::forward<Args>(args)...); \
+    }
+
+namespace VulkanDynamic
+{
+    namespace Detail
+    {
+        constexpr bool StringEqual(const char* left, const char* right) noexcept
+        {
+            return *left == *right && (*left == '\0' || StringEqual(left + 1, right + 1));
+        }
+
+        constexpr bool IsForwardedByOwner(const char* function) noexcept
+        {
+            return !StringEqual(function, "DestroyInstance") && !StringEqual(function, "DestroyDevice");
+        }
+
+        // Handle paired with the dispatch table of its tier. The table is referenced, not
+        // copied: it has to outlive every handle constructed from it.
+        template<typename HandleType, typename DispatchType>
+        class DispatchHandle
+        {
+        public:
+            using Handle = HandleType;
+            using Dispatch = DispatchType;
+
+            explicit operator bool() const noexcept
+            {
+                return handle_ != VK_NULL_HANDLE;
+            }
+
+            operator Handle() const noexcept
+            {
+                return handle_;
+            }
+
+            Handle get() const noexcept
+            {
+                return handle_;
+            }
+
+            const Dispatch& dispatch() const noexcept
+            {
+                return *dispatch_;
+            }
+
+        protected:
+            DispatchHandle(Handle handle, const Dispatch* dispatch) noexcept : handle_{ handle }, dispatch_{ dispatch }
+            {
+            }
+
+            DispatchHandle() noexcept = default;
+
+            Handle release() noexcept
+            {
+                auto handle = handle_;
+                handle_ = VK_NULL_HANDLE;
+                return handle;
+            }
+
+            void Swap(DispatchHandle& other) noexcept
+            {
+                ::std::swap(handle_, other.handle_);
+                ::std::swap(dispatch_, other.dispatch_);
+            }
+
+        protected:
+            Handle handle_{ VK_NULL_HANDLE };
+            const Dispatch* dispatch_{ nullptr };
+        };
+    } // namespace Detail
+
+    //------------------------------------------------------------------------------------
+    // Instance
+    //------------------------------------------------------------------------------------
+
+    class Instance : public Detail::DispatchHandle<::VkInstance, InstanceDispatch>
+    {
+    public:
+        explicit Instance(::VkInstance instance, const InstanceDispatch& instanceDispatch, const ::VkAllocationCallbacks* allocator = nullptr) noexcept
+            : DispatchHandle{ instance, &instanceDispatch }
+            , allocator_{ allocator }
+        {
+        }
+
+        Instance(const Instance&) noexcept = delete;
+
+        Instance(Instance&& src) noexcept : DispatchHandle{ src.handle_, src.dispatch_ }, allocator_{ src.allocator_ }
+        {
+            src.release();
+        }
+
+        Instance() noexcept = default;
+
+        ~Instance() noexcept
+        {
+            if (handle_)
+            {
+                dispatch_->DestroyInstance(handle_, allocator_);
+            }
+        }
+
+        Instance& operator=(const Instance&) noexcept = delete;
+
+        Instance& operator=(Instance&& other) noexcept
+        {
+            Instance{ ::std::move(other) }.Swap(*this);
+            return *this;
+        }
+
+        VULKANDYNAMIC_INSTANCE_FUNCTIONS(VULKANDYNAMIC_OWNING_HANDLE_FORWARD_FUNCTION)
+
+    private:
+        void Swap(Instance& other) noexcept
+        {
+            DispatchHandle::Swap(other);
+            ::std::swap(allocator_, other.allocator_);
+        }
+
+    private:
+        const ::VkAllocationCallbacks* allocator_{ nullptr };
+    };
+
+    //------------------------------------------------------------------------------------
+    // Physical Device
+    //------------------------------------------------------------------------------------
+
+    class PhysicalDevice : public Detail::DispatchHandle<::VkPhysicalDevice, PhysicalDeviceDispatch>
+    {
+    public:
+        explicit PhysicalDevice(::VkPhysicalDevice physicalDevice, const PhysicalDeviceDispatch& physicalDeviceDispatch) noexcept
+            : DispatchHandle{ physicalDevice, &physicalDeviceDispatch }
+        {
+        }
+
+        PhysicalDevice() noexcept = default;
+
+        VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS(VULKANDYNAMIC_HANDLE_FORWARD_FUNCTION)
+    };
+
+    //------------------------------------------------------------------------------------
+    // Device
+    //------------------------------------------------------------------------------------
+
+    class Queue : public Detail::DispatchHandle<::VkQueue, DeviceDispatch>
+    {
+    public:
+        explicit Queue(::VkQueue queue, const DeviceDispatch& deviceDispatch) noexcept : DispatchHandle{ queue, &deviceDispatch }
+        {
+        }
+
+        Queue() noexcept = default;
+
+        VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_HANDLE_FORWARD_FUNCTION)
+    };
+
+    class Device : public Detail::DispatchHandle<::VkDevice, DeviceDispatch>
+    {
+    public:
+        explicit Device(::VkDevice device, const DeviceDispatch& deviceDispatch, const ::VkAllocationCallbacks* allocator = nullptr) noexcept
+            : DispatchHandle{ device, &deviceDispatch }
+            , allocator_{ allocator }
+        {
+        }
+
+        Device(const Device&) noexcept = delete;
+
+        Device(Device&& src) noexcept : DispatchHandle{ src.handle_, src.dispatch_ }, allocator_{ src.allocator_ }
+        {
+            src.release();
+        }
+
+        Device() noexcept = default;
+
+        ~Device() noexcept
+        {
+            if (handle_)
+            {
+                dispatch_->DestroyDevice(handle_, allocator_);
+            }
+        }
+
+        Device& operator=(const Device&) noexcept = delete;
+
+        Device& operator=(Device&& other) noexcept
+        {
+            Device{ ::std::move(other) }.Swap(*this);
+            return *this;
+        }
+
+        Queue GetQueue(::uint32_t queueFamilyIndex, ::uint32_t queueIndex) const noexcept
+        {
+            ::VkQueue queue = VK_NULL_HANDLE;
+            dispatch_->GetDeviceQueue(handle_, queueFamilyIndex, queueIndex, &queue);
+
+            return Queue{ queue, *dispatch_ };
+        }
+
+        VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_OWNING_HANDLE_FORWARD_FUNCTION)
+
+    private:
+        void Swap(Device& other) noexcept
+        {
+            DispatchHandle::Swap(other);
+            ::std::swap(allocator_, other.allocator_);
+        }
+
+    private:
+        const ::VkAllocationCallbacks* allocator_{ nullptr };
+    };
+
+    class CommandBuffer : public Detail::DispatchHandle<::VkCommandBuffer, DeviceDispatch>
+    {
+    public:
+        explicit CommandBuffer(const Device& device, ::VkCommandPool commandPool, ::VkCommandBuffer commandBuffer) noexcept
+            : DispatchHandle{ commandBuffer, &device.dispatch() }
+            , device_{ device.get() }
+            , commandPool_{ commandPool }
+        {
+        }
+
+        CommandBuffer(const CommandBuffer&) noexcept = delete;
+
+        CommandBuffer(CommandBuffer&& src) noexcept : DispatchHandle{ src.handle_, src.dispatch_ }, device_{ src.device_ }, commandPool_{ src.commandPool_ }
+        {
+            src.release();
+        }
+
+        CommandBuffer() noexcept = default;
+
+        ~CommandBuffer() noexcept
+        {
+            if (handle_)
+            {
+                dispatch_->FreeCommandBuffers(device_, commandPool_, 1, &handle_);
+            }
+        }
+
+        CommandBuffer& operator=(const CommandBuffer&) noexcept = delete;
+
+        CommandBuffer& operator=(CommandBuffer&& other) noexcept
+        {
+            CommandBuffer{ ::std::move(other) }.Swap(*this);
+            return *this;
+        }
+
+        VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_HANDLE_FORWARD_FUNCTION)
+
+    private:
+        void Swap(CommandBuffer& other) noexcept
+        {
+            DispatchHandle::Swap(other);
+            ::std::swap(device_, other.device_);
+            ::std::swap(commandPool_, other.commandPool_);
+        }
+
+    private:
+        ::VkDevice device_{ VK_NULL_HANDLE };
+        ::VkCommandPool commandPool_{ VK_NULL_HANDLE };
+    };
+
+    class Buffer : public Detail::DispatchHandle<::VkBuffer, DeviceDispatch>
+    {
+    public:
+        explicit Buffer(const Device& device, ::VkBuffer buffer, const ::VkAllocationCallbacks* allocator = nullptr) noexcept
+            : DispatchHandle{ buffer, &device.dispatch() }
+            , device_{ device.get() }
+            , allocator_{ allocator }
+        {
+        }
+
+        Buffer(const Buffer&) noexcept = delete;
+
+        Buffer(Buffer&& src) noexcept : DispatchHandle{ src.handle_, src.dispatch_ }, device_{ src.device_ }, allocator_{ src.allocator_ }
+        {
+            src.release();
+        }
+
+        Buffer() noexcept = default;
+
+        ~Buffer() noexcept
+        {
+            if (handle_)
+            {
+                dispatch_->DestroyBuffer(device_, handle_, allocator_);
+            }
+        }
+
+        Buffer& operator=(const Buffer&) noexcept = delete;
+
+        Buffer& operator=(Buffer&& other) noexcept
+        {
+            Buffer{ ::std::move(other) }.Swap(*this);
+            return *this;
+        }
+
+        void GetMemoryRequirements(::VkMemoryRequirements* pMemoryRequirements) const noexcept
+        {
+            dispatch_->GetBufferMemoryRequirements(device_, handle_, pMemoryRequirements);
+        }
+
+        ::VkResult BindMemory(::VkDeviceMemory memory, ::VkDeviceSize memoryOffset) const noexcept
+        {
+            return dispatch_->BindBufferMemory(device_, handle_, memory, memoryOffset);
+        }
+
+    private:
+        void Swap(Buffer& other) noexcept
+        {
+            DispatchHandle::Swap(other);
+            ::std::swap(device_, other.device_);
+            ::std::swap(allocator_, other.allocator_);
+        }
+
+    private:
+        ::VkDevice device_{ VK_NULL_HANDLE };
+        const ::VkAllocationCallbacks* allocator_{ nullptr };
+    };
+
+    class Image : public Detail::DispatchHandle<::VkImage, DeviceDispatch>
+    {
+    public:
+        explicit Image(const Device& device, ::VkImage image, const ::VkAllocationCallbacks* allocator = nullptr) noexcept
+            : DispatchHandle{ image, &device.dispatch() }
+            , device_{ device.get() }
+            , allocator_{ allocator }
+        {
+        }
+
+        Image(const Image&) noexcept = delete;
+
+        Image(Image&& src) noexcept : DispatchHandle{ src.handle_, src.dispatch_ }, device_{ src.device_ }, allocator_{ src.allocator_ }
+        {
+            src.release();
+        }
+
+        Image() noexcept = default;
+
+        ~Image() noexcept
+        {
+            if (handle_)
+            {
+                dispatch_->DestroyImage(device_, handle_, allocator_);
+            }
+        }
+
+        Image& operator=(const Image&) noexcept = delete;
+
+        Image& operator=(Image&& other) noexcept
+        {
+            Image{ ::std::move(other) }.Swap(*this);
+            return *this;
+        }
+
+        void GetMemoryRequirements(::VkMemoryRequirements* pMemoryRequirements) const noexcept
+        {
+            dispatch_->GetImageMemoryRequirements(device_, handle_, pMemoryRequirements);
+        }
+
+        ::VkResult BindMemory(::VkDeviceMemory memory, ::VkDeviceSize memoryOffset) const noexcept
+        {
+            return dispatch_->BindImageMemory(device_, handle_, memory, memoryOffset);
+        }
+
+    private:
+        void Swap(Image& other) noexcept
+        {
+            DispatchHandle::Swap(other);
+            ::std::swap(device_, other.device_);
+            ::std::swap(allocator_, other.allocator_);
+        }
+
+    private:
+        ::VkDevice device_{ VK_NULL_HANDLE };
+        const ::VkAllocationCallbacks* allocator_{ nullptr };
+    };
+
+    //------------------------------------------------------------------------------------
+    // Command Buffer
+    //------------------------------------------------------------------------------------
+
+    // Non-owning recorder forwarding vkCmd* calls through the compact command buffer
+    // table, for threads that only record.
+    class CommandBufferRecorder : public Detail::DispatchHandle<::VkCommandBuffer, CommandBufferDispatch>
+    {
+    public:
+        explicit CommandBufferRecorder(::VkCommandBuffer commandBuffer, const CommandBufferDispatch& commandBufferDispatch) noexcept
+            : DispatchHandle{ commandBuffer, &commandBufferDispatch }
+        {
+        }
+
+        CommandBufferRecorder() noexcept = default;
+
+        VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS(VULKANDYNAMIC_HANDLE_FORWARD_FUNCTION)
+    };
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_HANDLES_HPP__
@@ -0,0 +1,61 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_INSTRUMENT_H__
+#define __VULKANDYNAMIC_INSTRUMENT_H__
+
+// Instrumented dispatch: every entry point of an instrumented table counts its calls in
+// per-thread, cache-line padded counters and times one call in `samplingRate` (0 only
+// counts) into log2 latency buckets. Statistics merge the counters of all threads and
+// are indexed by VulkanDynamic<Tier>FunctionId.
+//
+// There is one instrumentation session per tier and process: the instrumented table
+// forwards to `next`, which must stay valid while it is in use. Instrumenting a second,
+// different `next` of the same tier fails with VK_ERROR_TOO_MANY_OBJECTS until the first
+// is released with VulkanDynamicRelease<Tier>Instrumentation, after which its
+// instrumented tables must no longer be called. Statistics keep accumulating across
+// sessions. The instrumented table can be called directly or installed with
+// VulkanDynamicSwapDeviceDispatch.
+
+#include "VulkanDynamic.h"
+#include "VulkanDynamicFunctions.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+#define VULKANDYNAMIC_LATENCY_BUCKET_COUNT 32
+
+typedef struct VulkanDynamicFunctionStatistics
+{
+    uint64_t callCount;
+    uint64_t sampledCallCount;
+    uint64_t sampledNanoseconds;
+    uint64_t latencyBuckets[VULKANDYNAMIC_LATENCY_BUCKET_COUNT]; // [2^i, 2^(i+1)) ns, the last bucket is open
+} VulkanDynamicFunctionStatistics;
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInstrumentInstanceDispatch(const VulkanDynamicInstanceDispatch* next, uint32_t samplingRate, VulkanDynamicInstanceDispatch* instrumentedDispatch);
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInstrumentDeviceDispatch(const VulkanDynamicDeviceDispatch* next, uint32_t samplingRate, VulkanDynamicDeviceDispatch* instrumentedDispatch);
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicReleaseInstanceInstrumentation(const VulkanDynamicInstanceDispatch* next);
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicReleaseDeviceInstrumentation(const VulkanDynamicDeviceDispatch* next);
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetInstanceStatistics(uint32_t* pStatisticCount, VulkanDynamicFunctionStatistics* pStatistics);
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetDeviceStatistics(uint32_t* pStatisticCount, VulkanDynamicFunctionStatistics* pStatistics);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_INSTRUMENT_H__
@@ -0,0 +1,107 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_INTERPOSE_H__
+#define __VULKANDYNAMIC_INTERPOSE_H__
+
+// Hot-swappable device dispatch. A VulkanDynamicDeviceDispatchSwap owns a copy of the
+// device table (`next`) and publishes the active table through `current`: `&next` while
+// interposition is off, an interposer table otherwise. Recording code acquires the
+// active table once per batch of calls (a command buffer, a frame) and calls through
+// it, so with interposition off each call costs exactly a plain table call.
+//
+// Retired tables are reclaimed with quiescent-state epochs: every thread acquiring the
+// table registers a VulkanDynamicDispatchReader and reports a quiescent state whenever
+// it holds no table pointer (e.g. between frames). A table replaced by
+// VulkanDynamicSwapDeviceDispatch may be freed once VulkanDynamicQueryDeviceDispatchRetired
+// returns VK_SUCCESS for its retire epoch.
+//
+// A thread that stops acquiring the table for a while (idle worker, blocking wait) calls
+// VulkanDynamicDispatchReaderOffline after dropping its table pointer, so it does not hold
+// back reclamation. It must call VulkanDynamicDispatchReaderOnline before its next
+// VulkanDynamicAcquireDeviceDispatch. A thread that exits unregisters its reader, after
+// which the reader's storage may be released.
+
+#include "VulkanDynamic.h"
+
+#include <stdint.h>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define VULKANDYNAMIC_INLINE __inline
+#else
+    #define VULKANDYNAMIC_INLINE inline
+#endif // _MSC_VER
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+typedef struct VulkanDynamicDispatchReader
+{
+    volatile uint64_t epoch;                        // 0 while offline
+    struct VulkanDynamicDispatchReader* volatile next;
+} VulkanDynamicDispatchReader;
+
+typedef struct VulkanDynamicDeviceDispatchSwap
+{
+    const VulkanDynamicDeviceDispatch* volatile current;
+    VulkanDynamicDeviceDispatch next;
+    volatile uint64_t epoch;
+    VulkanDynamicDispatchReader* volatile readers;
+    volatile uint32_t readersLock;                  // guards linking and walking `readers`
+} VulkanDynamicDeviceDispatchSwap;
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInitializeDeviceDispatchSwap(const VulkanDynamicDeviceDispatch* deviceDispatch, VulkanDynamicDeviceDispatchSwap* swap);
+
+// Fills every NULL entry of `interposer` with the matching entry of `next`, so an
+// interposer only needs to provide the entry points it wraps.
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicFillDeviceInterposer(const VulkanDynamicDeviceDispatch* next, VulkanDynamicDeviceDispatch* interposer);
+
+// Publishes `deviceDispatch` (NULL restores `swap->next`) with release semantics and
+// returns the replaced table together with the epoch after which it can be reclaimed.
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicSwapDeviceDispatch(VulkanDynamicDeviceDispatchSwap* swap, const VulkanDynamicDeviceDispatch* deviceDispatch, const VulkanDynamicDeviceDispatch** previousDispatch, uint64_t* retireEpoch);
+
+// VK_SUCCESS once no online reader can still hold a table retired at `retireEpoch`,
+// VK_NOT_READY otherwise.
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicQueryDeviceDispatchRetired(const VulkanDynamicDeviceDispatchSwap* swap, uint64_t retireEpoch);
+
+// Links `reader` into the swap and brings it online. A registered reader stays linked
+// until VulkanDynamicUnregisterDispatchReader and must not be released before.
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicRegisterDispatchReader(VulkanDynamicDeviceDispatchSwap* swap, VulkanDynamicDispatchReader* reader);
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicUnregisterDispatchReader(VulkanDynamicDeviceDispatchSwap* swap, VulkanDynamicDispatchReader* reader);
+VULKANDYNAMIC_API VKAPI_ATTR void VKAPI_CALL VulkanDynamicDispatchReaderQuiescent(const VulkanDynamicDeviceDispatchSwap* swap, VulkanDynamicDispatchReader* reader);
+VULKANDYNAMIC_API VKAPI_ATTR void VKAPI_CALL VulkanDynamicDispatchReaderOffline(VulkanDynamicDispatchReader* reader);
+VULKANDYNAMIC_API VKAPI_ATTR void VKAPI_CALL VulkanDynamicDispatchReaderOnline(const VulkanDynamicDeviceDispatchSwap* swap, VulkanDynamicDispatchReader* reader);
+
+static VULKANDYNAMIC_INLINE const VulkanDynamicDeviceDispatch* VulkanDynamicAcquireDeviceDispatch(const VulkanDynamicDeviceDispatchSwap* swap)
+{
+#if defined(_MSC_VER)
+    const VulkanDynamicDeviceDispatch* deviceDispatch = swap->current;
+#if defined(_M_ARM64)
+    __dmb(_ARM64_BARRIER_ISHLD);
+#else
+    _ReadWriteBarrier();
+#endif // _M_ARM64
+    return deviceDispatch;
+#else
+    return __atomic_load_n(&swap->current, __ATOMIC_ACQUIRE);
+#endif // _MSC_VER
+}
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_INTERPOSE_H__
@@ -0,0 +1,88 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_METRICS_H__
+#define __VULKANDYNAMIC_METRICS_H__
+
+// Shared-memory metrics segment. VulkanDynamicPublishMetrics copies the resolution
+// statistics and the instrumentation counters (see VulkanDynamicInstrument.h) into a
+// named, fixed-layout segment (shm_open on POSIX, a named file mapping on Windows) that
+// other processes map read-only. Publication is a sequence lock: readers never block the
+// writer and retry while `sequence` is odd or changes under them, which
+// VulkanDynamicReadMetrics does for them.
+
+#include "VulkanDynamic.h"
+
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+#define VULKANDYNAMIC_METRICS_MAGIC 0x4D444B56u // "VKDM"
+#define VULKANDYNAMIC_METRICS_VERSION 1
+#define VULKANDYNAMIC_METRICS_NAME_SIZE 64
+
+VK_DEFINE_HANDLE(VulkanDynamicMetricsSegment);
+
+typedef struct VulkanDynamicMetricsFunction
+{
+    char name[VULKANDYNAMIC_METRICS_NAME_SIZE];
+    uint64_t callCount;
+    uint64_t sampledCallCount;
+    uint64_t sampledNanoseconds;
+    uint64_t reserved;
+} VulkanDynamicMetricsFunction;
+
+typedef struct VulkanDynamicMetricsHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t size;
+    uint64_t sequence;
+    uint64_t publishCount;
+    uint64_t timestampNanoseconds;
+    VulkanDynamicResolutionStatistics resolution[VULKANDYNAMIC_TIER_COUNT];
+    uint64_t fenceWaitCount;                        // 0 without device instrumentation
+    uint64_t fenceWaitSampledCount;
+    uint64_t fenceWaitSampledNanoseconds;
+    uint32_t instanceFunctionCount;
+    uint32_t instanceFunctionOffset;
+    uint32_t deviceFunctionCount;
+    uint32_t deviceFunctionOffset;
+} VulkanDynamicMetricsHeader;
+
+// Writer side. `name` follows the platform rules for shared memory names, e.g.
+// "/VulkanDynamic.1234" on POSIX, and must not name an existing segment: creation fails
+// with VK_ERROR_INITIALIZATION_FAILED rather than replacing it. A segment left behind by
+// a crashed process has to be removed (shm_unlink) before its name is reused.
+//
+// The fence wait totals are the WaitForFences counters of the device instrumentation:
+// they stay 0 unless the device table in use was instrumented with
+// VulkanDynamicInstrumentDeviceDispatch, and only sampled calls contribute time.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateMetricsSegment(const char* name, VulkanDynamicMetricsSegment* segment);
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicPublishMetrics(VulkanDynamicMetricsSegment segment);
+
+// Reader side. VulkanDynamicReadMetrics copies a consistent snapshot of the segment,
+// starting with its VulkanDynamicMetricsHeader; call it with `pData` NULL to query the size.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicOpenMetricsSegment(const char* name, VulkanDynamicMetricsSegment* segment);
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicReadMetrics(VulkanDynamicMetricsSegment segment, size_t* pDataSize, void* pData);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyMetricsSegment(VulkanDynamicMetricsSegment segment);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_METRICS_H__
@@ -0,0 +1,80 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PIPELINE_CACHE_SERVICE_H__
+#define __VULKANDYNAMIC_PIPELINE_CACHE_SERVICE_H__
+
+// Pipeline cache sharing between the processes of one machine. A pipeline cache server
+// listens on a local socket and keeps one VkPipelineCache per device it was given,
+// typically headless devices created by tools/PipelineCacheService. Processes publish
+// their pipeline cache data with VulkanDynamicPublishPipelineCache; the server merges it
+// into the cache of the device with the same vendorID, deviceID, driverVersion and
+// pipelineCacheUUID. VulkanDynamicCreateSharedPipelineCache creates a cache from the
+// merged data, so a new process starts with the pipelines others have compiled.
+//
+// The server accepts connections on its own thread and serves each on a thread of its own,
+// up to a limit, so a stalled client delays no other; merges take turns. Its socket is
+// only accessible to its owner, and connections between processes of different users
+// are refused on both ends, so the server and its clients run as one user. Clients fall back to an unshared cache when the
+// server cannot be reached. Server creation fails with VK_ERROR_FEATURE_NOT_PRESENT while
+// another server listens at the path, and where local sockets are not provided: they
+// are only provided on POSIX platforms.
+
+#include "VulkanDynamic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VK_DEFINE_HANDLE(VulkanDynamicPipelineCacheServer);
+
+// A device whose pipeline caches the server merges. Its pipeline cache data is served to
+// clients on devices with the same properties, so it need not be the clients' device.
+typedef struct VulkanDynamicPipelineCacheServerDevice
+{
+    const VulkanDynamicPhysicalDeviceDispatch* physicalDeviceDispatch;
+    VkPhysicalDevice physicalDevice;
+    const VulkanDynamicDeviceDispatch* deviceDispatch;
+    VkDevice device;
+} VulkanDynamicPipelineCacheServerDevice;
+
+typedef struct VulkanDynamicPipelineCacheServerStatistics
+{
+    uint64_t publishCount;
+    uint64_t rejectedPublishCount;
+    uint64_t fetchCount;
+    uint64_t servedSize;
+} VulkanDynamicPipelineCacheServerStatistics;
+
+// The devices and their dispatch tables must stay valid until the server is destroyed.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreatePipelineCacheServer(const char* socketPath, uint32_t deviceCount, const VulkanDynamicPipelineCacheServerDevice* pDevices, VulkanDynamicPipelineCacheServer* server);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyPipelineCacheServer(VulkanDynamicPipelineCacheServer server);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetPipelineCacheServerStatistics(VulkanDynamicPipelineCacheServer server, VulkanDynamicPipelineCacheServerStatistics* statistics);
+
+// Creates a pipeline cache from the data the server has merged for the device, or from
+// `pCreateInfo` alone when the server has none or cannot be reached.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateSharedPipelineCache(const char* socketPath, const VulkanDynamicPhysicalDeviceDispatch* physicalDeviceDispatch, VkPhysicalDevice physicalDevice, const VulkanDynamicDeviceDispatch* deviceDispatch, VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache);
+
+// Sends the data of `pipelineCache` to the server to be merged. Returns
+// VK_ERROR_INITIALIZATION_FAILED when the server cannot be reached and
+// VK_ERROR_INCOMPATIBLE_DRIVER when it has no device matching the data.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicPublishPipelineCache(const char* socketPath, const VulkanDynamicPhysicalDeviceDispatch* physicalDeviceDispatch, VkPhysicalDevice physicalDevice, const VulkanDynamicDeviceDispatch* deviceDispatch, VkDevice device, VkPipelineCache pipelineCache);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_PIPELINE_CACHE_SERVICE_H__
@@ -0,0 +1,70 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PIPELINE_CACHE_STORE_H__
+#define __VULKANDYNAMIC_PIPELINE_CACHE_STORE_H__
+
+// Persistent pipeline caches. A pipeline cache store keeps one VkPipelineCache per device
+// in a file of `directory` named after the device's vendorID, deviceID, driverVersion and
+// pipelineCacheUUID. The file is mapped read-only to create the cache; a file whose
+// pipeline cache header does not match the device is ignored and the cache starts empty.
+//
+// Writes go to a temporary file next to the store's, which is synced and renamed over it,
+// so a crash leaves either the previous or the new file. They are skipped while the cache
+// data is unchanged since the last write. Merging and writing must be externally
+// synchronized; the cache itself may be used for pipeline creation from any thread.
+
+#include "VulkanDynamic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VK_DEFINE_HANDLE(VulkanDynamicPipelineCacheStore);
+
+typedef struct VulkanDynamicPipelineCacheStoreStatistics
+{
+    uint64_t loadedSize;
+    uint64_t writtenSize;
+    uint64_t writeCount;
+    uint64_t skippedWriteCount;
+    VkBool32 rejected;
+} VulkanDynamicPipelineCacheStoreStatistics;
+
+// `writeInterval` is the least time, in nanoseconds, between writes made by
+// VulkanDynamicUpdatePipelineCacheStore. The dispatch tables must stay valid until the
+// store is destroyed.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreatePipelineCacheStore(const VulkanDynamicPhysicalDeviceDispatch* physicalDeviceDispatch, VkPhysicalDevice physicalDevice, const VulkanDynamicDeviceDispatch* deviceDispatch, VkDevice device, const char* directory, uint64_t writeInterval, VulkanDynamicPipelineCacheStore* store);
+
+// Writes the cache a last time, then destroys it.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyPipelineCacheStore(VulkanDynamicPipelineCacheStore store);
+
+VKAPI_ATTR VkPipelineCache VKAPI_CALL VulkanDynamicGetPipelineCacheStoreCache(VulkanDynamicPipelineCacheStore store);
+
+// Merges other caches of the device, e.g. per-thread ones, into the store's cache.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicMergePipelineCacheStore(VulkanDynamicPipelineCacheStore store, uint32_t cacheCount, const VkPipelineCache* pCaches);
+
+// Writes the cache if `writeInterval` has passed since the last write; call it
+// periodically, e.g. once per frame.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicUpdatePipelineCacheStore(VulkanDynamicPipelineCacheStore store);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWritePipelineCacheStore(VulkanDynamicPipelineCacheStore store);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetPipelineCacheStoreStatistics(VulkanDynamicPipelineCacheStore store, VulkanDynamicPipelineCacheStoreStatistics* statistics);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_PIPELINE_CACHE_STORE_H__
@@ -0,0 +1,75 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PIPELINE_COMPILER_H__
+#define __VULKANDYNAMIC_PIPELINE_COMPILER_H__
+
+// Parallel pipeline compilation. A pipeline compiler owns a pool of threads, each with a
+// VkPipelineCache of its own so that drivers do not serialize them on one cache. Batches
+// passed to VulkanDynamicCompileGraphicsPipelines and its siblings are split into one job
+// per pipeline and compiled in priority order, higher priorities first and batches of one
+// priority in the order they were passed. Batches where pipelines derive from others of
+// the batch through basePipelineIndex are compiled as one job.
+//
+// The thread caches start with the data of the pipeline cache given at creation, and are
+// merged back into it by VulkanDynamicWaitPipelineCompilerIdle and on destruction. Device
+// tables without vkCreatePipelineCache, vkDestroyPipelineCache or vkMergePipelineCaches
+// compile without thread caches. The create infos and the pipelines array of a batch
+// must stay valid until the callback has run for each of its pipelines.
+// VulkanDynamic/VulkanDynamicPipelineCompiler.hpp returns std::future objects instead.
+
+#include "VulkanDynamic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VK_DEFINE_HANDLE(VulkanDynamicPipelineCompiler);
+
+// Called on a compiler thread once pPipelines[index] has been written; `result` is that
+// pipeline's, e.g. VK_PIPELINE_COMPILE_REQUIRED_EXT for a pipeline not found in the cache.
+typedef void (VKAPI_PTR* PFN_VulkanDynamicPipelineCallback)(void* userData, uint32_t index, VkResult result);
+
+typedef struct VulkanDynamicPipelineCompilerStatistics
+{
+    uint64_t compiledCount;
+    uint64_t failedCount;
+} VulkanDynamicPipelineCompilerStatistics;
+
+// `threadCount` 0 starts a thread per hardware thread. `pipelineCache` may be
+// VK_NULL_HANDLE. `dispatch` must stay valid until the compiler is destroyed.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreatePipelineCompiler(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, uint32_t threadCount, VkPipelineCache pipelineCache, VulkanDynamicPipelineCompiler* compiler);
+
+// Compiles the outstanding pipelines, merges the thread caches and stops the threads.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyPipelineCompiler(VulkanDynamicPipelineCompiler compiler);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCompileGraphicsPipelines(VulkanDynamicPipelineCompiler compiler, int32_t priority, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, VkPipeline* pPipelines, PFN_VulkanDynamicPipelineCallback callback, void* userData);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCompileComputePipelines(VulkanDynamicPipelineCompiler compiler, int32_t priority, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, VkPipeline* pPipelines, PFN_VulkanDynamicPipelineCallback callback, void* userData);
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCompileRayTracingPipelinesKHR(VulkanDynamicPipelineCompiler compiler, int32_t priority, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, VkPipeline* pPipelines, PFN_VulkanDynamicPipelineCallback callback, void* userData);
+#endif // VK_KHR_ray_tracing_pipeline
+
+// Waits until every pipeline passed so far is compiled, then merges the thread caches into
+// the compiler's pipeline cache. Access to that cache must be externally synchronized.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWaitPipelineCompilerIdle(VulkanDynamicPipelineCompiler compiler);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetPipelineCompilerStatistics(VulkanDynamicPipelineCompiler compiler, VulkanDynamicPipelineCompilerStatistics* statistics);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_PIPELINE_COMPILER_H__
@@ -0,0 +1,126 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PIPELINE_COMPILER_HPP__
+#define __VULKANDYNAMIC_PIPELINE_COMPILER_HPP__
+
+#include "VulkanDynamicPipelineCompiler.h"
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+namespace VulkanDynamic
+{
+    struct CompiledPipeline
+    {
+        ::VkResult result;
+        ::VkPipeline pipeline;
+    };
+
+    namespace Detail
+    {
+        // The pipelines array and promises of one batch, freed by its last callback.
+        class PipelinePromises final
+        {
+        public:
+            explicit PipelinePromises(::uint32_t count) : pipelines_(count, VK_NULL_HANDLE), promises_(count), remaining_{ count }
+            {
+            }
+
+            ::std::vector<::std::future<CompiledPipeline>> Futures()
+            {
+                ::std::vector<::std::future<CompiledPipeline>> futures;
+                futures.reserve(promises_.size());
+                for (::std::promise<CompiledPipeline>& promise : promises_)
+                {
+                    futures.push_back(promise.get_future());
+                }
+
+                return futures;
+            }
+
+            ::VkPipeline* Pipelines() noexcept
+            {
+                return pipelines_.data();
+            }
+
+            // Completes every future with an error the batch was refused with.
+            void Refuse(::VkResult result)
+            {
+                for (::std::promise<CompiledPipeline>& promise : promises_)
+                {
+                    promise.set_value(CompiledPipeline{ result, VK_NULL_HANDLE });
+                }
+            }
+
+            static void VKAPI_CALL Complete(void* userData, ::uint32_t index, ::VkResult result)
+            {
+                PipelinePromises* promises = static_cast<PipelinePromises*>(userData);
+                promises->promises_[index].set_value(CompiledPipeline{ result, promises->pipelines_[index] });
+
+                if (promises->remaining_.fetch_sub(1, ::std::memory_order_acq_rel) == 1)
+                {
+                    delete promises;
+                }
+            }
+
+        private:
+            ::std::vector<::VkPipeline> pipelines_;
+            ::std::vector<::std::promise<CompiledPipeline>> promises_;
+            ::std::atomic<::uint32_t> remaining_;
+        };
+
+        template<typename CreateInfo, typename Function>
+        ::std::vector<::std::future<CompiledPipeline>> CompilePipelinesAsync(Function function, ::VulkanDynamicPipelineCompiler compiler, ::int32_t priority, ::uint32_t createInfoCount, const CreateInfo* pCreateInfos)
+        {
+            PipelinePromises* promises = new PipelinePromises{ createInfoCount };
+            ::std::vector<::std::future<CompiledPipeline>> futures = promises->Futures();
+
+            const ::VkResult result = function(compiler, priority, createInfoCount, pCreateInfos, promises->Pipelines(), &PipelinePromises::Complete, promises);
+            if (result != VK_SUCCESS || createInfoCount == 0)
+            {
+                promises->Refuse(result);
+                delete promises;
+            }
+
+            return futures;
+        }
+    } // namespace Detail
+
+    //------------------------------------------------------------------------------------
+    // Pipeline futures
+    //------------------------------------------------------------------------------------
+
+    // Passes a batch to the compiler and returns a future per pipeline. The create infos
+    // must stay valid until every future is ready.
+    inline ::std::vector<::std::future<CompiledPipeline>> CompilePipelinesAsync(::VulkanDynamicPipelineCompiler compiler, ::int32_t priority, ::uint32_t createInfoCount, const ::VkGraphicsPipelineCreateInfo* pCreateInfos)
+    {
+        return Detail::CompilePipelinesAsync(&::VulkanDynamicCompileGraphicsPipelines, compiler, priority, createInfoCount, pCreateInfos);
+    }
+
+    inline ::std::vector<::std::future<CompiledPipeline>> CompilePipelinesAsync(::VulkanDynamicPipelineCompiler compiler, ::int32_t priority, ::uint32_t createInfoCount, const ::VkComputePipelineCreateInfo* pCreateInfos)
+    {
+        return Detail::CompilePipelinesAsync(&::VulkanDynamicCompileComputePipelines, compiler, priority, createInfoCount, pCreateInfos);
+    }
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+    inline ::std::vector<::std::future<CompiledPipeline>> CompilePipelinesAsync(::VulkanDynamicPipelineCompiler compiler, ::int32_t priority, ::uint32_t createInfoCount, const ::VkRayTracingPipelineCreateInfoKHR* pCreateInfos)
+    {
+        return Detail::CompilePipelinesAsync(&::VulkanDynamicCompileRayTracingPipelinesKHR, compiler, priority, createInfoCount, pCreateInfos);
+    }
+#endif // VK_KHR_ray_tracing_pipeline
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_PIPELINE_COMPILER_HPP__
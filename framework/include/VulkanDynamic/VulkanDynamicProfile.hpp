@@ -0,0 +1,502 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PROFILE_HPP__
+#define __VULKANDYNAMIC_PROFILE_HPP__
+
+#include "VulkanDynamic.hpp"
+#include "VulkanDynamicFunctions.h"
+
+#include <cstdint>
+#include <type_traits>
+
+#define VULKANDYNAMIC_PROFILE_DECLARE_FUNCTION(function) PFN_vk##function function{ nullptr };
+#define VULKANDYNAMIC_PROFILE_GET_DEVICE_SYMBOL(function) function = reinterpret_cast<PFN_vk##function>(getDeviceProcAddr(device, "vk"#function));
+
+#define VULKANDYNAMIC_DEFINE_DEVICE_FUNCTIONS(functions) \
+    struct DeviceFunctions \
+    { \
+        functions(VULKANDYNAMIC_PROFILE_DECLARE_FUNCTION) \
+        \
+        void Resolve(::VkDevice device, ::PFN_vkGetDeviceProcAddr getDeviceProcAddr) noexcept \
+        { \
+            functions(VULKANDYNAMIC_PROFILE_GET_DEVICE_SYMBOL) \
+        } \
+    };
+
+#define VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(extension) \
+    struct extension \
+    { \
+        VULKANDYNAMIC_DEFINE_DEVICE_FUNCTIONS(VULKANDYNAMIC_DEVICE_FUNCTIONS_##extension) \
+    };
+
+namespace VulkanDynamic
+{
+    //------------------------------------------------------------------------------------
+    // Extension tags
+    //
+    // One tag per extension block of VulkanDynamicDeviceDispatch. Tags only exist for
+    // extensions known to the Vulkan headers, so naming an unknown one fails to compile.
+    //------------------------------------------------------------------------------------
+
+    namespace Extension
+    {
+#if defined(VK_KHR_swapchain)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_swapchain)
+#endif // VK_KHR_swapchain
+
+#if defined(VK_KHR_display_swapchain)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_display_swapchain)
+#endif // VK_KHR_display_swapchain
+
+#if defined(VK_EXT_debug_marker)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_debug_marker)
+#endif // VK_EXT_debug_marker
+
+#if defined(VK_KHR_video_queue)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_video_queue)
+#endif // VK_KHR_video_queue
+
+#if defined(VK_KHR_video_decode_queue)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_video_decode_queue)
+#endif // VK_KHR_video_decode_queue
+
+#if defined(VK_EXT_transform_feedback)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_transform_feedback)
+#endif // VK_EXT_transform_feedback
+
+#if defined(VK_NVX_binary_import)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NVX_binary_import)
+#endif // VK_NVX_binary_import
+
+#if defined(VK_NVX_image_view_handle)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NVX_image_view_handle)
+#endif // VK_NVX_image_view_handle
+
+#if defined(VK_AMD_draw_indirect_count)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(AMD_draw_indirect_count)
+#endif // VK_AMD_draw_indirect_count
+
+#if defined(VK_AMD_shader_info)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(AMD_shader_info)
+#endif // VK_AMD_shader_info
+
+#if defined(VK_KHR_dynamic_rendering)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_dynamic_rendering)
+#endif // VK_KHR_dynamic_rendering
+
+#if defined(VK_NV_external_memory_win32)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_external_memory_win32)
+#endif // VK_NV_external_memory_win32
+
+#if defined(VK_KHR_device_group)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_device_group)
+#endif // VK_KHR_device_group
+
+#if defined(VK_KHR_maintenance1)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_maintenance1)
+#endif // VK_KHR_maintenance1
+
+#if defined(VK_KHR_external_memory_win32)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_external_memory_win32)
+#endif // VK_KHR_external_memory_win32
+
+#if defined(VK_KHR_external_memory_fd)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_external_memory_fd)
+#endif // VK_KHR_external_memory_fd
+
+#if defined(VK_KHR_external_semaphore_win32)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_external_semaphore_win32)
+#endif // VK_KHR_external_semaphore_win32
+
+#if defined(VK_KHR_external_semaphore_fd)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_external_semaphore_fd)
+#endif // VK_KHR_external_semaphore_fd
+
+#if defined(VK_KHR_push_descriptor)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_push_descriptor)
+#endif // VK_KHR_push_descriptor
+
+#if defined(VK_EXT_conditional_rendering)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_conditional_rendering)
+#endif // VK_EXT_conditional_rendering
+
+#if defined(VK_KHR_descriptor_update_template)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_descriptor_update_template)
+#endif // VK_KHR_descriptor_update_template
+
+#if defined(VK_NV_clip_space_w_scaling)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_clip_space_w_scaling)
+#endif // VK_NV_clip_space_w_scaling
+
+#if defined(VK_EXT_display_control)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_display_control)
+#endif // VK_EXT_display_control
+
+#if defined(VK_GOOGLE_display_timing)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(GOOGLE_display_timing)
+#endif // VK_GOOGLE_display_timing
+
+#if defined(VK_EXT_discard_rectangles)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_discard_rectangles)
+#endif // VK_EXT_discard_rectangles
+
+#if defined(VK_EXT_hdr_metadata)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_hdr_metadata)
+#endif // VK_EXT_hdr_metadata
+
+#if defined(VK_KHR_create_renderpass2)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_create_renderpass2)
+#endif // VK_KHR_create_renderpass2
+
+#if defined(VK_KHR_shared_presentable_image)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_shared_presentable_image)
+#endif // VK_KHR_shared_presentable_image
+
+#if defined(VK_KHR_external_fence_win32)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_external_fence_win32)
+#endif // VK_KHR_external_fence_win32
+
+#if defined(VK_KHR_external_fence_fd)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_external_fence_fd)
+#endif // VK_KHR_external_fence_fd
+
+#if defined(VK_KHR_performance_query)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_performance_query)
+#endif // VK_KHR_performance_query
+
+#if defined(VK_ANDROID_external_memory_android_hardware_buffer)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(ANDROID_external_memory_android_hardware_buffer)
+#endif // VK_ANDROID_external_memory_android_hardware_buffer
+
+#if defined(VK_EXT_sample_locations)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_sample_locations)
+#endif // VK_EXT_sample_locations
+
+#if defined(VK_KHR_get_memory_requirements2)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_get_memory_requirements2)
+#endif // VK_KHR_get_memory_requirements2
+
+#if defined(VK_KHR_acceleration_structure)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_acceleration_structure)
+#endif // VK_KHR_acceleration_structure
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_ray_tracing_pipeline)
+#endif // VK_KHR_ray_tracing_pipeline
+
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_sampler_ycbcr_conversion)
+#endif // VK_KHR_sampler_ycbcr_conversion
+
+#if defined(VK_KHR_bind_memory2)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_bind_memory2)
+#endif // VK_KHR_bind_memory2
+
+#if defined(VK_EXT_image_drm_format_modifier)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_image_drm_format_modifier)
+#endif // VK_EXT_image_drm_format_modifier
+
+#if defined(VK_EXT_validation_cache)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_validation_cache)
+#endif // VK_EXT_validation_cache
+
+#if defined(VK_NV_shading_rate_image)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_shading_rate_image)
+#endif // VK_NV_shading_rate_image
+
+#if defined(VK_NV_ray_tracing)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_ray_tracing)
+#endif // VK_NV_ray_tracing
+
+#if defined(VK_KHR_maintenance3)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_maintenance3)
+#endif // VK_KHR_maintenance3
+
+#if defined(VK_KHR_draw_indirect_count)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_draw_indirect_count)
+#endif // VK_KHR_draw_indirect_count
+
+#if defined(VK_EXT_external_memory_host)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_external_memory_host)
+#endif // VK_EXT_external_memory_host
+
+#if defined(VK_AMD_buffer_marker)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(AMD_buffer_marker)
+#endif // VK_AMD_buffer_marker
+
+#if defined(VK_EXT_calibrated_timestamps)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_calibrated_timestamps)
+#endif // VK_EXT_calibrated_timestamps
+
+#if defined(VK_NV_mesh_shader)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_mesh_shader)
+#endif // VK_NV_mesh_shader
+
+#if defined(VK_NV_scissor_exclusive)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_scissor_exclusive)
+#endif // VK_NV_scissor_exclusive
+
+#if defined(VK_NV_device_diagnostic_checkpoints)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_device_diagnostic_checkpoints)
+#endif // VK_NV_device_diagnostic_checkpoints
+
+#if defined(VK_KHR_timeline_semaphore)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_timeline_semaphore)
+#endif // VK_KHR_timeline_semaphore
+
+#if defined(VK_INTEL_performance_query)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(INTEL_performance_query)
+#endif // VK_INTEL_performance_query
+
+#if defined(VK_AMD_display_native_hdr)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(AMD_display_native_hdr)
+#endif // VK_AMD_display_native_hdr
+
+#if defined(VK_KHR_fragment_shading_rate)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_fragment_shading_rate)
+#endif // VK_KHR_fragment_shading_rate
+
+#if defined(VK_EXT_buffer_device_address)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_buffer_device_address)
+#endif // VK_EXT_buffer_device_address
+
+#if defined(VK_EXT_tooling_info)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_tooling_info)
+#endif // VK_EXT_tooling_info
+
+#if defined(VK_KHR_present_wait)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_present_wait)
+#endif // VK_KHR_present_wait
+
+#if defined(VK_NV_cooperative_matrix)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_cooperative_matrix)
+#endif // VK_NV_cooperative_matrix
+
+#if defined(VK_NV_coverage_reduction_mode)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_coverage_reduction_mode)
+#endif // VK_NV_coverage_reduction_mode
+
+#if defined(VK_EXT_full_screen_exclusive)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_full_screen_exclusive)
+#endif // VK_EXT_full_screen_exclusive
+
+#if defined(VK_KHR_buffer_device_address)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_buffer_device_address)
+#endif // VK_KHR_buffer_device_address
+
+#if defined(VK_EXT_line_rasterization)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_line_rasterization)
+#endif // VK_EXT_line_rasterization
+
+#if defined(VK_EXT_host_query_reset)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_host_query_reset)
+#endif // VK_EXT_host_query_reset
+
+#if defined(VK_EXT_extended_dynamic_state)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_extended_dynamic_state)
+#endif // VK_EXT_extended_dynamic_state
+
+#if defined(VK_KHR_deferred_host_operations)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_deferred_host_operations)
+#endif // VK_KHR_deferred_host_operations
+
+#if defined(VK_KHR_pipeline_executable_properties)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_pipeline_executable_properties)
+#endif // VK_KHR_pipeline_executable_properties
+
+#if defined(VK_NV_device_generated_commands)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_device_generated_commands)
+#endif // VK_NV_device_generated_commands
+
+#if defined(VK_EXT_private_data)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_private_data)
+#endif // VK_EXT_private_data
+
+#if defined(VK_KHR_video_encode_queue)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_video_encode_queue)
+#endif // VK_KHR_video_encode_queue
+
+#if defined(VK_KHR_synchronization2)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_synchronization2)
+#endif // VK_KHR_synchronization2
+
+#if defined(VK_NV_fragment_shading_rate_enums)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_fragment_shading_rate_enums)
+#endif // VK_NV_fragment_shading_rate_enums
+
+#if defined(VK_KHR_copy_commands2)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_copy_commands2)
+#endif // VK_KHR_copy_commands2
+
+#if defined(VK_NV_acquire_winrt_display)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_acquire_winrt_display)
+#endif // VK_NV_acquire_winrt_display
+
+#if defined(VK_EXT_vertex_input_dynamic_state)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_vertex_input_dynamic_state)
+#endif // VK_EXT_vertex_input_dynamic_state
+
+#if defined(VK_FUCHSIA_external_memory)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(FUCHSIA_external_memory)
+#endif // VK_FUCHSIA_external_memory
+
+#if defined(VK_FUCHSIA_external_semaphore)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(FUCHSIA_external_semaphore)
+#endif // VK_FUCHSIA_external_semaphore
+
+#if defined(VK_FUCHSIA_buffer_collection)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(FUCHSIA_buffer_collection)
+#endif // VK_FUCHSIA_buffer_collection
+
+#if defined(VK_HUAWEI_subpass_shading)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(HUAWEI_subpass_shading)
+#endif // VK_HUAWEI_subpass_shading
+
+#if defined(VK_HUAWEI_invocation_mask)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(HUAWEI_invocation_mask)
+#endif // VK_HUAWEI_invocation_mask
+
+#if defined(VK_NV_external_memory_rdma)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(NV_external_memory_rdma)
+#endif // VK_NV_external_memory_rdma
+
+#if defined(VK_EXT_extended_dynamic_state2)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_extended_dynamic_state2)
+#endif // VK_EXT_extended_dynamic_state2
+
+#if defined(VK_EXT_color_write_enable)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_color_write_enable)
+#endif // VK_EXT_color_write_enable
+
+#if defined(VK_EXT_multi_draw)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_multi_draw)
+#endif // VK_EXT_multi_draw
+
+#if defined(VK_EXT_pageable_device_local_memory)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(EXT_pageable_device_local_memory)
+#endif // VK_EXT_pageable_device_local_memory
+
+#if defined(VK_KHR_maintenance4)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_maintenance4)
+#endif // VK_KHR_maintenance4
+
+#if defined(VK_KHR_device_group) || defined(VK_KHR_swapchain)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_device_group_KHR_swapchain)
+#endif // VK_KHR_device_group || VK_KHR_swapchain
+
+#if defined(VK_KHR_push_descriptor) || defined(VK_KHR_descriptor_update_template)
+        VULKANDYNAMIC_DEFINE_DEVICE_EXTENSION(KHR_push_descriptor_KHR_descriptor_update_template)
+#endif // VK_KHR_push_descriptor || VK_KHR_descriptor_update_template
+    } // namespace Extension
+
+    namespace Detail
+    {
+        struct Version_1_0
+        {
+            VULKANDYNAMIC_DEFINE_DEVICE_FUNCTIONS(VULKANDYNAMIC_DEVICE_FUNCTIONS_VERSION_1_0)
+        };
+
+        struct Version_1_1
+        {
+            VULKANDYNAMIC_DEFINE_DEVICE_FUNCTIONS(VULKANDYNAMIC_DEVICE_FUNCTIONS_VERSION_1_1)
+        };
+
+        struct Version_1_2
+        {
+            VULKANDYNAMIC_DEFINE_DEVICE_FUNCTIONS(VULKANDYNAMIC_DEVICE_FUNCTIONS_VERSION_1_2)
+        };
+
+        template<int Index>
+        struct NoDeviceFunctions
+        {
+            void Resolve(::VkDevice, ::PFN_vkGetDeviceProcAddr) noexcept
+            {
+            }
+        };
+
+        template<bool Enabled, typename Version, int Index>
+        using VersionDeviceFunctions = typename ::std::conditional<Enabled, typename Version::DeviceFunctions, NoDeviceFunctions<Index>>::type;
+
+        template<typename Extension, typename... Extensions>
+        struct Contains : ::std::false_type
+        {
+        };
+
+        template<typename Extension, typename Head, typename... Tail>
+        struct Contains<Extension, Head, Tail...> : ::std::integral_constant<bool, ::std::is_same<Extension, Head>::value || Contains<Extension, Tail...>::value>
+        {
+        };
+    } // namespace Detail
+
+    //------------------------------------------------------------------------------------
+    // Device
+    //
+    // DeviceDispatchT<Version, Extensions...> holds and resolves only the entry points of
+    // the core versions up to Version and of the listed extension tags. Calls into
+    // anything else do not compile; has<Extension>() is a constant expression.
+    //------------------------------------------------------------------------------------
+
+    template<::uint32_t Version, typename... Extensions>
+    struct DeviceDispatchT
+        : Detail::Version_1_0::DeviceFunctions
+        , Detail::VersionDeviceFunctions<(Version >= VK_API_VERSION_1_1), Detail::Version_1_1, 1>
+        , Detail::VersionDeviceFunctions<(Version >= VK_API_VERSION_1_2), Detail::Version_1_2, 2>
+        , Extensions::DeviceFunctions...
+    {
+        static constexpr ::uint32_t ApiVersion = Version;
+
+        template<typename Extension>
+        static constexpr bool has() noexcept
+        {
+            return Detail::Contains<Extension, Extensions...>::value;
+        }
+
+        explicit DeviceDispatchT(::VkDevice device, const InstanceDispatch& instanceDispatch, ::VkResult& result) noexcept : DeviceDispatchT{}
+        {
+            result = Resolve(device, instanceDispatch.GetDeviceProcAddr);
+        }
+
+        explicit DeviceDispatchT(::VkDevice device, const InstanceDispatch& instanceDispatch) noexcept : DeviceDispatchT{}
+        {
+            Resolve(device, instanceDispatch.GetDeviceProcAddr);
+        }
+
+        DeviceDispatchT() noexcept = default;
+
+        ::VkResult Resolve(::VkDevice device, ::PFN_vkGetDeviceProcAddr getDeviceProcAddr) noexcept
+        {
+            if (!device)
+            {
+                return ::VK_ERROR_OUT_OF_HOST_MEMORY;
+            }
+
+            if (!getDeviceProcAddr)
+            {
+                return ::VK_ERROR_INCOMPATIBLE_DRIVER;
+            }
+
+            Detail::Version_1_0::DeviceFunctions::Resolve(device, getDeviceProcAddr);
+            Detail::VersionDeviceFunctions<(Version >= VK_API_VERSION_1_1), Detail::Version_1_1, 1>::Resolve(device, getDeviceProcAddr);
+            Detail::VersionDeviceFunctions<(Version >= VK_API_VERSION_1_2), Detail::Version_1_2, 2>::Resolve(device, getDeviceProcAddr);
+
+            const int resolved[] = { 0, (Extensions::DeviceFunctions::Resolve(device, getDeviceProcAddr), 0)... };
+            static_cast<void>(resolved);
+
+            return ::VK_SUCCESS;
+        }
+    };
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_PROFILE_HPP__
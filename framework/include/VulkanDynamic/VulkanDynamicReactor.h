@@ -0,0 +1,72 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_REACTOR_H__
+#define __VULKANDYNAMIC_REACTOR_H__
+
+// Event loop completions. A completion reactor exports fences and binary semaphores as
+// sync file descriptors (VK_KHR_external_fence_fd, VK_KHR_external_semaphore_fd) and
+// watches them with one epoll set. The set's descriptor, from
+// VulkanDynamicGetCompletionReactorFd, turns readable when a watched object signals: add
+// it to an existing epoll loop, or poll it through io_uring, and call
+// VulkanDynamicDispatchCompletions when it is. That calls the callbacks of the signaled
+// objects on the calling thread; no thread waits and nothing polls in between.
+//
+// Exporting a sync file has the effects of a wait: the fence is reset and the semaphore
+// unsignaled, and either needs a signal operation submitted first. Fences must have been
+// created exportable to VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT, semaphores to
+// VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT. Only the readability of the exported
+// descriptors is used, so a stand-in table may return eventfds. Objects may be watched
+// from any thread; completions must be dispatched by one thread at a time.
+//
+// Reactors need epoll, and are only available on Linux.
+
+#include "VulkanDynamic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VK_DEFINE_HANDLE(VulkanDynamicCompletionReactor);
+
+// `result` is VK_SUCCESS once the object signaled, VK_ERROR_DEVICE_LOST if its sync file
+// reported an error, or VK_NOT_READY if the reactor was destroyed first.
+typedef void (VKAPI_PTR* PFN_VulkanDynamicCompletionCallback)(void* userData, VkResult result);
+
+// `dispatch` must stay valid until the reactor is destroyed. Returns
+// VK_ERROR_FEATURE_NOT_PRESENT where the platform has no epoll.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateCompletionReactor(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, VulkanDynamicCompletionReactor* reactor);
+
+// Closes the watched descriptors; their callbacks are called with VK_NOT_READY.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyCompletionReactor(VulkanDynamicCompletionReactor reactor);
+
+VKAPI_ATTR int VKAPI_CALL VulkanDynamicGetCompletionReactorFd(VulkanDynamicCompletionReactor reactor);
+
+#if defined(VK_KHR_external_fence_fd)
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWatchFence(VulkanDynamicCompletionReactor reactor, VkFence fence, PFN_VulkanDynamicCompletionCallback callback, void* userData);
+#endif // VK_KHR_external_fence_fd
+
+#if defined(VK_KHR_external_semaphore_fd)
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWatchSemaphore(VulkanDynamicCompletionReactor reactor, VkSemaphore semaphore, PFN_VulkanDynamicCompletionCallback callback, void* userData);
+#endif // VK_KHR_external_semaphore_fd
+
+// Calls the callbacks of the objects that signaled since the last call, without blocking,
+// and returns how many were called.
+VKAPI_ATTR uint32_t VKAPI_CALL VulkanDynamicDispatchCompletions(VulkanDynamicCompletionReactor reactor);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_REACTOR_H__
@@ -0,0 +1,63 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_SHADER_MODULE_CACHE_H__
+#define __VULKANDYNAMIC_SHADER_MODULE_CACHE_H__
+
+// Shader module deduplication. A shader module cache hands out one VkShaderModule per
+// distinct SPIR-V code of a device: VulkanDynamicAcquireShaderModule hashes the code with
+// a 128-bit hash and, when a module with the same code exists, returns it with its
+// reference count raised instead of calling vkCreateShaderModule. The module is destroyed
+// when its last reference is released.
+//
+// The hash only finds candidates: each module keeps a copy of its code, which is compared
+// word for word before the module is shared. Create infos with flags or a pNext chain
+// bypass the cache: their modules are created and, on release, destroyed as they would be
+// without it. The cache may be used from any thread.
+
+#include "VulkanDynamic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VK_DEFINE_HANDLE(VulkanDynamicShaderModuleCache);
+
+typedef struct VulkanDynamicShaderModuleCacheStatistics
+{
+    uint64_t createdCount;
+    uint64_t reusedCount;
+    uint64_t destroyedCount;
+    uint64_t bypassedCount;
+} VulkanDynamicShaderModuleCacheStatistics;
+
+// `dispatch` and `pAllocator` must stay valid until the cache is destroyed.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateShaderModuleCache(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, const VkAllocationCallbacks* pAllocator, VulkanDynamicShaderModuleCache* cache);
+
+// Destroys the modules that are still acquired.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyShaderModuleCache(VulkanDynamicShaderModuleCache cache);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicAcquireShaderModule(VulkanDynamicShaderModuleCache cache, const VkShaderModuleCreateInfo* pCreateInfo, VkShaderModule* pShaderModule);
+
+// Releases one reference taken by VulkanDynamicAcquireShaderModule. Pipelines created from
+// the module may still be in use, as destroying a shader module does not affect them.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicReleaseShaderModule(VulkanDynamicShaderModuleCache cache, VkShaderModule shaderModule);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetShaderModuleCacheStatistics(VulkanDynamicShaderModuleCache cache, VulkanDynamicShaderModuleCacheStatistics* statistics);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_SHADER_MODULE_CACHE_H__
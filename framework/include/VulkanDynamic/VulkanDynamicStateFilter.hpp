@@ -0,0 +1,593 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_STATE_FILTER_HPP__
+#define __VULKANDYNAMIC_STATE_FILTER_HPP__
+
+#include "VulkanDynamicHandles.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// Entry points whose redundant calls FilteringCommandBufferRecorder drops, plus the ones
+// that invalidate what it shadows.
+#define VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_VERSION_1_0(function) \
+    function(CmdBindPipeline) \
+    function(CmdSetViewport) \
+    function(CmdSetScissor) \
+    function(CmdBindDescriptorSets) \
+    function(CmdBindVertexBuffers) \
+    function(CmdExecuteCommands)
+
+#if defined(VK_EXT_extended_dynamic_state)
+    #define VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_EXT_extended_dynamic_state(function) \
+        function(CmdSetCullModeEXT) \
+        function(CmdBindVertexBuffers2EXT) \
+        function(CmdSetFrontFaceEXT) \
+        function(CmdSetPrimitiveTopologyEXT) \
+        function(CmdSetViewportWithCountEXT) \
+        function(CmdSetScissorWithCountEXT) \
+        function(CmdSetDepthTestEnableEXT) \
+        function(CmdSetDepthWriteEnableEXT) \
+        function(CmdSetDepthBoundsTestEnableEXT) \
+        function(CmdSetDepthCompareOpEXT) \
+        function(CmdSetStencilTestEnableEXT) \
+        function(CmdSetStencilOpEXT)
+#else
+    #define VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_EXT_extended_dynamic_state(function)
+#endif // VK_EXT_extended_dynamic_state
+
+#if defined(VK_EXT_extended_dynamic_state2)
+    #define VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_EXT_extended_dynamic_state2(function) \
+        function(CmdSetPatchControlPointsEXT) \
+        function(CmdSetRasterizerDiscardEnableEXT) \
+        function(CmdSetDepthBiasEnableEXT) \
+        function(CmdSetLogicOpEXT) \
+        function(CmdSetPrimitiveRestartEnableEXT)
+#else
+    #define VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_EXT_extended_dynamic_state2(function)
+#endif // VK_EXT_extended_dynamic_state2
+
+#if defined(VK_KHR_push_descriptor)
+    #define VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_KHR_push_descriptor(function) \
+        function(CmdPushDescriptorSetKHR) \
+        function(CmdPushDescriptorSetWithTemplateKHR)
+#else
+    #define VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_KHR_push_descriptor(function)
+#endif // VK_KHR_push_descriptor
+
+#define VULKANDYNAMIC_STATE_FILTER_FUNCTIONS(function) \
+    VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_VERSION_1_0(function) \
+    VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_KHR_push_descriptor(function) \
+    VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_EXT_extended_dynamic_state(function) \
+    VULKANDYNAMIC_STATE_FILTER_FUNCTIONS_EXT_extended_dynamic_state2(function)
+
+#define VULKANDYNAMIC_STATE_FILTER_FILTERED_FUNCTION(function) \
+    template<> \
+    struct IsFilteredFunction<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_##function> : ::std::true_type \
+    { \
+    };
+
+// Like VULKANDYNAMIC_HANDLE_FORWARD_FUNCTION, but routed through the state filter.
+#define VULKANDYNAMIC_STATE_FILTER_FORWARD_FUNCTION(function) \
+    template<typename... Args> \
+    auto function(Args&&... args) -> decltype(::std::declval<const Dispatch&>().function(::std::declval<const Handle&>(), ::std::forward<Args>(args)...)) \
+    { \
+        Record<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_##function>(dispatch_->function, ::std::forward<Args>(args)...); \
+    }
+
+namespace VulkanDynamic
+{
+    namespace Detail
+    {
+        template<::uint32_t FunctionId>
+        struct FunctionTag
+        {
+        };
+
+        template<::uint32_t FunctionId>
+        struct IsFilteredFunction : ::std::false_type
+        {
+        };
+
+        VULKANDYNAMIC_STATE_FILTER_FUNCTIONS(VULKANDYNAMIC_STATE_FILTER_FILTERED_FUNCTION)
+
+        // Last value set for one piece of command buffer state. Values are compared
+        // bitwise, which never elides a real change.
+        template<typename T>
+        class Shadow
+        {
+        public:
+            bool Set(const T& value) noexcept
+            {
+                if (valid_ && ::std::memcmp(&value_, &value, sizeof(T)) == 0)
+                {
+                    return false;
+                }
+
+                value_ = value;
+                valid_ = true;
+                return true;
+            }
+
+            void Invalidate() noexcept
+            {
+                valid_ = false;
+            }
+
+        private:
+            T value_{};
+            bool valid_{ false };
+        };
+    } // namespace Detail
+
+    //------------------------------------------------------------------------------------
+    // Filtering Command Buffer Recorder
+    //------------------------------------------------------------------------------------
+
+    // Non-owning recorder that shadows the bound pipelines, descriptor sets, vertex buffers,
+    // viewports, scissors and extended dynamic state of one command buffer, and drops calls
+    // that would not change them. Calls that change part of an indexed range are trimmed to
+    // the changed part. Everything else is forwarded unchanged.
+    //
+    // The shadows start unknown and are reset by Invalidate(), which is needed whenever the
+    // command buffer state changes behind the recorder, e.g. when it is begun again.
+    // vkCmdExecuteCommands invalidates them. A forwarded graphics pipeline bind forgets the
+    // viewports, scissors and extended dynamic state, which static pipeline state may
+    // overwrite, and push descriptors forget the descriptor sets of their bind point.
+    class FilteringCommandBufferRecorder : public Detail::DispatchHandle<::VkCommandBuffer, DeviceDispatch>
+    {
+    public:
+        static constexpr ::uint32_t MaxDescriptorSets = 32;
+        static constexpr ::uint32_t MaxVertexInputBindings = 32;
+        static constexpr ::uint32_t MaxViewports = 16;
+
+        explicit FilteringCommandBufferRecorder(::VkCommandBuffer commandBuffer, const DeviceDispatch& deviceDispatch) noexcept
+            : DispatchHandle{ commandBuffer, &deviceDispatch }
+        {
+        }
+
+        FilteringCommandBufferRecorder() noexcept = default;
+
+        void Invalidate() noexcept
+        {
+            state_ = State{};
+        }
+
+        ::uint64_t ElidedCallCount(::uint32_t functionId) const noexcept
+        {
+            return functionId < VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_COUNT ? elided_[functionId] : 0;
+        }
+
+        ::uint64_t ElidedCallCount() const noexcept
+        {
+            ::uint64_t count = 0;
+            for (::uint64_t elided : elided_)
+            {
+                count += elided;
+            }
+
+            return count;
+        }
+
+        VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS(VULKANDYNAMIC_STATE_FILTER_FORWARD_FUNCTION)
+
+    private:
+        template<::uint32_t FunctionId, typename Function, typename... Args>
+        void Record(Function function, Args&&... args)
+        {
+            Route<FunctionId>(Detail::IsFilteredFunction<FunctionId>{}, function, ::std::forward<Args>(args)...);
+        }
+
+        template<::uint32_t FunctionId, typename Function, typename... Args>
+        void Route(::std::false_type, Function function, Args&&... args)
+        {
+            function(handle_, ::std::forward<Args>(args)...);
+        }
+
+        // Filter overloads take the exact parameter types, so arguments convert as they
+        // would for the entry point itself.
+        template<::uint32_t FunctionId, typename Function, typename... Args>
+        void Route(::std::true_type, Function, Args&&... args)
+        {
+            Filter(Detail::FunctionTag<FunctionId>{}, ::std::forward<Args>(args)...);
+        }
+
+        template<typename T>
+        void FilterValue(::uint32_t functionId, Detail::Shadow<T>& shadow, T value, void (VKAPI_PTR* function)(::VkCommandBuffer, T))
+        {
+            if (shadow.Set(value))
+            {
+                function(handle_, value);
+            }
+            else
+            {
+                ++elided_[functionId];
+            }
+        }
+
+        // Updates shadows[first, first + count) from value(i) and narrows [begin, end) to the
+        // changed entries. Returns false if nothing changed. Ranges past the shadows are
+        // never elided.
+        template<typename T, ::size_t Size, typename Value>
+        static bool FilterRange(Detail::Shadow<T> (&shadows)[Size], ::uint32_t first, ::uint32_t count, Value value, ::uint32_t& begin, ::uint32_t& end) noexcept
+        {
+            if (first >= Size || count > Size - first)
+            {
+                for (::uint32_t index = first; index < Size; ++index)
+                {
+                    shadows[index].Invalidate();
+                }
+
+                begin = 0;
+                end = count;
+                return true;
+            }
+
+            begin = count;
+            end = 0;
+            for (::uint32_t index = 0; index < count; ++index)
+            {
+                if (shadows[first + index].Set(value(index)))
+                {
+                    begin = index < begin ? index : begin;
+                    end = index + 1;
+                }
+            }
+
+            return begin < end;
+        }
+
+        void ForgetDescriptorSets(::uint32_t bindPoint) noexcept
+        {
+            for (DescriptorSetBinding& binding : state_.descriptorSets[bindPoint])
+            {
+                binding = DescriptorSetBinding{};
+            }
+        }
+
+        static ::uint32_t BindPointIndex(::VkPipelineBindPoint pipelineBindPoint) noexcept
+        {
+            switch (pipelineBindPoint)
+            {
+            case VK_PIPELINE_BIND_POINT_GRAPHICS:
+                return 0;
+
+            case VK_PIPELINE_BIND_POINT_COMPUTE:
+                return 1;
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+            case VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR:
+                return 2;
+#endif // VK_KHR_ray_tracing_pipeline
+
+            default:
+                return BindPointCount;
+            }
+        }
+
+        //--------------------------------------------------------------------------------
+        // Vulkan Core 1.0
+        //--------------------------------------------------------------------------------
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdBindPipeline>, ::VkPipelineBindPoint pipelineBindPoint, ::VkPipeline pipeline)
+        {
+            const ::uint32_t bindPoint = BindPointIndex(pipelineBindPoint);
+            if (bindPoint < BindPointCount && !state_.pipelines[bindPoint].Set(pipeline))
+            {
+                ++elided_[VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdBindPipeline];
+                return;
+            }
+
+            dispatch_->CmdBindPipeline(handle_, pipelineBindPoint, pipeline);
+
+            if (pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS)
+            {
+                state_.dynamic = DynamicState{};
+            }
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetViewport>, ::uint32_t firstViewport, ::uint32_t viewportCount, const ::VkViewport* pViewports)
+        {
+            ::uint32_t begin, end;
+            if (!FilterRange(state_.dynamic.viewports, firstViewport, viewportCount, [pViewports](::uint32_t index) { return pViewports[index]; }, begin, end))
+            {
+                ++elided_[VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetViewport];
+                return;
+            }
+
+            dispatch_->CmdSetViewport(handle_, firstViewport + begin, end - begin, pViewports + begin);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetScissor>, ::uint32_t firstScissor, ::uint32_t scissorCount, const ::VkRect2D* pScissors)
+        {
+            ::uint32_t begin, end;
+            if (!FilterRange(state_.dynamic.scissors, firstScissor, scissorCount, [pScissors](::uint32_t index) { return pScissors[index]; }, begin, end))
+            {
+                ++elided_[VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetScissor];
+                return;
+            }
+
+            dispatch_->CmdSetScissor(handle_, firstScissor + begin, end - begin, pScissors + begin);
+        }
+
+        // Calls with dynamic offsets are always forwarded. Sets bound with another pipeline
+        // layout are forgotten on every forwarded call, as they may have been disturbed.
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdBindDescriptorSets>, ::VkPipelineBindPoint pipelineBindPoint, ::VkPipelineLayout layout,
+            ::uint32_t firstSet, ::uint32_t descriptorSetCount, const ::VkDescriptorSet* pDescriptorSets, ::uint32_t dynamicOffsetCount, const ::uint32_t* pDynamicOffsets)
+        {
+            const ::uint32_t bindPoint = BindPointIndex(pipelineBindPoint);
+            const bool filtered = bindPoint < BindPointCount && firstSet < MaxDescriptorSets && descriptorSetCount <= MaxDescriptorSets - firstSet;
+
+            bool changed = !filtered || dynamicOffsetCount != 0;
+            for (::uint32_t index = 0; index < descriptorSetCount && !changed; ++index)
+            {
+                const DescriptorSetBinding& binding = state_.descriptorSets[bindPoint][firstSet + index];
+                changed = binding.layout != layout || binding.descriptorSet != pDescriptorSets[index];
+            }
+
+            if (!changed)
+            {
+                ++elided_[VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdBindDescriptorSets];
+                return;
+            }
+
+            dispatch_->CmdBindDescriptorSets(handle_, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+
+            if (bindPoint < BindPointCount)
+            {
+                for (DescriptorSetBinding& binding : state_.descriptorSets[bindPoint])
+                {
+                    binding = binding.layout == layout ? binding : DescriptorSetBinding{};
+                }
+
+                for (::uint32_t index = 0; filtered && index < descriptorSetCount; ++index)
+                {
+                    state_.descriptorSets[bindPoint][firstSet + index] = DescriptorSetBinding{ layout, pDescriptorSets[index] };
+                }
+            }
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdBindVertexBuffers>, ::uint32_t firstBinding, ::uint32_t bindingCount, const ::VkBuffer* pBuffers, const ::VkDeviceSize* pOffsets)
+        {
+            ::uint32_t begin, end;
+            if (!FilterRange(state_.vertexBuffers, firstBinding, bindingCount, [pBuffers, pOffsets](::uint32_t index) { return VertexBufferBinding{ pBuffers[index], pOffsets[index] }; }, begin, end))
+            {
+                ++elided_[VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdBindVertexBuffers];
+                return;
+            }
+
+            dispatch_->CmdBindVertexBuffers(handle_, firstBinding + begin, end - begin, pBuffers + begin, pOffsets + begin);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdExecuteCommands>, ::uint32_t commandBufferCount, const ::VkCommandBuffer* pCommandBuffers)
+        {
+            dispatch_->CmdExecuteCommands(handle_, commandBufferCount, pCommandBuffers);
+            Invalidate();
+        }
+
+        //--------------------------------------------------------------------------------
+        // VK_KHR_push_descriptor
+        //--------------------------------------------------------------------------------
+
+#if defined(VK_KHR_push_descriptor)
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdPushDescriptorSetKHR>, ::VkPipelineBindPoint pipelineBindPoint, ::VkPipelineLayout layout,
+            ::uint32_t set, ::uint32_t descriptorWriteCount, const ::VkWriteDescriptorSet* pDescriptorWrites)
+        {
+            dispatch_->CmdPushDescriptorSetKHR(handle_, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+
+            const ::uint32_t bindPoint = BindPointIndex(pipelineBindPoint);
+            if (bindPoint < BindPointCount)
+            {
+                ForgetDescriptorSets(bindPoint);
+            }
+        }
+
+        // The template's bind point is not known here, so every bind point forgets its sets.
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdPushDescriptorSetWithTemplateKHR>, ::VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+            ::VkPipelineLayout layout, ::uint32_t set, const void* pData)
+        {
+            dispatch_->CmdPushDescriptorSetWithTemplateKHR(handle_, descriptorUpdateTemplate, layout, set, pData);
+
+            for (::uint32_t bindPoint = 0; bindPoint < BindPointCount; ++bindPoint)
+            {
+                ForgetDescriptorSets(bindPoint);
+            }
+        }
+#endif // VK_KHR_push_descriptor
+
+        //--------------------------------------------------------------------------------
+        // VK_EXT_extended_dynamic_state
+        //--------------------------------------------------------------------------------
+
+#if defined(VK_EXT_extended_dynamic_state)
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetCullModeEXT>, ::VkCullModeFlags cullMode)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetCullModeEXT, state_.dynamic.cullMode, cullMode, dispatch_->CmdSetCullModeEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdBindVertexBuffers2EXT>, ::uint32_t firstBinding, ::uint32_t bindingCount, const ::VkBuffer* pBuffers,
+            const ::VkDeviceSize* pOffsets, const ::VkDeviceSize* pSizes, const ::VkDeviceSize* pStrides)
+        {
+            dispatch_->CmdBindVertexBuffers2EXT(handle_, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+            for (Detail::Shadow<VertexBufferBinding>& vertexBuffer : state_.vertexBuffers)
+            {
+                vertexBuffer.Invalidate();
+            }
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetFrontFaceEXT>, ::VkFrontFace frontFace)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetFrontFaceEXT, state_.dynamic.frontFace, frontFace, dispatch_->CmdSetFrontFaceEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetPrimitiveTopologyEXT>, ::VkPrimitiveTopology primitiveTopology)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetPrimitiveTopologyEXT, state_.dynamic.primitiveTopology, primitiveTopology, dispatch_->CmdSetPrimitiveTopologyEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetViewportWithCountEXT>, ::uint32_t viewportCount, const ::VkViewport* pViewports)
+        {
+            dispatch_->CmdSetViewportWithCountEXT(handle_, viewportCount, pViewports);
+            for (Detail::Shadow<::VkViewport>& viewport : state_.dynamic.viewports)
+            {
+                viewport.Invalidate();
+            }
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetScissorWithCountEXT>, ::uint32_t scissorCount, const ::VkRect2D* pScissors)
+        {
+            dispatch_->CmdSetScissorWithCountEXT(handle_, scissorCount, pScissors);
+            for (Detail::Shadow<::VkRect2D>& scissor : state_.dynamic.scissors)
+            {
+                scissor.Invalidate();
+            }
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetDepthTestEnableEXT>, ::VkBool32 depthTestEnable)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetDepthTestEnableEXT, state_.dynamic.depthTestEnable, depthTestEnable, dispatch_->CmdSetDepthTestEnableEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetDepthWriteEnableEXT>, ::VkBool32 depthWriteEnable)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetDepthWriteEnableEXT, state_.dynamic.depthWriteEnable, depthWriteEnable, dispatch_->CmdSetDepthWriteEnableEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetDepthBoundsTestEnableEXT>, ::VkBool32 depthBoundsTestEnable)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetDepthBoundsTestEnableEXT, state_.dynamic.depthBoundsTestEnable, depthBoundsTestEnable, dispatch_->CmdSetDepthBoundsTestEnableEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetDepthCompareOpEXT>, ::VkCompareOp depthCompareOp)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetDepthCompareOpEXT, state_.dynamic.depthCompareOp, depthCompareOp, dispatch_->CmdSetDepthCompareOpEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetStencilTestEnableEXT>, ::VkBool32 stencilTestEnable)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetStencilTestEnableEXT, state_.dynamic.stencilTestEnable, stencilTestEnable, dispatch_->CmdSetStencilTestEnableEXT);
+        }
+
+        // Forwarded with the caller's face mask when either selected face changes.
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetStencilOpEXT>, ::VkStencilFaceFlags faceMask, ::VkStencilOp failOp, ::VkStencilOp passOp,
+            ::VkStencilOp depthFailOp, ::VkCompareOp compareOp)
+        {
+            const StencilOp stencilOp{ failOp, passOp, depthFailOp, compareOp };
+
+            bool changed = false;
+            changed = ((faceMask & VK_STENCIL_FACE_FRONT_BIT) && state_.dynamic.stencilOps[0].Set(stencilOp)) || changed;
+            changed = ((faceMask & VK_STENCIL_FACE_BACK_BIT) && state_.dynamic.stencilOps[1].Set(stencilOp)) || changed;
+            if (!changed)
+            {
+                ++elided_[VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetStencilOpEXT];
+                return;
+            }
+
+            dispatch_->CmdSetStencilOpEXT(handle_, faceMask, failOp, passOp, depthFailOp, compareOp);
+        }
+#endif // VK_EXT_extended_dynamic_state
+
+        //--------------------------------------------------------------------------------
+        // VK_EXT_extended_dynamic_state2
+        //--------------------------------------------------------------------------------
+
+#if defined(VK_EXT_extended_dynamic_state2)
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetPatchControlPointsEXT>, ::uint32_t patchControlPoints)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetPatchControlPointsEXT, state_.dynamic.patchControlPoints, patchControlPoints, dispatch_->CmdSetPatchControlPointsEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetRasterizerDiscardEnableEXT>, ::VkBool32 rasterizerDiscardEnable)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetRasterizerDiscardEnableEXT, state_.dynamic.rasterizerDiscardEnable, rasterizerDiscardEnable, dispatch_->CmdSetRasterizerDiscardEnableEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetDepthBiasEnableEXT>, ::VkBool32 depthBiasEnable)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetDepthBiasEnableEXT, state_.dynamic.depthBiasEnable, depthBiasEnable, dispatch_->CmdSetDepthBiasEnableEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetLogicOpEXT>, ::VkLogicOp logicOp)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetLogicOpEXT, state_.dynamic.logicOp, logicOp, dispatch_->CmdSetLogicOpEXT);
+        }
+
+        void Filter(Detail::FunctionTag<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetPrimitiveRestartEnableEXT>, ::VkBool32 primitiveRestartEnable)
+        {
+            FilterValue(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetPrimitiveRestartEnableEXT, state_.dynamic.primitiveRestartEnable, primitiveRestartEnable, dispatch_->CmdSetPrimitiveRestartEnableEXT);
+        }
+#endif // VK_EXT_extended_dynamic_state2
+
+    private:
+        static constexpr ::uint32_t BindPointCount = 3;
+
+        struct DescriptorSetBinding
+        {
+            ::VkPipelineLayout layout;
+            ::VkDescriptorSet descriptorSet;
+        };
+
+        struct VertexBufferBinding
+        {
+            ::VkBuffer buffer;
+            ::VkDeviceSize offset;
+        };
+
+        struct StencilOp
+        {
+            ::VkStencilOp failOp;
+            ::VkStencilOp passOp;
+            ::VkStencilOp depthFailOp;
+            ::VkCompareOp compareOp;
+        };
+
+        // State a graphics pipeline bind may overwrite with static pipeline state.
+        struct DynamicState
+        {
+            Detail::Shadow<::VkViewport> viewports[MaxViewports];
+            Detail::Shadow<::VkRect2D> scissors[MaxViewports];
+            Detail::Shadow<::VkCullModeFlags> cullMode;
+            Detail::Shadow<::VkFrontFace> frontFace;
+            Detail::Shadow<::VkPrimitiveTopology> primitiveTopology;
+            Detail::Shadow<::VkBool32> depthTestEnable;
+            Detail::Shadow<::VkBool32> depthWriteEnable;
+            Detail::Shadow<::VkBool32> depthBoundsTestEnable;
+            Detail::Shadow<::VkCompareOp> depthCompareOp;
+            Detail::Shadow<::VkBool32> stencilTestEnable;
+            Detail::Shadow<StencilOp> stencilOps[2];
+            Detail::Shadow<::uint32_t> patchControlPoints;
+            Detail::Shadow<::VkBool32> rasterizerDiscardEnable;
+            Detail::Shadow<::VkBool32> depthBiasEnable;
+            Detail::Shadow<::VkLogicOp> logicOp;
+            Detail::Shadow<::VkBool32> primitiveRestartEnable;
+        };
+
+        // Everything Invalidate() forgets.
+        struct State
+        {
+            Detail::Shadow<::VkPipeline> pipelines[BindPointCount];
+            DescriptorSetBinding descriptorSets[BindPointCount][MaxDescriptorSets]{};
+            Detail::Shadow<VertexBufferBinding> vertexBuffers[MaxVertexInputBindings];
+            DynamicState dynamic;
+        };
+
+        State state_;
+        ::uint64_t elided_[VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_COUNT]{};
+    };
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_STATE_FILTER_HPP__
@@ -0,0 +1,84 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_SUBMIT_H__
+#define __VULKANDYNAMIC_SUBMIT_H__
+
+// Asynchronous queue submission. A submit queue owns one thread that issues the
+// vkQueueSubmit, vkQueueSubmit2KHR and vkQueuePresentKHR calls enqueued on it to one
+// VkQueue, through a device table the caller keeps alive. Enqueueing takes no locks, so any
+// number of threads may enqueue at once without waiting on the driver; requests are issued
+// in the order they were enqueued, which keeps presents behind the submits before them.
+// The VkQueue must not be used directly while a submit queue owns it.
+//
+// Submit queues do not order requests against each other: each thread issues as soon as
+// it dequeues. Vulkan requires the signal of a binary semaphore to be submitted before any
+// wait on it, so a binary semaphore must be signaled and waited through the same submit
+// queue, or the signaling request must have been issued (its callback has run, or
+// VulkanDynamicWaitSubmitQueueIdle returned on its queue) before the waiting request is
+// enqueued. Dependencies between submit queues should use timeline semaphores, whose
+// waits may be submitted before their signals.
+//
+// Arguments are copied deeply like captured calls (see VulkanDynamicCapture.h), so the
+// caller's structures and arrays may be reused as soon as an enqueue returns. Requests with
+// pNext structures that cannot be copied are refused with VK_ERROR_FEATURE_NOT_PRESENT.
+// The callback of a request, if any, runs on the submit thread as soon as the call has
+// been issued, with the result the driver returned. It reports the issue, not the
+// completion of the work on the device, which fences and semaphores are for. pResults of
+// a present is not written.
+
+#include "VulkanDynamic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VK_DEFINE_HANDLE(VulkanDynamicSubmitQueue);
+
+typedef void (VKAPI_PTR* PFN_VulkanDynamicSubmitCallback)(void* userData, VkResult result);
+
+typedef struct VulkanDynamicSubmitQueueStatistics
+{
+    uint64_t enqueuedCount;
+    uint64_t issuedCount;
+    uint64_t failedCount;
+} VulkanDynamicSubmitQueueStatistics;
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateSubmitQueue(const VulkanDynamicDeviceDispatch* dispatch, VkQueue queue, VulkanDynamicSubmitQueue* submitQueue);
+
+// Issues the requests still enqueued, then stops the thread.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroySubmitQueue(VulkanDynamicSubmitQueue submitQueue);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicEnqueueSubmit(VulkanDynamicSubmitQueue submitQueue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, PFN_VulkanDynamicSubmitCallback callback, void* userData);
+
+#if defined(VK_KHR_synchronization2)
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicEnqueueSubmit2KHR(VulkanDynamicSubmitQueue submitQueue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits, VkFence fence, PFN_VulkanDynamicSubmitCallback callback, void* userData);
+#endif // VK_KHR_synchronization2
+
+#if defined(VK_KHR_swapchain)
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicEnqueuePresentKHR(VulkanDynamicSubmitQueue submitQueue, const VkPresentInfoKHR* pPresentInfo, PFN_VulkanDynamicSubmitCallback callback, void* userData);
+#endif // VK_KHR_swapchain
+
+// Waits until every request enqueued before the call has been issued and its callback has
+// returned. This does not wait for the device; use fences or vkQueueWaitIdle afterwards.
+// Must not be called from a callback.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicWaitSubmitQueueIdle(VulkanDynamicSubmitQueue submitQueue);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetSubmitQueueStatistics(VulkanDynamicSubmitQueue submitQueue, VulkanDynamicSubmitQueueStatistics* statistics);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_SUBMIT_H__
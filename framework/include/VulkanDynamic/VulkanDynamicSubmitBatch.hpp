@@ -0,0 +1,392 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_SUBMIT_BATCH_HPP__
+#define __VULKANDYNAMIC_SUBMIT_BATCH_HPP__
+
+#include "VulkanDynamicHandles.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace VulkanDynamic
+{
+    namespace Detail
+    {
+        // One batch of a pending submit; arrays are offsets into the storage of the batcher,
+        // as it may grow before the batch is flushed.
+        struct PendingSubmit
+        {
+            ::uint32_t waitSemaphoreOffset;
+            ::uint32_t waitSemaphoreCount;
+            ::uint32_t waitStageMaskOffset;
+            ::uint32_t commandBufferOffset;
+            ::uint32_t commandBufferCount;
+            ::uint32_t signalSemaphoreOffset;
+            ::uint32_t signalSemaphoreCount;
+            ::uint32_t waitSemaphoreValueOffset;
+            ::uint32_t waitSemaphoreValueCount;
+            ::uint32_t signalSemaphoreValueOffset;
+            ::uint32_t signalSemaphoreValueCount;
+            bool timelineSemaphoreValues;
+            ::VkFlags flags;
+        };
+
+        template<typename T>
+        inline ::uint32_t Append(::std::vector<T>& storage, ::uint32_t count, const T* elements)
+        {
+            const ::uint32_t offset = static_cast<::uint32_t>(storage.size());
+            if (count)
+            {
+                storage.insert(storage.end(), elements, elements + count);
+            }
+
+            return offset;
+        }
+
+        template<typename T>
+        inline const T* ElementsAt(const ::std::vector<T>& storage, ::uint32_t offset, ::uint32_t count) noexcept
+        {
+            return count ? storage.data() + offset : nullptr;
+        }
+    } // namespace Detail
+
+    struct SubmitBatchStatistics
+    {
+        ::uint64_t submitCallCount;
+        ::uint64_t emittedCallCount;
+        ::uint64_t batchCount;
+    };
+
+    //------------------------------------------------------------------------------------
+    // Submit Batch
+    //------------------------------------------------------------------------------------
+
+    // Collects the batches of vkQueueSubmit or vkQueueSubmit2KHR calls on one queue and
+    // submits them in one call. Batches keep their order, so the semaphore operations
+    // between them behave as with separate calls. A submit with a fence flushes, and the
+    // fence is attached to the combined call: a fence covers every batch submitted to the
+    // queue before it, so it signals at the same point.
+    //
+    // Pending batches are flushed when maxBatchCount is reached, when a call comes in after
+    // the oldest pending batch has waited maxDelay, at Flush(), before vkQueuePresentKHR and
+    // vkQueueWaitIdle, and in the destructor; there is no timer. Callers must flush before a
+    // submit on another queue or a host wait depends on a semaphore signaled here. Submits
+    // with pNext chains other than VkTimelineSemaphoreSubmitInfo, or mixing the two entry
+    // points, flush the pending batches and are then issued as they are.
+    //
+    // As with the queue itself, access must be externally synchronized. Errors of a flush
+    // are returned by the call that caused it; pending batches are dropped either way.
+    class SubmitBatch : public Detail::DispatchHandle<::VkQueue, DeviceDispatch>
+    {
+    public:
+        explicit SubmitBatch(::VkQueue queue, const DeviceDispatch& deviceDispatch, ::uint32_t maxBatchCount = 64, ::std::chrono::steady_clock::duration maxDelay = ::std::chrono::milliseconds{ 2 }) noexcept
+            : DispatchHandle{ queue, &deviceDispatch }
+            , maxBatchCount_{ maxBatchCount }
+            , maxDelay_{ maxDelay }
+        {
+        }
+
+        SubmitBatch(const SubmitBatch&) noexcept = delete;
+
+        ~SubmitBatch() noexcept
+        {
+            Flush();
+        }
+
+        SubmitBatch& operator=(const SubmitBatch&) noexcept = delete;
+
+        ::VkResult QueueSubmit(::uint32_t submitCount, const ::VkSubmitInfo* pSubmits, ::VkFence fence)
+        {
+            ++statistics_.submitCallCount;
+
+            if (synchronization2_ || !Batchable(submitCount, pSubmits))
+            {
+                return Forward(&DeviceDispatch::QueueSubmit, submitCount, pSubmits, fence);
+            }
+
+            Begin();
+            for (::uint32_t index = 0; index < submitCount; ++index)
+            {
+                const ::VkSubmitInfo& submit = pSubmits[index];
+                const ::VkTimelineSemaphoreSubmitInfo* values = static_cast<const ::VkTimelineSemaphoreSubmitInfo*>(submit.pNext);
+
+                Detail::PendingSubmit pending{};
+                pending.waitSemaphoreOffset = Detail::Append(semaphores_, submit.waitSemaphoreCount, submit.pWaitSemaphores);
+                pending.waitSemaphoreCount = submit.waitSemaphoreCount;
+                pending.waitStageMaskOffset = Detail::Append(waitStageMasks_, submit.waitSemaphoreCount, submit.pWaitDstStageMask);
+                pending.commandBufferOffset = Detail::Append(commandBuffers_, submit.commandBufferCount, submit.pCommandBuffers);
+                pending.commandBufferCount = submit.commandBufferCount;
+                pending.signalSemaphoreOffset = Detail::Append(semaphores_, submit.signalSemaphoreCount, submit.pSignalSemaphores);
+                pending.signalSemaphoreCount = submit.signalSemaphoreCount;
+                if (values)
+                {
+                    pending.timelineSemaphoreValues = true;
+                    pending.waitSemaphoreValueOffset = Detail::Append(semaphoreValues_, values->waitSemaphoreValueCount, values->pWaitSemaphoreValues);
+                    pending.waitSemaphoreValueCount = values->waitSemaphoreValueCount;
+                    pending.signalSemaphoreValueOffset = Detail::Append(semaphoreValues_, values->signalSemaphoreValueCount, values->pSignalSemaphoreValues);
+                    pending.signalSemaphoreValueCount = values->signalSemaphoreValueCount;
+                }
+
+                pending_.push_back(pending);
+            }
+
+            return End(fence);
+        }
+
+#if defined(VK_KHR_synchronization2)
+        ::VkResult QueueSubmit2KHR(::uint32_t submitCount, const ::VkSubmitInfo2KHR* pSubmits, ::VkFence fence)
+        {
+            ++statistics_.submitCallCount;
+
+            if ((!pending_.empty() && !synchronization2_) || !Batchable(submitCount, pSubmits))
+            {
+                return Forward(&DeviceDispatch::QueueSubmit2KHR, submitCount, pSubmits, fence);
+            }
+
+            Begin();
+            synchronization2_ = true;
+            for (::uint32_t index = 0; index < submitCount; ++index)
+            {
+                const ::VkSubmitInfo2KHR& submit = pSubmits[index];
+
+                Detail::PendingSubmit pending{};
+                pending.flags = submit.flags;
+                pending.waitSemaphoreOffset = Detail::Append(semaphoreInfos_, submit.waitSemaphoreInfoCount, submit.pWaitSemaphoreInfos);
+                pending.waitSemaphoreCount = submit.waitSemaphoreInfoCount;
+                pending.commandBufferOffset = Detail::Append(commandBufferInfos_, submit.commandBufferInfoCount, submit.pCommandBufferInfos);
+                pending.commandBufferCount = submit.commandBufferInfoCount;
+                pending.signalSemaphoreOffset = Detail::Append(semaphoreInfos_, submit.signalSemaphoreInfoCount, submit.pSignalSemaphoreInfos);
+                pending.signalSemaphoreCount = submit.signalSemaphoreInfoCount;
+                pending_.push_back(pending);
+            }
+
+            return End(fence);
+        }
+#endif // VK_KHR_synchronization2
+
+#if defined(VK_KHR_swapchain)
+        ::VkResult QueuePresentKHR(const ::VkPresentInfoKHR* pPresentInfo)
+        {
+            const ::VkResult result = Flush();
+            if (result != VK_SUCCESS)
+            {
+                return result;
+            }
+
+            return dispatch_->QueuePresentKHR(handle_, pPresentInfo);
+        }
+#endif // VK_KHR_swapchain
+
+        ::VkResult QueueWaitIdle()
+        {
+            const ::VkResult result = Flush();
+            if (result != VK_SUCCESS)
+            {
+                return result;
+            }
+
+            return dispatch_->QueueWaitIdle(handle_);
+        }
+
+        ::VkResult Flush()
+        {
+            return pending_.empty() ? VK_SUCCESS : Submit(VK_NULL_HANDLE);
+        }
+
+        const SubmitBatchStatistics& Statistics() const noexcept
+        {
+            return statistics_;
+        }
+
+    private:
+        static bool Batchable(::uint32_t submitCount, const ::VkSubmitInfo* pSubmits) noexcept
+        {
+            for (::uint32_t index = 0; index < submitCount; ++index)
+            {
+                const ::VkBaseInStructure* next = static_cast<const ::VkBaseInStructure*>(pSubmits[index].pNext);
+                if (next && (next->sType != VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO || next->pNext))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+#if defined(VK_KHR_synchronization2)
+        template<typename Info>
+        static bool HasNext(::uint32_t count, const Info* infos) noexcept
+        {
+            for (::uint32_t index = 0; index < count; ++index)
+            {
+                if (infos[index].pNext)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        static bool Batchable(::uint32_t submitCount, const ::VkSubmitInfo2KHR* pSubmits) noexcept
+        {
+            for (::uint32_t index = 0; index < submitCount; ++index)
+            {
+                const ::VkSubmitInfo2KHR& submit = pSubmits[index];
+                if (submit.pNext || HasNext(submit.waitSemaphoreInfoCount, submit.pWaitSemaphoreInfos) || HasNext(submit.commandBufferInfoCount, submit.pCommandBufferInfos)
+                    || HasNext(submit.signalSemaphoreInfoCount, submit.pSignalSemaphoreInfos))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+#endif // VK_KHR_synchronization2
+
+        template<typename Function, typename Info>
+        ::VkResult Forward(Function function, ::uint32_t submitCount, const Info* pSubmits, ::VkFence fence)
+        {
+            const ::VkResult result = Flush();
+            if (result != VK_SUCCESS)
+            {
+                return result;
+            }
+
+            ++statistics_.emittedCallCount;
+            statistics_.batchCount += submitCount;
+            return (dispatch_->*function)(handle_, submitCount, pSubmits, fence);
+        }
+
+        void Begin()
+        {
+            if (pending_.empty())
+            {
+                oldest_ = ::std::chrono::steady_clock::now();
+            }
+        }
+
+        ::VkResult End(::VkFence fence)
+        {
+            if (fence != VK_NULL_HANDLE || pending_.size() >= maxBatchCount_ || ::std::chrono::steady_clock::now() - oldest_ >= maxDelay_)
+            {
+                return Submit(fence);
+            }
+
+            return VK_SUCCESS;
+        }
+
+        ::VkResult Submit(::VkFence fence)
+        {
+            ::VkResult result;
+#if defined(VK_KHR_synchronization2)
+            if (synchronization2_)
+            {
+                submitInfos2_.clear();
+                for (const Detail::PendingSubmit& pending : pending_)
+                {
+                    ::VkSubmitInfo2KHR submit{};
+                    submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
+                    submit.flags = pending.flags;
+                    submit.waitSemaphoreInfoCount = pending.waitSemaphoreCount;
+                    submit.pWaitSemaphoreInfos = Detail::ElementsAt(semaphoreInfos_, pending.waitSemaphoreOffset, pending.waitSemaphoreCount);
+                    submit.commandBufferInfoCount = pending.commandBufferCount;
+                    submit.pCommandBufferInfos = Detail::ElementsAt(commandBufferInfos_, pending.commandBufferOffset, pending.commandBufferCount);
+                    submit.signalSemaphoreInfoCount = pending.signalSemaphoreCount;
+                    submit.pSignalSemaphoreInfos = Detail::ElementsAt(semaphoreInfos_, pending.signalSemaphoreOffset, pending.signalSemaphoreCount);
+                    submitInfos2_.push_back(submit);
+                }
+
+                result = dispatch_->QueueSubmit2KHR(handle_, static_cast<::uint32_t>(submitInfos2_.size()), submitInfos2_.data(), fence);
+            }
+            else
+#endif // VK_KHR_synchronization2
+            {
+                // Reserved up front: submits point into the timeline values.
+                submitInfos_.clear();
+                timelineSemaphoreInfos_.clear();
+                timelineSemaphoreInfos_.reserve(pending_.size());
+                for (const Detail::PendingSubmit& pending : pending_)
+                {
+                    ::VkSubmitInfo submit{};
+                    submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+                    submit.waitSemaphoreCount = pending.waitSemaphoreCount;
+                    submit.pWaitSemaphores = Detail::ElementsAt(semaphores_, pending.waitSemaphoreOffset, pending.waitSemaphoreCount);
+                    submit.pWaitDstStageMask = Detail::ElementsAt(waitStageMasks_, pending.waitStageMaskOffset, pending.waitSemaphoreCount);
+                    submit.commandBufferCount = pending.commandBufferCount;
+                    submit.pCommandBuffers = Detail::ElementsAt(commandBuffers_, pending.commandBufferOffset, pending.commandBufferCount);
+                    submit.signalSemaphoreCount = pending.signalSemaphoreCount;
+                    submit.pSignalSemaphores = Detail::ElementsAt(semaphores_, pending.signalSemaphoreOffset, pending.signalSemaphoreCount);
+                    if (pending.timelineSemaphoreValues)
+                    {
+                        ::VkTimelineSemaphoreSubmitInfo values{};
+                        values.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+                        values.waitSemaphoreValueCount = pending.waitSemaphoreValueCount;
+                        values.pWaitSemaphoreValues = Detail::ElementsAt(semaphoreValues_, pending.waitSemaphoreValueOffset, pending.waitSemaphoreValueCount);
+                        values.signalSemaphoreValueCount = pending.signalSemaphoreValueCount;
+                        values.pSignalSemaphoreValues = Detail::ElementsAt(semaphoreValues_, pending.signalSemaphoreValueOffset, pending.signalSemaphoreValueCount);
+                        timelineSemaphoreInfos_.push_back(values);
+                        submit.pNext = &timelineSemaphoreInfos_.back();
+                    }
+
+                    submitInfos_.push_back(submit);
+                }
+
+                result = dispatch_->QueueSubmit(handle_, static_cast<::uint32_t>(submitInfos_.size()), submitInfos_.data(), fence);
+            }
+
+            ++statistics_.emittedCallCount;
+            statistics_.batchCount += pending_.size();
+            Clear();
+            return result;
+        }
+
+        void Clear() noexcept
+        {
+            pending_.clear();
+            semaphores_.clear();
+            waitStageMasks_.clear();
+            commandBuffers_.clear();
+            semaphoreValues_.clear();
+#if defined(VK_KHR_synchronization2)
+            semaphoreInfos_.clear();
+            commandBufferInfos_.clear();
+#endif // VK_KHR_synchronization2
+            synchronization2_ = false;
+        }
+
+    private:
+        ::uint32_t maxBatchCount_;
+        ::std::chrono::steady_clock::duration maxDelay_;
+        ::std::chrono::steady_clock::time_point oldest_;
+        ::std::vector<Detail::PendingSubmit> pending_;
+        ::std::vector<::VkSemaphore> semaphores_;
+        ::std::vector<::VkPipelineStageFlags> waitStageMasks_;
+        ::std::vector<::VkCommandBuffer> commandBuffers_;
+        ::std::vector<::uint64_t> semaphoreValues_;
+        ::std::vector<::VkSubmitInfo> submitInfos_;
+        ::std::vector<::VkTimelineSemaphoreSubmitInfo> timelineSemaphoreInfos_;
+#if defined(VK_KHR_synchronization2)
+        ::std::vector<::VkSemaphoreSubmitInfoKHR> semaphoreInfos_;
+        ::std::vector<::VkCommandBufferSubmitInfoKHR> commandBufferInfos_;
+        ::std::vector<::VkSubmitInfo2KHR> submitInfos2_;
+#endif // VK_KHR_synchronization2
+        bool synchronization2_ = false;
+        SubmitBatchStatistics statistics_{};
+    };
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_SUBMIT_BATCH_HPP__
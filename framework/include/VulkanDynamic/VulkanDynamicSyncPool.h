@@ -0,0 +1,79 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_SYNC_POOL_H__
+#define __VULKANDYNAMIC_SYNC_POOL_H__
+
+// Synchronization object pools. A sync pool recycles the fences, binary semaphores and
+// timeline semaphores of one device instead of creating and destroying them. Acquired
+// fences are unsignaled: released fences are reset with one vkResetFences call per batch.
+// Each thread keeps its own free lists and only takes the pool's lock to trade objects
+// with other threads when its lists run empty or grow past a limit. The lists of a thread
+// go back to the pool when the thread exits.
+//
+// Objects must only be released once no pending queue operation uses them: fences and
+// timeline semaphores once waited on, binary semaphores once unsignaled by a wait. An
+// acquired timeline semaphore comes with its current counter value, from which its next
+// signal must increase. Destroying the pool destroys the objects it holds; objects that
+// are still acquired stay the caller's.
+
+#include "VulkanDynamic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VK_DEFINE_HANDLE(VulkanDynamicSyncPool);
+
+typedef struct VulkanDynamicSyncObjectStatistics
+{
+    uint64_t createdCount;
+    uint64_t reusedCount;
+    uint64_t releasedCount;
+} VulkanDynamicSyncObjectStatistics;
+
+typedef struct VulkanDynamicSyncPoolStatistics
+{
+    VulkanDynamicSyncObjectStatistics fences;
+    VulkanDynamicSyncObjectStatistics semaphores;
+    VulkanDynamicSyncObjectStatistics timelineSemaphores;
+    uint64_t fenceResetCallCount;
+} VulkanDynamicSyncPoolStatistics;
+
+// `dispatch` and `pAllocator` must stay valid until the pool is destroyed.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateSyncPool(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, const VkAllocationCallbacks* pAllocator, VulkanDynamicSyncPool* pool);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroySyncPool(VulkanDynamicSyncPool pool);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicAcquireFence(VulkanDynamicSyncPool pool, VkFence* pFence);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicReleaseFence(VulkanDynamicSyncPool pool, VkFence fence);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicAcquireSemaphore(VulkanDynamicSyncPool pool, VkSemaphore* pSemaphore);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicReleaseSemaphore(VulkanDynamicSyncPool pool, VkSemaphore semaphore);
+
+// Returns VK_ERROR_EXTENSION_NOT_PRESENT when the device table has no
+// vkGetSemaphoreCounterValue entry point or the headers predate Vulkan 1.2.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicAcquireTimelineSemaphore(VulkanDynamicSyncPool pool, VkSemaphore* pSemaphore, uint64_t* pValue);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicReleaseTimelineSemaphore(VulkanDynamicSyncPool pool, VkSemaphore semaphore);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetSyncPoolStatistics(VulkanDynamicSyncPool pool, VulkanDynamicSyncPoolStatistics* statistics);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_SYNC_POOL_H__
@@ -0,0 +1,53 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_TRACE_H__
+#define __VULKANDYNAMIC_TRACE_H__
+
+// Call tracing: every entry point of a traced table records its begin and end time,
+// thread and function identifier into a per-thread lock-free ring. While a trace is
+// running a background thread drains the rings into a Chrome trace event JSON file,
+// which chrome://tracing and the Perfetto UI open directly; thread ids are the operating
+// system ones. Application zones recorded with VulkanDynamicTraceBeginZone/EndZone share
+// the same clock and threads.
+//
+// As with instrumentation there is one traced table per tier and process, forwarding to
+// `next`; tracing a second, different `next` fails with VK_ERROR_TOO_MANY_OBJECTS.
+// Traced tables cost a flag check per call while no trace is running.
+
+#include "VulkanDynamic.h"
+#include "VulkanDynamicFunctions.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicTraceInstanceDispatch(const VulkanDynamicInstanceDispatch* next, VulkanDynamicInstanceDispatch* tracedDispatch);
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicTraceDeviceDispatch(const VulkanDynamicDeviceDispatch* next, VulkanDynamicDeviceDispatch* tracedDispatch);
+
+// `ringCapacity` is the number of events buffered per thread, rounded up to a power of
+// two, for threads first traced during this trace; events of a full ring are dropped
+// and reported in the trace.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicBeginTrace(const char* fileName, uint32_t ringCapacity);
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicEndTrace(void);
+
+// `name` must stay valid until the trace ends; zones nest per thread.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicTraceBeginZone(const char* name);
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicTraceEndZone(void);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_TRACE_H__
@@ -0,0 +1,66 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_WAIT_H__
+#define __VULKANDYNAMIC_WAIT_H__
+
+// Batched completion waits. A waiter owns one thread that waits for every outstanding fence
+// of a device with one vkWaitForFences call (waitAll VK_FALSE), and for every outstanding
+// timeline semaphore value with one vkWaitSemaphores call (VK_SEMAPHORE_WAIT_ANY_BIT), and
+// calls the callbacks of the waits that completed on that thread.
+//
+// Vulkan cannot interrupt a fence wait, so fence waits are issued with `fenceWaitTimeout`
+// and re-issued to pick up new waits. Timeouts under 1 ms are raised to 1 ms, so that
+// outstanding fences do not keep the thread spinning. While fences are outstanding,
+// semaphore values are polled after every fence wait, so they complete within
+// `fenceWaitTimeout`. Semaphore waits alone also wait on a timeline semaphore of the
+// waiter's own, which is signaled from the host when a wait is added. Without timeline
+// semaphore support, or with headers that predate Vulkan 1.2, semaphore waits are refused
+// with VK_ERROR_EXTENSION_NOT_PRESENT.
+
+#include "VulkanDynamic.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+VK_DEFINE_HANDLE(VulkanDynamicWaiter);
+
+// `result` is VK_SUCCESS once the wait completed, a device error such as
+// VK_ERROR_DEVICE_LOST, or VK_NOT_READY if the waiter was destroyed first.
+typedef void (VKAPI_PTR* PFN_VulkanDynamicWaitCallback)(void* userData, VkResult result);
+
+typedef struct VulkanDynamicWaiterStatistics
+{
+    uint64_t completedCount;
+    uint64_t waitCallCount;
+} VulkanDynamicWaiterStatistics;
+
+// `dispatch` must stay valid until the waiter is destroyed.
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateWaiter(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, uint64_t fenceWaitTimeout, VulkanDynamicWaiter* waiter);
+
+// Stops the thread; outstanding waits complete with VK_NOT_READY.
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyWaiter(VulkanDynamicWaiter waiter);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWaitForFenceAsync(VulkanDynamicWaiter waiter, VkFence fence, PFN_VulkanDynamicWaitCallback callback, void* userData);
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWaitForSemaphoreAsync(VulkanDynamicWaiter waiter, VkSemaphore semaphore, uint64_t value, PFN_VulkanDynamicWaitCallback callback, void* userData);
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetWaiterStatistics(VulkanDynamicWaiter waiter, VulkanDynamicWaiterStatistics* statistics);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_WAIT_H__
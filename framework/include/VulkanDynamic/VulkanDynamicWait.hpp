@@ -0,0 +1,111 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_WAIT_HPP__
+#define __VULKANDYNAMIC_WAIT_HPP__
+
+#include "VulkanDynamicWait.h"
+
+// Awaitables need C++20 coroutines and their standard header; the rest of the library only
+// needs C++11, so they are left out of older language modes and standard libraries.
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define VULKANDYNAMIC_COROUTINES 1
+#endif // __has_include(<coroutine>)
+#endif // __cpp_impl_coroutine && __has_include
+
+#if defined(VULKANDYNAMIC_COROUTINES)
+
+#include <coroutine>
+
+namespace VulkanDynamic
+{
+    //------------------------------------------------------------------------------------
+    // Completion awaitables
+    //------------------------------------------------------------------------------------
+
+    // `co_await WaitAsync(waiter, fence)` suspends the coroutine until the waiter sees the
+    // fence signaled, or the timeline semaphore reach `value`, and evaluates to the wait's
+    // VkResult. The coroutine resumes on the waiter's thread, which waits for no other
+    // completions until it suspends again; hand long work over to other threads.
+    class CompletionAwaitable
+    {
+    public:
+        CompletionAwaitable(::VulkanDynamicWaiter waiter, ::VkFence fence) noexcept : waiter_{ waiter }, fence_{ fence }
+        {
+        }
+
+        CompletionAwaitable(::VulkanDynamicWaiter waiter, ::VkSemaphore semaphore, ::uint64_t value) noexcept : waiter_{ waiter }, semaphore_{ semaphore }, value_{ value }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        // Refused waits resume the coroutine at once with their error. An accepted wait may
+        // resume, and so destroy, the coroutine before registration returns, so members are
+        // not touched after it.
+        bool await_suspend(::std::coroutine_handle<> coroutine) noexcept
+        {
+            coroutine_ = coroutine;
+
+            const ::VkResult result = fence_ != VK_NULL_HANDLE ? ::VulkanDynamicWaitForFenceAsync(waiter_, fence_, &Resume, this)
+                                                               : ::VulkanDynamicWaitForSemaphoreAsync(waiter_, semaphore_, value_, &Resume, this);
+            if (result != VK_SUCCESS)
+            {
+                result_ = result;
+                return false;
+            }
+
+            return true;
+        }
+
+        ::VkResult await_resume() const noexcept
+        {
+            return result_;
+        }
+
+    private:
+        static void VKAPI_CALL Resume(void* userData, ::VkResult result)
+        {
+            CompletionAwaitable* awaitable = static_cast<CompletionAwaitable*>(userData);
+            awaitable->result_ = result;
+            awaitable->coroutine_.resume();
+        }
+
+    private:
+        ::VulkanDynamicWaiter waiter_;
+        ::VkFence fence_{ VK_NULL_HANDLE };
+        ::VkSemaphore semaphore_{ VK_NULL_HANDLE };
+        ::uint64_t value_{ 0 };
+        ::VkResult result_{ VK_NOT_READY };
+        ::std::coroutine_handle<> coroutine_;
+    };
+
+    inline CompletionAwaitable WaitAsync(::VulkanDynamicWaiter waiter, ::VkFence fence) noexcept
+    {
+        return CompletionAwaitable{ waiter, fence };
+    }
+
+    inline CompletionAwaitable WaitAsync(::VulkanDynamicWaiter waiter, ::VkSemaphore semaphore, ::uint64_t value) noexcept
+    {
+        return CompletionAwaitable{ waiter, semaphore, value };
+    }
+} // namespace VulkanDynamic
+
+#endif // VULKANDYNAMIC_COROUTINES
+
+#endif // __VULKANDYNAMIC_WAIT_HPP__
@@ -0,0 +1,89 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_ALIGNED_HPP__
+#define __VULKANDYNAMIC_ALIGNED_HPP__
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if defined(_WIN32)
+    #include <malloc.h>
+#endif // _WIN32
+
+namespace VulkanDynamic
+{
+    namespace Detail
+    {
+        // Before C++17 `new` only guarantees alignof(std::max_align_t), so cache-line
+        // aligned objects allocated on the heap would share lines after all. They are
+        // allocated with the requested alignment through the platform instead.
+        inline void* AlignedAllocate(::std::size_t size, ::std::size_t alignment) noexcept
+        {
+#if defined(_WIN32)
+            return ::_aligned_malloc(size, alignment);
+#else
+            void* memory = nullptr;
+            return ::posix_memalign(&memory, alignment < sizeof(void*) ? sizeof(void*) : alignment, size) == 0 ? memory : nullptr;
+#endif // _WIN32
+        }
+
+        inline void AlignedFree(void* memory) noexcept
+        {
+#if defined(_WIN32)
+            ::_aligned_free(memory);
+#else
+            ::free(memory);
+#endif // _WIN32
+        }
+
+        template<typename T>
+        struct AlignedDelete
+        {
+            void operator()(T* object) const noexcept
+            {
+                object->~T();
+                AlignedFree(object);
+            }
+        };
+
+        template<typename T>
+        using AlignedPointer = ::std::unique_ptr<T, AlignedDelete<T>>;
+
+        template<typename T, typename... Args>
+        AlignedPointer<T> MakeAligned(Args&&... args)
+        {
+            void* memory = AlignedAllocate(sizeof(T), alignof(T));
+            if (!memory)
+            {
+                throw ::std::bad_alloc{};
+            }
+
+            try
+            {
+                return AlignedPointer<T>{ new (memory) T(::std::forward<Args>(args)...) };
+            }
+            catch (...)
+            {
+                AlignedFree(memory);
+                throw;
+            }
+        }
+    } // namespace Detail
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_ALIGNED_HPP__
@@ -0,0 +1,193 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_HASH_HPP__
+#define __VULKANDYNAMIC_HASH_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+
+    #define VULKANDYNAMIC_HASH_SSE2 1
+#endif
+
+namespace VulkanDynamic
+{
+    namespace Detail
+    {
+        //------------------------------------------------------------------------------------
+        // 128-bit hash
+        //------------------------------------------------------------------------------------
+
+        // A non-cryptographic 128-bit hash in the style of XXH3's long-input loop: four
+        // 64-bit lanes each accumulate the product of the halves of a keyed input word,
+        // and the unkeyed word of the neighbouring lane, over 32-byte stripes. Each stripe
+        // of a 16-stripe block takes its keys from its own offset into a secret, so equal
+        // stripes at different offsets do not cancel out. The lanes are scrambled after
+        // each block and mixed down to two 64-bit words at the end. With SSE2 two lanes
+        // share a register; the scalar loop computes the same hash.
+        struct Hash128
+        {
+            ::uint64_t low;
+            ::uint64_t high;
+
+            bool operator==(const Hash128& other) const noexcept
+            {
+                return low == other.low && high == other.high;
+            }
+        };
+
+        namespace HashConstants
+        {
+            constexpr ::size_t StripeSize = 32;
+            constexpr ::size_t StripesPerBlock = 16;
+            constexpr ::uint32_t ScrambleMultiplier = 0x9E3779B1u;
+
+            // Stripe s of a block keys lane l with Secret[s + l].
+            constexpr ::uint64_t Secret[StripesPerBlock + 3] = {
+                0xDAEB8EBD244A330Dull, 0x685BD8519D0023DBull, 0x959EF8713231C2CBull, 0xD1EA2FA4DD9AF44Dull,
+                0xA402CBA46B82BDDDull, 0x4F7580CD7B17A39Full, 0xC8B045B99D6FB287ull, 0xCECA0CA0C351E0A7ull,
+                0x38987F53584DF3C9ull, 0xBB74476EE0B6E30Full, 0x9474C83868219521ull, 0xA309F5FBA2117B35ull,
+                0xF901131499F29AADull, 0x6568525F65BE34AFull, 0xE61C980E7426B629ull, 0xF330A10B9EFE9905ull,
+                0x39381640553D574Dull, 0x0E6C783BD0D3AAC1ull, 0x992877185800058Bull,
+            };
+            constexpr ::uint64_t ScrambleKeys[4] = { 0x78E5C0CC4EE679CBull, 0x2172FFCC7DD05A82ull, 0x8E2443F7744608B8ull, 0x4C263A81E69035E0ull };
+        } // namespace HashConstants
+
+        inline ::uint64_t HashMix(::uint64_t value) noexcept
+        {
+            value ^= value >> 33;
+            value *= 0xFF51AFD7ED558CCDull;
+            value ^= value >> 33;
+            value *= 0xC4CEB9FE1A85EC53ull;
+            value ^= value >> 33;
+
+            return value;
+        }
+
+        inline ::uint64_t HashRotate(::uint64_t value, unsigned bits) noexcept
+        {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+#if defined(VULKANDYNAMIC_HASH_SSE2)
+        inline void HashStripes(::uint64_t* lanes, const unsigned char* data, ::size_t firstStripe, ::size_t stripeCount, bool scramble) noexcept
+        {
+            __m128i lanes01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes));
+            __m128i lanes23 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes + 2));
+
+            for (::size_t stripe = 0; stripe < stripeCount; ++stripe)
+            {
+                const __m128i key01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HashConstants::Secret + firstStripe + stripe));
+                const __m128i key23 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HashConstants::Secret + firstStripe + stripe + 2));
+                const __m128i data01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + stripe * HashConstants::StripeSize));
+                const __m128i data23 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + stripe * HashConstants::StripeSize + 16));
+                const __m128i keyed01 = _mm_xor_si128(data01, key01);
+                const __m128i keyed23 = _mm_xor_si128(data23, key23);
+
+                // Low half times high half of each keyed word, plus the other lane's word.
+                lanes01 = _mm_add_epi64(lanes01, _mm_mul_epu32(keyed01, _mm_shuffle_epi32(keyed01, _MM_SHUFFLE(0, 3, 0, 1))));
+                lanes23 = _mm_add_epi64(lanes23, _mm_mul_epu32(keyed23, _mm_shuffle_epi32(keyed23, _MM_SHUFFLE(0, 3, 0, 1))));
+                lanes01 = _mm_add_epi64(lanes01, _mm_shuffle_epi32(data01, _MM_SHUFFLE(1, 0, 3, 2)));
+                lanes23 = _mm_add_epi64(lanes23, _mm_shuffle_epi32(data23, _MM_SHUFFLE(1, 0, 3, 2)));
+            }
+
+            if (scramble)
+            {
+                const __m128i multiplier = _mm_set1_epi32(static_cast<int>(HashConstants::ScrambleMultiplier));
+                __m128i* lanePairs[2] = { &lanes01, &lanes23 };
+                for (::size_t pair = 0; pair < 2; ++pair)
+                {
+                    __m128i value = *lanePairs[pair];
+                    value = _mm_xor_si128(value, _mm_srli_epi64(value, 47));
+                    value = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(HashConstants::ScrambleKeys + pair * 2)));
+
+                    // 64-bit by 32-bit multiplication from two 32-bit products.
+                    const __m128i low = _mm_mul_epu32(value, multiplier);
+                    const __m128i high = _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(value, 32), multiplier), 32);
+                    *lanePairs[pair] = _mm_add_epi64(low, high);
+                }
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), lanes01);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes + 2), lanes23);
+        }
+#else
+        inline void HashStripes(::uint64_t* lanes, const unsigned char* data, ::size_t firstStripe, ::size_t stripeCount, bool scramble) noexcept
+        {
+            for (::size_t stripe = 0; stripe < stripeCount; ++stripe)
+            {
+                for (::size_t lane = 0; lane < 4; ++lane)
+                {
+                    ::uint64_t word;
+                    ::std::memcpy(&word, data + stripe * HashConstants::StripeSize + lane * 8, sizeof(word));
+
+                    const ::uint64_t keyed = word ^ HashConstants::Secret[firstStripe + stripe + lane];
+                    lanes[lane] += (keyed & 0xFFFFFFFFull) * (keyed >> 32);
+                    lanes[lane ^ 1] += word;
+                }
+            }
+
+            if (scramble)
+            {
+                for (::size_t lane = 0; lane < 4; ++lane)
+                {
+                    const ::uint64_t value = lanes[lane] ^ (lanes[lane] >> 47) ^ HashConstants::ScrambleKeys[lane];
+                    lanes[lane] = value * HashConstants::ScrambleMultiplier;
+                }
+            }
+        }
+#endif // VULKANDYNAMIC_HASH_SSE2
+
+        inline Hash128 HashBytes(const void* data, ::size_t size) noexcept
+        {
+            using namespace HashConstants;
+
+            ::uint64_t lanes[4] = { Secret[0], ScrambleKeys[1], Secret[2], ScrambleKeys[3] };
+
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            const ::size_t blockSize = StripeSize * StripesPerBlock;
+            ::size_t offset = 0;
+            for (; size - offset >= blockSize; offset += blockSize)
+            {
+                HashStripes(lanes, bytes + offset, 0, StripesPerBlock, true);
+            }
+
+            const ::size_t stripeCount = (size - offset) / StripeSize;
+            HashStripes(lanes, bytes + offset, 0, stripeCount, false);
+            offset += stripeCount * StripeSize;
+
+            // The zero-padded last stripe; the size mixed in below tells padding from data.
+            if (offset < size)
+            {
+                unsigned char last[StripeSize] = {};
+                ::std::memcpy(last, bytes + offset, size - offset);
+                HashStripes(lanes, last, stripeCount, 1, false);
+            }
+
+            const ::uint64_t length = static_cast<::uint64_t>(size);
+
+            Hash128 hash;
+            hash.low = HashMix(lanes[0] ^ HashRotate(lanes[1], 17) ^ length) + HashMix(lanes[2] ^ HashRotate(lanes[3], 31));
+            hash.high = HashMix(lanes[1] ^ HashRotate(lanes[2], 23) ^ ~length) + HashMix(lanes[3] ^ HashRotate(lanes[0], 41));
+
+            return hash;
+        }
+    } // namespace Detail
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_HASH_HPP__
@@ -0,0 +1,86 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_INTERPOSER_HPP__
+#define __VULKANDYNAMIC_INTERPOSER_HPP__
+
+#include <VulkanDynamic/VulkanDynamic.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace VulkanDynamic
+{
+    namespace Detail
+    {
+        // Generic interposer entry point for one table slot. Hooks provides
+        //  - Table: the dispatch table type,
+        //  - Next(): the table to forward to,
+        //  - Scope: constructed from the function identifier before the call and
+        //    destroyed after it.
+        // Interposer entry points carry no context, so each tier forwards to a single
+        // process-wide table. Binding it again to the same table is a no-op; binding a
+        // different one fails instead of re-routing the tables wrapped before, until the
+        // bound table is released.
+        template<typename Table>
+        ::VkResult BindNext(::std::atomic<const Table*>& next, const Table* table) noexcept
+        {
+            const Table* bound = nullptr;
+            if (next.compare_exchange_strong(bound, table, ::std::memory_order_acq_rel) || bound == table)
+            {
+                return ::VK_SUCCESS;
+            }
+
+            return ::VK_ERROR_TOO_MANY_OBJECTS;
+        }
+
+        // Unbinds `table` so another one can be bound. Tables wrapped around it must no
+        // longer be called once this returns.
+        template<typename Table>
+        ::VkResult ReleaseNext(::std::atomic<const Table*>& next, const Table* table) noexcept
+        {
+            const Table* bound = table;
+            if (next.compare_exchange_strong(bound, nullptr, ::std::memory_order_acq_rel))
+            {
+                return ::VK_SUCCESS;
+            }
+
+            return ::VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        template<typename Hooks, typename Function>
+        struct Interposer;
+
+        template<typename Hooks, typename Result, typename... Args>
+        struct Interposer<Hooks, Result (VKAPI_PTR*)(Args...)>
+        {
+            using Function = Result (VKAPI_PTR*)(Args...);
+
+            template<Function Hooks::Table::* Member, ::uint32_t FunctionId>
+            static Result VKAPI_CALL Call(Args... args)
+            {
+                const typename Hooks::Scope scope{ FunctionId };
+                return (Hooks::Next()->*Member)(args...);
+            }
+        };
+    } // namespace Detail
+} // namespace VulkanDynamic
+
+// Assigns the interposer of `function` to `interposed`, or NULL where `next` has no entry.
+#define VULKANDYNAMIC_INTERPOSE_FUNCTION(hooks, tier, next, interposed, function) \
+    interposed->function = next->function \
+        ? &::VulkanDynamic::Detail::Interposer<hooks, PFN_vk##function>::Call<&hooks::Table::function, VULKANDYNAMIC_##tier##_FUNCTION_ID_##function> \
+        : nullptr;
+
+#endif // __VULKANDYNAMIC_INTERPOSER_HPP__
@@ -0,0 +1,55 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PIPELINE_CACHE_HPP__
+#define __VULKANDYNAMIC_PIPELINE_CACHE_HPP__
+
+#include <VulkanDynamic/VulkanDynamic.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace VulkanDynamic
+{
+    namespace Detail
+    {
+        // VkPipelineCacheHeaderVersionOne, read field by field as older headers lack it.
+        constexpr ::size_t PipelineCacheHeaderSize = 16 + VK_UUID_SIZE;
+
+        inline ::uint32_t ReadPipelineCacheUint32(const unsigned char* data) noexcept
+        {
+            ::uint32_t value;
+            ::std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        // Whether pipeline cache data was written for the device, so that it is not handed
+        // to drivers that may not check it as thoroughly.
+        inline bool PipelineCacheMatchesDevice(const unsigned char* data, ::size_t size, const VkPhysicalDeviceProperties& properties) noexcept
+        {
+            if (size < PipelineCacheHeaderSize)
+            {
+                return false;
+            }
+
+            const ::uint32_t headerSize = ReadPipelineCacheUint32(data);
+            return headerSize >= PipelineCacheHeaderSize && headerSize <= size && ReadPipelineCacheUint32(data + 4) == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+                && ReadPipelineCacheUint32(data + 8) == properties.vendorID && ReadPipelineCacheUint32(data + 12) == properties.deviceID
+                && ::std::memcmp(data + 16, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+        }
+    } // namespace Detail
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_PIPELINE_CACHE_HPP__
@@ -0,0 +1,80 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PLATFORM_ATOMIC_H__
+#define __VULKANDYNAMIC_PLATFORM_ATOMIC_H__
+
+#include <stdint.h>
+
+// ATOMIC_COMPARE_EXCHANGE_POINTER is nonzero if `*pointer` held `expected` and was replaced
+// by `value`. `expected` is taken by value on every compiler: a failed exchange does not
+// write back the observed value.
+//
+// ATOMIC_PAUSE hints the core that the thread is spinning (pause on x86, yield on ARM);
+// ATOMIC_YIELD gives up the rest of the time slice for spins that last too long.
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #include <Windows.h>
+
+    #undef CreateSemaphore
+    #undef CreateEvent
+
+    #define ATOMIC_EXCHANGE_POINTER(pointer, value) _InterlockedExchangePointer((void* volatile*)(pointer), (void*)(value))
+    #define ATOMIC_COMPARE_EXCHANGE_POINTER(pointer, expected, value) AtomicCompareExchangePointer((void* volatile*)(pointer), (void*)(expected), (void*)(value))
+    #define ATOMIC_EXCHANGE_32(pointer, value) ((uint32_t)_InterlockedExchange((volatile long*)(pointer), (long)(value)))
+    #define ATOMIC_LOAD_32(pointer) ((uint32_t)_InterlockedOr((volatile long*)(pointer), 0))
+    #define ATOMIC_STORE_32(pointer, value) _InterlockedExchange((volatile long*)(pointer), (long)(value))
+    #define ATOMIC_LOAD_64(pointer) ((uint64_t)_InterlockedCompareExchange64((volatile __int64*)(pointer), 0, 0))
+    #define ATOMIC_STORE_64(pointer, value) _InterlockedExchange64((volatile __int64*)(pointer), (__int64)(value))
+    #define ATOMIC_ADD_64(pointer, value) ((uint64_t)_InterlockedExchangeAdd64((volatile __int64*)(pointer), (__int64)(value)) + (uint64_t)(value))
+    #define ATOMIC_INCREMENT_64(pointer) ((uint64_t)_InterlockedIncrement64((volatile __int64*)(pointer)))
+    #define ATOMIC_FENCE() MemoryBarrier()
+    #define ATOMIC_PAUSE() YieldProcessor()
+    #define ATOMIC_YIELD() SwitchToThread()
+
+    static __inline int AtomicCompareExchangePointer(void* volatile* pointer, void* expected, void* value)
+    {
+        return _InterlockedCompareExchangePointer(pointer, value, expected) == expected;
+    }
+#else
+    #include <sched.h>
+
+    #define ATOMIC_EXCHANGE_POINTER(pointer, value) __atomic_exchange_n(pointer, value, __ATOMIC_SEQ_CST)
+    #define ATOMIC_COMPARE_EXCHANGE_POINTER(pointer, expected, value) AtomicCompareExchangePointer((void* volatile*)(pointer), (void*)(expected), (void*)(value))
+    #define ATOMIC_EXCHANGE_32(pointer, value) __atomic_exchange_n(pointer, value, __ATOMIC_SEQ_CST)
+    #define ATOMIC_LOAD_32(pointer) __atomic_load_n(pointer, __ATOMIC_SEQ_CST)
+    #define ATOMIC_STORE_32(pointer, value) __atomic_store_n(pointer, value, __ATOMIC_SEQ_CST)
+    #define ATOMIC_LOAD_64(pointer) __atomic_load_n(pointer, __ATOMIC_SEQ_CST)
+    #define ATOMIC_STORE_64(pointer, value) __atomic_store_n(pointer, value, __ATOMIC_SEQ_CST)
+    #define ATOMIC_ADD_64(pointer, value) __atomic_add_fetch(pointer, value, __ATOMIC_SEQ_CST)
+    #define ATOMIC_INCREMENT_64(pointer) __atomic_add_fetch(pointer, 1, __ATOMIC_SEQ_CST)
+    #define ATOMIC_FENCE() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+    #define ATOMIC_YIELD() sched_yield()
+
+    #if defined(__i386__) || defined(__x86_64__)
+        #define ATOMIC_PAUSE() __builtin_ia32_pause()
+    #elif defined(__aarch64__) || defined(__arm__)
+        #define ATOMIC_PAUSE() __asm__ __volatile__("yield")
+    #else
+        #define ATOMIC_PAUSE() ((void)0)
+    #endif // __i386__ || __x86_64__
+
+    static inline int AtomicCompareExchangePointer(void* volatile* pointer, void* expected, void* value)
+    {
+        return __atomic_compare_exchange_n(pointer, &expected, value, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    }
+#endif // _MSC_VER
+
+#endif // __VULKANDYNAMIC_PLATFORM_ATOMIC_H__
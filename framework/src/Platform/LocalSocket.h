@@ -0,0 +1,49 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PLATFORM_LOCAL_SOCKET_H__
+#define __VULKANDYNAMIC_PLATFORM_LOCAL_SOCKET_H__
+
+#include <VulkanDynamic/VulkanDynamic.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+typedef struct __LocalSocket* LocalSocket;
+
+// Stream sockets bound to a file system path, for the processes of one user on one
+// machine. Listening fails while another server accepts connections at the path; a stale
+// socket file is replaced, and removed again when the listener closes. The socket file is
+// only accessible to its owner. Accepting refuses peers running as other users, and
+// connecting refuses servers running as other users.
+// Accepting waits at most `timeout` milliseconds for a connection. Sends and receives
+// transfer all of their bytes or fail, failing also after `timeout` milliseconds without
+// progress. The functions return NULL or 0 on failure, and where the platform has no
+// such sockets.
+VULKANDYNAMIC_API LocalSocket LocalSocketListen(const char* path);
+VULKANDYNAMIC_API LocalSocket LocalSocketAccept(LocalSocket listener, uint32_t timeout);
+VULKANDYNAMIC_API LocalSocket LocalSocketConnect(const char* path, uint32_t timeout);
+VULKANDYNAMIC_API void LocalSocketClose(LocalSocket socket);
+VULKANDYNAMIC_API int LocalSocketSend(LocalSocket socket, const void* data, size_t size);
+VULKANDYNAMIC_API int LocalSocketReceive(LocalSocket socket, void* data, size_t size);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_PLATFORM_LOCAL_SOCKET_H__
@@ -0,0 +1,50 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PLATFORM_MAPPEDFILE_H__
+#define __VULKANDYNAMIC_PLATFORM_MAPPEDFILE_H__
+
+#include <VulkanDynamic/VulkanDynamic.h>
+
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+typedef struct __MappedFile* MappedFile;
+
+// Created files are truncated, mapped read-write and can be grown with MappedFileResize,
+// which may move the mapping. MappedFileClose trims a created file to `size` bytes.
+// Opened files are mapped read-only and report their size.
+VULKANDYNAMIC_API MappedFile MappedFileCreate(const char* path, size_t size);
+VULKANDYNAMIC_API MappedFile MappedFileOpen(const char* path);
+VULKANDYNAMIC_API void* MappedFileResize(MappedFile file, size_t size);
+VULKANDYNAMIC_API void MappedFileClose(MappedFile file, size_t size);
+VULKANDYNAMIC_API void* MappedFileGetAddress(MappedFile file);
+VULKANDYNAMIC_API size_t MappedFileGetSize(MappedFile file);
+
+// Writes a created file's contents through to storage. Returns 0 on failure.
+VULKANDYNAMIC_API int MappedFileSync(MappedFile file);
+
+// Moves `replacement` over `path` in one step, so readers of `path` see either the old or
+// the new file whole, and makes the move durable where it can. Returns 0 if the file was
+// not moved; once it has been, the sync of its directory is best-effort.
+VULKANDYNAMIC_API int FileReplace(const char* replacement, const char* path);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_PLATFORM_MAPPEDFILE_H__
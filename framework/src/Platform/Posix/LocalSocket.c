@@ -0,0 +1,294 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// struct ucred, for SO_PEERCRED, is only declared for GNU sources.
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <Platform/LocalSocket.h>
+
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#if defined(MSG_NOSIGNAL)
+#define LOCAL_SOCKET_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define LOCAL_SOCKET_SEND_FLAGS 0
+#endif
+
+#if !defined(SOCK_CLOEXEC)
+#define SOCK_CLOEXEC 0
+#endif
+
+struct __LocalSocket
+{
+    int fd;
+    // The path of a listening socket, empty otherwise.
+    char path[sizeof(((struct sockaddr_un*)0)->sun_path)];
+};
+
+static int LocalSocketAddress(const char* path, struct sockaddr_un* address)
+{
+    const size_t length = strlen(path);
+    if (length == 0 || length >= sizeof(address->sun_path))
+    {
+        return 0;
+    }
+
+    memset(address, 0, sizeof(struct sockaddr_un));
+    address->sun_family = AF_UNIX;
+    memcpy(address->sun_path, path, length);
+
+    return 1;
+}
+
+// Whether a server accepts connections at the address.
+static int LocalSocketServed(const struct sockaddr_un* address)
+{
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return 0;
+    }
+
+    const int served = connect(fd, (const struct sockaddr*)address, sizeof(struct sockaddr_un)) == 0;
+    close(fd);
+
+    return served;
+}
+
+// Whether the peer of a connected socket runs as the user of this process.
+static int LocalSocketPeerIsUser(int fd)
+{
+#if defined(SO_PEERCRED)
+    struct ucred credentials;
+    socklen_t size = sizeof(credentials);
+    return getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &size) == 0 && credentials.uid == geteuid();
+#else
+    uid_t uid;
+    gid_t gid;
+    return getpeereid(fd, &uid, &gid) == 0 && uid == geteuid();
+#endif
+}
+
+static LocalSocket LocalSocketWrap(int fd, uint32_t timeout)
+{
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+#if defined(SO_NOSIGPIPE)
+    const int noSignal = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof(noSignal));
+#endif
+
+    struct timeval interval;
+    interval.tv_sec = timeout / 1000;
+    interval.tv_usec = (timeout % 1000) * 1000;
+
+    struct __LocalSocket* localSocket = (struct __LocalSocket*)calloc(1, sizeof(struct __LocalSocket));
+    if (!localSocket
+        || setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &interval, sizeof(interval)) != 0
+        || setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &interval, sizeof(interval)) != 0)
+    {
+        free(localSocket);
+        close(fd);
+        return NULL;
+    }
+
+    localSocket->fd = fd;
+
+    return localSocket;
+}
+
+VULKANDYNAMIC_API LocalSocket LocalSocketListen(const char* path)
+{
+    struct sockaddr_un address;
+    if (!LocalSocketAddress(path, &address))
+    {
+        return NULL;
+    }
+
+    // A live server keeps its path. A socket file left behind by a process that did not
+    // close its socket refuses binding, so it is replaced; other files are not.
+    if (LocalSocketServed(&address))
+    {
+        return NULL;
+    }
+
+    struct stat status;
+    if (lstat(path, &status) == 0 && S_ISSOCK(status.st_mode))
+    {
+        unlink(path);
+    }
+
+    struct __LocalSocket* localSocket = (struct __LocalSocket*)calloc(1, sizeof(struct __LocalSocket));
+    if (!localSocket)
+    {
+        return NULL;
+    }
+
+    localSocket->fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (localSocket->fd < 0 || bind(localSocket->fd, (const struct sockaddr*)&address, sizeof(struct sockaddr_un)) != 0)
+    {
+        LocalSocketClose(localSocket);
+        return NULL;
+    }
+
+    memcpy(localSocket->path, address.sun_path, sizeof(localSocket->path));
+
+    // Restricted before listening, so no other user ever connects.
+    if (chmod(path, S_IRUSR | S_IWUSR) != 0 || listen(localSocket->fd, SOMAXCONN) != 0)
+    {
+        LocalSocketClose(localSocket);
+        return NULL;
+    }
+
+    return localSocket;
+}
+
+VULKANDYNAMIC_API LocalSocket LocalSocketAccept(LocalSocket listener, uint32_t timeout)
+{
+    struct pollfd pending;
+    pending.fd = listener->fd;
+    pending.events = POLLIN;
+    pending.revents = 0;
+
+    int ready;
+    do
+    {
+        ready = poll(&pending, 1, timeout > INT_MAX ? -1 : (int)timeout);
+    } while (ready < 0 && errno == EINTR);
+
+    if (ready <= 0)
+    {
+        return NULL;
+    }
+
+    int fd;
+    do
+    {
+        fd = accept(listener->fd, NULL, NULL);
+    } while (fd < 0 && errno == EINTR);
+
+    if (fd >= 0 && !LocalSocketPeerIsUser(fd))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    return LocalSocketWrap(fd, timeout);
+}
+
+VULKANDYNAMIC_API LocalSocket LocalSocketConnect(const char* path, uint32_t timeout)
+{
+    struct sockaddr_un address;
+    if (!LocalSocketAddress(path, &address))
+    {
+        return NULL;
+    }
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    // A server of another user may have taken the path first, in a directory others can
+    // write to; its data must not be trusted.
+    if (connect(fd, (const struct sockaddr*)&address, sizeof(struct sockaddr_un)) != 0 || !LocalSocketPeerIsUser(fd))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    return LocalSocketWrap(fd, timeout);
+}
+
+VULKANDYNAMIC_API void LocalSocketClose(LocalSocket socket)
+{
+    if (!socket)
+    {
+        return;
+    }
+
+    if (socket->fd >= 0)
+    {
+        close(socket->fd);
+    }
+
+    if (socket->path[0])
+    {
+        unlink(socket->path);
+    }
+
+    free(socket);
+}
+
+VULKANDYNAMIC_API int LocalSocketSend(LocalSocket socket, const void* data, size_t size)
+{
+    const char* bytes = (const char*)data;
+    while (size > 0)
+    {
+        const ssize_t sent = send(socket->fd, bytes, size, LOCAL_SOCKET_SEND_FLAGS);
+        if (sent < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (sent <= 0)
+        {
+            return 0;
+        }
+
+        bytes += sent;
+        size -= (size_t)sent;
+    }
+
+    return 1;
+}
+
+VULKANDYNAMIC_API int LocalSocketReceive(LocalSocket socket, void* data, size_t size)
+{
+    char* bytes = (char*)data;
+    while (size > 0)
+    {
+        const ssize_t received = recv(socket->fd, bytes, size, 0);
+        if (received < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (received <= 0)
+        {
+            return 0;
+        }
+
+        bytes += received;
+        size -= (size_t)received;
+    }
+
+    return 1;
+}
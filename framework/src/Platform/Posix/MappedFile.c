@@ -0,0 +1,183 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Platform/MappedFile.h>
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct __MappedFile
+{
+    int descriptor;
+    void* address;
+    size_t size;
+    int writable;
+};
+
+static MappedFile MappedFileMap(int descriptor, size_t size, int writable)
+{
+    void* address = mmap(NULL, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, descriptor, 0);
+    if (address == MAP_FAILED)
+    {
+        close(descriptor);
+        return NULL;
+    }
+
+    struct __MappedFile* file = (struct __MappedFile*)calloc(1, sizeof(struct __MappedFile));
+    if (!file)
+    {
+        munmap(address, size);
+        close(descriptor);
+        return NULL;
+    }
+
+    file->descriptor = descriptor;
+    file->address = address;
+    file->size = size;
+    file->writable = writable;
+
+    return file;
+}
+
+VULKANDYNAMIC_API MappedFile MappedFileCreate(const char* path, size_t size)
+{
+    const int descriptor = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (descriptor < 0)
+    {
+        return NULL;
+    }
+
+    if (ftruncate(descriptor, (off_t)size) != 0)
+    {
+        close(descriptor);
+        return NULL;
+    }
+
+    return MappedFileMap(descriptor, size, 1);
+}
+
+VULKANDYNAMIC_API MappedFile MappedFileOpen(const char* path)
+{
+    const int descriptor = open(path, O_RDONLY);
+    if (descriptor < 0)
+    {
+        return NULL;
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || status.st_size <= 0)
+    {
+        close(descriptor);
+        return NULL;
+    }
+
+    return MappedFileMap(descriptor, (size_t)status.st_size, 0);
+}
+
+VULKANDYNAMIC_API void* MappedFileResize(MappedFile file, size_t size)
+{
+    if (!file->writable || ftruncate(file->descriptor, (off_t)size) != 0)
+    {
+        return NULL;
+    }
+
+    void* address = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, file->descriptor, 0);
+    if (address == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    munmap(file->address, file->size);
+    file->address = address;
+    file->size = size;
+
+    return address;
+}
+
+VULKANDYNAMIC_API void MappedFileClose(MappedFile file, size_t size)
+{
+    if (!file)
+    {
+        return;
+    }
+
+    munmap(file->address, file->size);
+    if (file->writable && size < file->size)
+    {
+        // On failure the file keeps its zero-filled tail; readers stop at the recorded size.
+        const int result = ftruncate(file->descriptor, (off_t)size);
+        (void)result;
+    }
+
+    close(file->descriptor);
+    free(file);
+}
+
+VULKANDYNAMIC_API void* MappedFileGetAddress(MappedFile file)
+{
+    return file->address;
+}
+
+VULKANDYNAMIC_API size_t MappedFileGetSize(MappedFile file)
+{
+    return file->size;
+}
+
+VULKANDYNAMIC_API int MappedFileSync(MappedFile file)
+{
+    return msync(file->address, file->size, MS_SYNC) == 0 && fsync(file->descriptor) == 0;
+}
+
+VULKANDYNAMIC_API int FileReplace(const char* replacement, const char* path)
+{
+    if (rename(replacement, path) != 0)
+    {
+        return 0;
+    }
+
+    // The rename itself is only durable once the directory holding it is synced. It has
+    // happened either way and cannot be undone, so a failed sync is not reported.
+    const char* separator = strrchr(path, '/');
+    char* directory = (char*)malloc(separator ? (size_t)(separator - path) + 2 : 2);
+    if (!directory)
+    {
+        return 1;
+    }
+
+    if (separator)
+    {
+        const size_t length = separator == path ? 1 : (size_t)(separator - path);
+        memcpy(directory, path, length);
+        directory[length] = '\0';
+    }
+    else
+    {
+        strcpy(directory, ".");
+    }
+
+    const int descriptor = open(directory, O_RDONLY);
+    free(directory);
+    if (descriptor >= 0)
+    {
+        fsync(descriptor);
+        close(descriptor);
+    }
+
+    return 1;
+}
@@ -0,0 +1,181 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Platform/Reactor.h>
+
+#if defined(__linux__)
+
+#include <stdlib.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#define REACTOR_POLL_BATCH 64
+
+struct __Reactor
+{
+    int epoll;
+    int notification;
+};
+
+VULKANDYNAMIC_API Reactor ReactorCreate(void)
+{
+    struct __Reactor* reactor = (struct __Reactor*)calloc(1, sizeof(struct __Reactor));
+    if (!reactor)
+    {
+        return NULL;
+    }
+
+    reactor->epoll = epoll_create1(EPOLL_CLOEXEC);
+    reactor->notification = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    // The notification descriptor is told apart by its NULL user data.
+    struct epoll_event event = { 0 };
+    event.events = EPOLLIN;
+    if (reactor->epoll < 0 || reactor->notification < 0 || epoll_ctl(reactor->epoll, EPOLL_CTL_ADD, reactor->notification, &event) != 0)
+    {
+        ReactorDestroy(reactor);
+        return NULL;
+    }
+
+    return reactor;
+}
+
+VULKANDYNAMIC_API void ReactorDestroy(Reactor reactor)
+{
+    if (!reactor)
+    {
+        return;
+    }
+
+    if (reactor->notification >= 0)
+    {
+        close(reactor->notification);
+    }
+
+    if (reactor->epoll >= 0)
+    {
+        close(reactor->epoll);
+    }
+
+    free(reactor);
+}
+
+VULKANDYNAMIC_API int ReactorGetFd(Reactor reactor)
+{
+    return reactor->epoll;
+}
+
+VULKANDYNAMIC_API int ReactorAdd(Reactor reactor, int fd, void* userData)
+{
+    struct epoll_event event = { 0 };
+    event.events = EPOLLIN | EPOLLONESHOT;
+    event.data.ptr = userData;
+
+    return epoll_ctl(reactor->epoll, EPOLL_CTL_ADD, fd, &event) == 0;
+}
+
+VULKANDYNAMIC_API void ReactorRemove(Reactor reactor, int fd)
+{
+    epoll_ctl(reactor->epoll, EPOLL_CTL_DEL, fd, NULL);
+    close(fd);
+}
+
+VULKANDYNAMIC_API void ReactorNotify(Reactor reactor)
+{
+    const uint64_t value = 1;
+    (void)!write(reactor->notification, &value, sizeof(value));
+}
+
+VULKANDYNAMIC_API uint32_t ReactorPoll(Reactor reactor, ReactorEvent* events, uint32_t capacity)
+{
+    struct epoll_event ready[REACTOR_POLL_BATCH];
+
+    // The notification takes a slot of epoll_wait without making an event, so it polls
+    // again until `events` is full or fewer descriptors than asked for were ready.
+    uint32_t eventCount = 0;
+    while (eventCount < capacity)
+    {
+        const int requested = (int)(capacity - eventCount < REACTOR_POLL_BATCH ? capacity - eventCount : REACTOR_POLL_BATCH);
+        const int count = epoll_wait(reactor->epoll, ready, requested, 0);
+
+        for (int index = 0; index < count; ++index)
+        {
+            if (!ready[index].data.ptr)
+            {
+                uint64_t value;
+                (void)!read(reactor->notification, &value, sizeof(value));
+                continue;
+            }
+
+            events[eventCount].userData = ready[index].data.ptr;
+            events[eventCount].failed = (ready[index].events & EPOLLERR) != 0;
+            ++eventCount;
+        }
+
+        if (count < requested)
+        {
+            break;
+        }
+    }
+
+    return eventCount;
+}
+
+#else
+
+VULKANDYNAMIC_API Reactor ReactorCreate(void)
+{
+    return NULL;
+}
+
+VULKANDYNAMIC_API void ReactorDestroy(Reactor reactor)
+{
+    (void)reactor;
+}
+
+VULKANDYNAMIC_API int ReactorGetFd(Reactor reactor)
+{
+    (void)reactor;
+    return -1;
+}
+
+VULKANDYNAMIC_API int ReactorAdd(Reactor reactor, int fd, void* userData)
+{
+    (void)reactor;
+    (void)fd;
+    (void)userData;
+    return 0;
+}
+
+VULKANDYNAMIC_API void ReactorRemove(Reactor reactor, int fd)
+{
+    (void)reactor;
+    (void)fd;
+}
+
+VULKANDYNAMIC_API void ReactorNotify(Reactor reactor)
+{
+    (void)reactor;
+}
+
+VULKANDYNAMIC_API uint32_t ReactorPoll(Reactor reactor, ReactorEvent* events, uint32_t capacity)
+{
+    (void)reactor;
+    (void)events;
+    (void)capacity;
+    return 0;
+}
+
+#endif // __linux__
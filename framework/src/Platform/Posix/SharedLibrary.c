@@ -16,17 +16,17 @@
 
 #include <dlfcn.h>
 
-SharedLibrary SharedLibraryLoad(const char* name)
+VULKANDYNAMIC_API SharedLibrary SharedLibraryLoad(const char* name)
 {
     return (SharedLibrary)dlopen(name, RTLD_LAZY);
 }
 
-void SharedLibraryFree(SharedLibrary library)
+VULKANDYNAMIC_API void SharedLibraryFree(SharedLibrary library)
 {
     dlclose((void*)library);
 }
 
-void* SharedLibraryGetSymbol(SharedLibrary library, const char* symbolName)
+VULKANDYNAMIC_API void* SharedLibraryGetSymbol(SharedLibrary library, const char* symbolName)
 {
     return (void*)dlsym((void*)library, symbolName);
 }
\ No newline at end of file
@@ -0,0 +1,128 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Platform/SharedMemory.h>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct __SharedMemory
+{
+    void* address;
+    size_t size;
+    char* unlinkName;
+};
+
+static SharedMemory SharedMemoryMap(int descriptor, size_t size, int protection, const char* unlinkName)
+{
+    void* address = mmap(NULL, size, protection, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if (address == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    struct __SharedMemory* memory = (struct __SharedMemory*)calloc(1, sizeof(struct __SharedMemory));
+    if (!memory)
+    {
+        munmap(address, size);
+        return NULL;
+    }
+
+    memory->address = address;
+    memory->size = size;
+    if (unlinkName)
+    {
+        memory->unlinkName = (char*)malloc(strlen(unlinkName) + 1);
+        if (memory->unlinkName)
+        {
+            strcpy(memory->unlinkName, unlinkName);
+        }
+    }
+
+    return memory;
+}
+
+VULKANDYNAMIC_API SharedMemory SharedMemoryCreate(const char* name, size_t size)
+{
+    const int descriptor = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (descriptor < 0)
+    {
+        return NULL;
+    }
+
+    if (ftruncate(descriptor, (off_t)size) != 0)
+    {
+        close(descriptor);
+        shm_unlink(name);
+        return NULL;
+    }
+
+    SharedMemory memory = SharedMemoryMap(descriptor, size, PROT_READ | PROT_WRITE, name);
+    if (!memory)
+    {
+        shm_unlink(name);
+    }
+
+    return memory;
+}
+
+VULKANDYNAMIC_API SharedMemory SharedMemoryOpen(const char* name)
+{
+    const int descriptor = shm_open(name, O_RDONLY, 0);
+    if (descriptor < 0)
+    {
+        return NULL;
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || status.st_size <= 0)
+    {
+        close(descriptor);
+        return NULL;
+    }
+
+    return SharedMemoryMap(descriptor, (size_t)status.st_size, PROT_READ, NULL);
+}
+
+VULKANDYNAMIC_API void SharedMemoryClose(SharedMemory memory)
+{
+    if (!memory)
+    {
+        return;
+    }
+
+    munmap(memory->address, memory->size);
+    if (memory->unlinkName)
+    {
+        shm_unlink(memory->unlinkName);
+        free(memory->unlinkName);
+    }
+
+    free(memory);
+}
+
+VULKANDYNAMIC_API void* SharedMemoryGetAddress(SharedMemory memory)
+{
+    return memory->address;
+}
+
+VULKANDYNAMIC_API size_t SharedMemoryGetSize(SharedMemory memory)
+{
+    return memory->size;
+}
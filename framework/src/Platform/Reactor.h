@@ -0,0 +1,54 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PLATFORM_REACTOR_H__
+#define __VULKANDYNAMIC_PLATFORM_REACTOR_H__
+
+#include <VulkanDynamic/VulkanDynamic.h>
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // __cplusplus
+
+typedef struct __Reactor* Reactor;
+
+typedef struct ReactorEvent
+{
+    void* userData;
+    int failed;
+} ReactorEvent;
+
+// A set of descriptors watched for readability, itself readable through ReactorGetFd while
+// an event is pending, so it nests in an event loop. Added descriptors report one event
+// and stay in the set until removed; ReactorRemove also closes them. ReactorNotify makes
+// the reactor readable without an event, to have its owner poll. ReactorCreate returns
+// NULL where the platform has no such facility.
+VULKANDYNAMIC_API Reactor ReactorCreate(void);
+VULKANDYNAMIC_API void ReactorDestroy(Reactor reactor);
+VULKANDYNAMIC_API int ReactorGetFd(Reactor reactor);
+VULKANDYNAMIC_API int ReactorAdd(Reactor reactor, int fd, void* userData);
+VULKANDYNAMIC_API void ReactorRemove(Reactor reactor, int fd);
+VULKANDYNAMIC_API void ReactorNotify(Reactor reactor);
+
+// Returns the pending events, up to `capacity`, without blocking. Fewer than `capacity`
+// means no other event was pending.
+VULKANDYNAMIC_API uint32_t ReactorPoll(Reactor reactor, ReactorEvent* events, uint32_t capacity);
+
+#if defined(__cplusplus)
+}
+#endif // __cplusplus
+
+#endif // __VULKANDYNAMIC_PLATFORM_REACTOR_H__
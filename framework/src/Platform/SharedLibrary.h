@@ -15,10 +15,12 @@
 #ifndef __VULKANDYNAMIC_PLATFORM_SHAREDLIBRARY_H__
 #define __VULKANDYNAMIC_PLATFORM_SHAREDLIBRARY_H__
 
+#include <VulkanDynamic/VulkanDynamic.h>
+
 typedef struct __SharedLibrary* SharedLibrary;
 
-SharedLibrary SharedLibraryLoad(const char* name);
-void SharedLibraryFree(SharedLibrary library);
-void* SharedLibraryGetSymbol(SharedLibrary library, const char* symbolName);
+VULKANDYNAMIC_API SharedLibrary SharedLibraryLoad(const char* name);
+VULKANDYNAMIC_API void SharedLibraryFree(SharedLibrary library);
+VULKANDYNAMIC_API void* SharedLibraryGetSymbol(SharedLibrary library, const char* symbolName);
 
 #endif // __VULKANDYNAMIC_PLATFORM_SHAREDLIBRARY_H__
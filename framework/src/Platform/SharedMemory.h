@@ -0,0 +1,33 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_PLATFORM_SHAREDMEMORY_H__
+#define __VULKANDYNAMIC_PLATFORM_SHAREDMEMORY_H__
+
+#include <VulkanDynamic/VulkanDynamic.h>
+
+#include <stddef.h>
+
+typedef struct __SharedMemory* SharedMemory;
+
+// Creates or opens a named segment mapped into the process. Creation fails if a segment
+// of that name already exists, so a live segment of another process is never replaced.
+// Opened segments are mapped read-only and report their size.
+VULKANDYNAMIC_API SharedMemory SharedMemoryCreate(const char* name, size_t size);
+VULKANDYNAMIC_API SharedMemory SharedMemoryOpen(const char* name);
+VULKANDYNAMIC_API void SharedMemoryClose(SharedMemory memory);
+VULKANDYNAMIC_API void* SharedMemoryGetAddress(SharedMemory memory);
+VULKANDYNAMIC_API size_t SharedMemoryGetSize(SharedMemory memory);
+
+#endif // __VULKANDYNAMIC_PLATFORM_SHAREDMEMORY_H__
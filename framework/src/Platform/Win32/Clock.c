@@ -0,0 +1,32 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Platform/Clock.h>
+#include <Windows.h>
+
+#undef CreateSemaphore
+#undef CreateEvent
+
+VULKANDYNAMIC_API uint64_t ClockNanoseconds(void)
+{
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    const uint64_t seconds = (uint64_t)counter.QuadPart / (uint64_t)frequency.QuadPart;
+    const uint64_t remainder = (uint64_t)counter.QuadPart % (uint64_t)frequency.QuadPart;
+
+    return seconds * 1000000000u + remainder * 1000000000u / (uint64_t)frequency.QuadPart;
+}
@@ -0,0 +1,58 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Platform/LocalSocket.h>
+
+// Local sockets are only provided on POSIX platforms.
+
+VULKANDYNAMIC_API LocalSocket LocalSocketListen(const char* path)
+{
+    (void)path;
+    return NULL;
+}
+
+VULKANDYNAMIC_API LocalSocket LocalSocketAccept(LocalSocket listener, uint32_t timeout)
+{
+    (void)listener;
+    (void)timeout;
+    return NULL;
+}
+
+VULKANDYNAMIC_API LocalSocket LocalSocketConnect(const char* path, uint32_t timeout)
+{
+    (void)path;
+    (void)timeout;
+    return NULL;
+}
+
+VULKANDYNAMIC_API void LocalSocketClose(LocalSocket socket)
+{
+    (void)socket;
+}
+
+VULKANDYNAMIC_API int LocalSocketSend(LocalSocket socket, const void* data, size_t size)
+{
+    (void)socket;
+    (void)data;
+    (void)size;
+    return 0;
+}
+
+VULKANDYNAMIC_API int LocalSocketReceive(LocalSocket socket, void* data, size_t size)
+{
+    (void)socket;
+    (void)data;
+    (void)size;
+    return 0;
+}
@@ -0,0 +1,165 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Platform/MappedFile.h>
+#include <Windows.h>
+
+#undef CreateSemaphore
+#undef CreateEvent
+
+#include <stdlib.h>
+
+struct __MappedFile
+{
+    HANDLE file;
+    HANDLE mapping;
+    void* address;
+    size_t size;
+    int writable;
+};
+
+static int MappedFileMap(struct __MappedFile* file, size_t size)
+{
+    const DWORD protection = file->writable ? PAGE_READWRITE : PAGE_READONLY;
+    const DWORD access = file->writable ? FILE_MAP_READ | FILE_MAP_WRITE : FILE_MAP_READ;
+
+    HANDLE mapping = CreateFileMappingA(file->file, NULL, protection, (DWORD)((unsigned long long)size >> 32), (DWORD)size, NULL);
+    if (!mapping)
+    {
+        return 0;
+    }
+
+    void* address = MapViewOfFile(mapping, access, 0, 0, size);
+    if (!address)
+    {
+        CloseHandle(mapping);
+        return 0;
+    }
+
+    if (file->address)
+    {
+        UnmapViewOfFile(file->address);
+        CloseHandle(file->mapping);
+    }
+
+    file->mapping = mapping;
+    file->address = address;
+    file->size = size;
+
+    return 1;
+}
+
+static MappedFile MappedFileCreateMapping(HANDLE handle, size_t size, int writable)
+{
+    struct __MappedFile* file = (struct __MappedFile*)calloc(1, sizeof(struct __MappedFile));
+    if (!file)
+    {
+        CloseHandle(handle);
+        return NULL;
+    }
+
+    file->file = handle;
+    file->writable = writable;
+    if (!MappedFileMap(file, size))
+    {
+        CloseHandle(handle);
+        free(file);
+        return NULL;
+    }
+
+    return file;
+}
+
+VULKANDYNAMIC_API MappedFile MappedFileCreate(const char* path, size_t size)
+{
+    HANDLE handle = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+        return NULL;
+    }
+
+    return MappedFileCreateMapping(handle, size, 1);
+}
+
+VULKANDYNAMIC_API MappedFile MappedFileOpen(const char* path)
+{
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+        return NULL;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart <= 0)
+    {
+        CloseHandle(handle);
+        return NULL;
+    }
+
+    return MappedFileCreateMapping(handle, (size_t)size.QuadPart, 0);
+}
+
+VULKANDYNAMIC_API void* MappedFileResize(MappedFile file, size_t size)
+{
+    if (!file->writable || !MappedFileMap(file, size))
+    {
+        return NULL;
+    }
+
+    return file->address;
+}
+
+VULKANDYNAMIC_API void MappedFileClose(MappedFile file, size_t size)
+{
+    if (!file)
+    {
+        return;
+    }
+
+    UnmapViewOfFile(file->address);
+    CloseHandle(file->mapping);
+
+    if (file->writable && size < file->size)
+    {
+        LARGE_INTEGER end;
+        end.QuadPart = (LONGLONG)size;
+        if (SetFilePointerEx(file->file, end, NULL, FILE_BEGIN))
+        {
+            SetEndOfFile(file->file);
+        }
+    }
+
+    CloseHandle(file->file);
+    free(file);
+}
+
+VULKANDYNAMIC_API void* MappedFileGetAddress(MappedFile file)
+{
+    return file->address;
+}
+
+VULKANDYNAMIC_API size_t MappedFileGetSize(MappedFile file)
+{
+    return file->size;
+}
+
+VULKANDYNAMIC_API int MappedFileSync(MappedFile file)
+{
+    return FlushViewOfFile(file->address, 0) && FlushFileBuffers(file->file);
+}
+
+VULKANDYNAMIC_API int FileReplace(const char* replacement, const char* path)
+{
+    return MoveFileExA(replacement, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
@@ -0,0 +1,60 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Platform/Reactor.h>
+
+// Completions are exported as file descriptors only on POSIX platforms.
+
+VULKANDYNAMIC_API Reactor ReactorCreate(void)
+{
+    return NULL;
+}
+
+VULKANDYNAMIC_API void ReactorDestroy(Reactor reactor)
+{
+    (void)reactor;
+}
+
+VULKANDYNAMIC_API int ReactorGetFd(Reactor reactor)
+{
+    (void)reactor;
+    return -1;
+}
+
+VULKANDYNAMIC_API int ReactorAdd(Reactor reactor, int fd, void* userData)
+{
+    (void)reactor;
+    (void)fd;
+    (void)userData;
+    return 0;
+}
+
+VULKANDYNAMIC_API void ReactorRemove(Reactor reactor, int fd)
+{
+    (void)reactor;
+    (void)fd;
+}
+
+VULKANDYNAMIC_API void ReactorNotify(Reactor reactor)
+{
+    (void)reactor;
+}
+
+VULKANDYNAMIC_API uint32_t ReactorPoll(Reactor reactor, ReactorEvent* events, uint32_t capacity)
+{
+    (void)reactor;
+    (void)events;
+    (void)capacity;
+    return 0;
+}
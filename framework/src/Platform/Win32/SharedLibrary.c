@@ -15,17 +15,20 @@
 #include <Platform/SharedLibrary.h>
 #include <Windows.h>
 
-SharedLibrary SharedLibraryLoad(const char* name)
+#undef CreateSemaphore
+#undef CreateEvent
+
+VULKANDYNAMIC_API SharedLibrary SharedLibraryLoad(const char* name)
 {
-    return (SharedLibrary)LoadLibrary(name);
+    return (SharedLibrary)LoadLibraryA(name);
 }
 
-void SharedLibraryFree(SharedLibrary library)
+VULKANDYNAMIC_API void SharedLibraryFree(SharedLibrary library)
 {
     FreeLibrary((HMODULE)library);
 }
 
-void* SharedLibraryGetSymbol(SharedLibrary library, const char* symbolName)
+VULKANDYNAMIC_API void* SharedLibraryGetSymbol(SharedLibrary library, const char* symbolName)
 {
     return (void*)GetProcAddress((HMODULE)library, symbolName);
 }
@@ -0,0 +1,105 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Platform/SharedMemory.h>
+#include <Windows.h>
+
+#undef CreateSemaphore
+#undef CreateEvent
+
+#include <stdlib.h>
+
+struct __SharedMemory
+{
+    HANDLE mapping;
+    void* address;
+    size_t size;
+};
+
+static SharedMemory SharedMemoryMap(HANDLE mapping, DWORD access)
+{
+    void* address = MapViewOfFile(mapping, access, 0, 0, 0);
+    if (!address)
+    {
+        CloseHandle(mapping);
+        return NULL;
+    }
+
+    MEMORY_BASIC_INFORMATION information;
+    VirtualQuery(address, &information, sizeof(information));
+
+    struct __SharedMemory* memory = (struct __SharedMemory*)calloc(1, sizeof(struct __SharedMemory));
+    if (!memory)
+    {
+        UnmapViewOfFile(address);
+        CloseHandle(mapping);
+        return NULL;
+    }
+
+    memory->mapping = mapping;
+    memory->address = address;
+    memory->size = information.RegionSize;
+
+    return memory;
+}
+
+VULKANDYNAMIC_API SharedMemory SharedMemoryCreate(const char* name, size_t size)
+{
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)((unsigned long long)size >> 32), (DWORD)size, name);
+    if (!mapping)
+    {
+        return NULL;
+    }
+
+    if (GetLastError() == ERROR_ALREADY_EXISTS)
+    {
+        CloseHandle(mapping);
+        return NULL;
+    }
+
+    return SharedMemoryMap(mapping, FILE_MAP_READ | FILE_MAP_WRITE);
+}
+
+VULKANDYNAMIC_API SharedMemory SharedMemoryOpen(const char* name)
+{
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    if (!mapping)
+    {
+        return NULL;
+    }
+
+    return SharedMemoryMap(mapping, FILE_MAP_READ);
+}
+
+VULKANDYNAMIC_API void SharedMemoryClose(SharedMemory memory)
+{
+    if (!memory)
+    {
+        return;
+    }
+
+    UnmapViewOfFile(memory->address);
+    CloseHandle(memory->mapping);
+    free(memory);
+}
+
+VULKANDYNAMIC_API void* SharedMemoryGetAddress(SharedMemory memory)
+{
+    return memory->address;
+}
+
+VULKANDYNAMIC_API size_t SharedMemoryGetSize(SharedMemory memory)
+{
+    return memory->size;
+}
@@ -0,0 +1,1078 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __VULKANDYNAMIC_SERIALIZATION_HPP__
+#define __VULKANDYNAMIC_SERIALIZATION_HPP__
+
+#include <VulkanDynamic/VulkanDynamic.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// Argument serialization shared by capture and deferred recording. Arguments are encoded
+// from the PFN signatures: scalars and handles by value, pointer parameters as arrays of
+// deep-copied elements. Decoded pointers refer to an Arena.
+
+namespace VulkanDynamic
+{
+    namespace Detail
+    {
+        //------------------------------------------------------------------------------------
+        // Streams
+        //------------------------------------------------------------------------------------
+
+        // Appends to a contiguous buffer. Grow makes room for more bytes and keeps what was
+        // written, possibly moving it.
+        class Writer
+        {
+        public:
+            void Bytes(const void* data, ::size_t size)
+            {
+                if (size == 0)
+                {
+                    return;
+                }
+
+                if (static_cast<::size_t>(end_ - cursor_) < size)
+                {
+                    Grow(size);
+                }
+
+                ::std::memcpy(cursor_, data, size);
+                cursor_ += size;
+            }
+
+            template<typename T>
+            void Value(const T& value)
+            {
+                Bytes(&value, sizeof(T));
+            }
+
+            const unsigned char* Data() const noexcept
+            {
+                return begin_;
+            }
+
+            ::size_t Size() const noexcept
+            {
+                return static_cast<::size_t>(cursor_ - begin_);
+            }
+
+            void Drop() noexcept
+            {
+                ++dropped_;
+            }
+
+            ::uint64_t Dropped() const noexcept
+            {
+                return dropped_;
+            }
+
+        protected:
+            ~Writer() = default;
+
+            virtual void Grow(::size_t size) = 0;
+
+            void Reset(unsigned char* begin, ::size_t size, ::size_t capacity) noexcept
+            {
+                begin_ = begin;
+                cursor_ = begin + size;
+                end_ = begin + capacity;
+            }
+
+        private:
+            unsigned char* begin_{ nullptr };
+            unsigned char* cursor_{ nullptr };
+            unsigned char* end_{ nullptr };
+            ::uint64_t dropped_{ 0 };
+        };
+
+        class VectorWriter final : public Writer
+        {
+        public:
+            explicit VectorWriter(::std::vector<unsigned char>& bytes) noexcept : bytes_(bytes)
+            {
+                Reset(bytes_.data(), 0, bytes_.size());
+            }
+
+        protected:
+            void Grow(::size_t size) override
+            {
+                const ::size_t used = Size();
+                const ::size_t required = used + size;
+                bytes_.resize(required > 2 * bytes_.size() ? required : 2 * bytes_.size());
+                Reset(bytes_.data(), used, bytes_.size());
+            }
+
+        private:
+            ::std::vector<unsigned char>& bytes_;
+        };
+
+        constexpr ::size_t ArenaBlockSize = 64 * 1024;
+
+        // Bump allocator for decoded arguments, reset after every replayed call.
+        class Arena
+        {
+        public:
+            void* Allocate(::size_t size)
+            {
+                size = (size + 15) & ~static_cast<::size_t>(15);
+                if (blocks_.empty() || offset_ + size > ArenaBlockSize)
+                {
+                    if (block_ + 1 < blocks_.size() && size <= ArenaBlockSize)
+                    {
+                        ++block_;
+                    }
+                    else
+                    {
+                        blocks_.emplace_back(new unsigned char[size > ArenaBlockSize ? size : ArenaBlockSize]);
+                        block_ = blocks_.size() - 1;
+                    }
+
+                    offset_ = 0;
+                }
+
+                void* memory = blocks_[block_].get() + offset_;
+                offset_ += size;
+                return memory;
+            }
+
+            void Reset() noexcept
+            {
+                block_ = 0;
+                offset_ = 0;
+            }
+
+        private:
+            ::std::vector<::std::unique_ptr<unsigned char[]>> blocks_;
+            ::size_t block_{ 0 };
+            ::size_t offset_{ 0 };
+        };
+
+        class Reader
+        {
+        public:
+            Reader(const unsigned char* data, ::size_t size, Arena& arena) noexcept : cursor_{ data }, end_{ data + size }, arena_(arena)
+            {
+            }
+
+            void Bytes(void* data, ::size_t size) noexcept
+            {
+                if (static_cast<::size_t>(end_ - cursor_) < size)
+                {
+                    failed_ = true;
+                    ::std::memset(data, 0, size);
+                    return;
+                }
+
+                ::std::memcpy(data, cursor_, size);
+                cursor_ += size;
+            }
+
+            template<typename T>
+            T Value() noexcept
+            {
+                T value;
+                Bytes(&value, sizeof(T));
+                return value;
+            }
+
+            template<typename T>
+            T* Allocate(::size_t count)
+            {
+                // Counts come from the file: never allocate more than the record could describe.
+                if (count > static_cast<::size_t>(end_ - cursor_) + 1)
+                {
+                    Fail();
+                    count = 1;
+                }
+
+                void* memory = arena_.Allocate(count * sizeof(T));
+                ::std::memset(memory, 0, count * sizeof(T));
+                return static_cast<T*>(memory);
+            }
+
+            void Fail() noexcept
+            {
+                failed_ = true;
+            }
+
+            bool Failed() const noexcept
+            {
+                return failed_;
+            }
+
+        private:
+            const unsigned char* cursor_;
+            const unsigned char* const end_;
+            Arena& arena_;
+            bool failed_{ false };
+        };
+
+        //------------------------------------------------------------------------------------
+        // Elements
+        //------------------------------------------------------------------------------------
+
+        template<typename T, typename = void>
+        struct IsComplete : ::std::false_type
+        {
+        };
+
+        template<typename T>
+        struct IsComplete<T, decltype(void(sizeof(T)))> : ::std::true_type
+        {
+        };
+
+        // Dispatchable handles, and non-dispatchable ones on 64-bit targets, are pointers to
+        // types that are never defined.
+        template<typename T>
+        struct IsHandle : ::std::integral_constant<bool, ::std::is_pointer<T>::value
+            && ::std::is_class<typename ::std::remove_pointer<T>::type>::value && !IsComplete<typename ::std::remove_pointer<T>::type>::value>
+        {
+        };
+
+        template<typename T>
+        struct IsScalar : ::std::integral_constant<bool, ::std::is_arithmetic<T>::value || ::std::is_enum<T>::value || IsHandle<T>::value>
+        {
+        };
+
+        // Element<T> serializes one array element or pointed-to structure.
+        template<typename T, typename = void>
+        struct Element
+        {
+            static constexpr bool Serializable = false;
+        };
+
+        template<typename T>
+        struct FlatElement
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const T& element)
+            {
+                writer.Value(element);
+            }
+
+            static void Read(Reader& reader, T& element)
+            {
+                element = reader.Value<T>();
+            }
+        };
+
+        template<typename T>
+        struct Element<T, typename ::std::enable_if<IsScalar<T>::value>::type> : FlatElement<T>
+        {
+        };
+
+        inline void WriteNext(Writer& writer, const void* next);
+        inline const void* ReadNext(Reader& reader);
+
+        // Structures whose only pointer is pNext.
+        template<typename T>
+        struct ChainedElement
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const T& element)
+            {
+                writer.Value(element);
+                WriteNext(writer, element.pNext);
+            }
+
+            static void Read(Reader& reader, T& element)
+            {
+                element = reader.Value<T>();
+                element.pNext = ReadNext(reader);
+            }
+        };
+
+        template<typename T>
+        void WriteArray(Writer& writer, const T* elements, ::uint64_t count)
+        {
+            const ::uint32_t elementCount = elements ? static_cast<::uint32_t>(count) : 0;
+            writer.Value(elementCount);
+            for (::uint32_t index = 0; index < elementCount; ++index)
+            {
+                Element<T>::Write(writer, elements[index]);
+            }
+        }
+
+        template<typename T>
+        const T* ReadArray(Reader& reader)
+        {
+            const ::uint32_t elementCount = reader.Value<::uint32_t>();
+            if (elementCount == 0 || reader.Failed())
+            {
+                return nullptr;
+            }
+
+            T* elements = reader.Allocate<T>(elementCount);
+            for (::uint32_t index = 0; index < elementCount && !reader.Failed(); ++index)
+            {
+                Element<T>::Read(reader, elements[index]);
+            }
+
+            return elements;
+        }
+
+        // Opaque byte arrays (push constants, buffer updates).
+        template<>
+        struct Element<void>
+        {
+            static constexpr bool Serializable = true;
+        };
+
+        template<>
+        inline void WriteArray<void>(Writer& writer, const void* data, ::uint64_t size)
+        {
+            const ::uint32_t byteCount = data ? static_cast<::uint32_t>(size) : 0;
+            writer.Value(byteCount);
+            writer.Bytes(data, byteCount);
+        }
+
+        template<>
+        inline const void* ReadArray<void>(Reader& reader)
+        {
+            const ::uint32_t byteCount = reader.Value<::uint32_t>();
+            if (byteCount == 0 || reader.Failed())
+            {
+                return nullptr;
+            }
+
+            unsigned char* data = reader.Allocate<unsigned char>(byteCount);
+            reader.Bytes(data, byteCount);
+            return data;
+        }
+
+#define VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(type) \
+        template<> \
+        struct Element<type> : FlatElement<type> \
+        { \
+        };
+
+#define VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(type) \
+        template<> \
+        struct Element<type> : ChainedElement<type> \
+        { \
+        };
+
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkBufferCopy)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkBufferImageCopy)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkClearAttachment)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkClearColorValue)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkClearDepthStencilValue)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkClearRect)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkClearValue)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkDescriptorBufferInfo)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkDescriptorImageInfo)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkImageBlit)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkImageCopy)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkImageResolve)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkImageSubresourceRange)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkRect2D)
+        VULKANDYNAMIC_SERIALIZATION_FLAT_ELEMENT(VkViewport)
+
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkBufferMemoryBarrier)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkCommandBufferInheritanceInfo)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkCopyDescriptorSet)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkImageMemoryBarrier)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkMappedMemoryRange)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkMemoryBarrier)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkSemaphoreSignalInfo)
+
+        template<>
+        struct Element<VkCommandBufferBeginInfo>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkCommandBufferBeginInfo& element)
+            {
+                ChainedElement<VkCommandBufferBeginInfo>::Write(writer, element);
+                WriteArray(writer, element.pInheritanceInfo, 1);
+            }
+
+            static void Read(Reader& reader, VkCommandBufferBeginInfo& element)
+            {
+                ChainedElement<VkCommandBufferBeginInfo>::Read(reader, element);
+                element.pInheritanceInfo = ReadArray<VkCommandBufferInheritanceInfo>(reader);
+            }
+        };
+
+        template<>
+        struct Element<VkRenderPassBeginInfo>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkRenderPassBeginInfo& element)
+            {
+                ChainedElement<VkRenderPassBeginInfo>::Write(writer, element);
+                WriteArray(writer, element.pClearValues, element.clearValueCount);
+            }
+
+            static void Read(Reader& reader, VkRenderPassBeginInfo& element)
+            {
+                ChainedElement<VkRenderPassBeginInfo>::Read(reader, element);
+                element.pClearValues = ReadArray<VkClearValue>(reader);
+            }
+        };
+
+        template<>
+        struct Element<VkSubmitInfo>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkSubmitInfo& element)
+            {
+                ChainedElement<VkSubmitInfo>::Write(writer, element);
+                WriteArray(writer, element.pWaitSemaphores, element.waitSemaphoreCount);
+                WriteArray(writer, element.pWaitDstStageMask, element.waitSemaphoreCount);
+                WriteArray(writer, element.pCommandBuffers, element.commandBufferCount);
+                WriteArray(writer, element.pSignalSemaphores, element.signalSemaphoreCount);
+            }
+
+            static void Read(Reader& reader, VkSubmitInfo& element)
+            {
+                ChainedElement<VkSubmitInfo>::Read(reader, element);
+                element.pWaitSemaphores = ReadArray<VkSemaphore>(reader);
+                element.pWaitDstStageMask = ReadArray<VkPipelineStageFlags>(reader);
+                element.pCommandBuffers = ReadArray<VkCommandBuffer>(reader);
+                element.pSignalSemaphores = ReadArray<VkSemaphore>(reader);
+            }
+        };
+
+        template<>
+        struct Element<VkTimelineSemaphoreSubmitInfo>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkTimelineSemaphoreSubmitInfo& element)
+            {
+                ChainedElement<VkTimelineSemaphoreSubmitInfo>::Write(writer, element);
+                WriteArray(writer, element.pWaitSemaphoreValues, element.waitSemaphoreValueCount);
+                WriteArray(writer, element.pSignalSemaphoreValues, element.signalSemaphoreValueCount);
+            }
+
+            static void Read(Reader& reader, VkTimelineSemaphoreSubmitInfo& element)
+            {
+                ChainedElement<VkTimelineSemaphoreSubmitInfo>::Read(reader, element);
+                element.pWaitSemaphoreValues = ReadArray<::uint64_t>(reader);
+                element.pSignalSemaphoreValues = ReadArray<::uint64_t>(reader);
+            }
+        };
+
+        template<>
+        struct Element<VkSemaphoreWaitInfo>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkSemaphoreWaitInfo& element)
+            {
+                ChainedElement<VkSemaphoreWaitInfo>::Write(writer, element);
+                WriteArray(writer, element.pSemaphores, element.semaphoreCount);
+                WriteArray(writer, element.pValues, element.semaphoreCount);
+            }
+
+            static void Read(Reader& reader, VkSemaphoreWaitInfo& element)
+            {
+                ChainedElement<VkSemaphoreWaitInfo>::Read(reader, element);
+                element.pSemaphores = ReadArray<VkSemaphore>(reader);
+                element.pValues = ReadArray<::uint64_t>(reader);
+            }
+        };
+
+        template<>
+        struct Element<VkWriteDescriptorSet>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkWriteDescriptorSet& element)
+            {
+                ChainedElement<VkWriteDescriptorSet>::Write(writer, element);
+
+                // Only the array selected by the descriptor type is valid; inline uniform blocks
+                // and acceleration structures live in the pNext chain.
+                const VkDescriptorType type = element.descriptorType;
+                const bool images = type == VK_DESCRIPTOR_TYPE_SAMPLER || type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER || type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE
+                    || type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE || type == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+                const bool buffers = type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+                    || type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+                const bool texelBuffers = type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+
+                WriteArray(writer, images ? element.pImageInfo : nullptr, element.descriptorCount);
+                WriteArray(writer, buffers ? element.pBufferInfo : nullptr, element.descriptorCount);
+                WriteArray(writer, texelBuffers ? element.pTexelBufferView : nullptr, element.descriptorCount);
+            }
+
+            static void Read(Reader& reader, VkWriteDescriptorSet& element)
+            {
+                ChainedElement<VkWriteDescriptorSet>::Read(reader, element);
+                element.pImageInfo = ReadArray<VkDescriptorImageInfo>(reader);
+                element.pBufferInfo = ReadArray<VkDescriptorBufferInfo>(reader);
+                element.pTexelBufferView = ReadArray<VkBufferView>(reader);
+            }
+        };
+
+#if defined(VK_VERSION_1_1)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkDeviceGroupCommandBufferBeginInfo)
+
+        template<>
+        struct Element<VkDeviceGroupRenderPassBeginInfo>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkDeviceGroupRenderPassBeginInfo& element)
+            {
+                ChainedElement<VkDeviceGroupRenderPassBeginInfo>::Write(writer, element);
+                WriteArray(writer, element.pDeviceRenderAreas, element.deviceRenderAreaCount);
+            }
+
+            static void Read(Reader& reader, VkDeviceGroupRenderPassBeginInfo& element)
+            {
+                ChainedElement<VkDeviceGroupRenderPassBeginInfo>::Read(reader, element);
+                element.pDeviceRenderAreas = ReadArray<VkRect2D>(reader);
+            }
+        };
+
+        template<>
+        struct Element<VkDeviceGroupSubmitInfo>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkDeviceGroupSubmitInfo& element)
+            {
+                ChainedElement<VkDeviceGroupSubmitInfo>::Write(writer, element);
+                WriteArray(writer, element.pWaitSemaphoreDeviceIndices, element.waitSemaphoreCount);
+                WriteArray(writer, element.pCommandBufferDeviceMasks, element.commandBufferCount);
+                WriteArray(writer, element.pSignalSemaphoreDeviceIndices, element.signalSemaphoreCount);
+            }
+
+            static void Read(Reader& reader, VkDeviceGroupSubmitInfo& element)
+            {
+                ChainedElement<VkDeviceGroupSubmitInfo>::Read(reader, element);
+                element.pWaitSemaphoreDeviceIndices = ReadArray<::uint32_t>(reader);
+                element.pCommandBufferDeviceMasks = ReadArray<::uint32_t>(reader);
+                element.pSignalSemaphoreDeviceIndices = ReadArray<::uint32_t>(reader);
+            }
+        };
+#endif // VK_VERSION_1_1
+
+#if defined(VK_VERSION_1_2)
+        template<>
+        struct Element<VkRenderPassAttachmentBeginInfo>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkRenderPassAttachmentBeginInfo& element)
+            {
+                ChainedElement<VkRenderPassAttachmentBeginInfo>::Write(writer, element);
+                WriteArray(writer, element.pAttachments, element.attachmentCount);
+            }
+
+            static void Read(Reader& reader, VkRenderPassAttachmentBeginInfo& element)
+            {
+                ChainedElement<VkRenderPassAttachmentBeginInfo>::Read(reader, element);
+                element.pAttachments = ReadArray<VkImageView>(reader);
+            }
+        };
+#endif // VK_VERSION_1_2
+
+#if defined(VK_KHR_swapchain)
+        template<>
+        struct Element<VkPresentInfoKHR>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkPresentInfoKHR& element)
+            {
+                ChainedElement<VkPresentInfoKHR>::Write(writer, element);
+                WriteArray(writer, element.pWaitSemaphores, element.waitSemaphoreCount);
+                WriteArray(writer, element.pSwapchains, element.swapchainCount);
+                WriteArray(writer, element.pImageIndices, element.swapchainCount);
+            }
+
+            static void Read(Reader& reader, VkPresentInfoKHR& element)
+            {
+                ChainedElement<VkPresentInfoKHR>::Read(reader, element);
+                element.pWaitSemaphores = ReadArray<VkSemaphore>(reader);
+                element.pSwapchains = ReadArray<VkSwapchainKHR>(reader);
+                element.pImageIndices = ReadArray<::uint32_t>(reader);
+
+                // pResults is an output; the captured pointer only tells whether it was requested.
+                element.pResults = element.pResults ? reader.Allocate<VkResult>(element.swapchainCount) : nullptr;
+            }
+        };
+#endif // VK_KHR_swapchain
+
+#if defined(VK_KHR_synchronization2)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkBufferMemoryBarrier2KHR)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkCommandBufferSubmitInfoKHR)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkImageMemoryBarrier2KHR)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkMemoryBarrier2KHR)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkSemaphoreSubmitInfoKHR)
+
+        template<>
+        struct Element<VkDependencyInfoKHR>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkDependencyInfoKHR& element)
+            {
+                ChainedElement<VkDependencyInfoKHR>::Write(writer, element);
+                WriteArray(writer, element.pMemoryBarriers, element.memoryBarrierCount);
+                WriteArray(writer, element.pBufferMemoryBarriers, element.bufferMemoryBarrierCount);
+                WriteArray(writer, element.pImageMemoryBarriers, element.imageMemoryBarrierCount);
+            }
+
+            static void Read(Reader& reader, VkDependencyInfoKHR& element)
+            {
+                ChainedElement<VkDependencyInfoKHR>::Read(reader, element);
+                element.pMemoryBarriers = ReadArray<VkMemoryBarrier2KHR>(reader);
+                element.pBufferMemoryBarriers = ReadArray<VkBufferMemoryBarrier2KHR>(reader);
+                element.pImageMemoryBarriers = ReadArray<VkImageMemoryBarrier2KHR>(reader);
+            }
+        };
+
+        template<>
+        struct Element<VkSubmitInfo2KHR>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkSubmitInfo2KHR& element)
+            {
+                ChainedElement<VkSubmitInfo2KHR>::Write(writer, element);
+                WriteArray(writer, element.pWaitSemaphoreInfos, element.waitSemaphoreInfoCount);
+                WriteArray(writer, element.pCommandBufferInfos, element.commandBufferInfoCount);
+                WriteArray(writer, element.pSignalSemaphoreInfos, element.signalSemaphoreInfoCount);
+            }
+
+            static void Read(Reader& reader, VkSubmitInfo2KHR& element)
+            {
+                ChainedElement<VkSubmitInfo2KHR>::Read(reader, element);
+                element.pWaitSemaphoreInfos = ReadArray<VkSemaphoreSubmitInfoKHR>(reader);
+                element.pCommandBufferInfos = ReadArray<VkCommandBufferSubmitInfoKHR>(reader);
+                element.pSignalSemaphoreInfos = ReadArray<VkSemaphoreSubmitInfoKHR>(reader);
+            }
+        };
+#endif // VK_KHR_synchronization2
+
+#if defined(VK_KHR_copy_commands2)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkBufferCopy2KHR)
+        VULKANDYNAMIC_SERIALIZATION_CHAINED_ELEMENT(VkBufferImageCopy2KHR)
+
+        template<>
+        struct Element<VkCopyBufferInfo2KHR>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkCopyBufferInfo2KHR& element)
+            {
+                ChainedElement<VkCopyBufferInfo2KHR>::Write(writer, element);
+                WriteArray(writer, element.pRegions, element.regionCount);
+            }
+
+            static void Read(Reader& reader, VkCopyBufferInfo2KHR& element)
+            {
+                ChainedElement<VkCopyBufferInfo2KHR>::Read(reader, element);
+                element.pRegions = ReadArray<VkBufferCopy2KHR>(reader);
+            }
+        };
+
+        template<>
+        struct Element<VkCopyBufferToImageInfo2KHR>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const VkCopyBufferToImageInfo2KHR& element)
+            {
+                ChainedElement<VkCopyBufferToImageInfo2KHR>::Write(writer, element);
+                WriteArray(writer, element.pRegions, element.regionCount);
+            }
+
+            static void Read(Reader& reader, VkCopyBufferToImageInfo2KHR& element)
+            {
+                ChainedElement<VkCopyBufferToImageInfo2KHR>::Read(reader, element);
+                element.pRegions = ReadArray<VkBufferImageCopy2KHR>(reader);
+            }
+        };
+#endif // VK_KHR_copy_commands2
+
+        //------------------------------------------------------------------------------------
+        // pNext chains
+        //------------------------------------------------------------------------------------
+
+        // Extension structures copied through pNext chains: those that submits, presents and
+        // command buffer and render pass begins carry. Unknown ones are dropped from the chain
+        // and counted, and callers must not replay or issue a call that lost structures.
+#if defined(VK_VERSION_1_1)
+#define VULKANDYNAMIC_SERIALIZATION_NEXT_STRUCTURES_1_1(structure) \
+        structure(VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO, VkDeviceGroupCommandBufferBeginInfo) \
+        structure(VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO, VkDeviceGroupRenderPassBeginInfo) \
+        structure(VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO, VkDeviceGroupSubmitInfo)
+#else
+#define VULKANDYNAMIC_SERIALIZATION_NEXT_STRUCTURES_1_1(structure)
+#endif // VK_VERSION_1_1
+
+#if defined(VK_VERSION_1_2)
+#define VULKANDYNAMIC_SERIALIZATION_NEXT_STRUCTURES_1_2(structure) \
+        structure(VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO, VkRenderPassAttachmentBeginInfo)
+#else
+#define VULKANDYNAMIC_SERIALIZATION_NEXT_STRUCTURES_1_2(structure)
+#endif // VK_VERSION_1_2
+
+#define VULKANDYNAMIC_SERIALIZATION_NEXT_STRUCTURES(structure) \
+        structure(VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO, VkTimelineSemaphoreSubmitInfo) \
+        VULKANDYNAMIC_SERIALIZATION_NEXT_STRUCTURES_1_1(structure) \
+        VULKANDYNAMIC_SERIALIZATION_NEXT_STRUCTURES_1_2(structure)
+
+        // Chains are a sequence of (sType, structure) pairs ended by this marker.
+        constexpr VkStructureType ChainEnd = VK_STRUCTURE_TYPE_MAX_ENUM;
+
+        inline void WriteNext(Writer& writer, const void* next)
+        {
+            for (const VkBaseInStructure* structure = static_cast<const VkBaseInStructure*>(next); structure; structure = structure->pNext)
+            {
+                switch (structure->sType)
+                {
+#define VULKANDYNAMIC_SERIALIZATION_WRITE_NEXT(structureType, type) \
+                case structureType: \
+                    writer.Value(structure->sType); \
+                    Element<type>::Write(writer, *reinterpret_cast<const type*>(structure)); \
+                    return;
+
+                    VULKANDYNAMIC_SERIALIZATION_NEXT_STRUCTURES(VULKANDYNAMIC_SERIALIZATION_WRITE_NEXT)
+
+#undef VULKANDYNAMIC_SERIALIZATION_WRITE_NEXT
+
+                default:
+                    writer.Drop();
+                    break;
+                }
+            }
+
+            writer.Value(ChainEnd);
+        }
+
+        inline const void* ReadNext(Reader& reader)
+        {
+            switch (reader.Value<VkStructureType>())
+            {
+#define VULKANDYNAMIC_SERIALIZATION_READ_NEXT(structureType, type) \
+            case structureType: \
+            { \
+                type* structure = reader.Allocate<type>(1); \
+                Element<type>::Read(reader, *structure); \
+                return structure; \
+            }
+
+                VULKANDYNAMIC_SERIALIZATION_NEXT_STRUCTURES(VULKANDYNAMIC_SERIALIZATION_READ_NEXT)
+
+#undef VULKANDYNAMIC_SERIALIZATION_READ_NEXT
+
+            case ChainEnd:
+                return nullptr;
+
+            default:
+                // Anything else means the record is corrupt.
+                reader.Fail();
+                return nullptr;
+            }
+        }
+
+        //------------------------------------------------------------------------------------
+        // Parameters
+        //------------------------------------------------------------------------------------
+
+        // Pointer parameters are arrays whose length is the closest preceding integer
+        // parameter (regionCount, descriptorWriteCount, dataSize...), or the function's
+        // initial count where none precedes them. Outputs other than scalars are not
+        // serialized. Opaque `const void*` data is only serialized for the entry points
+        // whose FunctionTraits declare it sized by the preceding integer.
+        template<typename T, typename = void>
+        struct Parameter
+        {
+            static constexpr bool Serializable = false;
+        };
+
+        template<typename T>
+        struct Parameter<T, typename ::std::enable_if<IsScalar<T>::value>::type>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, T value, ::uint64_t& count)
+            {
+                writer.Value(value);
+                Count(value, count, ::std::is_integral<T>{});
+            }
+
+            static void Read(Reader& reader, T& value, ::uint64_t& count)
+            {
+                value = reader.Value<T>();
+                Count(value, count, ::std::is_integral<T>{});
+            }
+
+        private:
+            static void Count(T value, ::uint64_t& count, ::std::true_type) noexcept
+            {
+                count = static_cast<::uint64_t>(value);
+            }
+
+            static void Count(T, ::uint64_t&, ::std::false_type) noexcept
+            {
+            }
+        };
+
+        template<typename T>
+        struct Parameter<const T*, typename ::std::enable_if<Element<T>::Serializable>::type>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const T* elements, ::uint64_t& count)
+            {
+                WriteArray(writer, elements, count);
+            }
+
+            static void Read(Reader& reader, const T*& elements, ::uint64_t&)
+            {
+                elements = ReadArray<T>(reader);
+            }
+        };
+
+        template<>
+        struct Parameter<const char*>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer& writer, const char* string, ::uint64_t&)
+            {
+                WriteArray<void>(writer, string, string ? ::std::strlen(string) + 1 : 0);
+            }
+
+            static void Read(Reader& reader, const char*& string, ::uint64_t&)
+            {
+                string = static_cast<const char*>(ReadArray<void>(reader));
+            }
+        };
+
+        template<typename T>
+        struct Parameter<T*, typename ::std::enable_if<!::std::is_const<T>::value && ::std::is_arithmetic<T>::value>::type>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer&, T*, ::uint64_t&)
+            {
+            }
+
+            static void Read(Reader& reader, T*& output, ::uint64_t&)
+            {
+                output = reader.Allocate<T>(1);
+            }
+        };
+
+        template<typename... Args>
+        struct HasOpaqueData : ::std::false_type
+        {
+        };
+
+        template<typename First, typename... Rest>
+        struct HasOpaqueData<First, Rest...> : ::std::integral_constant<bool, ::std::is_same<First, const void*>::value || HasOpaqueData<Rest...>::value>
+        {
+        };
+
+        template<typename... Args>
+        struct Parameters;
+
+        template<>
+        struct Parameters<>
+        {
+            static constexpr bool Serializable = true;
+
+            static void Write(Writer&, ::uint64_t&)
+            {
+            }
+        };
+
+        template<typename First, typename... Rest>
+        struct Parameters<First, Rest...>
+        {
+            static constexpr bool Serializable = Parameter<First>::Serializable && Parameters<Rest...>::Serializable;
+
+            static void Write(Writer& writer, ::uint64_t& count, First first, Rest... rest)
+            {
+                Parameter<First>::Write(writer, first, count);
+                Parameters<Rest...>::Write(writer, count, rest...);
+            }
+        };
+
+        template<::std::size_t Index, typename Tuple>
+        struct TupleReader
+        {
+            static void Read(Reader& reader, Tuple& arguments, ::uint64_t& count)
+            {
+                TupleReader<Index - 1, Tuple>::Read(reader, arguments, count);
+                Parameter<typename ::std::tuple_element<Index - 1, Tuple>::type>::Read(reader, ::std::get<Index - 1>(arguments), count);
+            }
+        };
+
+        template<typename Tuple>
+        struct TupleReader<0, Tuple>
+        {
+            static void Read(Reader&, Tuple&, ::uint64_t&)
+            {
+            }
+        };
+
+        template<::std::size_t... Indices>
+        struct IndexSequence
+        {
+        };
+
+        template<::std::size_t Count, ::std::size_t... Indices>
+        struct MakeIndexSequence : MakeIndexSequence<Count - 1, Count - 1, Indices...>
+        {
+        };
+
+        template<::std::size_t... Indices>
+        struct MakeIndexSequence<0, Indices...>
+        {
+            using Type = IndexSequence<Indices...>;
+        };
+
+        // Parameter conventions the generic rules above get wrong, keyed by signature.
+        // SizedData marks entry points whose `const void*` data is sized in bytes by the
+        // integer parameter before it; any other opaque data (descriptor update templates,
+        // checkpoint markers) cannot be copied.
+        template<typename Function>
+        struct FunctionTraits
+        {
+            static constexpr bool Serializable = true;
+            static constexpr bool SizedData = false;
+            static constexpr ::uint64_t InitialCount = 1;
+        };
+
+        template<>
+        struct FunctionTraits<PFN_vkCmdPushConstants>
+        {
+            static constexpr bool Serializable = true;
+            static constexpr bool SizedData = true;
+            static constexpr ::uint64_t InitialCount = 1;
+        };
+
+        template<>
+        struct FunctionTraits<PFN_vkCmdUpdateBuffer>
+        {
+            static constexpr bool Serializable = true;
+            static constexpr bool SizedData = true;
+            static constexpr ::uint64_t InitialCount = 1;
+        };
+
+        // blendConstants is a float[4].
+        template<>
+        struct FunctionTraits<PFN_vkCmdSetBlendConstants>
+        {
+            static constexpr bool Serializable = true;
+            static constexpr bool SizedData = false;
+            static constexpr ::uint64_t InitialCount = 4;
+        };
+
+#if defined(VK_KHR_fragment_shading_rate)
+        // combinerOps is a VkFragmentShadingRateCombinerOpKHR[2] following a single extent.
+        template<>
+        struct FunctionTraits<PFN_vkCmdSetFragmentShadingRateKHR>
+        {
+            static constexpr bool Serializable = false;
+            static constexpr bool SizedData = false;
+            static constexpr ::uint64_t InitialCount = 1;
+        };
+#endif // VK_KHR_fragment_shading_rate
+
+#if defined(VK_NV_fragment_shading_rate_enums)
+        // combinerOps is a VkFragmentShadingRateCombinerOpKHR[2] and no integer precedes it.
+        template<>
+        struct FunctionTraits<PFN_vkCmdSetFragmentShadingRateEnumNV>
+        {
+            static constexpr bool Serializable = true;
+            static constexpr bool SizedData = false;
+            static constexpr ::uint64_t InitialCount = 2;
+        };
+#endif // VK_NV_fragment_shading_rate_enums
+
+#if defined(VK_EXT_multi_draw)
+        // Draw arrays are strided.
+        template<>
+        struct FunctionTraits<PFN_vkCmdDrawMultiEXT>
+        {
+            static constexpr bool Serializable = false;
+            static constexpr bool SizedData = false;
+            static constexpr ::uint64_t InitialCount = 1;
+        };
+
+        template<>
+        struct FunctionTraits<PFN_vkCmdDrawMultiIndexedEXT>
+        {
+            static constexpr bool Serializable = false;
+            static constexpr bool SizedData = false;
+            static constexpr ::uint64_t InitialCount = 1;
+        };
+#endif // VK_EXT_multi_draw
+
+        //------------------------------------------------------------------------------------
+        // Signatures
+        //------------------------------------------------------------------------------------
+
+        // Encodes and decodes the arguments of one entry point. Write, Read and Invoke may only
+        // be used where Serializable holds.
+        template<typename Function>
+        struct Signature;
+
+        template<typename Result, typename... Args>
+        struct Signature<Result (VKAPI_PTR*)(Args...)>
+        {
+            using Function = Result (VKAPI_PTR*)(Args...);
+            using Arguments = ::std::tuple<Args...>;
+
+            static constexpr bool Serializable = Parameters<Args...>::Serializable && FunctionTraits<Function>::Serializable
+                && (!HasOpaqueData<Args...>::value || FunctionTraits<Function>::SizedData);
+
+            static void Write(Writer& writer, Args... args)
+            {
+                ::uint64_t count = FunctionTraits<Function>::InitialCount;
+                Parameters<Args...>::Write(writer, count, args...);
+            }
+
+            static void Read(Reader& reader, Arguments& arguments)
+            {
+                ::uint64_t count = FunctionTraits<Function>::InitialCount;
+                TupleReader<sizeof...(Args), Arguments>::Read(reader, arguments, count);
+            }
+
+            static Result Invoke(Function function, Arguments& arguments)
+            {
+                return Invoke(function, arguments, typename MakeIndexSequence<sizeof...(Args)>::Type{});
+            }
+
+        private:
+            template<::std::size_t... Indices>
+            static Result Invoke(Function function, Arguments& arguments, IndexSequence<Indices...>)
+            {
+                return function(::std::get<Indices>(arguments)...);
+            }
+        };
+    } // namespace Detail
+} // namespace VulkanDynamic
+
+#endif // __VULKANDYNAMIC_SERIALIZATION_HPP__
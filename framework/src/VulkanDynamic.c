@@ -13,18 +13,66 @@
 // limitations under the License.
 
 #include <VulkanDynamic/VulkanDynamic.h>
+#include <VulkanDynamic/VulkanDynamicFunctions.h>
+#include <Platform/Atomic.h>
+#include <Platform/Clock.h>
 #include <Platform/SharedLibrary.h>
 
 #define VULKANDYNAMIC_GET_SYMBOL(loader, dispatch, entryPoint, function) dispatch->function = (PFN_vk##function)dispatch->entryPoint(loader, "vk"#function)
 #define VULKANDYNAMIC_GET_LOADER_SYMBOL(dispatch, function) VULKANDYNAMIC_GET_SYMBOL(VK_NULL_HANDLE, dispatch, GetInstanceProcAddr, function)
 #define VULKANDYNAMIC_GET_INSTANCE_SYMBOL(instance, dispatch, function) VULKANDYNAMIC_GET_SYMBOL(instance, dispatch, GetInstanceProcAddr, function)
 #define VULKANDYNAMIC_GET_DEVICE_SYMBOL(device, dispatch, function) VULKANDYNAMIC_GET_SYMBOL(device, dispatch, GetDeviceProcAddr, function)
+#define VULKANDYNAMIC_COPY_SYMBOL(source, destination, function) destination->function = source->function
+#define VULKANDYNAMIC_FUNCTION_NAME(function) "vk"#function,
+
+typedef PFN_vkVoidFunction (VKAPI_PTR *PFN_vk_icdGetPhysicalDeviceProcAddr)(VkInstance instance, const char* pName);
+
+#define VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, source, destination, function) \
+    destination->function = getPhysicalDeviceProcAddr ? (PFN_vk##function)getPhysicalDeviceProcAddr(instance, "vk"#function) : NULL; \
+    destination->function = destination->function ? destination->function : source->function
+
+#define VULKANDYNAMIC_COUNT_LOADER_SYMBOL(function) resolvedFunctionCount += loaderDispatch->function != NULL;
+#define VULKANDYNAMIC_COUNT_INSTANCE_SYMBOL(function) resolvedFunctionCount += instanceDispatch->function != NULL;
+#define VULKANDYNAMIC_COUNT_PHYSICAL_DEVICE_SYMBOL(function) resolvedFunctionCount += physicalDeviceDispatch->function != NULL;
+#define VULKANDYNAMIC_COUNT_DEVICE_SYMBOL(function) resolvedFunctionCount += deviceDispatch->function != NULL;
+#define VULKANDYNAMIC_COUNT_COMMAND_BUFFER_SYMBOL(function) resolvedFunctionCount += commandBufferDispatch->function != NULL;
+
+//------------------------------------------------------------------------------------
+// Resolution Statistics
+//------------------------------------------------------------------------------------
+
+static VulkanDynamicResolutionStatistics VulkanDynamicResolution[VULKANDYNAMIC_TIER_COUNT];
+
+static void VulkanDynamicRecordResolution(VulkanDynamicTier tier, uint64_t start, uint64_t resolvedFunctionCount, uint64_t functionCount)
+{
+    VulkanDynamicResolutionStatistics* statistics = &VulkanDynamicResolution[tier];
+
+    ATOMIC_INCREMENT_64(&statistics->resolveCount);
+    ATOMIC_ADD_64(&statistics->resolveNanoseconds, ClockNanoseconds() - start);
+    ATOMIC_STORE_64(&statistics->resolvedFunctionCount, resolvedFunctionCount);
+    ATOMIC_STORE_64(&statistics->functionCount, functionCount);
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetResolutionStatistics(VulkanDynamicTier tier, VulkanDynamicResolutionStatistics* statistics)
+{
+    if (tier >= VULKANDYNAMIC_TIER_COUNT || !statistics)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    statistics->resolveCount = ATOMIC_LOAD_64(&VulkanDynamicResolution[tier].resolveCount);
+    statistics->resolveNanoseconds = ATOMIC_LOAD_64(&VulkanDynamicResolution[tier].resolveNanoseconds);
+    statistics->resolvedFunctionCount = ATOMIC_LOAD_64(&VulkanDynamicResolution[tier].resolvedFunctionCount);
+    statistics->functionCount = ATOMIC_LOAD_64(&VulkanDynamicResolution[tier].functionCount);
+
+    return VK_SUCCESS;
+}
 
 //------------------------------------------------------------------------------------
 // Loader
 //------------------------------------------------------------------------------------
 
-VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateLoader(VulkanDynamicLoader* loader)
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateLoader(VulkanDynamicLoader* loader)
 {
     if (!loader)
     {
@@ -32,16 +80,23 @@ VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateLoader(VulkanDynamicLoader* lo
     }
 
 #if defined(_WIN32)
-    const char* vulkanLibraryName = "vulkan-1.dll";
+    const char* vulkanLibraryNames[] = { "vulkan-1.dll" };
 #elif __APPLE__
-    const char* vulkanLibraryName = "libMoltenVK.dylib";
-#elif __UNIX__
-    const char* vulkanLibraryName = "libvulkan.so;libvulkan.so.1";
+    const char* vulkanLibraryNames[] = { "libMoltenVK.dylib" };
+#elif defined(__unix__) || defined(__UNIX__)
+    // The versioned name is what loader packages install; the unversioned link usually
+    // ships only with development packages.
+    const char* vulkanLibraryNames[] = { "libvulkan.so.1", "libvulkan.so" };
 #else
     #error "Target platform undefined"
 #endif
 
-    VulkanDynamicLoader vulkanLoader = (VulkanDynamicLoader)SharedLibraryLoad(vulkanLibraryName);
+    VulkanDynamicLoader vulkanLoader = VK_NULL_HANDLE;
+    for (size_t i = 0; !vulkanLoader && i < sizeof(vulkanLibraryNames) / sizeof(vulkanLibraryNames[0]); ++i)
+    {
+        vulkanLoader = (VulkanDynamicLoader)SharedLibraryLoad(vulkanLibraryNames[i]);
+    }
+
     if (!vulkanLoader)
     {
         return VK_ERROR_INCOMPATIBLE_DRIVER;
@@ -52,19 +107,21 @@ VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateLoader(VulkanDynamicLoader* lo
     return VK_SUCCESS;
 }
 
-VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyLoader(VulkanDynamicLoader loader)
+VULKANDYNAMIC_API VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyLoader(VulkanDynamicLoader loader)
 {
     SharedLibraryFree((SharedLibrary)loader);
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetLoaderDispatch(const VulkanDynamicLoader loader, VulkanDynamicLoaderDispatch* loaderDispatch)
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetLoaderDispatch(const VulkanDynamicLoader loader, VulkanDynamicLoaderDispatch* loaderDispatch)
 {
+    const uint64_t start = ClockNanoseconds();
+
     if (!loader || !loaderDispatch)
     {
         return VK_ERROR_OUT_OF_HOST_MEMORY;
     }
 
-    loaderDispatch->GetInstanceProcAddr = SharedLibraryGetSymbol((SharedLibrary)loader, "vkGetInstanceProcAddr");
+    loaderDispatch->GetInstanceProcAddr = (PFN_vkGetInstanceProcAddr)SharedLibraryGetSymbol((SharedLibrary)loader, "vkGetInstanceProcAddr");
     if (!loaderDispatch->GetInstanceProcAddr)
     {
         return VK_ERROR_INCOMPATIBLE_DRIVER;
@@ -78,6 +135,10 @@ VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetLoaderDispatch(const VulkanDynami
     // Vulkan Core 1.1
     VULKANDYNAMIC_GET_LOADER_SYMBOL(loaderDispatch, EnumerateInstanceVersion);
 
+    uint64_t resolvedFunctionCount = 0;
+    VULKANDYNAMIC_LOADER_FUNCTIONS(VULKANDYNAMIC_COUNT_LOADER_SYMBOL)
+    VulkanDynamicRecordResolution(VULKANDYNAMIC_TIER_LOADER, start, resolvedFunctionCount, VULKANDYNAMIC_LOADER_FUNCTION_ID_COUNT);
+
     return VK_SUCCESS;
 }
 
@@ -85,8 +146,10 @@ VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetLoaderDispatch(const VulkanDynami
 // Instance
 //------------------------------------------------------------------------------------
 
-VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetInstanceDispatch(VkInstance instance, const VulkanDynamicLoaderDispatch* loaderDispatch, VulkanDynamicInstanceDispatch* instanceDispatch)
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetInstanceDispatch(VkInstance instance, const VulkanDynamicLoaderDispatch* loaderDispatch, VulkanDynamicInstanceDispatch* instanceDispatch)
 {
+    const uint64_t start = ClockNanoseconds();
+
     if (!instance || !loaderDispatch || !instanceDispatch)
     {
         return VK_ERROR_OUT_OF_HOST_MEMORY;
@@ -287,6 +350,164 @@ VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetInstanceDispatch(VkInstance insta
     VULKANDYNAMIC_GET_INSTANCE_SYMBOL(instance, instanceDispatch, GetPhysicalDeviceScreenPresentationSupportQNX);
 #endif // VK_QNX_screen_surface
 
+    uint64_t resolvedFunctionCount = 0;
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS(VULKANDYNAMIC_COUNT_INSTANCE_SYMBOL)
+    VulkanDynamicRecordResolution(VULKANDYNAMIC_TIER_INSTANCE, start, resolvedFunctionCount, VULKANDYNAMIC_INSTANCE_FUNCTION_ID_COUNT);
+
+    return VK_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------
+// Physical Device
+//------------------------------------------------------------------------------------
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetPhysicalDeviceDispatch(VkInstance instance, const VulkanDynamicLoader loader, const VulkanDynamicInstanceDispatch* instanceDispatch, VulkanDynamicPhysicalDeviceDispatch* physicalDeviceDispatch)
+{
+    const uint64_t start = ClockNanoseconds();
+
+    if (!instance || !instanceDispatch || !physicalDeviceDispatch)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    // Only a driver exports vk_icdGetPhysicalDeviceProcAddr, and the Vulkan loader never
+    // hands it out through vkGetInstanceProcAddr. MoltenVK is the one library
+    // VulkanDynamicCreateLoader opens directly; everywhere else the loader's
+    // trampolines are required to unwrap the physical device handle.
+    PFN_vk_icdGetPhysicalDeviceProcAddr getPhysicalDeviceProcAddr = NULL;
+#if defined(__APPLE__)
+    if (loader)
+    {
+        getPhysicalDeviceProcAddr = (PFN_vk_icdGetPhysicalDeviceProcAddr)SharedLibraryGetSymbol((SharedLibrary)loader, "vk_icdGetPhysicalDeviceProcAddr");
+    }
+#else
+    (void)loader;
+#endif // __APPLE__
+
+    // Vulkan Core 1.0
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceFeatures);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceFormatProperties);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceImageFormatProperties);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceProperties);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceQueueFamilyProperties);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceMemoryProperties);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, CreateDevice);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, EnumerateDeviceExtensionProperties);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, EnumerateDeviceLayerProperties);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceSparseImageFormatProperties);
+
+    // Vulkan Core 1.1
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceFeatures2);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceProperties2);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceFormatProperties2);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceImageFormatProperties2);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceQueueFamilyProperties2);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceMemoryProperties2);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceSparseImageFormatProperties2);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceExternalBufferProperties);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceExternalFenceProperties);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceExternalSemaphoreProperties);
+
+#if defined(VK_KHR_surface)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceSurfaceSupportKHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceSurfaceCapabilitiesKHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceSurfaceFormatsKHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceSurfacePresentModesKHR);
+#endif // VK_KHR_surface
+
+#if defined(VK_KHR_display)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceDisplayPropertiesKHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceDisplayPlanePropertiesKHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetDisplayPlaneSupportedDisplaysKHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetDisplayModePropertiesKHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, CreateDisplayModeKHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetDisplayPlaneCapabilitiesKHR);
+#endif // VK_KHR_display
+
+#if defined(VK_KHR_xlib_surface)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceXlibPresentationSupportKHR);
+#endif // VK_KHR_xlib_surface
+
+#if defined(VK_KHR_xcb_surface)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceXcbPresentationSupportKHR);
+#endif // VK_KHR_xcb_surface
+
+#if defined(VK_KHR_wayland_surface)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceWaylandPresentationSupportKHR);
+#endif // VK_KHR_wayland_surface
+
+#if defined(VK_KHR_win32_surface)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceWin32PresentationSupportKHR);
+#endif // VK_KHR_win32_surface
+
+#if defined(VK_NV_external_memory_capabilities)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceExternalImageFormatPropertiesNV);
+#endif // VK_NV_external_memory_capabilities
+
+#if defined(VK_KHR_get_physical_device_properties2)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceFeatures2KHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceProperties2KHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceFormatProperties2KHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceImageFormatProperties2KHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceQueueFamilyProperties2KHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceMemoryProperties2KHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceSparseImageFormatProperties2KHR);
+#endif // VK_KHR_get_physical_device_properties2
+
+#if defined(VK_KHR_external_memory_capabilities)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceExternalBufferPropertiesKHR);
+#endif // VK_KHR_external_memory_capabilities
+
+#if defined(VK_KHR_external_semaphore_capabilities)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceExternalSemaphorePropertiesKHR);
+#endif // VK_KHR_external_semaphore_capabilities
+
+#if defined(VK_EXT_direct_mode_display)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, ReleaseDisplayEXT);
+#endif // VK_EXT_direct_mode_display
+
+#if defined(VK_EXT_acquire_xlib_display)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, AcquireXlibDisplayEXT);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetRandROutputDisplayEXT);
+#endif // VK_EXT_acquire_xlib_display
+
+#if defined(VK_EXT_display_surface_counter)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceSurfaceCapabilities2EXT);
+#endif // VK_EXT_display_surface_counter
+
+#if defined(VK_KHR_external_fence_capabilities)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceExternalFencePropertiesKHR);
+#endif // VK_KHR_external_fence_capabilities
+
+#if defined(VK_KHR_get_surface_capabilities2)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceSurfaceCapabilities2KHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceSurfaceFormats2KHR);
+#endif // VK_KHR_get_surface_capabilities2
+
+#if defined(VK_KHR_get_display_properties2)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceDisplayProperties2KHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceDisplayPlaneProperties2KHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetDisplayModeProperties2KHR);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetDisplayPlaneCapabilities2KHR);
+#endif // VK_KHR_get_display_properties2
+
+#if defined(VK_EXT_acquire_drm_display)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, AcquireDrmDisplayEXT);
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetDrmDisplayEXT);
+#endif // VK_EXT_acquire_drm_display
+
+#if defined(VK_EXT_directfb_surface)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceDirectFBPresentationSupportEXT);
+#endif // VK_EXT_directfb_surface
+
+#if defined(VK_QNX_screen_surface)
+    VULKANDYNAMIC_GET_PHYSICAL_DEVICE_SYMBOL(instance, getPhysicalDeviceProcAddr, instanceDispatch, physicalDeviceDispatch, GetPhysicalDeviceScreenPresentationSupportQNX);
+#endif // VK_QNX_screen_surface
+
+    uint64_t resolvedFunctionCount = 0;
+    VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS(VULKANDYNAMIC_COUNT_PHYSICAL_DEVICE_SYMBOL)
+    VulkanDynamicRecordResolution(VULKANDYNAMIC_TIER_PHYSICAL_DEVICE, start, resolvedFunctionCount, VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTION_ID_COUNT);
+
     return VK_SUCCESS;
 }
 
@@ -294,8 +515,10 @@ VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetInstanceDispatch(VkInstance insta
 // Device
 //------------------------------------------------------------------------------------
 
-VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetDeviceDispatch(VkDevice device, const VulkanDynamicInstanceDispatch* instanceDispatch, VulkanDynamicDeviceDispatch* deviceDispatch)
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetDeviceDispatch(VkDevice device, const VulkanDynamicInstanceDispatch* instanceDispatch, VulkanDynamicDeviceDispatch* deviceDispatch)
 {
+    const uint64_t start = ClockNanoseconds();
+
     if (!device || !instanceDispatch || !deviceDispatch)
     {
         return VK_ERROR_OUT_OF_HOST_MEMORY;
@@ -981,5 +1204,341 @@ VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetDeviceDispatch(VkDevice device, c
     VULKANDYNAMIC_GET_DEVICE_SYMBOL(device, deviceDispatch, CmdPushDescriptorSetWithTemplateKHR);
 #endif // VK_KHR_push_descriptor || VK_KHR_descriptor_update_template
 
+    uint64_t resolvedFunctionCount = 0;
+    VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_COUNT_DEVICE_SYMBOL)
+    VulkanDynamicRecordResolution(VULKANDYNAMIC_TIER_DEVICE, start, resolvedFunctionCount, VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT);
+
+    return VK_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------
+// Command Buffer
+//------------------------------------------------------------------------------------
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetCommandBufferDispatch(const VulkanDynamicDeviceDispatch* deviceDispatch, VulkanDynamicCommandBufferDispatch* commandBufferDispatch)
+{
+    const uint64_t start = ClockNanoseconds();
+
+    if (!deviceDispatch || !commandBufferDispatch)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    // Vulkan Core 1.0
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBindPipeline);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetViewport);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetScissor);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetLineWidth);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetDepthBias);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetBlendConstants);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetDepthBounds);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetStencilCompareMask);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetStencilWriteMask);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetStencilReference);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBindDescriptorSets);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBindIndexBuffer);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBindVertexBuffers);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDraw);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawIndexed);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawIndirect);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawIndexedIndirect);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDispatch);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDispatchIndirect);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyBuffer);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyImage);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBlitImage);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyBufferToImage);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyImageToBuffer);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdUpdateBuffer);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdFillBuffer);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdClearColorImage);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdClearDepthStencilImage);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdClearAttachments);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdResolveImage);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetEvent);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdResetEvent);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdWaitEvents);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdPipelineBarrier);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBeginQuery);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdEndQuery);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdResetQueryPool);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdWriteTimestamp);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyQueryPoolResults);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdPushConstants);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBeginRenderPass);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdNextSubpass);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdEndRenderPass);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdExecuteCommands);
+
+    // Vulkan Core 1.1
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetDeviceMask);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDispatchBase);
+
+    // Vulkan Core 1.2
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawIndirectCount);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawIndexedIndirectCount);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBeginRenderPass2);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdNextSubpass2);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdEndRenderPass2);
+
+#if defined(VK_EXT_debug_marker)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDebugMarkerBeginEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDebugMarkerEndEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDebugMarkerInsertEXT);
+#endif // VK_EXT_debug_marker
+
+#if defined(VK_KHR_video_queue)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBeginVideoCodingKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdEndVideoCodingKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdControlVideoCodingKHR);
+#endif // VK_KHR_video_queue
+
+#if defined(VK_KHR_video_decode_queue)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDecodeVideoKHR);
+#endif // VK_KHR_video_decode_queue
+
+#if defined(VK_EXT_transform_feedback)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawIndirectByteCountEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBindTransformFeedbackBuffersEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdEndTransformFeedbackEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBeginTransformFeedbackEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdEndQueryIndexedEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBeginQueryIndexedEXT);
+#endif // VK_EXT_transform_feedback
+
+#if defined(VK_NVX_binary_import)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCuLaunchKernelNVX);
+#endif // VK_NVX_binary_import
+
+#if defined(VK_AMD_draw_indirect_count)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawIndirectCountAMD);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawIndexedIndirectCountAMD);
+#endif // VK_AMD_draw_indirect_count
+
+#if defined(VK_KHR_dynamic_rendering)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdEndRenderingKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBeginRenderingKHR);
+#endif // VK_KHR_dynamic_rendering
+
+#if defined(VK_KHR_device_group)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetDeviceMaskKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDispatchBaseKHR);
+#endif // VK_KHR_device_group
+
+#if defined(VK_KHR_push_descriptor)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdPushDescriptorSetKHR);
+#endif // VK_KHR_push_descriptor
+
+#if defined(VK_EXT_conditional_rendering)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdEndConditionalRenderingEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBeginConditionalRenderingEXT);
+#endif // VK_EXT_conditional_rendering
+
+#if defined(VK_NV_clip_space_w_scaling)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetViewportWScalingNV);
+#endif // VK_NV_clip_space_w_scaling
+
+#if defined(VK_EXT_discard_rectangles)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetDiscardRectangleEXT);
+#endif // VK_EXT_discard_rectangles
+
+#if defined(VK_KHR_create_renderpass2)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdEndRenderPass2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdNextSubpass2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBeginRenderPass2KHR);
+#endif // VK_KHR_create_renderpass2
+
+#if defined(VK_EXT_sample_locations)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetSampleLocationsEXT);
+#endif // VK_EXT_sample_locations
+
+#if defined(VK_KHR_acceleration_structure)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBuildAccelerationStructuresKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdWriteAccelerationStructuresPropertiesKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBuildAccelerationStructuresIndirectKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyAccelerationStructureKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyAccelerationStructureToMemoryKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyMemoryToAccelerationStructureKHR);
+#endif // VK_KHR_acceleration_structure
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdTraceRaysKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdTraceRaysIndirectKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetRayTracingPipelineStackSizeKHR);
+#endif // VK_KHR_ray_tracing_pipeline
+
+#if defined(VK_NV_shading_rate_image)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBindShadingRateImageNV);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetCoarseSampleOrderNV);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetViewportShadingRatePaletteNV);
+#endif // VK_NV_shading_rate_image
+
+#if defined(VK_NV_ray_tracing)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyAccelerationStructureNV);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBuildAccelerationStructureNV);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdTraceRaysNV);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdWriteAccelerationStructuresPropertiesNV);
+#endif // VK_NV_ray_tracing
+
+#if defined(VK_KHR_draw_indirect_count)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawIndirectCountKHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawIndexedIndirectCountKHR);
+#endif // VK_KHR_draw_indirect_count
+
+#if defined(VK_AMD_buffer_marker)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdWriteBufferMarkerAMD);
+#endif // VK_AMD_buffer_marker
+
+#if defined(VK_NV_mesh_shader)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawMeshTasksNV);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawMeshTasksIndirectNV);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawMeshTasksIndirectCountNV);
+#endif // VK_NV_mesh_shader
+
+#if defined(VK_NV_scissor_exclusive)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetExclusiveScissorNV);
+#endif // VK_NV_scissor_exclusive
+
+#if defined(VK_NV_device_diagnostic_checkpoints)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetCheckpointNV);
+#endif // VK_NV_device_diagnostic_checkpoints
+
+#if defined(VK_INTEL_performance_query)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetPerformanceStreamMarkerINTEL);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetPerformanceMarkerINTEL);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetPerformanceOverrideINTEL);
+#endif // VK_INTEL_performance_query
+
+#if defined(VK_KHR_fragment_shading_rate)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetFragmentShadingRateKHR);
+#endif // VK_KHR_fragment_shading_rate
+
+#if defined(VK_EXT_line_rasterization)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetLineStippleEXT);
+#endif // VK_EXT_line_rasterization
+
+#if defined(VK_EXT_extended_dynamic_state)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetCullModeEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBindVertexBuffers2EXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetFrontFaceEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetPrimitiveTopologyEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetViewportWithCountEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetScissorWithCountEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetDepthTestEnableEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetDepthWriteEnableEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetDepthBoundsTestEnableEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetDepthCompareOpEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetStencilTestEnableEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetStencilOpEXT);
+#endif // VK_EXT_extended_dynamic_state
+
+#if defined(VK_NV_device_generated_commands)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdPreprocessGeneratedCommandsNV);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdExecuteGeneratedCommandsNV);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBindPipelineShaderGroupNV);
+#endif // VK_NV_device_generated_commands
+
+#if defined(VK_KHR_video_encode_queue)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdEncodeVideoKHR);
+#endif // VK_KHR_video_encode_queue
+
+#if defined(VK_KHR_synchronization2)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetEvent2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdPipelineBarrier2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdResetEvent2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdWaitEvents2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdWriteTimestamp2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdWriteBufferMarker2AMD);
+#endif // VK_KHR_synchronization2
+
+#if defined(VK_NV_fragment_shading_rate_enums)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetFragmentShadingRateEnumNV);
+#endif // VK_NV_fragment_shading_rate_enums
+
+#if defined(VK_KHR_copy_commands2)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyBuffer2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyImage2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyBufferToImage2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdCopyImageToBuffer2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBlitImage2KHR);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdResolveImage2KHR);
+#endif // VK_KHR_copy_commands2
+
+#if defined(VK_EXT_vertex_input_dynamic_state)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetVertexInputEXT);
+#endif // VK_EXT_vertex_input_dynamic_state
+
+#if defined(VK_HUAWEI_subpass_shading)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSubpassShadingHUAWEI);
+#endif // VK_HUAWEI_subpass_shading
+
+#if defined(VK_HUAWEI_invocation_mask)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdBindInvocationMaskHUAWEI);
+#endif // VK_HUAWEI_invocation_mask
+
+#if defined(VK_EXT_extended_dynamic_state2)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetPatchControlPointsEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetRasterizerDiscardEnableEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetDepthBiasEnableEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetLogicOpEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetPrimitiveRestartEnableEXT);
+#endif // VK_EXT_extended_dynamic_state2
+
+#if defined(VK_EXT_color_write_enable)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdSetColorWriteEnableEXT);
+#endif // VK_EXT_color_write_enable
+
+#if defined(VK_EXT_multi_draw)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawMultiEXT);
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdDrawMultiIndexedEXT);
+#endif // VK_EXT_multi_draw
+
+#if defined(VK_KHR_push_descriptor) || defined(VK_KHR_descriptor_update_template)
+    VULKANDYNAMIC_COPY_SYMBOL(deviceDispatch, commandBufferDispatch, CmdPushDescriptorSetWithTemplateKHR);
+#endif // VK_KHR_push_descriptor || VK_KHR_descriptor_update_template
+
+    uint64_t resolvedFunctionCount = 0;
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS(VULKANDYNAMIC_COUNT_COMMAND_BUFFER_SYMBOL)
+    VulkanDynamicRecordResolution(VULKANDYNAMIC_TIER_COMMAND_BUFFER, start, resolvedFunctionCount, VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_COUNT);
+
     return VK_SUCCESS;
 }
+
+//------------------------------------------------------------------------------------
+// Function Identifiers
+//------------------------------------------------------------------------------------
+
+VULKANDYNAMIC_API VKAPI_ATTR const char* VKAPI_CALL VulkanDynamicGetLoaderFunctionName(uint32_t functionId)
+{
+    static const char* const functionNames[] = { VULKANDYNAMIC_LOADER_FUNCTIONS(VULKANDYNAMIC_FUNCTION_NAME) NULL };
+
+    return functionId < VULKANDYNAMIC_LOADER_FUNCTION_ID_COUNT ? functionNames[functionId] : NULL;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR const char* VKAPI_CALL VulkanDynamicGetInstanceFunctionName(uint32_t functionId)
+{
+    static const char* const functionNames[] = { VULKANDYNAMIC_INSTANCE_FUNCTIONS(VULKANDYNAMIC_FUNCTION_NAME) NULL };
+
+    return functionId < VULKANDYNAMIC_INSTANCE_FUNCTION_ID_COUNT ? functionNames[functionId] : NULL;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR const char* VKAPI_CALL VulkanDynamicGetPhysicalDeviceFunctionName(uint32_t functionId)
+{
+    static const char* const functionNames[] = { VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTIONS(VULKANDYNAMIC_FUNCTION_NAME) NULL };
+
+    return functionId < VULKANDYNAMIC_PHYSICAL_DEVICE_FUNCTION_ID_COUNT ? functionNames[functionId] : NULL;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR const char* VKAPI_CALL VulkanDynamicGetDeviceFunctionName(uint32_t functionId)
+{
+    static const char* const functionNames[] = { VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_FUNCTION_NAME) NULL };
+
+    return functionId < VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT ? functionNames[functionId] : NULL;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR const char* VKAPI_CALL VulkanDynamicGetCommandBufferFunctionName(uint32_t functionId)
+{
+    static const char* const functionNames[] = { VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS(VULKANDYNAMIC_FUNCTION_NAME) NULL };
+
+    return functionId < VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_COUNT ? functionNames[functionId] : NULL;
+}
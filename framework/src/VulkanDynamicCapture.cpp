@@ -0,0 +1,500 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicCapture.h>
+#include <Platform/MappedFile.h>
+
+#include "Interposer.hpp"
+#include "Serialization.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using namespace ::VulkanDynamic::Detail;
+
+    //------------------------------------------------------------------------------------
+    // Session
+    //------------------------------------------------------------------------------------
+
+    inline ::uint64_t Now() noexcept
+    {
+        return static_cast<::uint64_t>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(::std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    constexpr ::size_t RecordAlignment = 8;
+    constexpr ::size_t InitialCaptureSize = 16 * 1024 * 1024;
+    constexpr ::size_t ThreadBufferFlushSize = 256 * 1024;
+
+    // Records of one thread, appended to the file in chunks. The mutex is only contended
+    // while a chunk is written or the session begins or ends.
+    struct ThreadBuffer
+    {
+        ::std::mutex mutex;
+        ::std::vector<unsigned char> data;
+        ::uint64_t recordCount{ 0 };
+        ::uint64_t uncapturedCallCount{ 0 };
+        ::uint64_t droppedStructureCount{ 0 };
+
+        void Clear() noexcept
+        {
+            data.clear();
+            recordCount = 0;
+            uncapturedCallCount = 0;
+            droppedStructureCount = 0;
+        }
+    };
+
+    class Session
+    {
+    public:
+        static Session& Get() noexcept
+        {
+            static Session session;
+            return session;
+        }
+
+        bool Active() const noexcept
+        {
+            return active_.load(::std::memory_order_relaxed);
+        }
+
+        void Append(::uint32_t functionId, const unsigned char* arguments, ::size_t argumentSize, ::uint64_t droppedStructureCount)
+        {
+            ThreadBuffer& buffer = Local();
+            {
+                const ::std::lock_guard<::std::mutex> lock{ buffer.mutex };
+
+                const ::size_t offset = buffer.data.size();
+                const ::size_t recordSize = (sizeof(VulkanDynamicCaptureRecord) + argumentSize + RecordAlignment - 1) & ~(RecordAlignment - 1);
+                buffer.data.resize(offset + recordSize);
+
+                // Buffers reach the file in chunks, so the global call order is kept per record.
+                const VulkanDynamicCaptureRecord record{ functionId, static_cast<::uint32_t>(argumentSize), sequence_.fetch_add(1, ::std::memory_order_relaxed) };
+                ::std::memcpy(buffer.data.data() + offset, &record, sizeof(record));
+                if (argumentSize)
+                {
+                    ::std::memcpy(buffer.data.data() + offset + sizeof(record), arguments, argumentSize);
+                }
+
+                buffer.recordCount++;
+                buffer.uncapturedCallCount += (functionId & VULKANDYNAMIC_CAPTURE_UNCAPTURED_BIT) ? 1 : 0;
+                buffer.droppedStructureCount += droppedStructureCount;
+
+                if (buffer.data.size() < ThreadBufferFlushSize)
+                {
+                    return;
+                }
+            }
+
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            Write(buffer);
+        }
+
+        ::VkResult Begin(const char* fileName)
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            if (file_)
+            {
+                return ::VK_ERROR_INITIALIZATION_FAILED;
+            }
+
+            file_ = ::MappedFileCreate(fileName, InitialCaptureSize);
+            if (!file_)
+            {
+                return ::VK_ERROR_INITIALIZATION_FAILED;
+            }
+
+            // Calls that raced with the end of the previous capture belong to no capture.
+            for (const auto& buffer : buffers_)
+            {
+                const ::std::lock_guard<::std::mutex> bufferLock{ buffer->mutex };
+                buffer->Clear();
+            }
+
+            VulkanDynamicCaptureHeader* header = static_cast<VulkanDynamicCaptureHeader*>(::MappedFileGetAddress(file_));
+            ::std::memset(header, 0, sizeof(VulkanDynamicCaptureHeader));
+            header->magic = VULKANDYNAMIC_CAPTURE_MAGIC;
+            header->version = VULKANDYNAMIC_CAPTURE_VERSION;
+            header->pointerSize = sizeof(void*);
+            header->deviceFunctionCount = VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT;
+            header->size = sizeof(VulkanDynamicCaptureHeader);
+
+            size_ = sizeof(VulkanDynamicCaptureHeader);
+            capacity_ = InitialCaptureSize;
+            failed_ = false;
+            sequence_.store(0, ::std::memory_order_relaxed);
+            active_.store(true, ::std::memory_order_relaxed);
+
+            return ::VK_SUCCESS;
+        }
+
+        ::VkResult End()
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            if (!file_)
+            {
+                return ::VK_NOT_READY;
+            }
+
+            active_.store(false, ::std::memory_order_relaxed);
+            for (const auto& buffer : buffers_)
+            {
+                Write(*buffer);
+            }
+
+            const VulkanDynamicCaptureHeader* header = static_cast<const VulkanDynamicCaptureHeader*>(::MappedFileGetAddress(file_));
+            const bool complete = !failed_ && header->droppedStructureCount == 0;
+
+            ::MappedFileClose(file_, size_);
+            file_ = nullptr;
+
+            return complete ? ::VK_SUCCESS : ::VK_INCOMPLETE;
+        }
+
+        ~Session()
+        {
+            End();
+        }
+
+    private:
+        ThreadBuffer& Local()
+        {
+            thread_local ThreadBuffer* local = nullptr;
+            if (!local)
+            {
+                // Buffers of exited threads stay registered so End still writes their records.
+                ::std::unique_ptr<ThreadBuffer> buffer{ new ThreadBuffer() };
+                local = buffer.get();
+
+                const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+                buffers_.push_back(::std::move(buffer));
+            }
+
+            return *local;
+        }
+
+        // Appends the buffered records of one thread as a chunk; called with mutex_ held.
+        void Write(ThreadBuffer& buffer)
+        {
+            const ::std::lock_guard<::std::mutex> lock{ buffer.mutex };
+            if (!file_ || failed_)
+            {
+                buffer.Clear();
+                return;
+            }
+
+            const ::size_t chunkSize = buffer.data.size();
+            if (size_ + chunkSize > capacity_ && !Grow(size_ + chunkSize))
+            {
+                // Out of disk or address space: keep what was captured so far.
+                active_.store(false, ::std::memory_order_relaxed);
+                failed_ = true;
+                buffer.Clear();
+                return;
+            }
+
+            unsigned char* data = static_cast<unsigned char*>(::MappedFileGetAddress(file_));
+            ::std::memcpy(data + size_, buffer.data.data(), chunkSize);
+            size_ += chunkSize;
+
+            // The header always describes a complete prefix of the file.
+            VulkanDynamicCaptureHeader* header = reinterpret_cast<VulkanDynamicCaptureHeader*>(data);
+            header->recordCount += buffer.recordCount;
+            header->uncapturedCallCount += buffer.uncapturedCallCount;
+            header->droppedStructureCount += buffer.droppedStructureCount;
+            header->size = size_;
+
+            buffer.Clear();
+        }
+
+        bool Grow(::size_t size)
+        {
+            ::size_t capacity = capacity_;
+            while (capacity < size)
+            {
+                capacity *= 2;
+            }
+
+            if (!::MappedFileResize(file_, capacity))
+            {
+                return false;
+            }
+
+            capacity_ = capacity;
+            return true;
+        }
+
+    private:
+        ::std::atomic<bool> active_{ false };
+        ::std::atomic<::uint64_t> sequence_{ 0 };
+        ::std::mutex mutex_;
+        ::std::vector<::std::unique_ptr<ThreadBuffer>> buffers_;
+        ::MappedFile file_{ nullptr };
+        ::size_t size_{ 0 };
+        ::size_t capacity_{ 0 };
+        bool failed_{ false };
+    };
+
+    using Table = ::VulkanDynamicDeviceDispatch;
+
+    ::std::atomic<const Table*> nextDispatch{ nullptr };
+
+    //------------------------------------------------------------------------------------
+    // Capture and replay entry points
+    //------------------------------------------------------------------------------------
+
+    using ReplayFunction = bool (*)(Reader& reader, const Table* dispatch);
+
+    template<typename Function>
+    struct Capture;
+
+    template<typename Result, typename... Args>
+    struct Capture<Result (VKAPI_PTR*)(Args...)>
+    {
+        using Function = Result (VKAPI_PTR*)(Args...);
+
+        template<Function Table::* Member, ::uint32_t FunctionId>
+        static Result VKAPI_CALL Call(Args... args)
+        {
+            if (Session::Get().Active())
+            {
+                Record<FunctionId>(Capturable{}, args...);
+            }
+
+            return (nextDispatch.load(::std::memory_order_acquire)->*Member)(args...);
+        }
+
+        template<Function Table::* Member, ::uint32_t FunctionId>
+        static bool Replay(Reader& reader, const Table* dispatch)
+        {
+            return Replay<Member, FunctionId>(Capturable{}, reader, dispatch);
+        }
+
+    private:
+        using Capturable = ::std::integral_constant<bool, Signature<Function>::Serializable>;
+
+        template<::uint32_t FunctionId>
+        static void Record(::std::true_type, Args... args)
+        {
+            thread_local ::std::vector<unsigned char> arguments;
+
+            VectorWriter writer{ arguments };
+            Signature<Function>::Write(writer, args...);
+
+            // A call whose pNext chain lost structures would replay as a different call.
+            if (writer.Dropped())
+            {
+                Session::Get().Append(FunctionId | VULKANDYNAMIC_CAPTURE_UNCAPTURED_BIT, nullptr, 0, writer.Dropped());
+                return;
+            }
+
+            Session::Get().Append(FunctionId, writer.Data(), writer.Size(), 0);
+        }
+
+        template<::uint32_t FunctionId>
+        static void Record(::std::false_type, Args...)
+        {
+            Session::Get().Append(FunctionId | VULKANDYNAMIC_CAPTURE_UNCAPTURED_BIT, nullptr, 0, 0);
+        }
+
+        template<Function Table::* Member, ::uint32_t FunctionId>
+        static bool Replay(::std::true_type, Reader& reader, const Table* dispatch)
+        {
+            typename Signature<Function>::Arguments arguments;
+            Signature<Function>::Read(reader, arguments);
+            if (reader.Failed() || !(dispatch->*Member))
+            {
+                return false;
+            }
+
+            Signature<Function>::Invoke(dispatch->*Member, arguments);
+            return true;
+        }
+
+        template<Function Table::* Member, ::uint32_t FunctionId>
+        static bool Replay(::std::false_type, Reader&, const Table*)
+        {
+            return false;
+        }
+    };
+
+#define VULKANDYNAMIC_CAPTURE_DEVICE_FUNCTION(function) \
+    capturedDispatch->function = next->function \
+        ? &Capture<PFN_vk##function>::Call<&Table::function, VULKANDYNAMIC_DEVICE_FUNCTION_ID_##function> \
+        : nullptr;
+
+#define VULKANDYNAMIC_REPLAY_DEVICE_FUNCTION(function) \
+    &Capture<PFN_vk##function>::Replay<&Table::function, VULKANDYNAMIC_DEVICE_FUNCTION_ID_##function>,
+
+    const ReplayFunction replayFunctions[] =
+    {
+        VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_REPLAY_DEVICE_FUNCTION)
+    };
+
+    // Sequence number and offset of every complete record, in call order.
+    using RecordIndex = ::std::vector<::std::pair<::uint64_t, ::size_t>>;
+
+    ::VkResult IndexRecords(const unsigned char* data, ::size_t size, RecordIndex& index)
+    {
+        ::VkResult result = ::VK_SUCCESS;
+
+        ::size_t offset = sizeof(VulkanDynamicCaptureHeader);
+        while (offset < size)
+        {
+            VulkanDynamicCaptureRecord record;
+            if (size - offset < sizeof(record))
+            {
+                result = ::VK_INCOMPLETE;
+                break;
+            }
+
+            ::std::memcpy(&record, data + offset, sizeof(record));
+            const ::size_t recordSize = (sizeof(record) + static_cast<::size_t>(record.size) + RecordAlignment - 1) & ~(RecordAlignment - 1);
+            if (size - offset < recordSize || (record.functionId & ~VULKANDYNAMIC_CAPTURE_UNCAPTURED_BIT) >= VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT)
+            {
+                result = ::VK_INCOMPLETE;
+                break;
+            }
+
+            index.emplace_back(record.sequence, offset);
+            offset += recordSize;
+        }
+
+        // Chunks of different threads interleave in the file; each is already in order.
+        ::std::sort(index.begin(), index.end());
+
+        return result;
+    }
+
+    ::VkResult ReplayRecords(const unsigned char* data, const RecordIndex& index, const Table* dispatch, ::VulkanDynamicReplayStatistics* statistics)
+    {
+        thread_local Arena arena;
+
+        for (const auto& entry : index)
+        {
+            VulkanDynamicCaptureRecord record;
+            ::std::memcpy(&record, data + entry.second, sizeof(record));
+
+            const ::uint32_t functionId = record.functionId & ~VULKANDYNAMIC_CAPTURE_UNCAPTURED_BIT;
+
+            Reader reader{ data + entry.second + sizeof(record), record.size, arena };
+            const bool called = !(record.functionId & VULKANDYNAMIC_CAPTURE_UNCAPTURED_BIT) && replayFunctions[functionId](reader, dispatch);
+            arena.Reset();
+
+            if (reader.Failed())
+            {
+                return ::VK_INCOMPLETE;
+            }
+
+            (called ? statistics->callCount : statistics->skippedCallCount)++;
+        }
+
+        return ::VK_SUCCESS;
+    }
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Capture
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCaptureDeviceDispatch(const VulkanDynamicDeviceDispatch* next, VulkanDynamicDeviceDispatch* capturedDispatch)
+{
+    if (!next || !capturedDispatch)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    const VkResult result = ::VulkanDynamic::Detail::BindNext(nextDispatch, next);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_CAPTURE_DEVICE_FUNCTION)
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicBeginCapture(const char* fileName)
+{
+    if (!fileName)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return Session::Get().Begin(fileName);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicEndCapture(void)
+{
+    return Session::Get().End();
+}
+
+//------------------------------------------------------------------------------------
+// Replay
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicReplayCapture(const char* fileName, const VulkanDynamicDeviceDispatch* dispatch, uint32_t iterations, VulkanDynamicReplayStatistics* statistics)
+{
+    if (!fileName || !dispatch || !statistics)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    *statistics = VulkanDynamicReplayStatistics{};
+
+    MappedFile file = MappedFileOpen(fileName);
+    if (!file)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    const unsigned char* data = static_cast<const unsigned char*>(MappedFileGetAddress(file));
+    VulkanDynamicCaptureHeader header;
+    ::std::memset(&header, 0, sizeof(header));
+    ::std::memcpy(&header, data, MappedFileGetSize(file) < sizeof(header) ? MappedFileGetSize(file) : sizeof(header));
+
+    if (header.magic != VULKANDYNAMIC_CAPTURE_MAGIC || header.version != VULKANDYNAMIC_CAPTURE_VERSION || header.pointerSize != sizeof(void*)
+        || header.deviceFunctionCount != VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT || header.size > MappedFileGetSize(file))
+    {
+        MappedFileClose(file, 0);
+        return VK_ERROR_INCOMPATIBLE_DRIVER;
+    }
+
+    RecordIndex index;
+    const VkResult indexResult = IndexRecords(data, static_cast<::size_t>(header.size), index);
+
+    VkResult result = VK_SUCCESS;
+    const ::uint64_t begin = Now();
+    for (uint32_t iteration = 0; iteration < iterations && result == VK_SUCCESS; ++iteration)
+    {
+        result = ReplayRecords(data, index, dispatch, statistics);
+    }
+
+    statistics->nanoseconds = Now() - begin;
+
+    MappedFileClose(file, 0);
+
+    return result == VK_SUCCESS ? indexResult : result;
+}
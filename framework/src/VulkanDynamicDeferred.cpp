@@ -0,0 +1,369 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicDeferred.h>
+#include <VulkanDynamic/VulkanDynamicFunctions.h>
+
+#include "Serialization.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using namespace ::VulkanDynamic::Detail;
+
+    constexpr ::size_t CommandBlockSize = 64 * 1024;
+    constexpr ::size_t RecordAlignment = 8;
+
+    struct Record
+    {
+        ::uint32_t functionId;
+        ::uint32_t size;
+    };
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Command arena
+//------------------------------------------------------------------------------------
+
+// Records are laid out like capture records and never straddle blocks: a record that
+// outgrows its block is moved, with what has been written of it, to the next one. Blocks
+// are kept across resets, so steady-state recording does not allocate.
+struct VulkanDynamicCommandArena_T final : public Writer
+{
+    void BeginRecord(::uint32_t functionId)
+    {
+        recordStart_ = Size();
+        Value(Record{ functionId, 0 });
+    }
+
+    void EndRecord()
+    {
+        static const unsigned char padding[RecordAlignment] = {};
+
+        const ::size_t size = Size() - recordStart_ - sizeof(Record);
+        Bytes(padding, (RecordAlignment - (Size() & (RecordAlignment - 1))) & (RecordAlignment - 1));
+
+        Block& block = blocks_[block_];
+        const ::uint32_t recordSize = static_cast<::uint32_t>(size);
+        ::std::memcpy(block.data.get() + recordStart_ + offsetof(Record, size), &recordSize, sizeof(recordSize));
+        block.size = Size();
+
+        ++commandCount_;
+    }
+
+    void Clear() noexcept
+    {
+        for (Block& block : blocks_)
+        {
+            block.size = 0;
+        }
+
+        block_ = 0;
+        recordStart_ = 0;
+        commandCount_ = 0;
+        Reset(blocks_.empty() ? nullptr : blocks_[0].data.get(), 0, blocks_.empty() ? 0 : blocks_[0].capacity);
+    }
+
+    template<typename Visitor>
+    bool Visit(Visitor&& visitor) const
+    {
+        for (::size_t index = 0; index < blocks_.size() && index <= block_; ++index)
+        {
+            const unsigned char* data = blocks_[index].data.get();
+            for (::size_t offset = 0; offset < blocks_[index].size;)
+            {
+                Record record;
+                ::std::memcpy(&record, data + offset, sizeof(record));
+                if (!visitor(record.functionId, data + offset + sizeof(record), static_cast<::size_t>(record.size)))
+                {
+                    return false;
+                }
+
+                offset += (sizeof(record) + record.size + RecordAlignment - 1) & ~(RecordAlignment - 1);
+            }
+        }
+
+        return true;
+    }
+
+    ::uint64_t CommandCount() const noexcept
+    {
+        return commandCount_;
+    }
+
+    ::uint64_t RecordedSize() const noexcept
+    {
+        ::uint64_t size = 0;
+        for (::size_t index = 0; index < blocks_.size() && index <= block_; ++index)
+        {
+            size += blocks_[index].size;
+        }
+
+        return size;
+    }
+
+protected:
+    void Grow(::size_t size) override
+    {
+        const ::size_t partial = Size() - recordStart_;
+        const ::size_t required = partial + size;
+
+        ::size_t next = 0;
+        if (!blocks_.empty())
+        {
+            blocks_[block_].size = recordStart_;
+            next = block_ + 1;
+        }
+
+        if (next == blocks_.size())
+        {
+            blocks_.emplace_back();
+        }
+
+        Block& block = blocks_[next];
+        if (block.capacity < required)
+        {
+            block.capacity = required > CommandBlockSize ? required : CommandBlockSize;
+            block.data.reset(new unsigned char[block.capacity]);
+        }
+
+        if (partial)
+        {
+            ::std::memcpy(block.data.get(), Data() + recordStart_, partial);
+        }
+
+        block.size = 0;
+        block_ = next;
+        recordStart_ = 0;
+        Reset(block.data.get(), partial, block.capacity);
+    }
+
+private:
+    struct Block
+    {
+        ::std::unique_ptr<unsigned char[]> data;
+        ::size_t capacity{ 0 };
+        ::size_t size{ 0 };
+    };
+
+    ::std::vector<Block> blocks_;
+    ::size_t block_{ 0 };
+    ::size_t recordStart_{ 0 };
+    ::uint64_t commandCount_{ 0 };
+};
+
+namespace
+{
+    //------------------------------------------------------------------------------------
+    // Deferred entry points
+    //------------------------------------------------------------------------------------
+
+    using Table = ::VulkanDynamicCommandBufferDispatch;
+
+    using ReplayFunction = ::VkResult (*)(Reader& reader, const Table* dispatch, ::VkCommandBuffer commandBuffer);
+
+    template<typename Function>
+    struct Deferred;
+
+    // Commands that return a result (the INTEL performance markers) cannot be deferred:
+    // the caller needs the driver's answer at record time, so they are left unset.
+    template<typename Result, typename... Args>
+    struct Deferred<Result (VKAPI_PTR*)(::VkCommandBuffer, Args...)>
+    {
+        using Function = Result (VKAPI_PTR*)(::VkCommandBuffer, Args...);
+
+        template<::uint32_t FunctionId>
+        static Function Recorder() noexcept
+        {
+            return nullptr;
+        }
+
+        template<Function Table::* Member>
+        static ReplayFunction Replayer() noexcept
+        {
+            return nullptr;
+        }
+    };
+
+    template<typename... Args>
+    struct Deferred<void (VKAPI_PTR*)(::VkCommandBuffer, Args...)>
+    {
+        using Function = void (VKAPI_PTR*)(::VkCommandBuffer, Args...);
+
+        template<::uint32_t FunctionId>
+        static Function Recorder() noexcept
+        {
+            return Recorder<FunctionId>(Serializable{});
+        }
+
+        template<Function Table::* Member>
+        static ReplayFunction Replayer() noexcept
+        {
+            return Replayer<Member>(Serializable{});
+        }
+
+    private:
+        using Serializable = ::std::integral_constant<bool, Signature<Function>::Serializable>;
+
+        template<::uint32_t FunctionId>
+        static void VKAPI_CALL Record(::VkCommandBuffer commandBuffer, Args... args)
+        {
+            VulkanDynamicCommandArena arena = reinterpret_cast<VulkanDynamicCommandArena>(commandBuffer);
+            arena->BeginRecord(FunctionId);
+            Signature<Function>::Write(*arena, commandBuffer, args...);
+            arena->EndRecord();
+        }
+
+        template<Function Table::* Member>
+        static ::VkResult Replay(Reader& reader, const Table* dispatch, ::VkCommandBuffer commandBuffer)
+        {
+            if (!(dispatch->*Member))
+            {
+                return ::VK_ERROR_EXTENSION_NOT_PRESENT;
+            }
+
+            typename Signature<Function>::Arguments arguments;
+            Signature<Function>::Read(reader, arguments);
+            if (reader.Failed())
+            {
+                // Never hand the driver arguments decoded from a short or corrupt record.
+                return ::VK_ERROR_INITIALIZATION_FAILED;
+            }
+
+            ::std::get<0>(arguments) = commandBuffer;
+
+            Signature<Function>::Invoke(dispatch->*Member, arguments);
+            return ::VK_SUCCESS;
+        }
+
+        template<::uint32_t FunctionId>
+        static Function Recorder(::std::true_type) noexcept
+        {
+            return &Record<FunctionId>;
+        }
+
+        template<::uint32_t FunctionId>
+        static Function Recorder(::std::false_type) noexcept
+        {
+            return nullptr;
+        }
+
+        template<Function Table::* Member>
+        static ReplayFunction Replayer(::std::true_type) noexcept
+        {
+            return &Replay<Member>;
+        }
+
+        template<Function Table::* Member>
+        static ReplayFunction Replayer(::std::false_type) noexcept
+        {
+            return nullptr;
+        }
+    };
+
+#define VULKANDYNAMIC_DEFERRED_COMMAND_BUFFER_FUNCTION(function) \
+    deferredDispatch->function = Deferred<PFN_vk##function>::Recorder<VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_##function>();
+
+#define VULKANDYNAMIC_REPLAY_COMMAND_BUFFER_FUNCTION(function) \
+    Deferred<PFN_vk##function>::Replayer<&Table::function>(),
+
+    const ReplayFunction replayFunctions[] =
+    {
+        VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS(VULKANDYNAMIC_REPLAY_COMMAND_BUFFER_FUNCTION)
+    };
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Arenas
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateCommandArena(VulkanDynamicCommandArena* arena)
+{
+    if (!arena)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    *arena = new VulkanDynamicCommandArena_T{};
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicResetCommandArena(VulkanDynamicCommandArena arena)
+{
+    if (arena)
+    {
+        arena->Clear();
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyCommandArena(VulkanDynamicCommandArena arena)
+{
+    delete arena;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetCommandArenaStatistics(VulkanDynamicCommandArena arena, VulkanDynamicCommandArenaStatistics* statistics)
+{
+    if (!arena || !statistics)
+    {
+        return;
+    }
+
+    statistics->commandCount = arena->CommandCount();
+    statistics->size = arena->RecordedSize();
+    statistics->droppedStructureCount = arena->Dropped();
+}
+
+//------------------------------------------------------------------------------------
+// Recording and replay
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetDeferredCommandBufferDispatch(VulkanDynamicCommandBufferDispatch* deferredDispatch)
+{
+    if (!deferredDispatch)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    VULKANDYNAMIC_COMMAND_BUFFER_FUNCTIONS(VULKANDYNAMIC_DEFERRED_COMMAND_BUFFER_FUNCTION)
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicReplayCommandArena(VulkanDynamicCommandArena arena, const VulkanDynamicCommandBufferDispatch* dispatch, VkCommandBuffer commandBuffer)
+{
+    if (!arena || !dispatch)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    thread_local Arena decoded;
+
+    VkResult result = VK_SUCCESS;
+    arena->Visit([&](::uint32_t functionId, const unsigned char* data, ::size_t size)
+    {
+        Reader reader{ data, size, decoded };
+        result = replayFunctions[functionId](reader, dispatch, commandBuffer);
+        decoded.Reset();
+        return result == VK_SUCCESS;
+    });
+
+    return result;
+}
@@ -0,0 +1,438 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicDeferredOperations.h>
+
+#if defined(VK_KHR_deferred_host_operations)
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // An operation's state holds the number of joined threads in its low bits.
+    // StateCompleted is set by a joined thread once the operation needs no more joins, and
+    // StateFinished by the last thread to leave a completed operation, which then calls its
+    // callback. Both are terminal: threads only join, and so only use the operation, while
+    // neither is set, and the operation cannot finish while any thread is joined.
+    constexpr ::uint32_t StateJoinedMask = 0x3fffffffu;
+    constexpr ::uint32_t StateCompleted = 0x40000000u;
+    constexpr ::uint32_t StateFinished = 0x80000000u;
+
+    // A thread that finds nothing but an operation without work for it to join pauses for
+    // this long, doubled each time the operation has no work again, up to the maximum.
+    constexpr ::std::chrono::microseconds MinIdleBackoff{ 16 };
+    constexpr ::uint32_t MaxIdleBackoffShift = 6;
+
+    // Shared by the queue entries and threads holding the operation, so that entries left
+    // in queues after completion stay valid.
+    struct Operation
+    {
+        VkDeferredOperationKHR operation;
+        PFN_VulkanDynamicDeferredOperationCallback callback;
+        void* userData;
+        ::std::atomic<::uint32_t> state{ 0 };
+        ::std::atomic<VkResult> joinError{ VK_SUCCESS };
+        ::std::atomic<::uint32_t> idleCount{ 0 };
+    };
+
+    using OperationPointer = ::std::shared_ptr<Operation>;
+
+    // One thread's operations. The thread takes from the back, others steal from the front.
+    struct WorkQueue
+    {
+        ::std::mutex mutex;
+        ::std::deque<OperationPointer> operations;
+    };
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Deferred operation scheduler
+//------------------------------------------------------------------------------------
+
+// Threads sleep on a condition variable only when every queue is empty. They count
+// themselves as sleeping before checking for work, and producers check that count after
+// publishing work, so one of the two always sees the other.
+struct VulkanDynamicDeferredOperationScheduler_T final
+{
+    VulkanDynamicDeferredOperationScheduler_T(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device) noexcept
+        : dispatch_{ dispatch }
+        , device_{ device }
+    {
+    }
+
+    ~VulkanDynamicDeferredOperationScheduler_T()
+    {
+        {
+            ::std::unique_lock<::std::mutex> lock{ mutex_ };
+            idle_.wait(lock, [this] { return outstanding_ == 0; });
+            stopping_ = true;
+        }
+
+        wakeup_.notify_all();
+        for (::std::thread& thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    VkResult Start(::uint32_t threadCount)
+    {
+        for (::uint32_t index = 0; index < threadCount; ++index)
+        {
+            queues_.emplace_back(new WorkQueue{});
+        }
+
+        try
+        {
+            threads_.reserve(threadCount);
+            for (::uint32_t index = 0; index < threadCount; ++index)
+            {
+                threads_.emplace_back([this, index] { Run(index); });
+            }
+        }
+        catch (const ::std::system_error&)
+        {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        return VK_SUCCESS;
+    }
+
+    void Schedule(VkDeferredOperationKHR operation, PFN_VulkanDynamicDeferredOperationCallback callback, void* userData)
+    {
+        OperationPointer scheduled = ::std::make_shared<Operation>();
+        scheduled->operation = operation;
+        scheduled->callback = callback;
+        scheduled->userData = userData;
+
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            ++outstanding_;
+        }
+
+        Offer(::std::move(scheduled), nextQueue_.fetch_add(1, ::std::memory_order_relaxed) % queues_.size());
+    }
+
+    void Statistics(VulkanDynamicDeferredOperationSchedulerStatistics& statistics) const noexcept
+    {
+        statistics.completedCount = completedCount_.load(::std::memory_order_relaxed);
+        statistics.joinCount = joinCount_.load(::std::memory_order_relaxed);
+        statistics.stealCount = stealCount_.load(::std::memory_order_relaxed);
+    }
+
+private:
+    // Operations offered at the front are taken by the queue's thread after its others.
+    void Offer(OperationPointer operation, ::size_t queueIndex, bool front = false)
+    {
+        WorkQueue& queue = *queues_[queueIndex];
+        {
+            const ::std::lock_guard<::std::mutex> lock{ queue.mutex };
+            if (front)
+            {
+                queue.operations.push_front(::std::move(operation));
+            }
+            else
+            {
+                queue.operations.push_back(::std::move(operation));
+            }
+        }
+
+        available_.fetch_add(1);
+        if (sleeping_.load())
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            wakeup_.notify_one();
+        }
+    }
+
+    OperationPointer Take(::size_t queueIndex)
+    {
+        for (::size_t offset = 0; offset < queues_.size(); ++offset)
+        {
+            WorkQueue& queue = *queues_[(queueIndex + offset) % queues_.size()];
+
+            const ::std::lock_guard<::std::mutex> lock{ queue.mutex };
+            if (queue.operations.empty())
+            {
+                continue;
+            }
+
+            OperationPointer operation;
+            if (offset == 0)
+            {
+                operation = ::std::move(queue.operations.back());
+                queue.operations.pop_back();
+            }
+            else
+            {
+                operation = ::std::move(queue.operations.front());
+                queue.operations.pop_front();
+                stealCount_.fetch_add(1, ::std::memory_order_relaxed);
+            }
+
+            available_.fetch_sub(1);
+            return operation;
+        }
+
+        return nullptr;
+    }
+
+    void Run(::size_t queueIndex)
+    {
+        for (;;)
+        {
+            OperationPointer operation = Take(queueIndex);
+            if (operation)
+            {
+                Join(queueIndex, operation);
+                continue;
+            }
+
+            ::std::unique_lock<::std::mutex> lock{ mutex_ };
+            sleeping_.fetch_add(1);
+            wakeup_.wait(lock, [this] { return available_.load() > 0 || stopping_; });
+            sleeping_.fetch_sub(1);
+
+            if (available_.load() == 0 && stopping_)
+            {
+                return;
+            }
+        }
+    }
+
+    void Join(::size_t queueIndex, const OperationPointer& operation)
+    {
+        // Entries left in queues after completion are dropped here without a Vulkan call,
+        // as the operation may have been destroyed by its callback.
+        ::uint32_t state = operation->state.load(::std::memory_order_acquire);
+        do
+        {
+            if (state & (StateCompleted | StateFinished))
+            {
+                return;
+            }
+        } while (!operation->state.compare_exchange_weak(state, state + 1, ::std::memory_order_acq_rel, ::std::memory_order_acquire));
+
+        const ::uint32_t joinedCount = (state & StateJoinedMask) + 1;
+        const ::uint32_t maxConcurrency = dispatch_->GetDeferredOperationMaxConcurrencyKHR(device_, operation->operation);
+
+        // An operation may be offered more than once, so threads beyond its concurrency
+        // leave at once. One thread always joins, as a maximum of 0 only means that the
+        // operation has no work left for more threads.
+        bool idle = false;
+        if (joinedCount == 1 || joinedCount <= maxConcurrency)
+        {
+            if (joinedCount < maxConcurrency)
+            {
+                Offer(operation, (queueIndex + 1) % queues_.size());
+            }
+
+            const VkResult result = dispatch_->DeferredOperationJoinKHR(device_, operation->operation);
+            joinCount_.fetch_add(1, ::std::memory_order_relaxed);
+
+            // An operation that reports VK_THREAD_DONE_KHR but is not complete is finishing
+            // elsewhere, and has no more work for a rejoin than an idle one.
+            idle = result == VK_THREAD_IDLE_KHR || result == VK_THREAD_DONE_KHR;
+            if (!idle)
+            {
+                operation->idleCount.store(0, ::std::memory_order_relaxed);
+            }
+
+            // A failed join would fail again, so errors complete the operation as well.
+            if (result != VK_THREAD_IDLE_KHR && result != VK_THREAD_DONE_KHR)
+            {
+                if (result < 0)
+                {
+                    operation->joinError.store(result, ::std::memory_order_relaxed);
+                }
+
+                operation->state.fetch_or(StateCompleted, ::std::memory_order_acq_rel);
+            }
+        }
+
+        Leave(queueIndex, operation, idle);
+    }
+
+    // VK_THREAD_DONE_KHR and VK_THREAD_IDLE_KHR leave completion to the other threads; the
+    // last to leave checks for it, and keeps the operation scheduled if it is still running.
+    void Leave(::size_t queueIndex, const OperationPointer& operation, bool idle)
+    {
+        ::uint32_t state = operation->state.load(::std::memory_order_acquire);
+        for (;;)
+        {
+            if ((state & StateJoinedMask) != 1)
+            {
+                if (operation->state.compare_exchange_weak(state, state - 1, ::std::memory_order_acq_rel, ::std::memory_order_acquire))
+                {
+                    return;
+                }
+            }
+            else if (state & StateCompleted)
+            {
+                if (operation->state.compare_exchange_weak(state, StateCompleted | StateFinished, ::std::memory_order_acq_rel, ::std::memory_order_acquire))
+                {
+                    Finish(*operation);
+                    return;
+                }
+            }
+            else if (dispatch_->GetDeferredOperationResultKHR(device_, operation->operation) != VK_NOT_READY)
+            {
+                state = operation->state.fetch_or(StateCompleted, ::std::memory_order_acq_rel) | StateCompleted;
+            }
+            else if (operation->state.compare_exchange_weak(state, state - 1, ::std::memory_order_acq_rel, ::std::memory_order_acquire))
+            {
+                Requeue(queueIndex, operation, idle);
+                return;
+            }
+        }
+    }
+
+    // An idle or done operation has work again only later, if at all: it goes behind the
+    // thread's other operations, and the thread backs off when there are none.
+    void Requeue(::size_t queueIndex, const OperationPointer& operation, bool idle)
+    {
+        if (!idle)
+        {
+            Offer(operation, queueIndex);
+            return;
+        }
+
+        const ::uint32_t idleCount = operation->idleCount.fetch_add(1, ::std::memory_order_relaxed);
+        Offer(operation, queueIndex, true);
+
+        if (available_.load() <= 1)
+        {
+            ::std::this_thread::sleep_for(MinIdleBackoff * (1u << ::std::min(idleCount, MaxIdleBackoffShift)));
+        }
+    }
+
+    void Finish(Operation& operation)
+    {
+        // A failed join may leave the operation without a result of its own.
+        VkResult result = dispatch_->GetDeferredOperationResultKHR(device_, operation.operation);
+        if (result == VK_NOT_READY && operation.joinError.load(::std::memory_order_relaxed) != VK_SUCCESS)
+        {
+            result = operation.joinError.load(::std::memory_order_relaxed);
+        }
+
+        completedCount_.fetch_add(1, ::std::memory_order_relaxed);
+
+        if (operation.callback)
+        {
+            operation.callback(operation.userData, operation.operation, result);
+        }
+
+        bool idle;
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            idle = --outstanding_ == 0;
+        }
+
+        if (idle)
+        {
+            idle_.notify_all();
+        }
+    }
+
+private:
+    const VulkanDynamicDeviceDispatch* dispatch_;
+    VkDevice device_;
+    ::std::vector<::std::unique_ptr<WorkQueue>> queues_;
+    ::std::vector<::std::thread> threads_;
+    ::std::atomic<::size_t> nextQueue_{ 0 };
+    ::std::atomic<::uint64_t> available_{ 0 };
+    ::std::atomic<::uint32_t> sleeping_{ 0 };
+    ::uint64_t outstanding_{ 0 };
+    bool stopping_{ false };
+    ::std::mutex mutex_;
+    ::std::condition_variable wakeup_;
+    ::std::condition_variable idle_;
+    ::std::atomic<::uint64_t> completedCount_{ 0 };
+    ::std::atomic<::uint64_t> joinCount_{ 0 };
+    ::std::atomic<::uint64_t> stealCount_{ 0 };
+};
+
+//------------------------------------------------------------------------------------
+// Deferred operation schedulers
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateDeferredOperationScheduler(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, uint32_t threadCount, VulkanDynamicDeferredOperationScheduler* scheduler)
+{
+    if (!dispatch || !scheduler)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    if (!dispatch->DeferredOperationJoinKHR || !dispatch->GetDeferredOperationMaxConcurrencyKHR || !dispatch->GetDeferredOperationResultKHR)
+    {
+        return VK_ERROR_EXTENSION_NOT_PRESENT;
+    }
+
+    if (threadCount == 0)
+    {
+        threadCount = ::std::thread::hardware_concurrency();
+        threadCount = threadCount ? threadCount : 1;
+    }
+
+    VulkanDynamicDeferredOperationScheduler_T* created = new VulkanDynamicDeferredOperationScheduler_T{ dispatch, device };
+
+    const VkResult result = created->Start(threadCount);
+    if (result != VK_SUCCESS)
+    {
+        delete created;
+        return result;
+    }
+
+    *scheduler = created;
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyDeferredOperationScheduler(VulkanDynamicDeferredOperationScheduler scheduler)
+{
+    delete scheduler;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicScheduleDeferredOperation(VulkanDynamicDeferredOperationScheduler scheduler, VkDeferredOperationKHR operation, PFN_VulkanDynamicDeferredOperationCallback callback, void* userData)
+{
+    if (!scheduler)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    scheduler->Schedule(operation, callback, userData);
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetDeferredOperationSchedulerStatistics(VulkanDynamicDeferredOperationScheduler scheduler, VulkanDynamicDeferredOperationSchedulerStatistics* statistics)
+{
+    if (scheduler && statistics)
+    {
+        scheduler->Statistics(*statistics);
+    }
+}
+
+#endif // VK_KHR_deferred_host_operations
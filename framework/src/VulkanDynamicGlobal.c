@@ -0,0 +1,72 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define VULKANDYNAMIC_GLOBAL_NO_FUNCTIONS
+#include <VulkanDynamic/VulkanDynamicGlobal.h>
+#undef VULKANDYNAMIC_GLOBAL_NO_FUNCTIONS
+
+VulkanDynamicLoaderDispatch VulkanDynamicGlobalLoaderDispatch;
+VulkanDynamicInstanceDispatch VulkanDynamicGlobalInstanceDispatch;
+VulkanDynamicDeviceDispatch VulkanDynamicGlobalDeviceDispatch;
+
+//------------------------------------------------------------------------------------
+// Loader
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInitializeGlobalLoaderDispatch(const VulkanDynamicLoader loader)
+{
+    return VulkanDynamicGetLoaderDispatch(loader, &VulkanDynamicGlobalLoaderDispatch);
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicSetGlobalLoaderDispatch(const VulkanDynamicLoaderDispatch* loaderDispatch)
+{
+    if (loaderDispatch)
+    {
+        VulkanDynamicGlobalLoaderDispatch = *loaderDispatch;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Instance
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInitializeGlobalInstanceDispatch(VkInstance instance)
+{
+    return VulkanDynamicGetInstanceDispatch(instance, &VulkanDynamicGlobalLoaderDispatch, &VulkanDynamicGlobalInstanceDispatch);
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicSetGlobalInstanceDispatch(const VulkanDynamicInstanceDispatch* instanceDispatch)
+{
+    if (instanceDispatch)
+    {
+        VulkanDynamicGlobalInstanceDispatch = *instanceDispatch;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Device
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInitializeGlobalDeviceDispatch(VkDevice device)
+{
+    return VulkanDynamicGetDeviceDispatch(device, &VulkanDynamicGlobalInstanceDispatch, &VulkanDynamicGlobalDeviceDispatch);
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicSetGlobalDeviceDispatch(const VulkanDynamicDeviceDispatch* deviceDispatch)
+{
+    if (deviceDispatch)
+    {
+        VulkanDynamicGlobalDeviceDispatch = *deviceDispatch;
+    }
+}
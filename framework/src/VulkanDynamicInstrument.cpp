@@ -0,0 +1,293 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicInstrument.h>
+
+#include "Aligned.hpp"
+#include "Interposer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    using Clock = ::std::chrono::steady_clock;
+
+    struct alignas(64) FunctionCounters
+    {
+        ::std::atomic<::uint64_t> callCount;
+        ::std::atomic<::uint64_t> sampledCallCount;
+        ::std::atomic<::uint64_t> sampledNanoseconds;
+        ::std::atomic<::uint64_t> latencyBuckets[VULKANDYNAMIC_LATENCY_BUCKET_COUNT];
+    };
+
+    // Counters have a single writing thread, so increments need no read-modify-write.
+    inline void Increment(::std::atomic<::uint64_t>& counter, ::uint64_t value = 1) noexcept
+    {
+        counter.store(counter.load(::std::memory_order_relaxed) + value, ::std::memory_order_relaxed);
+    }
+
+    inline ::uint32_t LatencyBucket(::uint64_t nanoseconds) noexcept
+    {
+        ::uint32_t bucket = 0;
+        while ((nanoseconds >>= 1) != 0 && bucket < VULKANDYNAMIC_LATENCY_BUCKET_COUNT - 1)
+        {
+            ++bucket;
+        }
+
+        return bucket;
+    }
+
+    template<typename Traits>
+    class Statistics
+    {
+    public:
+        using Table = typename Traits::Table;
+
+        struct Counters
+        {
+            FunctionCounters functions[Traits::FunctionCount];
+            ::uint32_t sampleCounter;
+        };
+
+        class Scope
+        {
+        public:
+            explicit Scope(::uint32_t functionId) noexcept : function_{ Local().functions[functionId] }, sampled_{ false }
+            {
+                Increment(function_.callCount);
+
+                const ::uint32_t samplingRate = samplingRate_.load(::std::memory_order_relaxed);
+                if (samplingRate != 0)
+                {
+                    Counters& counters = Local();
+                    if (++counters.sampleCounter >= samplingRate)
+                    {
+                        counters.sampleCounter = 0;
+                        sampled_ = true;
+                        start_ = Clock::now();
+                    }
+                }
+            }
+
+            ~Scope() noexcept
+            {
+                if (sampled_)
+                {
+                    const auto nanoseconds = static_cast<::uint64_t>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(Clock::now() - start_).count());
+
+                    Increment(function_.sampledCallCount);
+                    Increment(function_.sampledNanoseconds, nanoseconds);
+                    Increment(function_.latencyBuckets[LatencyBucket(nanoseconds)]);
+                }
+            }
+
+        private:
+            FunctionCounters& function_;
+            bool sampled_;
+            Clock::time_point start_;
+        };
+
+        static const Table* Next() noexcept
+        {
+            return next_.load(::std::memory_order_acquire);
+        }
+
+        static ::VkResult Instrument(const Table* next, ::uint32_t samplingRate) noexcept
+        {
+            const ::VkResult result = ::VulkanDynamic::Detail::BindNext(next_, next);
+            if (result == ::VK_SUCCESS)
+            {
+                samplingRate_.store(samplingRate, ::std::memory_order_relaxed);
+            }
+
+            return result;
+        }
+
+        static ::VkResult Release(const Table* next) noexcept
+        {
+            return ::VulkanDynamic::Detail::ReleaseNext(next_, next);
+        }
+
+        static ::VkResult Get(::uint32_t* pStatisticCount, ::VulkanDynamicFunctionStatistics* pStatistics)
+        {
+            if (!pStatisticCount)
+            {
+                return ::VK_ERROR_OUT_OF_HOST_MEMORY;
+            }
+
+            if (!pStatistics)
+            {
+                *pStatisticCount = Traits::FunctionCount;
+                return ::VK_SUCCESS;
+            }
+
+            const ::uint32_t count = *pStatisticCount < Traits::FunctionCount ? *pStatisticCount : Traits::FunctionCount;
+            ::std::memset(pStatistics, 0, sizeof(::VulkanDynamicFunctionStatistics) * count);
+
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            for (const auto& counters : counters_)
+            {
+                for (::uint32_t functionId = 0; functionId < count; ++functionId)
+                {
+                    const FunctionCounters& function = counters->functions[functionId];
+                    ::VulkanDynamicFunctionStatistics& statistics = pStatistics[functionId];
+
+                    statistics.callCount += function.callCount.load(::std::memory_order_relaxed);
+                    statistics.sampledCallCount += function.sampledCallCount.load(::std::memory_order_relaxed);
+                    statistics.sampledNanoseconds += function.sampledNanoseconds.load(::std::memory_order_relaxed);
+                    for (::uint32_t bucket = 0; bucket < VULKANDYNAMIC_LATENCY_BUCKET_COUNT; ++bucket)
+                    {
+                        statistics.latencyBuckets[bucket] += function.latencyBuckets[bucket].load(::std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            *pStatisticCount = count;
+
+            return count < Traits::FunctionCount ? ::VK_INCOMPLETE : ::VK_SUCCESS;
+        }
+
+    private:
+        static Counters& Local()
+        {
+            thread_local Counters* local = nullptr;
+            if (!local)
+            {
+                // Counters of exited threads stay registered so their calls remain in the totals.
+                ::VulkanDynamic::Detail::AlignedPointer<Counters> counters = ::VulkanDynamic::Detail::MakeAligned<Counters>();
+                local = counters.get();
+
+                const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+                counters_.push_back(::std::move(counters));
+            }
+
+            return *local;
+        }
+
+    private:
+        static ::std::atomic<const Table*> next_;
+        static ::std::atomic<::uint32_t> samplingRate_;
+        static ::std::mutex mutex_;
+        static ::std::vector<::VulkanDynamic::Detail::AlignedPointer<Counters>> counters_;
+    };
+
+    template<typename Traits>
+    ::std::atomic<const typename Statistics<Traits>::Table*> Statistics<Traits>::next_{ nullptr };
+
+    template<typename Traits>
+    ::std::atomic<::uint32_t> Statistics<Traits>::samplingRate_{ 0 };
+
+    template<typename Traits>
+    ::std::mutex Statistics<Traits>::mutex_;
+
+    template<typename Traits>
+    ::std::vector<::VulkanDynamic::Detail::AlignedPointer<typename Statistics<Traits>::Counters>> Statistics<Traits>::counters_;
+
+    struct InstanceTraits
+    {
+        using Table = ::VulkanDynamicInstanceDispatch;
+        static constexpr ::uint32_t FunctionCount = VULKANDYNAMIC_INSTANCE_FUNCTION_ID_COUNT;
+    };
+
+    struct DeviceTraits
+    {
+        using Table = ::VulkanDynamicDeviceDispatch;
+        static constexpr ::uint32_t FunctionCount = VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT;
+    };
+
+    using InstanceStatistics = Statistics<InstanceTraits>;
+    using DeviceStatistics = Statistics<DeviceTraits>;
+} // namespace
+
+#define VULKANDYNAMIC_INSTRUMENT_INSTANCE_FUNCTION(function) VULKANDYNAMIC_INTERPOSE_FUNCTION(InstanceStatistics, INSTANCE, next, instrumentedDispatch, function)
+#define VULKANDYNAMIC_INSTRUMENT_DEVICE_FUNCTION(function) VULKANDYNAMIC_INTERPOSE_FUNCTION(DeviceStatistics, DEVICE, next, instrumentedDispatch, function)
+
+//------------------------------------------------------------------------------------
+// Instance
+//------------------------------------------------------------------------------------
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInstrumentInstanceDispatch(const VulkanDynamicInstanceDispatch* next, uint32_t samplingRate, VulkanDynamicInstanceDispatch* instrumentedDispatch)
+{
+    if (!next || !instrumentedDispatch)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    const VkResult result = InstanceStatistics::Instrument(next, samplingRate);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS(VULKANDYNAMIC_INSTRUMENT_INSTANCE_FUNCTION)
+
+    return VK_SUCCESS;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicReleaseInstanceInstrumentation(const VulkanDynamicInstanceDispatch* next)
+{
+    if (!next)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return InstanceStatistics::Release(next);
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetInstanceStatistics(uint32_t* pStatisticCount, VulkanDynamicFunctionStatistics* pStatistics)
+{
+    return InstanceStatistics::Get(pStatisticCount, pStatistics);
+}
+
+//------------------------------------------------------------------------------------
+// Device
+//------------------------------------------------------------------------------------
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInstrumentDeviceDispatch(const VulkanDynamicDeviceDispatch* next, uint32_t samplingRate, VulkanDynamicDeviceDispatch* instrumentedDispatch)
+{
+    if (!next || !instrumentedDispatch)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    const VkResult result = DeviceStatistics::Instrument(next, samplingRate);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_INSTRUMENT_DEVICE_FUNCTION)
+
+    return VK_SUCCESS;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicReleaseDeviceInstrumentation(const VulkanDynamicDeviceDispatch* next)
+{
+    if (!next)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return DeviceStatistics::Release(next);
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicGetDeviceStatistics(uint32_t* pStatisticCount, VulkanDynamicFunctionStatistics* pStatistics)
+{
+    return DeviceStatistics::Get(pStatisticCount, pStatistics);
+}
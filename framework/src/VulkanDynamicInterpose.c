@@ -0,0 +1,187 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicInterpose.h>
+#include <VulkanDynamic/VulkanDynamicFunctions.h>
+#include <Platform/Atomic.h>
+
+#define VULKANDYNAMIC_FILL_INTERPOSER_SYMBOL(function) interposer->function = interposer->function ? interposer->function : next->function;
+
+#define VULKANDYNAMIC_READERS_LOCK_SPIN_COUNT 64
+
+static void LockReaders(const VulkanDynamicDeviceDispatchSwap* swap)
+{
+    volatile uint32_t* readersLock = &((VulkanDynamicDeviceDispatchSwap*)swap)->readersLock;
+    uint32_t spinCount = 0;
+    while (ATOMIC_EXCHANGE_32(readersLock, 1u) != 0)
+    {
+        // Wait on plain loads so the line stays shared while the holder works, and yield
+        // the core if it is taking long, e.g. because the holder was preempted.
+        while (ATOMIC_LOAD_32(readersLock) != 0)
+        {
+            if (spinCount < VULKANDYNAMIC_READERS_LOCK_SPIN_COUNT)
+            {
+                ++spinCount;
+                ATOMIC_PAUSE();
+            }
+            else
+            {
+                ATOMIC_YIELD();
+            }
+        }
+    }
+}
+
+static void UnlockReaders(const VulkanDynamicDeviceDispatchSwap* swap)
+{
+    ATOMIC_STORE_32(&((VulkanDynamicDeviceDispatchSwap*)swap)->readersLock, 0u);
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicInitializeDeviceDispatchSwap(const VulkanDynamicDeviceDispatch* deviceDispatch, VulkanDynamicDeviceDispatchSwap* swap)
+{
+    if (!deviceDispatch || !swap)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    swap->next = *deviceDispatch;
+    swap->current = &swap->next;
+    swap->epoch = 1;
+    swap->readers = NULL;
+    swap->readersLock = 0;
+
+    return VK_SUCCESS;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicFillDeviceInterposer(const VulkanDynamicDeviceDispatch* next, VulkanDynamicDeviceDispatch* interposer)
+{
+    if (!next || !interposer)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_FILL_INTERPOSER_SYMBOL)
+
+    return VK_SUCCESS;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicSwapDeviceDispatch(VulkanDynamicDeviceDispatchSwap* swap, const VulkanDynamicDeviceDispatch* deviceDispatch, const VulkanDynamicDeviceDispatch** previousDispatch, uint64_t* retireEpoch)
+{
+    if (!swap)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    const VulkanDynamicDeviceDispatch* previous = (const VulkanDynamicDeviceDispatch*)ATOMIC_EXCHANGE_POINTER(&swap->current, deviceDispatch ? deviceDispatch : &swap->next);
+    const uint64_t epoch = ATOMIC_INCREMENT_64(&swap->epoch);
+
+    if (previousDispatch)
+    {
+        *previousDispatch = previous;
+    }
+
+    if (retireEpoch)
+    {
+        *retireEpoch = epoch;
+    }
+
+    return VK_SUCCESS;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicQueryDeviceDispatchRetired(const VulkanDynamicDeviceDispatchSwap* swap, uint64_t retireEpoch)
+{
+    if (!swap)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    VkResult result = VK_SUCCESS;
+
+    LockReaders(swap);
+
+    for (const VulkanDynamicDispatchReader* reader = swap->readers; reader; reader = reader->next)
+    {
+        const uint64_t epoch = ATOMIC_LOAD_64(&((VulkanDynamicDispatchReader*)reader)->epoch);
+        if (epoch != 0 && epoch < retireEpoch)
+        {
+            result = VK_NOT_READY;
+            break;
+        }
+    }
+
+    UnlockReaders(swap);
+
+    return result;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicRegisterDispatchReader(VulkanDynamicDeviceDispatchSwap* swap, VulkanDynamicDispatchReader* reader)
+{
+    if (!swap || !reader)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    reader->epoch = 0;
+
+    LockReaders(swap);
+    reader->next = swap->readers;
+    swap->readers = reader;
+    UnlockReaders(swap);
+
+    VulkanDynamicDispatchReaderOnline(swap, reader);
+
+    return VK_SUCCESS;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicUnregisterDispatchReader(VulkanDynamicDeviceDispatchSwap* swap, VulkanDynamicDispatchReader* reader)
+{
+    if (!swap || !reader)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    VkResult result = VK_ERROR_INITIALIZATION_FAILED;
+
+    LockReaders(swap);
+
+    for (VulkanDynamicDispatchReader* volatile* link = &swap->readers; *link; link = &(*link)->next)
+    {
+        if (*link == reader)
+        {
+            *link = reader->next;
+            result = VK_SUCCESS;
+            break;
+        }
+    }
+
+    UnlockReaders(swap);
+
+    return result;
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR void VKAPI_CALL VulkanDynamicDispatchReaderQuiescent(const VulkanDynamicDeviceDispatchSwap* swap, VulkanDynamicDispatchReader* reader)
+{
+    const uint64_t epoch = ATOMIC_LOAD_64(&((VulkanDynamicDeviceDispatchSwap*)swap)->epoch);
+    ATOMIC_STORE_64(&reader->epoch, epoch);
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR void VKAPI_CALL VulkanDynamicDispatchReaderOffline(VulkanDynamicDispatchReader* reader)
+{
+    ATOMIC_STORE_64(&reader->epoch, 0);
+}
+
+VULKANDYNAMIC_API VKAPI_ATTR void VKAPI_CALL VulkanDynamicDispatchReaderOnline(const VulkanDynamicDeviceDispatchSwap* swap, VulkanDynamicDispatchReader* reader)
+{
+    VulkanDynamicDispatchReaderQuiescent(swap, reader);
+}
@@ -0,0 +1,247 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicMetrics.h>
+#include <VulkanDynamic/VulkanDynamicInstrument.h>
+#include <Platform/Atomic.h>
+#include <Platform/Clock.h>
+#include <Platform/SharedMemory.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#define VULKANDYNAMIC_METRICS_READ_ATTEMPTS 1024
+
+struct VulkanDynamicMetricsSegment_T
+{
+    SharedMemory memory;
+    VulkanDynamicFunctionStatistics* statistics;
+    size_t size;                                    // validated on open, the writer may not change it
+};
+
+static void VulkanDynamicCopyFunctionName(char* destination, const char* source)
+{
+    strncpy(destination, source ? source : "", VULKANDYNAMIC_METRICS_NAME_SIZE - 1);
+    destination[VULKANDYNAMIC_METRICS_NAME_SIZE - 1] = '\0';
+}
+
+static void VulkanDynamicPublishFunctions(VulkanDynamicMetricsFunction* functions, uint32_t functionCount, const VulkanDynamicFunctionStatistics* statistics)
+{
+    for (uint32_t functionId = 0; functionId < functionCount; ++functionId)
+    {
+        functions[functionId].callCount = statistics[functionId].callCount;
+        functions[functionId].sampledCallCount = statistics[functionId].sampledCallCount;
+        functions[functionId].sampledNanoseconds = statistics[functionId].sampledNanoseconds;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Writer
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateMetricsSegment(const char* name, VulkanDynamicMetricsSegment* segment)
+{
+    if (!name || !segment)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    const uint32_t instanceFunctionOffset = (uint32_t)sizeof(VulkanDynamicMetricsHeader);
+    const uint32_t deviceFunctionOffset = instanceFunctionOffset + VULKANDYNAMIC_INSTANCE_FUNCTION_ID_COUNT * (uint32_t)sizeof(VulkanDynamicMetricsFunction);
+    const uint32_t size = deviceFunctionOffset + VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT * (uint32_t)sizeof(VulkanDynamicMetricsFunction);
+
+    const uint32_t instanceFunctionCount = VULKANDYNAMIC_INSTANCE_FUNCTION_ID_COUNT;
+    const uint32_t deviceFunctionCount = VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT;
+    const uint32_t maxFunctionCount = instanceFunctionCount > deviceFunctionCount ? instanceFunctionCount : deviceFunctionCount;
+
+    VulkanDynamicMetricsSegment metricsSegment = (VulkanDynamicMetricsSegment)calloc(1, sizeof(struct VulkanDynamicMetricsSegment_T));
+    if (!metricsSegment)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    metricsSegment->statistics = (VulkanDynamicFunctionStatistics*)calloc(maxFunctionCount, sizeof(VulkanDynamicFunctionStatistics));
+    metricsSegment->memory = SharedMemoryCreate(name, size);
+    if (!metricsSegment->statistics || !metricsSegment->memory)
+    {
+        VulkanDynamicDestroyMetricsSegment(metricsSegment);
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    metricsSegment->size = size;
+
+    unsigned char* data = (unsigned char*)SharedMemoryGetAddress(metricsSegment->memory);
+    VulkanDynamicMetricsHeader* header = (VulkanDynamicMetricsHeader*)data;
+    header->size = size;
+    header->instanceFunctionCount = VULKANDYNAMIC_INSTANCE_FUNCTION_ID_COUNT;
+    header->instanceFunctionOffset = instanceFunctionOffset;
+    header->deviceFunctionCount = VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT;
+    header->deviceFunctionOffset = deviceFunctionOffset;
+
+    VulkanDynamicMetricsFunction* instanceFunctions = (VulkanDynamicMetricsFunction*)(data + instanceFunctionOffset);
+    for (uint32_t functionId = 0; functionId < VULKANDYNAMIC_INSTANCE_FUNCTION_ID_COUNT; ++functionId)
+    {
+        VulkanDynamicCopyFunctionName(instanceFunctions[functionId].name, VulkanDynamicGetInstanceFunctionName(functionId));
+    }
+
+    VulkanDynamicMetricsFunction* deviceFunctions = (VulkanDynamicMetricsFunction*)(data + deviceFunctionOffset);
+    for (uint32_t functionId = 0; functionId < VULKANDYNAMIC_DEVICE_FUNCTION_ID_COUNT; ++functionId)
+    {
+        VulkanDynamicCopyFunctionName(deviceFunctions[functionId].name, VulkanDynamicGetDeviceFunctionName(functionId));
+    }
+
+    // Readers accept the segment once the magic is visible.
+    header->version = VULKANDYNAMIC_METRICS_VERSION;
+    ATOMIC_FENCE();
+    header->magic = VULKANDYNAMIC_METRICS_MAGIC;
+
+    *segment = metricsSegment;
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicPublishMetrics(VulkanDynamicMetricsSegment segment)
+{
+    if (!segment || !segment->statistics)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    unsigned char* data = (unsigned char*)SharedMemoryGetAddress(segment->memory);
+    VulkanDynamicMetricsHeader* header = (VulkanDynamicMetricsHeader*)data;
+
+    const uint64_t sequence = ATOMIC_LOAD_64(&header->sequence);
+    ATOMIC_STORE_64(&header->sequence, sequence + 1);
+    ATOMIC_FENCE();
+
+    header->publishCount++;
+    header->timestampNanoseconds = ClockNanoseconds();
+
+    for (uint32_t tier = 0; tier < VULKANDYNAMIC_TIER_COUNT; ++tier)
+    {
+        VulkanDynamicGetResolutionStatistics((VulkanDynamicTier)tier, &header->resolution[tier]);
+    }
+
+    uint32_t statisticCount = header->instanceFunctionCount;
+    VulkanDynamicGetInstanceStatistics(&statisticCount, segment->statistics);
+    VulkanDynamicPublishFunctions((VulkanDynamicMetricsFunction*)(data + header->instanceFunctionOffset), statisticCount, segment->statistics);
+
+    statisticCount = header->deviceFunctionCount;
+    VulkanDynamicGetDeviceStatistics(&statisticCount, segment->statistics);
+    VulkanDynamicPublishFunctions((VulkanDynamicMetricsFunction*)(data + header->deviceFunctionOffset), statisticCount, segment->statistics);
+
+    header->fenceWaitCount = segment->statistics[VULKANDYNAMIC_DEVICE_FUNCTION_ID_WaitForFences].callCount;
+    header->fenceWaitSampledCount = segment->statistics[VULKANDYNAMIC_DEVICE_FUNCTION_ID_WaitForFences].sampledCallCount;
+    header->fenceWaitSampledNanoseconds = segment->statistics[VULKANDYNAMIC_DEVICE_FUNCTION_ID_WaitForFences].sampledNanoseconds;
+
+    ATOMIC_FENCE();
+    ATOMIC_STORE_64(&header->sequence, sequence + 2);
+
+    return VK_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------
+// Reader
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicOpenMetricsSegment(const char* name, VulkanDynamicMetricsSegment* segment)
+{
+    if (!name || !segment)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    SharedMemory memory = SharedMemoryOpen(name);
+    if (!memory)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    const VulkanDynamicMetricsHeader* header = (const VulkanDynamicMetricsHeader*)SharedMemoryGetAddress(memory);
+    if (SharedMemoryGetSize(memory) < sizeof(VulkanDynamicMetricsHeader) || header->magic != VULKANDYNAMIC_METRICS_MAGIC
+        || header->version != VULKANDYNAMIC_METRICS_VERSION || header->size < sizeof(VulkanDynamicMetricsHeader) || header->size > SharedMemoryGetSize(memory))
+    {
+        SharedMemoryClose(memory);
+        return VK_ERROR_INCOMPATIBLE_DRIVER;
+    }
+
+    VulkanDynamicMetricsSegment metricsSegment = (VulkanDynamicMetricsSegment)calloc(1, sizeof(struct VulkanDynamicMetricsSegment_T));
+    if (!metricsSegment)
+    {
+        SharedMemoryClose(memory);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    metricsSegment->memory = memory;
+    metricsSegment->size = (size_t)header->size;
+    *segment = metricsSegment;
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicReadMetrics(VulkanDynamicMetricsSegment segment, size_t* pDataSize, void* pData)
+{
+    if (!segment || !pDataSize)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    const unsigned char* data = (const unsigned char*)SharedMemoryGetAddress(segment->memory);
+    const VulkanDynamicMetricsHeader* header = (const VulkanDynamicMetricsHeader*)data;
+    const size_t size = segment->size;
+
+    if (!pData)
+    {
+        *pDataSize = size;
+        return VK_SUCCESS;
+    }
+
+    if (*pDataSize < size)
+    {
+        return VK_INCOMPLETE;
+    }
+
+    for (uint32_t attempt = 0; attempt < VULKANDYNAMIC_METRICS_READ_ATTEMPTS; ++attempt)
+    {
+        const uint64_t sequence = ATOMIC_LOAD_64(&((VulkanDynamicMetricsHeader*)header)->sequence);
+        if (sequence & 1)
+        {
+            continue;
+        }
+
+        ATOMIC_FENCE();
+        memcpy(pData, data, size);
+        ATOMIC_FENCE();
+
+        if (ATOMIC_LOAD_64(&((VulkanDynamicMetricsHeader*)header)->sequence) == sequence)
+        {
+            *pDataSize = size;
+            return VK_SUCCESS;
+        }
+    }
+
+    return VK_TIMEOUT;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyMetricsSegment(VulkanDynamicMetricsSegment segment)
+{
+    if (!segment)
+    {
+        return;
+    }
+
+    SharedMemoryClose(segment->memory);
+    free(segment->statistics);
+    free(segment);
+}
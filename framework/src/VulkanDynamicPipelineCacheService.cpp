@@ -0,0 +1,583 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicPipelineCacheService.h>
+#include <Platform/LocalSocket.h>
+
+#include "PipelineCache.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr ::uint32_t MessageMagic = 0x43504456u;
+    constexpr ::uint32_t OperationFetch = 1;
+    constexpr ::uint32_t OperationPublish = 2;
+
+    // Milliseconds without progress before a peer is given up on, and between checks for
+    // the server stopping.
+    constexpr ::uint32_t SocketTimeout = 5000;
+
+    // Connections served at once. Further ones are closed, so their clients fall back to an
+    // unshared cache rather than wait.
+    constexpr ::size_t MaxConnectionCount = 16;
+
+    // Bounds what a peer can make the server allocate, and what all the connections being
+    // served can together.
+    constexpr ::uint64_t MaxDataSize = 1ull << 30;
+    constexpr ::uint64_t MaxReceivedSize = 1ull << 30;
+
+    // Data is received in steps of this size, so that it is only allocated as it arrives.
+    constexpr ::size_t ReceiveStepSize = 1 << 20;
+
+    // A request or reply, followed by `size` bytes of pipeline cache data. Both ends run
+    // on one machine, so fields are sent as they are laid out in memory.
+    struct Message
+    {
+        ::uint32_t magic;
+        ::uint32_t operation;
+        ::int32_t result;
+        ::uint32_t vendorID;
+        ::uint32_t deviceID;
+        ::uint32_t driverVersion;
+        ::uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+        ::uint64_t size;
+    };
+
+    Message MakeRequest(::uint32_t operation, const VkPhysicalDeviceProperties& properties, ::uint64_t size) noexcept
+    {
+        Message message{};
+        message.magic = MessageMagic;
+        message.operation = operation;
+        message.vendorID = properties.vendorID;
+        message.deviceID = properties.deviceID;
+        message.driverVersion = properties.driverVersion;
+        ::std::memcpy(message.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+        message.size = size;
+
+        return message;
+    }
+
+    bool IsRequestFor(const Message& message, const VkPhysicalDeviceProperties& properties) noexcept
+    {
+        return message.vendorID == properties.vendorID && message.deviceID == properties.deviceID && message.driverVersion == properties.driverVersion
+            && ::std::memcmp(message.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+    }
+
+    class Connection final
+    {
+    public:
+        explicit Connection(LocalSocket socket) noexcept
+            : socket_{ socket }
+        {
+        }
+
+        Connection(const Connection&) = delete;
+        Connection& operator=(const Connection&) = delete;
+
+        ~Connection()
+        {
+            ::LocalSocketClose(socket_);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return socket_ != nullptr;
+        }
+
+        bool Send(const Message& message, const void* data) noexcept
+        {
+            return ::LocalSocketSend(socket_, &message, sizeof(Message)) && (message.size == 0 || ::LocalSocketSend(socket_, data, static_cast<::size_t>(message.size)));
+        }
+
+        bool Receive(Message& message, ::std::vector<unsigned char>& data)
+        {
+            return ReceiveMessage(message) && ReceiveData(message, data);
+        }
+
+        bool ReceiveMessage(Message& message) noexcept
+        {
+            return ::LocalSocketReceive(socket_, &message, sizeof(Message)) && message.magic == MessageMagic && message.size <= MaxDataSize;
+        }
+
+        bool ReceiveData(const Message& message, ::std::vector<unsigned char>& data)
+        {
+            data.clear();
+            while (data.size() < message.size)
+            {
+                const ::size_t offset = data.size();
+                const ::size_t remaining = static_cast<::size_t>(message.size) - offset;
+                const ::size_t step = remaining < ReceiveStepSize ? remaining : ReceiveStepSize;
+
+                data.resize(offset + step);
+                if (!::LocalSocketReceive(socket_, data.data() + offset, step))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    private:
+        LocalSocket socket_;
+    };
+
+    // Sends a request to the server and returns the data of its reply.
+    VkResult Exchange(const char* socketPath, const Message& request, const void* data, ::std::vector<unsigned char>& replyData)
+    {
+        Connection connection{ ::LocalSocketConnect(socketPath, SocketTimeout) };
+
+        Message reply;
+        if (!connection || !connection.Send(request, data) || !connection.Receive(reply, replyData))
+        {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        return static_cast<VkResult>(reply.result);
+    }
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Pipeline cache server
+//------------------------------------------------------------------------------------
+
+struct VulkanDynamicPipelineCacheServer_T final
+{
+    ~VulkanDynamicPipelineCacheServer_T()
+    {
+        if (thread_.joinable())
+        {
+            // The thread checks the flag after each connection and accept timeout, so one
+            // more connection wakes it early.
+            stopping_.store(true, ::std::memory_order_release);
+            ::LocalSocketClose(::LocalSocketConnect(socketPath_.c_str(), SocketTimeout));
+            thread_.join();
+        }
+
+        ::LocalSocketClose(listener_);
+
+        for (Device& device : devices_)
+        {
+            if (device.cache != VK_NULL_HANDLE)
+            {
+                device.dispatch->DestroyPipelineCache(device.device, device.cache, nullptr);
+            }
+        }
+    }
+
+    VkResult Start(const char* socketPath, ::uint32_t deviceCount, const VulkanDynamicPipelineCacheServerDevice* devices)
+    {
+        VkPipelineCacheCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+
+        devices_.resize(deviceCount);
+        for (::uint32_t index = 0; index < deviceCount; ++index)
+        {
+            Device& device = devices_[index];
+            device.dispatch = devices[index].deviceDispatch;
+            device.device = devices[index].device;
+            devices[index].physicalDeviceDispatch->GetPhysicalDeviceProperties(devices[index].physicalDevice, &device.properties);
+
+            const VkResult result = device.dispatch->CreatePipelineCache(device.device, &createInfo, nullptr, &device.cache);
+            if (result != VK_SUCCESS)
+            {
+                device.cache = VK_NULL_HANDLE;
+                return result;
+            }
+        }
+
+        socketPath_ = socketPath;
+        listener_ = ::LocalSocketListen(socketPath);
+        if (!listener_)
+        {
+            return VK_ERROR_FEATURE_NOT_PRESENT;
+        }
+
+        try
+        {
+            thread_ = ::std::thread{ [this] { Run(); } };
+        }
+        catch (const ::std::system_error&)
+        {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        return VK_SUCCESS;
+    }
+
+    void Statistics(VulkanDynamicPipelineCacheServerStatistics& statistics) const noexcept
+    {
+        statistics.publishCount = publishCount_.load(::std::memory_order_relaxed);
+        statistics.rejectedPublishCount = rejectedPublishCount_.load(::std::memory_order_relaxed);
+        statistics.fetchCount = fetchCount_.load(::std::memory_order_relaxed);
+        statistics.servedSize = servedSize_.load(::std::memory_order_relaxed);
+    }
+
+private:
+    struct Device
+    {
+        const VulkanDynamicDeviceDispatch* dispatch;
+        VkDevice device;
+        VkPhysicalDeviceProperties properties;
+        VkPipelineCache cache;
+        // The cache's data as last served, read again after merges.
+        ::std::vector<unsigned char> data;
+        bool stale;
+    };
+
+    struct Worker
+    {
+        ::std::thread thread;
+        ::std::atomic<bool> finished{ false };
+    };
+
+    // Each connection is served on a thread of its own, so a client that stalls holds up
+    // no other; merges and reads of the caches take turns under the lock.
+    void Run()
+    {
+        ::std::list<Worker> workers;
+        for (;;)
+        {
+            LocalSocket socket = ::LocalSocketAccept(listener_, SocketTimeout);
+            if (stopping_.load(::std::memory_order_acquire))
+            {
+                ::LocalSocketClose(socket);
+                break;
+            }
+
+            for (auto worker = workers.begin(); worker != workers.end();)
+            {
+                if (worker->finished.load(::std::memory_order_acquire))
+                {
+                    worker->thread.join();
+                    worker = workers.erase(worker);
+                }
+                else
+                {
+                    ++worker;
+                }
+            }
+
+            if (!socket || workers.size() >= MaxConnectionCount)
+            {
+                ::LocalSocketClose(socket);
+                continue;
+            }
+
+            workers.emplace_back();
+            Worker* worker = &workers.back();
+            try
+            {
+                worker->thread = ::std::thread{ [this, worker, socket]
+                {
+                    Handle(socket);
+                    worker->finished.store(true, ::std::memory_order_release);
+                } };
+            }
+            catch (const ::std::system_error&)
+            {
+                workers.pop_back();
+                ::LocalSocketClose(socket);
+            }
+        }
+
+        for (Worker& worker : workers)
+        {
+            worker.thread.join();
+        }
+    }
+
+    // The data of a request is only allocated once it fits in what the connections being
+    // served may hold together; connections it does not fit are closed.
+    void Handle(LocalSocket socket)
+    {
+        Connection connection{ socket };
+
+        Message request;
+        if (!connection.ReceiveMessage(request) || !Reserve(request.size))
+        {
+            return;
+        }
+
+        Respond(connection, request);
+        receivedSize_.fetch_sub(request.size, ::std::memory_order_relaxed);
+    }
+
+    bool Reserve(::uint64_t size) noexcept
+    {
+        ::uint64_t reserved = receivedSize_.load(::std::memory_order_relaxed);
+        do
+        {
+            if (size > MaxReceivedSize - reserved)
+            {
+                return false;
+            }
+        } while (!receivedSize_.compare_exchange_weak(reserved, reserved + size, ::std::memory_order_relaxed));
+
+        return true;
+    }
+
+    void Respond(Connection& connection, const Message& request)
+    {
+        ::std::vector<unsigned char> data;
+        if (!connection.ReceiveData(request, data))
+        {
+            return;
+        }
+
+        // The reply's data is copied out, so the lock is not held while it is sent.
+        Message reply;
+        ::std::vector<unsigned char> replyData;
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            reply = Serve(request, data);
+            if (reply.size != 0)
+            {
+                replyData = FindDevice(request)->data;
+            }
+        }
+
+        connection.Send(reply, replyData.data());
+    }
+
+    Device* FindDevice(const Message& request) noexcept
+    {
+        for (Device& candidate : devices_)
+        {
+            if (IsRequestFor(request, candidate.properties))
+            {
+                return &candidate;
+            }
+        }
+
+        return nullptr;
+    }
+
+    Message Serve(const Message& request, const ::std::vector<unsigned char>& data)
+    {
+        Device* device = FindDevice(request);
+
+        Message reply = request;
+        reply.size = 0;
+        reply.result = VK_ERROR_INCOMPATIBLE_DRIVER;
+
+        if (request.operation == OperationPublish)
+        {
+            if (device)
+            {
+                reply.result = Merge(*device, data);
+            }
+
+            if (reply.result == VK_SUCCESS)
+            {
+                publishCount_.fetch_add(1, ::std::memory_order_relaxed);
+            }
+            else
+            {
+                rejectedPublishCount_.fetch_add(1, ::std::memory_order_relaxed);
+            }
+        }
+        else if (request.operation == OperationFetch && device)
+        {
+            reply.result = Read(*device);
+            if (reply.result == VK_SUCCESS)
+            {
+                reply.size = device->data.size();
+                fetchCount_.fetch_add(1, ::std::memory_order_relaxed);
+                servedSize_.fetch_add(reply.size, ::std::memory_order_relaxed);
+            }
+        }
+
+        return reply;
+    }
+
+    VkResult Merge(Device& device, const ::std::vector<unsigned char>& data)
+    {
+        // Checked here as well, as clients are not trusted to have sent matching data.
+        if (!::VulkanDynamic::Detail::PipelineCacheMatchesDevice(data.data(), data.size(), device.properties))
+        {
+            return VK_ERROR_INCOMPATIBLE_DRIVER;
+        }
+
+        VkPipelineCacheCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        createInfo.initialDataSize = data.size();
+        createInfo.pInitialData = data.data();
+
+        VkPipelineCache cache;
+        VkResult result = device.dispatch->CreatePipelineCache(device.device, &createInfo, nullptr, &cache);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+
+        result = device.dispatch->MergePipelineCaches(device.device, device.cache, 1, &cache);
+        device.dispatch->DestroyPipelineCache(device.device, cache, nullptr);
+        device.stale = true;
+
+        return result;
+    }
+
+    VkResult Read(Device& device)
+    {
+        if (!device.stale && !device.data.empty())
+        {
+            return VK_SUCCESS;
+        }
+
+        ::size_t size = 0;
+        VkResult result = device.dispatch->GetPipelineCacheData(device.device, device.cache, &size, nullptr);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+
+        device.data.resize(size);
+        result = device.dispatch->GetPipelineCacheData(device.device, device.cache, &size, device.data.data());
+        if (result < 0)
+        {
+            device.data.clear();
+            return result;
+        }
+
+        device.data.resize(size);
+        device.stale = false;
+
+        return VK_SUCCESS;
+    }
+
+    ::std::vector<Device> devices_;
+    ::std::string socketPath_;
+    LocalSocket listener_{ nullptr };
+    ::std::mutex mutex_;
+    ::std::atomic<bool> stopping_{ false };
+    ::std::atomic<::uint64_t> receivedSize_{ 0 };
+    ::std::thread thread_;
+    ::std::atomic<::uint64_t> publishCount_{ 0 };
+    ::std::atomic<::uint64_t> rejectedPublishCount_{ 0 };
+    ::std::atomic<::uint64_t> fetchCount_{ 0 };
+    ::std::atomic<::uint64_t> servedSize_{ 0 };
+};
+
+//------------------------------------------------------------------------------------
+// Pipeline cache servers
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreatePipelineCacheServer(const char* socketPath, uint32_t deviceCount, const VulkanDynamicPipelineCacheServerDevice* pDevices, VulkanDynamicPipelineCacheServer* server)
+{
+    if (!socketPath || (deviceCount && !pDevices) || !server)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    VulkanDynamicPipelineCacheServer_T* created = new VulkanDynamicPipelineCacheServer_T{};
+
+    const VkResult result = created->Start(socketPath, deviceCount, pDevices);
+    if (result != VK_SUCCESS)
+    {
+        delete created;
+        return result;
+    }
+
+    *server = created;
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyPipelineCacheServer(VulkanDynamicPipelineCacheServer server)
+{
+    delete server;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetPipelineCacheServerStatistics(VulkanDynamicPipelineCacheServer server, VulkanDynamicPipelineCacheServerStatistics* statistics)
+{
+    if (server && statistics)
+    {
+        server->Statistics(*statistics);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Pipeline cache clients
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateSharedPipelineCache(const char* socketPath, const VulkanDynamicPhysicalDeviceDispatch* physicalDeviceDispatch, VkPhysicalDevice physicalDevice, const VulkanDynamicDeviceDispatch* deviceDispatch, VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache)
+{
+    if (!socketPath || !physicalDeviceDispatch || !deviceDispatch || !pCreateInfo || !pPipelineCache)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    VkPhysicalDeviceProperties properties{};
+    physicalDeviceDispatch->GetPhysicalDeviceProperties(physicalDevice, &properties);
+
+    ::std::vector<unsigned char> data;
+    if (Exchange(socketPath, MakeRequest(OperationFetch, properties, 0), nullptr, data) == VK_SUCCESS
+        && ::VulkanDynamic::Detail::PipelineCacheMatchesDevice(data.data(), data.size(), properties))
+    {
+        VkPipelineCacheCreateInfo createInfo = *pCreateInfo;
+        createInfo.initialDataSize = data.size();
+        createInfo.pInitialData = data.data();
+
+        if (deviceDispatch->CreatePipelineCache(device, &createInfo, pAllocator, pPipelineCache) == VK_SUCCESS)
+        {
+            return VK_SUCCESS;
+        }
+    }
+
+    return deviceDispatch->CreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicPublishPipelineCache(const char* socketPath, const VulkanDynamicPhysicalDeviceDispatch* physicalDeviceDispatch, VkPhysicalDevice physicalDevice, const VulkanDynamicDeviceDispatch* deviceDispatch, VkDevice device, VkPipelineCache pipelineCache)
+{
+    if (!socketPath || !physicalDeviceDispatch || !deviceDispatch)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    VkPhysicalDeviceProperties properties{};
+    physicalDeviceDispatch->GetPhysicalDeviceProperties(physicalDevice, &properties);
+
+    // The cache may grow between the size query and the copy, truncating the copy.
+    ::size_t size = 0;
+    ::std::vector<unsigned char> data;
+    VkResult result = VK_INCOMPLETE;
+    while (result == VK_INCOMPLETE)
+    {
+        result = deviceDispatch->GetPipelineCacheData(device, pipelineCache, &size, nullptr);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+
+        data.resize(size);
+        result = deviceDispatch->GetPipelineCacheData(device, pipelineCache, &size, data.data());
+        if (result < 0)
+        {
+            return result;
+        }
+    }
+
+    ::std::vector<unsigned char> replyData;
+    return Exchange(socketPath, MakeRequest(OperationPublish, properties, size), data.data(), replyData);
+}
@@ -0,0 +1,288 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicPipelineCacheStore.h>
+#include <Platform/MappedFile.h>
+
+#include "PipelineCache.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using Clock = ::std::chrono::steady_clock;
+
+    // FNV-1a, to skip writing unchanged data.
+    ::uint64_t Fingerprint(const unsigned char* data, ::size_t size) noexcept
+    {
+        ::uint64_t hash = 14695981039346656037ull;
+        for (::size_t index = 0; index < size; ++index)
+        {
+            hash = (hash ^ data[index]) * 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    ::std::string StorePath(const char* directory, const VkPhysicalDeviceProperties& properties)
+    {
+        char name[128];
+        int length = ::std::snprintf(name, sizeof(name), "/%08x-%08x-%08x-", properties.vendorID, properties.deviceID, properties.driverVersion);
+        for (::uint32_t index = 0; index < VK_UUID_SIZE; ++index)
+        {
+            length += ::std::snprintf(name + length, sizeof(name) - length, "%02x", properties.pipelineCacheUUID[index]);
+        }
+
+        return ::std::string{ directory } + name + ".pipelinecache";
+    }
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Pipeline cache store
+//------------------------------------------------------------------------------------
+
+struct VulkanDynamicPipelineCacheStore_T final
+{
+    VulkanDynamicPipelineCacheStore_T(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, ::std::string path, Clock::duration writeInterval) noexcept
+        : dispatch_{ dispatch }
+        , device_{ device }
+        , path_{ ::std::move(path) }
+        , writeInterval_{ writeInterval }
+        , lastWrite_{ Clock::now() }
+    {
+    }
+
+    ~VulkanDynamicPipelineCacheStore_T()
+    {
+        if (cache_ != VK_NULL_HANDLE)
+        {
+            Write();
+            dispatch_->DestroyPipelineCache(device_, cache_, nullptr);
+        }
+    }
+
+    VkResult Load(const VkPhysicalDeviceProperties& properties)
+    {
+        VkPipelineCacheCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+
+        // The mapping only has to outlive vkCreatePipelineCache, which copies the data.
+        MappedFile file = ::MappedFileOpen(path_.c_str());
+        if (file)
+        {
+            const unsigned char* data = static_cast<const unsigned char*>(::MappedFileGetAddress(file));
+            const ::size_t size = ::MappedFileGetSize(file);
+            if (::VulkanDynamic::Detail::PipelineCacheMatchesDevice(data, size, properties))
+            {
+                createInfo.initialDataSize = size;
+                createInfo.pInitialData = data;
+                fingerprint_ = Fingerprint(data, size);
+                statistics_.loadedSize = size;
+            }
+            else
+            {
+                statistics_.rejected = VK_TRUE;
+            }
+        }
+
+        VkResult result = dispatch_->CreatePipelineCache(device_, &createInfo, nullptr, &cache_);
+        if (result != VK_SUCCESS && createInfo.initialDataSize)
+        {
+            // Drivers may still refuse data they wrote, e.g. after an update that kept the UUID.
+            createInfo.initialDataSize = 0;
+            createInfo.pInitialData = nullptr;
+            fingerprint_ = 0;
+            statistics_.loadedSize = 0;
+            statistics_.rejected = VK_TRUE;
+            result = dispatch_->CreatePipelineCache(device_, &createInfo, nullptr, &cache_);
+        }
+
+        ::MappedFileClose(file, 0);
+
+        return result;
+    }
+
+    VkPipelineCache Cache() const noexcept
+    {
+        return cache_;
+    }
+
+    VkResult Merge(::uint32_t cacheCount, const VkPipelineCache* caches)
+    {
+        return dispatch_->MergePipelineCaches(device_, cache_, cacheCount, caches);
+    }
+
+    VkResult Update()
+    {
+        return Clock::now() - lastWrite_ < writeInterval_ ? VK_SUCCESS : Write();
+    }
+
+    VkResult Write()
+    {
+        lastWrite_ = Clock::now();
+
+        // Other threads may grow the cache between the size query and the copy, which then
+        // comes back VK_INCOMPLETE with a truncated cache; the data is fetched again.
+        ::size_t size = 0;
+        VkResult result = VK_INCOMPLETE;
+        while (result == VK_INCOMPLETE)
+        {
+            result = dispatch_->GetPipelineCacheData(device_, cache_, &size, nullptr);
+            if (result != VK_SUCCESS)
+            {
+                return result;
+            }
+
+            data_.resize(size);
+            result = dispatch_->GetPipelineCacheData(device_, cache_, &size, data_.data());
+            if (result < 0)
+            {
+                return result;
+            }
+        }
+
+        const ::uint64_t fingerprint = Fingerprint(data_.data(), size);
+        if (size == 0 || fingerprint == fingerprint_)
+        {
+            ++statistics_.skippedWriteCount;
+            return VK_SUCCESS;
+        }
+
+        // Named uniquely so that processes writing the same store do not share a file.
+        char suffix[40];
+        ::std::snprintf(suffix, sizeof(suffix), ".%llx.tmp", static_cast<unsigned long long>(Clock::now().time_since_epoch().count() ^ reinterpret_cast<::uintptr_t>(this)));
+        const ::std::string temporaryPath = path_ + suffix;
+
+        MappedFile file = ::MappedFileCreate(temporaryPath.c_str(), size);
+        if (!file)
+        {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        ::std::memcpy(::MappedFileGetAddress(file), data_.data(), size);
+        const int synced = ::MappedFileSync(file);
+        ::MappedFileClose(file, size);
+
+        if (!synced || !::FileReplace(temporaryPath.c_str(), path_.c_str()))
+        {
+            ::std::remove(temporaryPath.c_str());
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        fingerprint_ = fingerprint;
+        ++statistics_.writeCount;
+        statistics_.writtenSize = size;
+
+        return VK_SUCCESS;
+    }
+
+    const VulkanDynamicPipelineCacheStoreStatistics& Statistics() const noexcept
+    {
+        return statistics_;
+    }
+
+private:
+    const VulkanDynamicDeviceDispatch* dispatch_;
+    VkDevice device_;
+    const ::std::string path_;
+    const Clock::duration writeInterval_;
+    Clock::time_point lastWrite_;
+    VkPipelineCache cache_{ VK_NULL_HANDLE };
+    ::uint64_t fingerprint_{ 0 };
+    ::std::vector<unsigned char> data_;
+    VulkanDynamicPipelineCacheStoreStatistics statistics_{};
+};
+
+//------------------------------------------------------------------------------------
+// Pipeline cache stores
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreatePipelineCacheStore(const VulkanDynamicPhysicalDeviceDispatch* physicalDeviceDispatch, VkPhysicalDevice physicalDevice, const VulkanDynamicDeviceDispatch* deviceDispatch, VkDevice device, const char* directory, uint64_t writeInterval, VulkanDynamicPipelineCacheStore* store)
+{
+    if (!physicalDeviceDispatch || !deviceDispatch || !directory || !store)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    VkPhysicalDeviceProperties properties{};
+    physicalDeviceDispatch->GetPhysicalDeviceProperties(physicalDevice, &properties);
+
+    VulkanDynamicPipelineCacheStore_T* created = new VulkanDynamicPipelineCacheStore_T{ deviceDispatch, device, StorePath(directory, properties),
+        ::std::chrono::duration_cast<Clock::duration>(::std::chrono::nanoseconds{ writeInterval }) };
+
+    const VkResult result = created->Load(properties);
+    if (result != VK_SUCCESS)
+    {
+        delete created;
+        return result;
+    }
+
+    *store = created;
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyPipelineCacheStore(VulkanDynamicPipelineCacheStore store)
+{
+    delete store;
+}
+
+VKAPI_ATTR VkPipelineCache VKAPI_CALL VulkanDynamicGetPipelineCacheStoreCache(VulkanDynamicPipelineCacheStore store)
+{
+    return store ? store->Cache() : VK_NULL_HANDLE;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicMergePipelineCacheStore(VulkanDynamicPipelineCacheStore store, uint32_t cacheCount, const VkPipelineCache* pCaches)
+{
+    if (!store)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return store->Merge(cacheCount, pCaches);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicUpdatePipelineCacheStore(VulkanDynamicPipelineCacheStore store)
+{
+    if (!store)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return store->Update();
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWritePipelineCacheStore(VulkanDynamicPipelineCacheStore store)
+{
+    if (!store)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return store->Write();
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetPipelineCacheStoreStatistics(VulkanDynamicPipelineCacheStore store, VulkanDynamicPipelineCacheStoreStatistics* statistics)
+{
+    if (store && statistics)
+    {
+        *statistics = store->Statistics();
+    }
+}
@@ -0,0 +1,409 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicPipelineCompiler.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using CompileFunction = VkResult (*)(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, VkPipelineCache cache, const void* createInfos, ::uint32_t first, ::uint32_t count, VkPipeline* pipelines);
+
+    VkResult CreatePipelines(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, VkPipelineCache cache, const VkGraphicsPipelineCreateInfo* createInfos, ::uint32_t count, VkPipeline* pipelines)
+    {
+        return dispatch->CreateGraphicsPipelines(device, cache, count, createInfos, nullptr, pipelines);
+    }
+
+    VkResult CreatePipelines(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, VkPipelineCache cache, const VkComputePipelineCreateInfo* createInfos, ::uint32_t count, VkPipeline* pipelines)
+    {
+        return dispatch->CreateComputePipelines(device, cache, count, createInfos, nullptr, pipelines);
+    }
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+    VkResult CreatePipelines(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, VkPipelineCache cache, const VkRayTracingPipelineCreateInfoKHR* createInfos, ::uint32_t count, VkPipeline* pipelines)
+    {
+        return dispatch->CreateRayTracingPipelinesKHR(device, VK_NULL_HANDLE, cache, count, createInfos, nullptr, pipelines);
+    }
+#endif // VK_KHR_ray_tracing_pipeline
+
+    template<typename CreateInfo>
+    VkResult Compile(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, VkPipelineCache cache, const void* createInfos, ::uint32_t first, ::uint32_t count, VkPipeline* pipelines)
+    {
+        return CreatePipelines(dispatch, device, cache, static_cast<const CreateInfo*>(createInfos) + first, count, pipelines + first);
+    }
+
+    // basePipelineIndex refers to the batch, so such batches are not split.
+    template<typename CreateInfo>
+    bool HasDerivatives(::uint32_t createInfoCount, const CreateInfo* createInfos) noexcept
+    {
+        for (::uint32_t index = 0; index < createInfoCount; ++index)
+        {
+            if ((createInfos[index].flags & VK_PIPELINE_CREATE_DERIVATIVE_BIT) && createInfos[index].basePipelineIndex >= 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Freed by the last of its jobs.
+    struct Batch
+    {
+        CompileFunction compile;
+        const void* createInfos;
+        VkPipeline* pipelines;
+        PFN_VulkanDynamicPipelineCallback callback;
+        void* userData;
+        ::std::atomic<::uint32_t> remainingJobs;
+    };
+
+    struct Job
+    {
+        ::int32_t priority;
+        ::uint64_t sequence;
+        Batch* batch;
+        ::uint32_t first;
+        ::uint32_t count;
+
+        // Orders the queue's top as the highest priority, then the earliest passed.
+        bool operator<(const Job& other) const noexcept
+        {
+            return priority != other.priority ? priority < other.priority : sequence > other.sequence;
+        }
+    };
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Pipeline compiler
+//------------------------------------------------------------------------------------
+
+struct VulkanDynamicPipelineCompiler_T final
+{
+    VulkanDynamicPipelineCompiler_T(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, VkPipelineCache pipelineCache) noexcept
+        : dispatch_{ dispatch }
+        , device_{ device }
+        , pipelineCache_{ pipelineCache }
+    {
+    }
+
+    ~VulkanDynamicPipelineCompiler_T()
+    {
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            stopping_ = true;
+        }
+
+        wakeup_.notify_all();
+        for (::std::thread& thread : threads_)
+        {
+            thread.join();
+        }
+
+        Merge();
+
+        for (VkPipelineCache cache : caches_)
+        {
+            dispatch_->DestroyPipelineCache(device_, cache, nullptr);
+        }
+    }
+
+    // Tables without the pipeline cache entry points compile without thread caches, and
+    // ones without vkGetPipelineCacheData start the thread caches empty.
+    VkResult Start(::uint32_t threadCount)
+    {
+        VkPipelineCacheCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+
+        ::std::vector<unsigned char> data;
+        if (pipelineCache_ != VK_NULL_HANDLE && dispatch_->GetPipelineCacheData)
+        {
+            ::size_t size = 0;
+            VkResult result = VK_INCOMPLETE;
+            while (result == VK_INCOMPLETE && dispatch_->GetPipelineCacheData(device_, pipelineCache_, &size, nullptr) == VK_SUCCESS)
+            {
+                data.resize(size);
+                result = dispatch_->GetPipelineCacheData(device_, pipelineCache_, &size, data.data());
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                createInfo.initialDataSize = size;
+                createInfo.pInitialData = data.data();
+            }
+        }
+
+        const bool threadCaches = dispatch_->CreatePipelineCache && dispatch_->DestroyPipelineCache && dispatch_->MergePipelineCaches;
+
+        caches_.reserve(threadCount);
+        for (::uint32_t index = 0; index < threadCount && threadCaches; ++index)
+        {
+            VkPipelineCache cache;
+            const VkResult result = dispatch_->CreatePipelineCache(device_, &createInfo, nullptr, &cache);
+            if (result != VK_SUCCESS)
+            {
+                return result;
+            }
+
+            caches_.push_back(cache);
+        }
+
+        try
+        {
+            threads_.reserve(threadCount);
+            for (::uint32_t index = 0; index < threadCount; ++index)
+            {
+                const VkPipelineCache cache = caches_.empty() ? VK_NULL_HANDLE : caches_[index];
+                threads_.emplace_back([this, cache] { Run(cache); });
+            }
+        }
+        catch (const ::std::system_error&)
+        {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        return VK_SUCCESS;
+    }
+
+    const VulkanDynamicDeviceDispatch* Dispatch() const noexcept
+    {
+        return dispatch_;
+    }
+
+    template<typename CreateInfo>
+    void Push(::int32_t priority, ::uint32_t createInfoCount, const CreateInfo* createInfos, VkPipeline* pipelines, PFN_VulkanDynamicPipelineCallback callback, void* userData)
+    {
+        const bool whole = HasDerivatives(createInfoCount, createInfos);
+        const ::uint32_t jobCount = whole ? 1 : createInfoCount;
+
+        Batch* batch = new Batch{ &Compile<CreateInfo>, createInfos, pipelines, callback, userData, {} };
+        batch->remainingJobs.store(jobCount, ::std::memory_order_relaxed);
+
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            for (::uint32_t index = 0; index < jobCount; ++index)
+            {
+                jobs_.push(Job{ priority, sequence_++, batch, index, whole ? createInfoCount : 1 });
+            }
+
+            outstandingJobs_ += jobCount;
+        }
+
+        if (jobCount == 1)
+        {
+            wakeup_.notify_one();
+        }
+        else
+        {
+            wakeup_.notify_all();
+        }
+    }
+
+    VkResult WaitIdle()
+    {
+        {
+            ::std::unique_lock<::std::mutex> lock{ mutex_ };
+            idle_.wait(lock, [this] { return outstandingJobs_ == 0; });
+        }
+
+        return Merge();
+    }
+
+    void Statistics(VulkanDynamicPipelineCompilerStatistics& statistics) const noexcept
+    {
+        statistics.compiledCount = compiledCount_.load(::std::memory_order_relaxed);
+        statistics.failedCount = failedCount_.load(::std::memory_order_relaxed);
+    }
+
+private:
+    VkResult Merge()
+    {
+        if (pipelineCache_ == VK_NULL_HANDLE || caches_.empty())
+        {
+            return VK_SUCCESS;
+        }
+
+        return dispatch_->MergePipelineCaches(device_, pipelineCache_, static_cast<::uint32_t>(caches_.size()), caches_.data());
+    }
+
+    void Run(VkPipelineCache cache)
+    {
+        for (;;)
+        {
+            Job job;
+            {
+                ::std::unique_lock<::std::mutex> lock{ mutex_ };
+                wakeup_.wait(lock, [this] { return !jobs_.empty() || stopping_; });
+
+                // Outstanding jobs are compiled before the threads stop.
+                if (jobs_.empty())
+                {
+                    return;
+                }
+
+                job = jobs_.top();
+                jobs_.pop();
+            }
+
+            Batch* batch = job.batch;
+            const VkResult result = batch->compile(dispatch_, device_, cache, batch->createInfos, job.first, job.count, batch->pipelines);
+
+            // Failed pipelines of a batch are left VK_NULL_HANDLE and the others created.
+            for (::uint32_t index = job.first; index < job.first + job.count; ++index)
+            {
+                const VkResult pipelineResult = batch->pipelines[index] != VK_NULL_HANDLE ? VK_SUCCESS : result;
+                (pipelineResult == VK_SUCCESS ? compiledCount_ : failedCount_).fetch_add(1, ::std::memory_order_relaxed);
+
+                if (batch->callback)
+                {
+                    batch->callback(batch->userData, index, pipelineResult);
+                }
+            }
+
+            if (batch->remainingJobs.fetch_sub(1, ::std::memory_order_acq_rel) == 1)
+            {
+                delete batch;
+            }
+
+            bool idle;
+            {
+                const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+                idle = --outstandingJobs_ == 0;
+            }
+
+            if (idle)
+            {
+                idle_.notify_all();
+            }
+        }
+    }
+
+private:
+    const VulkanDynamicDeviceDispatch* dispatch_;
+    VkDevice device_;
+    VkPipelineCache pipelineCache_;
+    ::std::vector<VkPipelineCache> caches_;
+    ::std::vector<::std::thread> threads_;
+    ::std::priority_queue<Job> jobs_;
+    ::uint64_t sequence_{ 0 };
+    ::uint64_t outstandingJobs_{ 0 };
+    bool stopping_{ false };
+    ::std::mutex mutex_;
+    ::std::condition_variable wakeup_;
+    ::std::condition_variable idle_;
+    ::std::atomic<::uint64_t> compiledCount_{ 0 };
+    ::std::atomic<::uint64_t> failedCount_{ 0 };
+};
+
+namespace
+{
+    template<typename CreateInfo, typename Function>
+    VkResult Enqueue(VulkanDynamicPipelineCompiler compiler, Function function, ::int32_t priority, ::uint32_t createInfoCount, const CreateInfo* createInfos, VkPipeline* pipelines, PFN_VulkanDynamicPipelineCallback callback, void* userData)
+    {
+        if (!compiler || (createInfoCount && (!createInfos || !pipelines)))
+        {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+
+        if (!function)
+        {
+            return VK_ERROR_EXTENSION_NOT_PRESENT;
+        }
+
+        if (createInfoCount)
+        {
+            compiler->Push(priority, createInfoCount, createInfos, pipelines, callback, userData);
+        }
+
+        return VK_SUCCESS;
+    }
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Pipeline compilers
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreatePipelineCompiler(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, uint32_t threadCount, VkPipelineCache pipelineCache, VulkanDynamicPipelineCompiler* compiler)
+{
+    if (!dispatch || !compiler)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    if (threadCount == 0)
+    {
+        threadCount = ::std::thread::hardware_concurrency();
+        threadCount = threadCount ? threadCount : 1;
+    }
+
+    VulkanDynamicPipelineCompiler_T* created = new VulkanDynamicPipelineCompiler_T{ dispatch, device, pipelineCache };
+
+    const VkResult result = created->Start(threadCount);
+    if (result != VK_SUCCESS)
+    {
+        delete created;
+        return result;
+    }
+
+    *compiler = created;
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyPipelineCompiler(VulkanDynamicPipelineCompiler compiler)
+{
+    delete compiler;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCompileGraphicsPipelines(VulkanDynamicPipelineCompiler compiler, int32_t priority, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, VkPipeline* pPipelines, PFN_VulkanDynamicPipelineCallback callback, void* userData)
+{
+    return Enqueue(compiler, compiler ? compiler->Dispatch()->CreateGraphicsPipelines : nullptr, priority, createInfoCount, pCreateInfos, pPipelines, callback, userData);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCompileComputePipelines(VulkanDynamicPipelineCompiler compiler, int32_t priority, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, VkPipeline* pPipelines, PFN_VulkanDynamicPipelineCallback callback, void* userData)
+{
+    return Enqueue(compiler, compiler ? compiler->Dispatch()->CreateComputePipelines : nullptr, priority, createInfoCount, pCreateInfos, pPipelines, callback, userData);
+}
+
+#if defined(VK_KHR_ray_tracing_pipeline)
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCompileRayTracingPipelinesKHR(VulkanDynamicPipelineCompiler compiler, int32_t priority, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, VkPipeline* pPipelines, PFN_VulkanDynamicPipelineCallback callback, void* userData)
+{
+    return Enqueue(compiler, compiler ? compiler->Dispatch()->CreateRayTracingPipelinesKHR : nullptr, priority, createInfoCount, pCreateInfos, pPipelines, callback, userData);
+}
+#endif // VK_KHR_ray_tracing_pipeline
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWaitPipelineCompilerIdle(VulkanDynamicPipelineCompiler compiler)
+{
+    if (!compiler)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return compiler->WaitIdle();
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetPipelineCompilerStatistics(VulkanDynamicPipelineCompiler compiler, VulkanDynamicPipelineCompilerStatistics* statistics)
+{
+    if (compiler && statistics)
+    {
+        compiler->Statistics(*statistics);
+    }
+}
@@ -0,0 +1,253 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicReactor.h>
+
+#include <Platform/Reactor.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    constexpr ::uint32_t EventBatchSize = 64;
+
+    struct Watch
+    {
+        int fd;
+        PFN_VulkanDynamicCompletionCallback callback;
+        void* userData;
+    };
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Completion reactor
+//------------------------------------------------------------------------------------
+
+struct VulkanDynamicCompletionReactor_T final
+{
+    VulkanDynamicCompletionReactor_T(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, Reactor reactor) noexcept
+        : dispatch_{ dispatch }
+        , device_{ device }
+        , reactor_{ reactor }
+    {
+    }
+
+    ~VulkanDynamicCompletionReactor_T()
+    {
+        for (Watch* watch : watches_)
+        {
+            if (watch->fd >= 0)
+            {
+                ReactorRemove(reactor_, watch->fd);
+            }
+
+            watch->callback(watch->userData, VK_NOT_READY);
+            delete watch;
+        }
+
+        ReactorDestroy(reactor_);
+    }
+
+    int Fd() const noexcept
+    {
+        return ReactorGetFd(reactor_);
+    }
+
+    const VulkanDynamicDeviceDispatch* Dispatch() const noexcept
+    {
+        return dispatch_;
+    }
+
+    VkDevice Device() const noexcept
+    {
+        return device_;
+    }
+
+    // Takes ownership of `fd`. A sync file of -1 stands for an object that had already
+    // signaled; it completes at the next dispatch.
+    VkResult Add(int fd, PFN_VulkanDynamicCompletionCallback callback, void* userData)
+    {
+        ::std::unique_ptr<Watch> watch{ new Watch{ fd, callback, userData } };
+
+        const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+        if (fd < 0)
+        {
+            signaled_.push_back(watch.get());
+            ReactorNotify(reactor_);
+        }
+        else if (!ReactorAdd(reactor_, fd, watch.get()))
+        {
+            ReactorRemove(reactor_, fd);
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+
+        watches_.insert(watch.release());
+
+        return VK_SUCCESS;
+    }
+
+    ::uint32_t DispatchCompletions()
+    {
+        ::uint32_t completedCount = 0;
+
+        ReactorEvent events[EventBatchSize];
+        for (::uint32_t eventCount = EventBatchSize; eventCount == EventBatchSize;)
+        {
+            eventCount = ReactorPoll(reactor_, events, EventBatchSize);
+            for (::uint32_t index = 0; index < eventCount; ++index)
+            {
+                Watch* watch = static_cast<Watch*>(events[index].userData);
+                ReactorRemove(reactor_, watch->fd);
+                Complete(watch, events[index].failed ? VK_ERROR_DEVICE_LOST : VK_SUCCESS);
+            }
+
+            completedCount += eventCount;
+        }
+
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            signaled_.swap(completing_);
+        }
+
+        for (Watch* watch : completing_)
+        {
+            Complete(watch, VK_SUCCESS);
+        }
+
+        completedCount += static_cast<::uint32_t>(completing_.size());
+        completing_.clear();
+
+        return completedCount;
+    }
+
+private:
+    void Complete(Watch* watch, VkResult result)
+    {
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            watches_.erase(watch);
+        }
+
+        watch->callback(watch->userData, result);
+        delete watch;
+    }
+
+private:
+    const VulkanDynamicDeviceDispatch* dispatch_;
+    VkDevice device_;
+    Reactor reactor_;
+    ::std::mutex mutex_;
+    ::std::unordered_set<Watch*> watches_;
+    ::std::vector<Watch*> signaled_;
+    ::std::vector<Watch*> completing_;
+};
+
+//------------------------------------------------------------------------------------
+// Completion reactors
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateCompletionReactor(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, VulkanDynamicCompletionReactor* reactor)
+{
+    if (!dispatch || !reactor)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    const Reactor platformReactor = ReactorCreate();
+    if (!platformReactor)
+    {
+        return VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+
+    *reactor = new VulkanDynamicCompletionReactor_T{ dispatch, device, platformReactor };
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyCompletionReactor(VulkanDynamicCompletionReactor reactor)
+{
+    delete reactor;
+}
+
+VKAPI_ATTR int VKAPI_CALL VulkanDynamicGetCompletionReactorFd(VulkanDynamicCompletionReactor reactor)
+{
+    return reactor ? reactor->Fd() : -1;
+}
+
+#if defined(VK_KHR_external_fence_fd)
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWatchFence(VulkanDynamicCompletionReactor reactor, VkFence fence, PFN_VulkanDynamicCompletionCallback callback, void* userData)
+{
+    if (!reactor || !callback)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    if (!reactor->Dispatch()->GetFenceFdKHR)
+    {
+        return VK_ERROR_EXTENSION_NOT_PRESENT;
+    }
+
+    VkFenceGetFdInfoKHR getFdInfo{};
+    getFdInfo.sType = VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR;
+    getFdInfo.fence = fence;
+    getFdInfo.handleType = VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT;
+
+    int fd = -1;
+    const VkResult result = reactor->Dispatch()->GetFenceFdKHR(reactor->Device(), &getFdInfo, &fd);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    return reactor->Add(fd, callback, userData);
+}
+#endif // VK_KHR_external_fence_fd
+
+#if defined(VK_KHR_external_semaphore_fd)
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWatchSemaphore(VulkanDynamicCompletionReactor reactor, VkSemaphore semaphore, PFN_VulkanDynamicCompletionCallback callback, void* userData)
+{
+    if (!reactor || !callback)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    if (!reactor->Dispatch()->GetSemaphoreFdKHR)
+    {
+        return VK_ERROR_EXTENSION_NOT_PRESENT;
+    }
+
+    VkSemaphoreGetFdInfoKHR getFdInfo{};
+    getFdInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR;
+    getFdInfo.semaphore = semaphore;
+    getFdInfo.handleType = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT;
+
+    int fd = -1;
+    const VkResult result = reactor->Dispatch()->GetSemaphoreFdKHR(reactor->Device(), &getFdInfo, &fd);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    return reactor->Add(fd, callback, userData);
+}
+#endif // VK_KHR_external_semaphore_fd
+
+VKAPI_ATTR uint32_t VKAPI_CALL VulkanDynamicDispatchCompletions(VulkanDynamicCompletionReactor reactor)
+{
+    return reactor ? reactor->DispatchCompletions() : 0;
+}
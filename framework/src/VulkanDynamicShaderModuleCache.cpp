@@ -0,0 +1,241 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicShaderModuleCache.h>
+
+#include "Hash.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using ::VulkanDynamic::Detail::Hash128;
+
+    // The hash finds candidates; the code words decide, so that colliding code never
+    // shares a module. Keys in the cache point to the copy of the code their module keeps,
+    // keys being looked up to the caller's code.
+    struct CodeKey
+    {
+        Hash128 hash;
+        ::size_t size;
+        const ::uint32_t* code;
+
+        bool operator==(const CodeKey& other) const noexcept
+        {
+            return hash == other.hash && size == other.size && ::std::memcmp(code, other.code, size) == 0;
+        }
+    };
+
+    struct CodeKeyHasher
+    {
+        ::size_t operator()(const CodeKey& key) const noexcept
+        {
+            return static_cast<::size_t>(key.hash.low);
+        }
+    };
+
+    struct CachedModule
+    {
+        VkShaderModule module;
+        ::uint64_t referenceCount;
+        ::std::unique_ptr<::uint32_t[]> code;
+    };
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Shader module cache
+//------------------------------------------------------------------------------------
+
+// Code is hashed and modules are created outside the lock. Two threads creating a module
+// for the same code at once both create one; the second to take the lock destroys its own
+// and shares the first.
+struct VulkanDynamicShaderModuleCache_T final
+{
+    VulkanDynamicShaderModuleCache_T(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, const VkAllocationCallbacks* pAllocator) noexcept
+        : dispatch_{ dispatch }
+        , device_{ device }
+        , allocator_{ pAllocator }
+    {
+    }
+
+    ~VulkanDynamicShaderModuleCache_T()
+    {
+        for (const auto& cached : modules_)
+        {
+            dispatch_->DestroyShaderModule(device_, cached.second.module, allocator_);
+        }
+    }
+
+    VkResult Acquire(const VkShaderModuleCreateInfo& createInfo, VkShaderModule& shaderModule)
+    {
+        if (createInfo.pNext || createInfo.flags)
+        {
+            bypassedCount_.fetch_add(1, ::std::memory_order_relaxed);
+            return dispatch_->CreateShaderModule(device_, &createInfo, allocator_, &shaderModule);
+        }
+
+        const CodeKey key{ ::VulkanDynamic::Detail::HashBytes(createInfo.pCode, createInfo.codeSize), createInfo.codeSize, createInfo.pCode };
+        if (Reuse(key, shaderModule))
+        {
+            return VK_SUCCESS;
+        }
+
+        VkShaderModule created;
+        const VkResult result = dispatch_->CreateShaderModule(device_, &createInfo, allocator_, &created);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+
+        ::std::unique_ptr<::uint32_t[]> code{ new ::uint32_t[(createInfo.codeSize + sizeof(::uint32_t) - 1) / sizeof(::uint32_t)] };
+        ::std::memcpy(code.get(), createInfo.pCode, createInfo.codeSize);
+        const CodeKey cachedKey{ key.hash, key.size, code.get() };
+
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            auto inserted = modules_.emplace(cachedKey, CachedModule{ created, 1, ::std::move(code) });
+            if (inserted.second)
+            {
+                keys_.emplace(created, cachedKey);
+                createdCount_.fetch_add(1, ::std::memory_order_relaxed);
+                shaderModule = created;
+                return VK_SUCCESS;
+            }
+
+            ++inserted.first->second.referenceCount;
+            shaderModule = inserted.first->second.module;
+        }
+
+        reusedCount_.fetch_add(1, ::std::memory_order_relaxed);
+        dispatch_->DestroyShaderModule(device_, created, allocator_);
+
+        return VK_SUCCESS;
+    }
+
+    void Release(VkShaderModule shaderModule)
+    {
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            auto key = keys_.find(shaderModule);
+            if (key != keys_.end())
+            {
+                auto cached = modules_.find(key->second);
+                if (--cached->second.referenceCount != 0)
+                {
+                    return;
+                }
+
+                modules_.erase(cached);
+                keys_.erase(key);
+                destroyedCount_.fetch_add(1, ::std::memory_order_relaxed);
+            }
+        }
+
+        // The last reference, or a module that bypassed the cache.
+        dispatch_->DestroyShaderModule(device_, shaderModule, allocator_);
+    }
+
+    void Statistics(VulkanDynamicShaderModuleCacheStatistics& statistics) const noexcept
+    {
+        statistics.createdCount = createdCount_.load(::std::memory_order_relaxed);
+        statistics.reusedCount = reusedCount_.load(::std::memory_order_relaxed);
+        statistics.destroyedCount = destroyedCount_.load(::std::memory_order_relaxed);
+        statistics.bypassedCount = bypassedCount_.load(::std::memory_order_relaxed);
+    }
+
+private:
+    bool Reuse(const CodeKey& key, VkShaderModule& shaderModule)
+    {
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            auto cached = modules_.find(key);
+            if (cached == modules_.end())
+            {
+                return false;
+            }
+
+            ++cached->second.referenceCount;
+            shaderModule = cached->second.module;
+        }
+
+        reusedCount_.fetch_add(1, ::std::memory_order_relaxed);
+
+        return true;
+    }
+
+private:
+    const VulkanDynamicDeviceDispatch* dispatch_;
+    VkDevice device_;
+    const VkAllocationCallbacks* allocator_;
+    ::std::mutex mutex_;
+    ::std::unordered_map<CodeKey, CachedModule, CodeKeyHasher> modules_;
+    ::std::unordered_map<VkShaderModule, CodeKey> keys_;
+    ::std::atomic<::uint64_t> createdCount_{ 0 };
+    ::std::atomic<::uint64_t> reusedCount_{ 0 };
+    ::std::atomic<::uint64_t> destroyedCount_{ 0 };
+    ::std::atomic<::uint64_t> bypassedCount_{ 0 };
+};
+
+//------------------------------------------------------------------------------------
+// Shader module caches
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateShaderModuleCache(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, const VkAllocationCallbacks* pAllocator, VulkanDynamicShaderModuleCache* cache)
+{
+    if (!dispatch || !cache)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    *cache = new VulkanDynamicShaderModuleCache_T{ dispatch, device, pAllocator };
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyShaderModuleCache(VulkanDynamicShaderModuleCache cache)
+{
+    delete cache;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicAcquireShaderModule(VulkanDynamicShaderModuleCache cache, const VkShaderModuleCreateInfo* pCreateInfo, VkShaderModule* pShaderModule)
+{
+    if (!cache || !pCreateInfo || !pShaderModule)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return cache->Acquire(*pCreateInfo, *pShaderModule);
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicReleaseShaderModule(VulkanDynamicShaderModuleCache cache, VkShaderModule shaderModule)
+{
+    if (cache && shaderModule != VK_NULL_HANDLE)
+    {
+        cache->Release(shaderModule);
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetShaderModuleCacheStatistics(VulkanDynamicShaderModuleCache cache, VulkanDynamicShaderModuleCacheStatistics* statistics)
+{
+    if (cache && statistics)
+    {
+        cache->Statistics(*statistics);
+    }
+}
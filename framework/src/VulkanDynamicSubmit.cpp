@@ -0,0 +1,384 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicSubmit.h>
+
+#include "Serialization.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace ::VulkanDynamic::Detail;
+
+    using IssueFunction = VkResult (*)(Reader& reader, const VulkanDynamicDeviceDispatch* dispatch);
+
+    struct Request
+    {
+        ::std::atomic<Request*> next{ nullptr };
+        Request* pooled{ nullptr };
+        IssueFunction issue{ nullptr };
+        PFN_VulkanDynamicSubmitCallback callback{ nullptr };
+        void* userData{ nullptr };
+        ::std::vector<unsigned char> arguments;
+        ::size_t size{ 0 };
+    };
+
+    template<typename Function, Function VulkanDynamicDeviceDispatch::* Member>
+    VkResult Issue(Reader& reader, const VulkanDynamicDeviceDispatch* dispatch)
+    {
+        typename Signature<Function>::Arguments arguments;
+        Signature<Function>::Read(reader, arguments);
+        if (reader.Failed())
+        {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        return Signature<Function>::Invoke(dispatch->*Member, arguments);
+    }
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Submit queue
+//------------------------------------------------------------------------------------
+
+// Requests go through an intrusive multi-producer, single-consumer list: producers swap
+// themselves in as the tail and then link the previous tail to them, and the submit thread
+// follows the links from a node it has already issued. The thread sleeps on a condition
+// variable only when the list is empty, and producers take the mutex only to wake it.
+//
+// Issued requests are recycled, with the capacity of their argument buffers, through a
+// pool the submit thread pushes onto. One producer at a time may pop from it; the others
+// allocate instead of waiting. With a single popper a node cannot leave and come back
+// between the read of the top and the exchange, so the pool has no ABA problem.
+struct VulkanDynamicSubmitQueue_T final
+{
+    VulkanDynamicSubmitQueue_T(const VulkanDynamicDeviceDispatch* dispatch, VkQueue queue) : dispatch_{ dispatch }, queue_{ queue }, head_{ new Request{} }, tail_{ head_ }
+    {
+    }
+
+    ~VulkanDynamicSubmitQueue_T()
+    {
+        delete head_;
+
+        for (Request* request = pool_.load(); request;)
+        {
+            Request* pooled = request->pooled;
+            delete request;
+            request = pooled;
+        }
+    }
+
+    VkResult Start()
+    {
+        try
+        {
+            thread_ = ::std::thread{ [this] { Run(); } };
+        }
+        catch (const ::std::system_error&)
+        {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        return VK_SUCCESS;
+    }
+
+    void Stop()
+    {
+        stopping_.store(true);
+        Wake();
+        thread_.join();
+    }
+
+    const VulkanDynamicDeviceDispatch* Dispatch() const noexcept
+    {
+        return dispatch_;
+    }
+
+    VkQueue Queue() const noexcept
+    {
+        return queue_;
+    }
+
+    ::std::unique_ptr<Request> Allocate()
+    {
+        Request* request = nullptr;
+        if (!popping_.test_and_set(::std::memory_order_acquire))
+        {
+            request = pool_.load(::std::memory_order_acquire);
+            while (request && !pool_.compare_exchange_weak(request, request->pooled, ::std::memory_order_acquire))
+            {
+            }
+
+            popping_.clear(::std::memory_order_release);
+        }
+
+        if (!request)
+        {
+            return ::std::unique_ptr<Request>{ new Request{} };
+        }
+
+        request->next.store(nullptr, ::std::memory_order_relaxed);
+        request->pooled = nullptr;
+        return ::std::unique_ptr<Request>{ request };
+    }
+
+    void Push(Request* request)
+    {
+        enqueued_.fetch_add(1);
+
+        Request* previous = tail_.exchange(request);
+        previous->next.store(request, ::std::memory_order_release);
+
+        if (sleeping_.load())
+        {
+            Wake();
+        }
+    }
+
+    // Requests are issued in list order, and every request linked before the call was
+    // counted before it, so the first `enqueued` issued requests include all of them.
+    void WaitIdle()
+    {
+        const ::uint64_t enqueued = enqueued_.load();
+
+        ::std::unique_lock<::std::mutex> lock{ mutex_ };
+        idleWaiters_.fetch_add(1);
+        idle_.wait(lock, [&] { return issued_.load() >= enqueued; });
+        idleWaiters_.fetch_sub(1);
+    }
+
+    void Statistics(VulkanDynamicSubmitQueueStatistics& statistics) const noexcept
+    {
+        statistics.enqueuedCount = enqueued_.load(::std::memory_order_relaxed);
+        statistics.issuedCount = issued_.load(::std::memory_order_relaxed);
+        statistics.failedCount = failed_.load(::std::memory_order_relaxed);
+    }
+
+private:
+    void Wake()
+    {
+        const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+        wakeup_.notify_one();
+    }
+
+    void Recycle(Request* request) noexcept
+    {
+        request->pooled = pool_.load(::std::memory_order_relaxed);
+        while (!pool_.compare_exchange_weak(request->pooled, request, ::std::memory_order_release, ::std::memory_order_relaxed))
+        {
+        }
+    }
+
+    bool Empty() const noexcept
+    {
+        return tail_.load() == head_;
+    }
+
+    void Run()
+    {
+        Arena decoded;
+
+        for (;;)
+        {
+            Request* request = head_->next.load(::std::memory_order_acquire);
+            if (request)
+            {
+                Recycle(head_);
+                head_ = request;
+
+                Reader reader{ request->arguments.data(), request->size, decoded };
+                const VkResult result = request->issue(reader, dispatch_);
+                decoded.Reset();
+
+                if (result < 0)
+                {
+                    failed_.fetch_add(1, ::std::memory_order_relaxed);
+                }
+
+                if (request->callback)
+                {
+                    request->callback(request->userData, result);
+                }
+
+                issued_.fetch_add(1);
+                if (idleWaiters_.load())
+                {
+                    const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+                    idle_.notify_all();
+                }
+
+                continue;
+            }
+
+            if (!Empty())
+            {
+                // A producer has swapped in the tail but not linked it yet.
+                ::std::this_thread::yield();
+                continue;
+            }
+
+            ::std::unique_lock<::std::mutex> lock{ mutex_ };
+            sleeping_.store(true);
+            wakeup_.wait(lock, [this] { return !Empty() || stopping_.load(); });
+            sleeping_.store(false);
+
+            if (Empty())
+            {
+                return;
+            }
+        }
+    }
+
+private:
+    const VulkanDynamicDeviceDispatch* dispatch_;
+    VkQueue queue_;
+    Request* head_;
+    ::std::atomic<Request*> tail_;
+    ::std::atomic<Request*> pool_{ nullptr };
+    ::std::atomic_flag popping_ = ATOMIC_FLAG_INIT;
+    ::std::atomic<bool> sleeping_{ false };
+    ::std::atomic<bool> stopping_{ false };
+    ::std::atomic<::uint32_t> idleWaiters_{ 0 };
+    ::std::atomic<::uint64_t> enqueued_{ 0 };
+    ::std::atomic<::uint64_t> issued_{ 0 };
+    ::std::atomic<::uint64_t> failed_{ 0 };
+    ::std::mutex mutex_;
+    ::std::condition_variable wakeup_;
+    ::std::condition_variable idle_;
+    ::std::thread thread_;
+};
+
+namespace
+{
+    template<typename Function, Function VulkanDynamicDeviceDispatch::* Member, typename... Args>
+    VkResult Enqueue(VulkanDynamicSubmitQueue submitQueue, PFN_VulkanDynamicSubmitCallback callback, void* userData, Args... args)
+    {
+        if (!(submitQueue->Dispatch()->*Member))
+        {
+            return VK_ERROR_EXTENSION_NOT_PRESENT;
+        }
+
+        ::std::unique_ptr<Request> request = submitQueue->Allocate();
+
+        VectorWriter writer{ request->arguments };
+        Signature<Function>::Write(writer, submitQueue->Queue(), args...);
+        if (writer.Dropped())
+        {
+            return VK_ERROR_FEATURE_NOT_PRESENT;
+        }
+
+        request->issue = &Issue<Function, Member>;
+        request->callback = callback;
+        request->userData = userData;
+        request->size = writer.Size();
+
+        submitQueue->Push(request.release());
+
+        return VK_SUCCESS;
+    }
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Submit queues
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateSubmitQueue(const VulkanDynamicDeviceDispatch* dispatch, VkQueue queue, VulkanDynamicSubmitQueue* submitQueue)
+{
+    if (!dispatch || !submitQueue)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    ::std::unique_ptr<VulkanDynamicSubmitQueue_T> created{ new VulkanDynamicSubmitQueue_T{ dispatch, queue } };
+
+    const VkResult result = created->Start();
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    *submitQueue = created.release();
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroySubmitQueue(VulkanDynamicSubmitQueue submitQueue)
+{
+    if (submitQueue)
+    {
+        submitQueue->Stop();
+        delete submitQueue;
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicEnqueueSubmit(VulkanDynamicSubmitQueue submitQueue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, PFN_VulkanDynamicSubmitCallback callback, void* userData)
+{
+    if (!submitQueue)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return Enqueue<PFN_vkQueueSubmit, &VulkanDynamicDeviceDispatch::QueueSubmit>(submitQueue, callback, userData, submitCount, pSubmits, fence);
+}
+
+#if defined(VK_KHR_synchronization2)
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicEnqueueSubmit2KHR(VulkanDynamicSubmitQueue submitQueue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits, VkFence fence, PFN_VulkanDynamicSubmitCallback callback, void* userData)
+{
+    if (!submitQueue)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return Enqueue<PFN_vkQueueSubmit2KHR, &VulkanDynamicDeviceDispatch::QueueSubmit2KHR>(submitQueue, callback, userData, submitCount, pSubmits, fence);
+}
+#endif // VK_KHR_synchronization2
+
+#if defined(VK_KHR_swapchain)
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicEnqueuePresentKHR(VulkanDynamicSubmitQueue submitQueue, const VkPresentInfoKHR* pPresentInfo, PFN_VulkanDynamicSubmitCallback callback, void* userData)
+{
+    if (!submitQueue || !pPresentInfo)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    // pResults is the caller's and may be gone by the time the present is issued.
+    VkPresentInfoKHR presentInfo = *pPresentInfo;
+    presentInfo.pResults = nullptr;
+
+    return Enqueue<PFN_vkQueuePresentKHR, &VulkanDynamicDeviceDispatch::QueuePresentKHR>(submitQueue, callback, userData, &presentInfo);
+}
+#endif // VK_KHR_swapchain
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicWaitSubmitQueueIdle(VulkanDynamicSubmitQueue submitQueue)
+{
+    if (submitQueue)
+    {
+        submitQueue->WaitIdle();
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetSubmitQueueStatistics(VulkanDynamicSubmitQueue submitQueue, VulkanDynamicSubmitQueueStatistics* statistics)
+{
+    if (submitQueue && statistics)
+    {
+        submitQueue->Statistics(*statistics);
+    }
+}
@@ -0,0 +1,556 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicSyncPool.h>
+
+#include "Aligned.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    using namespace ::VulkanDynamic::Detail;
+
+    // Released fences are reset this many at a time.
+    constexpr ::size_t FenceResetBatchSize = 32;
+
+    // Free lists longer than this give their upper half to the pool; empty ones take up to
+    // half of it back.
+    constexpr ::size_t LocalCapacity = 64;
+
+    // Counters have a single writing thread, so increments need no read-modify-write.
+    inline void Increment(::std::atomic<::uint64_t>& counter) noexcept
+    {
+        counter.store(counter.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+    }
+
+    struct ObjectCounters
+    {
+        ::std::atomic<::uint64_t> createdCount{ 0 };
+        ::std::atomic<::uint64_t> reusedCount{ 0 };
+        ::std::atomic<::uint64_t> releasedCount{ 0 };
+
+        void Add(VulkanDynamicSyncObjectStatistics& statistics) const noexcept
+        {
+            statistics.createdCount += createdCount.load(::std::memory_order_relaxed);
+            statistics.reusedCount += reusedCount.load(::std::memory_order_relaxed);
+            statistics.releasedCount += releasedCount.load(::std::memory_order_relaxed);
+        }
+    };
+
+    template<typename Handle>
+    struct FreeList
+    {
+        ::std::vector<Handle> objects;
+        ObjectCounters counters;
+    };
+
+    struct alignas(64) LocalLists
+    {
+        FreeList<VkFence> fences;
+        ::std::vector<VkFence> releasedFences;
+        FreeList<VkSemaphore> semaphores;
+        FreeList<VkSemaphore> timelineSemaphores;
+        ::std::atomic<::uint64_t> fenceResetCallCount{ 0 };
+    };
+
+    struct ThreadSlot
+    {
+        VulkanDynamicSyncPool_T* pool;
+        LocalLists* lists;
+    };
+
+    // The lists a thread holds in each live pool. Pools remove their slot when destroyed,
+    // and exiting threads hand their lists back, so the lock is only contended then.
+    struct ThreadSlots
+    {
+        ::std::mutex mutex;
+        ::std::vector<ThreadSlot> slots;
+    };
+
+    // Owns the slots of one thread and hands its lists back to their pools when the thread
+    // exits. The slots stay alive meanwhile, so a pool being destroyed waits on their lock.
+    struct ThreadRegistration
+    {
+        ::std::shared_ptr<ThreadSlots> thread{ ::std::make_shared<ThreadSlots>() };
+
+        ~ThreadRegistration();
+    };
+
+    // The lists last looked up by a thread. Pools are told apart by a generation as well as
+    // by address, since a new pool may be allocated where a destroyed one was.
+    struct LocalCache
+    {
+        const VulkanDynamicSyncPool_T* pool{ nullptr };
+        ::uint64_t generation{ 0 };
+        LocalLists* lists{ nullptr };
+    };
+
+    struct RegisteredLists
+    {
+        AlignedPointer<LocalLists> lists;
+        ::std::weak_ptr<ThreadSlots> thread;
+    };
+
+    ::std::atomic<::uint64_t> poolGeneration{ 0 };
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Sync pool
+//------------------------------------------------------------------------------------
+
+struct VulkanDynamicSyncPool_T final
+{
+    VulkanDynamicSyncPool_T(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, const VkAllocationCallbacks* pAllocator) noexcept
+        : dispatch_{ dispatch }
+        , device_{ device }
+        , allocator_{ pAllocator }
+        , generation_{ poolGeneration.fetch_add(1) + 1 }
+    {
+#if defined(VK_VERSION_1_2)
+#if defined(VK_KHR_timeline_semaphore)
+        getCounterValue_ = dispatch->GetSemaphoreCounterValueKHR;
+#endif // VK_KHR_timeline_semaphore
+        if (!getCounterValue_)
+        {
+            getCounterValue_ = dispatch->GetSemaphoreCounterValue;
+        }
+#endif // VK_VERSION_1_2
+    }
+
+    // Slots are removed first: a thread exiting meanwhile hands its lists back under its
+    // slot lock, which is taken without holding the pool lock.
+    ~VulkanDynamicSyncPool_T()
+    {
+        ::std::vector<::std::weak_ptr<ThreadSlots>> threads;
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            for (const RegisteredLists& registered : locals_)
+            {
+                threads.push_back(registered.thread);
+            }
+        }
+
+        for (const ::std::weak_ptr<ThreadSlots>& registered : threads)
+        {
+            const ::std::shared_ptr<ThreadSlots> thread = registered.lock();
+            if (thread)
+            {
+                const ::std::lock_guard<::std::mutex> lock{ thread->mutex };
+                for (::size_t index = 0; index < thread->slots.size(); ++index)
+                {
+                    if (thread->slots[index].pool == this)
+                    {
+                        thread->slots[index] = thread->slots.back();
+                        thread->slots.pop_back();
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (const RegisteredLists& registered : locals_)
+        {
+            const AlignedPointer<LocalLists>& local = registered.lists;
+            DestroyFences(local->fences.objects);
+            DestroyFences(local->releasedFences);
+            DestroySemaphores(local->semaphores.objects);
+            DestroySemaphores(local->timelineSemaphores.objects);
+        }
+
+        DestroyFences(fences_);
+        DestroySemaphores(semaphores_);
+        DestroySemaphores(timelineSemaphores_);
+    }
+
+    VkResult AcquireFence(VkFence* pFence)
+    {
+        LocalLists& local = Local();
+        if (local.fences.objects.empty() && !local.releasedFences.empty())
+        {
+            ResetFences(local);
+        }
+
+        return Acquire(local.fences, fences_, pFence, [this](VkFence* fence)
+        {
+            VkFenceCreateInfo createInfo{};
+            createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            return dispatch_->CreateFence(device_, &createInfo, allocator_, fence);
+        });
+    }
+
+    void ReleaseFence(VkFence fence)
+    {
+        LocalLists& local = Local();
+        local.releasedFences.push_back(fence);
+        Increment(local.fences.counters.releasedCount);
+
+        if (local.releasedFences.size() >= FenceResetBatchSize)
+        {
+            ResetFences(local);
+        }
+    }
+
+    VkResult AcquireSemaphore(VkSemaphore* pSemaphore)
+    {
+        return Acquire(Local().semaphores, semaphores_, pSemaphore, [this](VkSemaphore* semaphore)
+        {
+            VkSemaphoreCreateInfo createInfo{};
+            createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            return dispatch_->CreateSemaphore(device_, &createInfo, allocator_, semaphore);
+        });
+    }
+
+    void ReleaseSemaphore(VkSemaphore semaphore)
+    {
+        Release(Local().semaphores, semaphores_, semaphore);
+    }
+
+    VkResult AcquireTimelineSemaphore(VkSemaphore* pSemaphore, ::uint64_t* pValue)
+    {
+#if defined(VK_VERSION_1_2)
+        if (!getCounterValue_)
+        {
+            return VK_ERROR_EXTENSION_NOT_PRESENT;
+        }
+
+        // Created semaphores start at 0; reused ones are where their last signal left them.
+        bool created = false;
+        FreeList<VkSemaphore>& list = Local().timelineSemaphores;
+        VkResult result = Acquire(list, timelineSemaphores_, pSemaphore, [&](VkSemaphore* semaphore)
+        {
+            VkSemaphoreTypeCreateInfo typeCreateInfo{};
+            typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+            typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+
+            VkSemaphoreCreateInfo createInfo{};
+            createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            createInfo.pNext = &typeCreateInfo;
+
+            created = true;
+            return dispatch_->CreateSemaphore(device_, &createInfo, allocator_, semaphore);
+        });
+
+        if (result != VK_SUCCESS || created)
+        {
+            *pValue = 0;
+            return result;
+        }
+
+        result = getCounterValue_(device_, *pSemaphore, pValue);
+        if (result != VK_SUCCESS)
+        {
+            list.objects.push_back(*pSemaphore);
+        }
+
+        return result;
+#else
+        (void)pSemaphore;
+        (void)pValue;
+        return VK_ERROR_EXTENSION_NOT_PRESENT;
+#endif // VK_VERSION_1_2
+    }
+
+    void ReleaseTimelineSemaphore(VkSemaphore semaphore)
+    {
+        Release(Local().timelineSemaphores, timelineSemaphores_, semaphore);
+    }
+
+    void Statistics(VulkanDynamicSyncPoolStatistics& statistics)
+    {
+        const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+        statistics = retired_;
+
+        for (const RegisteredLists& registered : locals_)
+        {
+            const AlignedPointer<LocalLists>& local = registered.lists;
+            local->fences.counters.Add(statistics.fences);
+            local->semaphores.counters.Add(statistics.semaphores);
+            local->timelineSemaphores.counters.Add(statistics.timelineSemaphores);
+            statistics.fenceResetCallCount += local->fenceResetCallCount.load(::std::memory_order_relaxed);
+        }
+    }
+
+    // Called by an exiting thread under its slot lock. Its objects and counters move to the
+    // pool, and its lists are freed.
+    void Retire(LocalLists* local)
+    {
+        if (!local->releasedFences.empty())
+        {
+            ResetFences(*local);
+        }
+
+        const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+        fences_.insert(fences_.end(), local->fences.objects.begin(), local->fences.objects.end());
+        semaphores_.insert(semaphores_.end(), local->semaphores.objects.begin(), local->semaphores.objects.end());
+        timelineSemaphores_.insert(timelineSemaphores_.end(), local->timelineSemaphores.objects.begin(), local->timelineSemaphores.objects.end());
+
+        local->fences.counters.Add(retired_.fences);
+        local->semaphores.counters.Add(retired_.semaphores);
+        local->timelineSemaphores.counters.Add(retired_.timelineSemaphores);
+        retired_.fenceResetCallCount += local->fenceResetCallCount.load(::std::memory_order_relaxed);
+
+        for (::size_t index = 0; index < locals_.size(); ++index)
+        {
+            if (locals_[index].lists.get() == local)
+            {
+                locals_[index] = ::std::move(locals_.back());
+                locals_.pop_back();
+                break;
+            }
+        }
+    }
+
+private:
+    // The common case, a thread using the same pool as on its previous call, is one compare
+    // against a thread-local cache. Other pools are found in the thread's slots.
+    LocalLists& Local()
+    {
+        thread_local LocalCache cache;
+        if (cache.pool == this && cache.generation == generation_)
+        {
+            return *cache.lists;
+        }
+
+        thread_local const ThreadRegistration registration;
+        const ::std::shared_ptr<ThreadSlots>& thread = registration.thread;
+
+        LocalLists* local = nullptr;
+        {
+            const ::std::lock_guard<::std::mutex> lock{ thread->mutex };
+            for (const ThreadSlot& slot : thread->slots)
+            {
+                if (slot.pool == this)
+                {
+                    local = slot.lists;
+                    break;
+                }
+            }
+        }
+
+        if (!local)
+        {
+            AlignedPointer<LocalLists> lists = MakeAligned<LocalLists>();
+            local = lists.get();
+            {
+                const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+                locals_.push_back(RegisteredLists{ ::std::move(lists), thread });
+            }
+
+            const ::std::lock_guard<::std::mutex> lock{ thread->mutex };
+            thread->slots.push_back(ThreadSlot{ this, local });
+        }
+
+        cache.pool = this;
+        cache.generation = generation_;
+        cache.lists = local;
+        return *local;
+    }
+
+    template<typename Handle, typename Create>
+    VkResult Acquire(FreeList<Handle>& list, ::std::vector<Handle>& shared, Handle* handle, Create create)
+    {
+        if (list.objects.empty())
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            const ::size_t count = shared.size() < LocalCapacity / 2 ? shared.size() : LocalCapacity / 2;
+            list.objects.insert(list.objects.end(), shared.end() - count, shared.end());
+            shared.resize(shared.size() - count);
+        }
+
+        if (!list.objects.empty())
+        {
+            *handle = list.objects.back();
+            list.objects.pop_back();
+            Increment(list.counters.reusedCount);
+            return VK_SUCCESS;
+        }
+
+        const VkResult result = create(handle);
+        if (result == VK_SUCCESS)
+        {
+            Increment(list.counters.createdCount);
+        }
+
+        return result;
+    }
+
+    template<typename Handle>
+    void Release(FreeList<Handle>& list, ::std::vector<Handle>& shared, Handle handle)
+    {
+        list.objects.push_back(handle);
+        Increment(list.counters.releasedCount);
+        Spill(list.objects, shared);
+    }
+
+    template<typename Handle>
+    void Spill(::std::vector<Handle>& objects, ::std::vector<Handle>& shared)
+    {
+        if (objects.size() > LocalCapacity)
+        {
+            const ::size_t count = objects.size() / 2;
+
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            shared.insert(shared.end(), objects.end() - count, objects.end());
+            objects.resize(objects.size() - count);
+        }
+    }
+
+    void ResetFences(LocalLists& local)
+    {
+        const VkResult result = dispatch_->ResetFences(device_, static_cast<::uint32_t>(local.releasedFences.size()), local.releasedFences.data());
+        Increment(local.fenceResetCallCount);
+
+        if (result == VK_SUCCESS)
+        {
+            local.fences.objects.insert(local.fences.objects.end(), local.releasedFences.begin(), local.releasedFences.end());
+        }
+        else
+        {
+            DestroyFences(local.releasedFences);
+        }
+
+        local.releasedFences.clear();
+        Spill(local.fences.objects, fences_);
+    }
+
+    void DestroyFences(const ::std::vector<VkFence>& fences) const
+    {
+        for (VkFence fence : fences)
+        {
+            dispatch_->DestroyFence(device_, fence, allocator_);
+        }
+    }
+
+    void DestroySemaphores(const ::std::vector<VkSemaphore>& semaphores) const
+    {
+        for (VkSemaphore semaphore : semaphores)
+        {
+            dispatch_->DestroySemaphore(device_, semaphore, allocator_);
+        }
+    }
+
+private:
+    const VulkanDynamicDeviceDispatch* dispatch_;
+    VkDevice device_;
+    const VkAllocationCallbacks* allocator_;
+    const ::uint64_t generation_;
+#if defined(VK_VERSION_1_2)
+    PFN_vkGetSemaphoreCounterValue getCounterValue_{ nullptr };
+#endif // VK_VERSION_1_2
+    ::std::mutex mutex_;
+    ::std::vector<RegisteredLists> locals_;
+    VulkanDynamicSyncPoolStatistics retired_{};
+    ::std::vector<VkFence> fences_;
+    ::std::vector<VkSemaphore> semaphores_;
+    ::std::vector<VkSemaphore> timelineSemaphores_;
+};
+
+ThreadRegistration::~ThreadRegistration()
+{
+    const ::std::lock_guard<::std::mutex> lock{ thread->mutex };
+    for (const ThreadSlot& slot : thread->slots)
+    {
+        slot.pool->Retire(slot.lists);
+    }
+
+    thread->slots.clear();
+}
+
+//------------------------------------------------------------------------------------
+// Sync pools
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateSyncPool(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, const VkAllocationCallbacks* pAllocator, VulkanDynamicSyncPool* pool)
+{
+    if (!dispatch || !pool)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    *pool = new VulkanDynamicSyncPool_T{ dispatch, device, pAllocator };
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroySyncPool(VulkanDynamicSyncPool pool)
+{
+    delete pool;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicAcquireFence(VulkanDynamicSyncPool pool, VkFence* pFence)
+{
+    if (!pool || !pFence)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return pool->AcquireFence(pFence);
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicReleaseFence(VulkanDynamicSyncPool pool, VkFence fence)
+{
+    if (pool && fence != VK_NULL_HANDLE)
+    {
+        pool->ReleaseFence(fence);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicAcquireSemaphore(VulkanDynamicSyncPool pool, VkSemaphore* pSemaphore)
+{
+    if (!pool || !pSemaphore)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return pool->AcquireSemaphore(pSemaphore);
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicReleaseSemaphore(VulkanDynamicSyncPool pool, VkSemaphore semaphore)
+{
+    if (pool && semaphore != VK_NULL_HANDLE)
+    {
+        pool->ReleaseSemaphore(semaphore);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicAcquireTimelineSemaphore(VulkanDynamicSyncPool pool, VkSemaphore* pSemaphore, uint64_t* pValue)
+{
+    if (!pool || !pSemaphore || !pValue)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return pool->AcquireTimelineSemaphore(pSemaphore, pValue);
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicReleaseTimelineSemaphore(VulkanDynamicSyncPool pool, VkSemaphore semaphore)
+{
+    if (pool && semaphore != VK_NULL_HANDLE)
+    {
+        pool->ReleaseTimelineSemaphore(semaphore);
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetSyncPoolStatistics(VulkanDynamicSyncPool pool, VulkanDynamicSyncPoolStatistics* statistics)
+{
+    if (pool && statistics)
+    {
+        pool->Statistics(*statistics);
+    }
+}
@@ -0,0 +1,497 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicTrace.h>
+#include <Platform/Thread.h>
+
+#include "Aligned.hpp"
+#include "Interposer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = ::std::chrono::steady_clock;
+
+    enum EventSource : ::uint32_t
+    {
+        EVENT_SOURCE_ZONE,
+        EVENT_SOURCE_INSTANCE,
+        EVENT_SOURCE_DEVICE,
+    };
+
+    struct Event
+    {
+        ::uint64_t begin;
+        ::uint64_t end;
+        const char* zoneName;
+        ::uint32_t source;
+        ::uint32_t functionId;
+    };
+
+    inline ::uint64_t Now() noexcept
+    {
+        return static_cast<::uint64_t>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+    }
+
+    // Single-producer single-consumer ring: the traced thread pushes, the flush thread drains.
+    class Ring
+    {
+    public:
+        Ring(::uint64_t threadId, ::uint32_t capacity) : threadId_{ threadId }, mask_{ capacity - 1 }, events_{ new Event[capacity] }
+        {
+        }
+
+        void Push(const Event& event) noexcept
+        {
+            const ::uint64_t head = head_.load(::std::memory_order_relaxed);
+            if (head - tail_.load(::std::memory_order_acquire) > mask_)
+            {
+                dropped_.store(dropped_.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+                return;
+            }
+
+            events_[head & mask_] = event;
+            head_.store(head + 1, ::std::memory_order_release);
+        }
+
+        template<typename Consumer>
+        void Drain(Consumer&& consumer)
+        {
+            ::uint64_t tail = tail_.load(::std::memory_order_relaxed);
+            const ::uint64_t head = head_.load(::std::memory_order_acquire);
+            for (; tail != head; ++tail)
+            {
+                consumer(threadId_, events_[tail & mask_]);
+            }
+
+            tail_.store(tail, ::std::memory_order_release);
+        }
+
+        // Consumer side, like Drain. The producer may still be pushing, so its drop count
+        // is never written here: the count seen now becomes the baseline of the next trace.
+        void Discard() noexcept
+        {
+            tail_.store(head_.load(::std::memory_order_acquire), ::std::memory_order_release);
+            droppedBase_ = dropped_.load(::std::memory_order_relaxed);
+        }
+
+        ::uint64_t Dropped() const noexcept
+        {
+            return dropped_.load(::std::memory_order_relaxed) - droppedBase_;
+        }
+
+    private:
+        const ::uint64_t threadId_;
+        const ::uint64_t mask_;
+        const ::std::unique_ptr<Event[]> events_;
+        ::uint64_t droppedBase_{ 0 };
+        alignas(64) ::std::atomic<::uint64_t> head_{ 0 };
+        ::std::atomic<::uint64_t> dropped_{ 0 };
+        alignas(64) ::std::atomic<::uint64_t> tail_{ 0 };
+    };
+
+    class Tracer
+    {
+    public:
+        static Tracer& Get() noexcept
+        {
+            static Tracer tracer;
+            return tracer;
+        }
+
+        bool Active() const noexcept
+        {
+            return active_.load(::std::memory_order_relaxed);
+        }
+
+        void Record(const Event& event) noexcept
+        {
+            thread_local Ring* ring = nullptr;
+            if (!ring)
+            {
+                ring = Register();
+            }
+
+            ring->Push(event);
+        }
+
+        ::VkResult Begin(const char* fileName, ::uint32_t ringCapacity)
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            if (file_)
+            {
+                return ::VK_ERROR_INITIALIZATION_FAILED;
+            }
+
+            file_ = ::std::fopen(fileName, "w");
+            if (!file_)
+            {
+                return ::VK_ERROR_INITIALIZATION_FAILED;
+            }
+
+            ringCapacity_ = 1;
+            while (ringCapacity_ < ringCapacity)
+            {
+                ringCapacity_ <<= 1;
+            }
+
+            for (const auto& ring : rings_)
+            {
+                ring->Discard();
+            }
+
+            ::std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file_);
+            firstEvent_ = true;
+            start_ = Now();
+            stop_ = false;
+            flushThread_ = ::std::thread{ &Tracer::Flush, this };
+            active_.store(true, ::std::memory_order_relaxed);
+
+            return ::VK_SUCCESS;
+        }
+
+        ::VkResult End()
+        {
+            ::std::unique_lock<::std::mutex> lock{ mutex_ };
+            if (!file_ || stop_)
+            {
+                return ::VK_NOT_READY;
+            }
+
+            active_.store(false, ::std::memory_order_relaxed);
+            stop_ = true;
+            lock.unlock();
+
+            condition_.notify_one();
+            flushThread_.join();
+
+            lock.lock();
+            const ::std::vector<Ring*> rings = Rings();
+            lock.unlock();
+
+            ::std::string text;
+            DrainAll(rings, text);
+
+            ::uint64_t dropped = 0;
+            for (Ring* ring : rings)
+            {
+                dropped += ring->Dropped();
+            }
+
+            lock.lock();
+            ::std::fprintf(file_, "%s{\"name\":\"VulkanDynamic dropped events\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":0,\"args\":{\"count\":%llu}}\n]}\n",
+                firstEvent_ ? "" : ",", (Now() - start_) / 1000.0, static_cast<unsigned long long>(dropped));
+            ::std::fclose(file_);
+            file_ = nullptr;
+
+            return ::VK_SUCCESS;
+        }
+
+        ~Tracer()
+        {
+            End();
+        }
+
+    private:
+        Ring* Register()
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+
+            // Rings of exited threads are kept: the flush thread may still be draining them.
+            rings_.push_back(::VulkanDynamic::Detail::MakeAligned<Ring>(::ThreadCurrentId(), ringCapacity_));
+            return rings_.back().get();
+        }
+
+        ::std::vector<Ring*> Rings() const
+        {
+            ::std::vector<Ring*> rings;
+            rings.reserve(rings_.size());
+            for (const auto& ring : rings_)
+            {
+                rings.push_back(ring.get());
+            }
+
+            return rings;
+        }
+
+        void Flush()
+        {
+            ::std::vector<Ring*> rings;
+            ::std::string text;
+
+            ::std::unique_lock<::std::mutex> lock{ mutex_ };
+            while (!stop_)
+            {
+                condition_.wait_for(lock, ::std::chrono::milliseconds{ 10 });
+
+                // Only the ring list is guarded: a thread registering its ring must not
+                // wait for formatting and file I/O.
+                rings = Rings();
+                lock.unlock();
+                DrainAll(rings, text);
+                lock.lock();
+            }
+        }
+
+        // Called by the flush thread, or by End once it has joined: the rings' consumer
+        // side, the file and the formatting state have a single user at a time.
+        void DrainAll(const ::std::vector<Ring*>& rings, ::std::string& text)
+        {
+            for (Ring* ring : rings)
+            {
+                ring->Drain([this, &text](::uint64_t threadId, const Event& event) { Write(text, threadId, event); });
+            }
+
+            ::std::fwrite(text.data(), 1, text.size(), file_);
+            ::std::fflush(file_);
+            text.clear();
+        }
+
+        void Write(::std::string& text, ::uint64_t threadId, const Event& event)
+        {
+            // Events recorded before this trace began still sit in rings of idle threads.
+            if (event.begin < start_)
+            {
+                return;
+            }
+
+            const char* name = event.zoneName;
+            const char* category = "zone";
+            if (event.source == EVENT_SOURCE_INSTANCE)
+            {
+                name = ::VulkanDynamicGetInstanceFunctionName(event.functionId);
+                category = "vulkan.instance";
+            }
+            else if (event.source == EVENT_SOURCE_DEVICE)
+            {
+                name = ::VulkanDynamicGetDeviceFunctionName(event.functionId);
+                category = "vulkan.device";
+            }
+
+            text += firstEvent_ ? "{\"name\":\"" : ",{\"name\":\"";
+            WriteEscaped(text, name ? name : "unknown");
+
+            char fields[256];
+            ::std::snprintf(fields, sizeof(fields), "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%llu}\n",
+                category, (event.begin - start_) / 1000.0, (event.end - event.begin) / 1000.0, static_cast<unsigned long long>(threadId));
+            text += fields;
+            firstEvent_ = false;
+        }
+
+        static void WriteEscaped(::std::string& text, const char* string)
+        {
+            for (; *string; ++string)
+            {
+                const unsigned char character = static_cast<unsigned char>(*string);
+                if (character == '"' || character == '\\')
+                {
+                    text += '\\';
+                    text += static_cast<char>(character);
+                }
+                else if (character < 0x20)
+                {
+                    char escaped[8];
+                    ::std::snprintf(escaped, sizeof(escaped), "\\u%04x", character);
+                    text += escaped;
+                }
+                else
+                {
+                    text += static_cast<char>(character);
+                }
+            }
+        }
+
+    private:
+        ::std::atomic<bool> active_{ false };
+        ::std::mutex mutex_;
+        ::std::condition_variable condition_;
+        ::std::vector<::VulkanDynamic::Detail::AlignedPointer<Ring>> rings_;
+        ::uint32_t ringCapacity_{ 1u << 16 };
+        ::std::FILE* file_{ nullptr };
+        ::std::thread flushThread_;
+        ::uint64_t start_{ 0 };
+        bool stop_{ false };
+        bool firstEvent_{ true };
+    };
+
+    template<typename Traits>
+    class Trace
+    {
+    public:
+        using Table = typename Traits::Table;
+
+        class Scope
+        {
+        public:
+            explicit Scope(::uint32_t functionId) noexcept : functionId_{ functionId }, active_{ Tracer::Get().Active() }, begin_{ active_ ? Now() : 0 }
+            {
+            }
+
+            ~Scope() noexcept
+            {
+                if (active_)
+                {
+                    Tracer::Get().Record(Event{ begin_, Now(), nullptr, Traits::Source, functionId_ });
+                }
+            }
+
+        private:
+            const ::uint32_t functionId_;
+            const bool active_;
+            const ::uint64_t begin_;
+        };
+
+        static const Table* Next() noexcept
+        {
+            return next_.load(::std::memory_order_acquire);
+        }
+
+        static ::VkResult Forward(const Table* next) noexcept
+        {
+            return ::VulkanDynamic::Detail::BindNext(next_, next);
+        }
+
+    private:
+        static ::std::atomic<const Table*> next_;
+    };
+
+    template<typename Traits>
+    ::std::atomic<const typename Trace<Traits>::Table*> Trace<Traits>::next_{ nullptr };
+
+    struct InstanceTraits
+    {
+        using Table = ::VulkanDynamicInstanceDispatch;
+        static constexpr ::uint32_t Source = EVENT_SOURCE_INSTANCE;
+    };
+
+    struct DeviceTraits
+    {
+        using Table = ::VulkanDynamicDeviceDispatch;
+        static constexpr ::uint32_t Source = EVENT_SOURCE_DEVICE;
+    };
+
+    using InstanceTrace = Trace<InstanceTraits>;
+    using DeviceTrace = Trace<DeviceTraits>;
+
+    struct ZoneStack
+    {
+        static constexpr ::uint32_t MaxDepth = 64;
+
+        const char* names[MaxDepth];
+        ::uint64_t begins[MaxDepth];
+        ::uint32_t depth;
+    };
+
+    thread_local ZoneStack zones{};
+} // namespace
+
+#define VULKANDYNAMIC_TRACE_INSTANCE_FUNCTION(function) VULKANDYNAMIC_INTERPOSE_FUNCTION(InstanceTrace, INSTANCE, next, tracedDispatch, function)
+#define VULKANDYNAMIC_TRACE_DEVICE_FUNCTION(function) VULKANDYNAMIC_INTERPOSE_FUNCTION(DeviceTrace, DEVICE, next, tracedDispatch, function)
+
+//------------------------------------------------------------------------------------
+// Dispatch
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicTraceInstanceDispatch(const VulkanDynamicInstanceDispatch* next, VulkanDynamicInstanceDispatch* tracedDispatch)
+{
+    if (!next || !tracedDispatch)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    const VkResult result = InstanceTrace::Forward(next);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    VULKANDYNAMIC_INSTANCE_FUNCTIONS(VULKANDYNAMIC_TRACE_INSTANCE_FUNCTION)
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicTraceDeviceDispatch(const VulkanDynamicDeviceDispatch* next, VulkanDynamicDeviceDispatch* tracedDispatch)
+{
+    if (!next || !tracedDispatch)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    const VkResult result = DeviceTrace::Forward(next);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    VULKANDYNAMIC_DEVICE_FUNCTIONS(VULKANDYNAMIC_TRACE_DEVICE_FUNCTION)
+
+    return VK_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------
+// Session
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicBeginTrace(const char* fileName, uint32_t ringCapacity)
+{
+    if (!fileName || ringCapacity == 0 || ringCapacity > (1u << 31))
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return Tracer::Get().Begin(fileName, ringCapacity);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicEndTrace(void)
+{
+    return Tracer::Get().End();
+}
+
+//------------------------------------------------------------------------------------
+// Zones
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicTraceBeginZone(const char* name)
+{
+    if (zones.depth < ZoneStack::MaxDepth)
+    {
+        zones.names[zones.depth] = name;
+        zones.begins[zones.depth] = Now();
+    }
+
+    ++zones.depth;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicTraceEndZone(void)
+{
+    if (zones.depth == 0)
+    {
+        return;
+    }
+
+    --zones.depth;
+    if (zones.depth < ZoneStack::MaxDepth && Tracer::Get().Active())
+    {
+        Tracer::Get().Record(Event{ zones.begins[zones.depth], Now(), zones.names[zones.depth], EVENT_SOURCE_ZONE, 0 });
+    }
+}
@@ -0,0 +1,385 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicWait.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Shorter fence waits would keep the thread spinning while fences are outstanding.
+    constexpr ::uint64_t MinimumFenceWaitTimeout = 1000000;
+
+    struct Wait
+    {
+        VkFence fence;
+        VkSemaphore semaphore;
+        ::uint64_t value;
+        PFN_VulkanDynamicWaitCallback callback;
+        void* userData;
+    };
+} // namespace
+
+//------------------------------------------------------------------------------------
+// Waiter
+//------------------------------------------------------------------------------------
+
+struct VulkanDynamicWaiter_T final
+{
+    VulkanDynamicWaiter_T(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, ::uint64_t fenceWaitTimeout) noexcept
+        : dispatch_{ dispatch }
+        , device_{ device }
+        , fenceWaitTimeout_{ fenceWaitTimeout < MinimumFenceWaitTimeout ? MinimumFenceWaitTimeout : fenceWaitTimeout }
+    {
+#if defined(VK_VERSION_1_2)
+#if defined(VK_KHR_timeline_semaphore)
+        getCounterValue_ = dispatch->GetSemaphoreCounterValueKHR;
+        waitSemaphores_ = dispatch->WaitSemaphoresKHR;
+        signalSemaphore_ = dispatch->SignalSemaphoreKHR;
+#endif // VK_KHR_timeline_semaphore
+        if (!getCounterValue_ || !waitSemaphores_ || !signalSemaphore_)
+        {
+            getCounterValue_ = dispatch->GetSemaphoreCounterValue;
+            waitSemaphores_ = dispatch->WaitSemaphores;
+            signalSemaphore_ = dispatch->SignalSemaphore;
+        }
+#endif // VK_VERSION_1_2
+    }
+
+    ~VulkanDynamicWaiter_T()
+    {
+        if (wakeSemaphore_ != VK_NULL_HANDLE)
+        {
+            dispatch_->DestroySemaphore(device_, wakeSemaphore_, nullptr);
+        }
+    }
+
+    VkResult Start()
+    {
+#if defined(VK_VERSION_1_2)
+        if (TimelineSemaphores())
+        {
+            VkSemaphoreTypeCreateInfo typeCreateInfo{};
+            typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+            typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+
+            VkSemaphoreCreateInfo createInfo{};
+            createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            createInfo.pNext = &typeCreateInfo;
+
+            // Without it semaphore waits are refused, as the device lacks the feature.
+            if (dispatch_->CreateSemaphore(device_, &createInfo, nullptr, &wakeSemaphore_) != VK_SUCCESS)
+            {
+                wakeSemaphore_ = VK_NULL_HANDLE;
+            }
+        }
+#endif // VK_VERSION_1_2
+
+        try
+        {
+            thread_ = ::std::thread{ [this] { Run(); } };
+        }
+        catch (const ::std::system_error&)
+        {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        return VK_SUCCESS;
+    }
+
+    void Stop()
+    {
+        {
+            const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+            stopping_ = true;
+            Wake();
+        }
+
+        thread_.join();
+    }
+
+    VkResult Add(const Wait& wait)
+    {
+        if (wait.semaphore != VK_NULL_HANDLE && wakeSemaphore_ == VK_NULL_HANDLE)
+        {
+            return VK_ERROR_EXTENSION_NOT_PRESENT;
+        }
+
+        const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+        incoming_.push_back(wait);
+        Wake();
+
+        return VK_SUCCESS;
+    }
+
+    void Statistics(VulkanDynamicWaiterStatistics& statistics) const noexcept
+    {
+        statistics.completedCount = completedCount_.load(::std::memory_order_relaxed);
+        statistics.waitCallCount = waitCallCount_.load(::std::memory_order_relaxed);
+    }
+
+private:
+    bool TimelineSemaphores() const noexcept
+    {
+#if defined(VK_VERSION_1_2)
+        return getCounterValue_ && waitSemaphores_ && signalSemaphore_;
+#else
+        return false;
+#endif // VK_VERSION_1_2
+    }
+
+    // Called with the lock held, so wake values are signaled in increasing order.
+    void Wake()
+    {
+        wakeup_.notify_one();
+
+#if defined(VK_VERSION_1_2)
+        if (waitingOnSemaphores_)
+        {
+            VkSemaphoreSignalInfo signalInfo{};
+            signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+            signalInfo.semaphore = wakeSemaphore_;
+            signalInfo.value = ++wakeValue_;
+            signalSemaphore_(device_, &signalInfo);
+
+            waitingOnSemaphores_ = false;
+        }
+#endif // VK_VERSION_1_2
+    }
+
+    void Run()
+    {
+        for (;;)
+        {
+            ::uint64_t wakeValue = 0;
+            {
+                ::std::unique_lock<::std::mutex> lock{ mutex_ };
+                wakeup_.wait(lock, [this] { return stopping_ || !incoming_.empty() || !waits_.empty(); });
+                if (stopping_)
+                {
+                    break;
+                }
+
+                waits_.insert(waits_.end(), incoming_.begin(), incoming_.end());
+                incoming_.clear();
+
+                fences_.clear();
+                semaphores_.clear();
+                values_.clear();
+                for (const Wait& wait : waits_)
+                {
+                    if (wait.fence != VK_NULL_HANDLE)
+                    {
+                        fences_.push_back(wait.fence);
+                    }
+                    else
+                    {
+                        semaphores_.push_back(wait.semaphore);
+                        values_.push_back(wait.value);
+                    }
+                }
+
+                // Only a wait on semaphores alone can be woken up early.
+                if (fences_.empty())
+                {
+                    waitingOnSemaphores_ = true;
+                    wakeValue = wakeValue_ + 1;
+                }
+            }
+
+            VkResult result;
+            if (!fences_.empty())
+            {
+                result = dispatch_->WaitForFences(device_, static_cast<::uint32_t>(fences_.size()), fences_.data(), VK_FALSE, fenceWaitTimeout_);
+            }
+            else
+            {
+#if defined(VK_VERSION_1_2)
+                semaphores_.push_back(wakeSemaphore_);
+                values_.push_back(wakeValue);
+
+                VkSemaphoreWaitInfo waitInfo{};
+                waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+                waitInfo.flags = VK_SEMAPHORE_WAIT_ANY_BIT;
+                waitInfo.semaphoreCount = static_cast<::uint32_t>(semaphores_.size());
+                waitInfo.pSemaphores = semaphores_.data();
+                waitInfo.pValues = values_.data();
+                result = waitSemaphores_(device_, &waitInfo, UINT64_MAX);
+
+                const ::std::lock_guard<::std::mutex> lock{ mutex_ };
+                waitingOnSemaphores_ = false;
+#else
+                // Semaphore waits are refused without Vulkan 1.2 headers.
+                (void)wakeValue;
+                result = VK_ERROR_EXTENSION_NOT_PRESENT;
+#endif // VK_VERSION_1_2
+            }
+
+            waitCallCount_.fetch_add(1, ::std::memory_order_relaxed);
+
+            // Semaphores are polled after every fence wait, timed out or not, so they are
+            // not starved while fences stay pending.
+            Complete(result);
+        }
+
+        for (const Wait& wait : waits_)
+        {
+            wait.callback(wait.userData, VK_NOT_READY);
+        }
+
+        for (const Wait& wait : incoming_)
+        {
+            wait.callback(wait.userData, VK_NOT_READY);
+        }
+    }
+
+    // A failed wait completes every wait it covered with its error; otherwise every wait is
+    // polled.
+    void Complete(VkResult waitResult)
+    {
+        const bool fenceWait = !fences_.empty();
+
+        for (::size_t index = 0; index < waits_.size();)
+        {
+            const Wait wait = waits_[index];
+
+            VkResult result = VK_NOT_READY;
+            if (wait.fence != VK_NULL_HANDLE)
+            {
+                result = fenceWait && waitResult < 0 ? waitResult : dispatch_->GetFenceStatus(device_, wait.fence);
+            }
+            else if (!fenceWait && waitResult < 0)
+            {
+                result = waitResult;
+            }
+            else
+            {
+#if defined(VK_VERSION_1_2)
+                ::uint64_t value = 0;
+                result = getCounterValue_(device_, wait.semaphore, &value);
+                if (result == VK_SUCCESS && value < wait.value)
+                {
+                    result = VK_NOT_READY;
+                }
+#else
+                result = VK_ERROR_EXTENSION_NOT_PRESENT;
+#endif // VK_VERSION_1_2
+            }
+
+            if (result == VK_NOT_READY)
+            {
+                ++index;
+                continue;
+            }
+
+            waits_[index] = waits_.back();
+            waits_.pop_back();
+
+            completedCount_.fetch_add(1, ::std::memory_order_relaxed);
+            wait.callback(wait.userData, result);
+        }
+    }
+
+private:
+    const VulkanDynamicDeviceDispatch* dispatch_;
+    VkDevice device_;
+    ::uint64_t fenceWaitTimeout_;
+#if defined(VK_VERSION_1_2)
+    PFN_vkGetSemaphoreCounterValue getCounterValue_{ nullptr };
+    PFN_vkWaitSemaphores waitSemaphores_{ nullptr };
+    PFN_vkSignalSemaphore signalSemaphore_{ nullptr };
+#endif // VK_VERSION_1_2
+    VkSemaphore wakeSemaphore_{ VK_NULL_HANDLE };
+    ::uint64_t wakeValue_{ 0 };
+    bool waitingOnSemaphores_{ false };
+    bool stopping_{ false };
+    ::std::mutex mutex_;
+    ::std::condition_variable wakeup_;
+    ::std::vector<Wait> incoming_;
+    ::std::vector<Wait> waits_;
+    ::std::vector<VkFence> fences_;
+    ::std::vector<VkSemaphore> semaphores_;
+    ::std::vector<::uint64_t> values_;
+    ::std::atomic<::uint64_t> completedCount_{ 0 };
+    ::std::atomic<::uint64_t> waitCallCount_{ 0 };
+    ::std::thread thread_;
+};
+
+//------------------------------------------------------------------------------------
+// Waiters
+//------------------------------------------------------------------------------------
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicCreateWaiter(const VulkanDynamicDeviceDispatch* dispatch, VkDevice device, uint64_t fenceWaitTimeout, VulkanDynamicWaiter* waiter)
+{
+    if (!dispatch || !waiter)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    ::std::unique_ptr<VulkanDynamicWaiter_T> created{ new VulkanDynamicWaiter_T{ dispatch, device, fenceWaitTimeout } };
+
+    const VkResult result = created->Start();
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    *waiter = created.release();
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicDestroyWaiter(VulkanDynamicWaiter waiter)
+{
+    if (waiter)
+    {
+        waiter->Stop();
+        delete waiter;
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWaitForFenceAsync(VulkanDynamicWaiter waiter, VkFence fence, PFN_VulkanDynamicWaitCallback callback, void* userData)
+{
+    if (!waiter || fence == VK_NULL_HANDLE || !callback)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return waiter->Add(Wait{ fence, VK_NULL_HANDLE, 0, callback, userData });
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL VulkanDynamicWaitForSemaphoreAsync(VulkanDynamicWaiter waiter, VkSemaphore semaphore, uint64_t value, PFN_VulkanDynamicWaitCallback callback, void* userData)
+{
+    if (!waiter || semaphore == VK_NULL_HANDLE || !callback)
+    {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return waiter->Add(Wait{ VK_NULL_HANDLE, semaphore, value, callback, userData });
+}
+
+VKAPI_ATTR void VKAPI_CALL VulkanDynamicGetWaiterStatistics(VulkanDynamicWaiter waiter, VulkanDynamicWaiterStatistics* statistics)
+{
+    if (waiter && statistics)
+    {
+        waiter->Statistics(*statistics);
+    }
+}
@@ -62,6 +62,7 @@ int main()
     }
 
     const ::VulkanDynamic::InstanceDispatch instanceDispatch{ instance, loaderDispatch, result };
+    const ::VulkanDynamic::PhysicalDeviceDispatch physicalDeviceDispatch{ instance, loader, instanceDispatch, result };
 
     uint32_t physicalDeviceCount{};
     instanceDispatch.EnumeratePhysicalDevices(instance, &physicalDeviceCount, nullptr);
@@ -72,7 +73,7 @@ int main()
     {
         ::VkPhysicalDeviceDriverProperties driverProperties{ ::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES };
         ::VkPhysicalDeviceProperties2 physicalDeviceProperties{ ::VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, &driverProperties };
-        instanceDispatch.GetPhysicalDeviceProperties2KHR(physicalDevice, &physicalDeviceProperties);
+        physicalDeviceDispatch.GetPhysicalDeviceProperties2KHR(physicalDevice, &physicalDeviceProperties);
 
         Print(std::cout, physicalDeviceProperties.properties);
         Print(std::cout, driverProperties);
@@ -0,0 +1,96 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicProfile.hpp>
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    using DeviceDispatch = ::VulkanDynamic::DeviceDispatchT<VK_API_VERSION_1_1, ::VulkanDynamic::Extension::KHR_swapchain>;
+
+    static_assert(DeviceDispatch::has<::VulkanDynamic::Extension::KHR_swapchain>(), "VK_KHR_swapchain is part of the profile");
+    static_assert(!DeviceDispatch::has<::VulkanDynamic::Extension::KHR_maintenance4>(), "VK_KHR_maintenance4 is not part of the profile");
+}
+
+int main()
+{
+    ::VkResult result{ ::VK_SUCCESS };
+
+    ::VulkanDynamic::Loader loader = ::VulkanDynamic::CreateLoader(result);
+    if (!loader)
+    {
+        return -1;
+    }
+
+    const ::VulkanDynamic::LoaderDispatch loaderDispatch{ loader, result };
+
+    ::VkApplicationInfo applicationInfo{ ::VK_STRUCTURE_TYPE_APPLICATION_INFO };
+    applicationInfo.apiVersion = VK_API_VERSION_1_1;
+
+    ::VkInstanceCreateInfo instanceCreateInfo{ ::VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO };
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+
+    ::VkInstance instance = nullptr;
+    if (loaderDispatch.CreateInstance(&instanceCreateInfo, nullptr, &instance) != VK_SUCCESS)
+    {
+        return -1;
+    }
+
+    const ::VulkanDynamic::InstanceDispatch instanceDispatch{ instance, loaderDispatch, result };
+
+    uint32_t physicalDeviceCount{};
+    instanceDispatch.EnumeratePhysicalDevices(instance, &physicalDeviceCount, nullptr);
+    std::vector<::VkPhysicalDevice> physicalDevices{ physicalDeviceCount };
+    instanceDispatch.EnumeratePhysicalDevices(instance, &physicalDeviceCount, physicalDevices.data());
+
+    if (physicalDevices.empty())
+    {
+        instanceDispatch.DestroyInstance(instance, nullptr);
+        return -1;
+    }
+
+    const float queuePriority = 1.0f;
+
+    ::VkDeviceQueueCreateInfo queueCreateInfo{ ::VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO };
+    queueCreateInfo.queueFamilyIndex = 0;
+    queueCreateInfo.queueCount = 1;
+    queueCreateInfo.pQueuePriorities = &queuePriority;
+
+    const char* requiredDeviceExtensions[] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+
+    ::VkDeviceCreateInfo deviceCreateInfo{ ::VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+    deviceCreateInfo.enabledExtensionCount = 1;
+    deviceCreateInfo.ppEnabledExtensionNames = requiredDeviceExtensions;
+
+    ::VkDevice device = nullptr;
+    if (instanceDispatch.CreateDevice(physicalDevices.front(), &deviceCreateInfo, nullptr, &device) != VK_SUCCESS)
+    {
+        instanceDispatch.DestroyInstance(instance, nullptr);
+        return -1;
+    }
+
+    const DeviceDispatch deviceDispatch{ device, instanceDispatch, result };
+
+    std::cout << "vkCreateSwapchainKHR: " << (deviceDispatch.CreateSwapchainKHR ? "resolved" : "missing") << "\n";
+    std::cout << "vkTrimCommandPool: " << (deviceDispatch.TrimCommandPool ? "resolved" : "missing") << "\n";
+
+    deviceDispatch.DestroyDevice(device, nullptr);
+    instanceDispatch.DestroyInstance(instance, nullptr);
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicHandles.hpp>
+
+#include <iostream>
+#include <vector>
+
+int main()
+{
+    ::VkResult result{ ::VK_SUCCESS };
+
+    ::VulkanDynamic::Loader loader = ::VulkanDynamic::CreateLoader(result);
+    if (!loader)
+    {
+        return -1;
+    }
+
+    const ::VulkanDynamic::LoaderDispatch loaderDispatch{ loader, result };
+
+    ::VkApplicationInfo applicationInfo{ ::VK_STRUCTURE_TYPE_APPLICATION_INFO };
+    applicationInfo.apiVersion = VK_API_VERSION_1_0;
+
+    ::VkInstanceCreateInfo instanceCreateInfo{ ::VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO };
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+
+    ::VkInstance vkInstance = nullptr;
+    if (loaderDispatch.CreateInstance(&instanceCreateInfo, nullptr, &vkInstance) != VK_SUCCESS)
+    {
+        return -1;
+    }
+
+    const ::VulkanDynamic::InstanceDispatch instanceDispatch{ vkInstance, loaderDispatch, result };
+    const ::VulkanDynamic::Instance instance{ vkInstance, instanceDispatch };
+
+    uint32_t physicalDeviceCount{};
+    instance.EnumeratePhysicalDevices(&physicalDeviceCount, nullptr);
+    std::vector<::VkPhysicalDevice> physicalDevices{ physicalDeviceCount };
+    instance.EnumeratePhysicalDevices(&physicalDeviceCount, physicalDevices.data());
+
+    if (physicalDevices.empty())
+    {
+        return -1;
+    }
+
+    const float queuePriority = 1.0f;
+
+    ::VkDeviceQueueCreateInfo queueCreateInfo{ ::VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO };
+    queueCreateInfo.queueFamilyIndex = 0;
+    queueCreateInfo.queueCount = 1;
+    queueCreateInfo.pQueuePriorities = &queuePriority;
+
+    ::VkDeviceCreateInfo deviceCreateInfo{ ::VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+
+    ::VkDevice vkDevice = nullptr;
+    if (instanceDispatch.CreateDevice(physicalDevices.front(), &deviceCreateInfo, nullptr, &vkDevice) != VK_SUCCESS)
+    {
+        return -1;
+    }
+
+    const ::VulkanDynamic::DeviceDispatch deviceDispatch{ vkDevice, instanceDispatch, result };
+    const ::VulkanDynamic::Device device{ vkDevice, deviceDispatch };
+
+    ::VkBufferCreateInfo bufferCreateInfo{ ::VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    bufferCreateInfo.size = 4096;
+    bufferCreateInfo.usage = ::VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    bufferCreateInfo.sharingMode = ::VK_SHARING_MODE_EXCLUSIVE;
+
+    ::VkBuffer vkBuffer = VK_NULL_HANDLE;
+    if (device.CreateBuffer(&bufferCreateInfo, nullptr, &vkBuffer) != VK_SUCCESS)
+    {
+        return -1;
+    }
+
+    const ::VulkanDynamic::Buffer buffer{ device, vkBuffer };
+
+    ::VkMemoryRequirements memoryRequirements{};
+    buffer.GetMemoryRequirements(&memoryRequirements);
+
+    std::cout << "Buffer memory requirements:\n";
+    std::cout << "  Size: " << memoryRequirements.size << "\n";
+    std::cout << "  Alignment: " << memoryRequirements.alignment << "\n\n";
+
+    const ::VulkanDynamic::Queue queue = device.GetQueue(0, 0);
+    queue.QueueWaitIdle();
+
+    return 0;
+}
@@ -0,0 +1,294 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Barrier batching against a stand-in device table that keeps a copy of every barrier
+// call it receives, in synchronization2 widths.
+
+#include <VulkanDynamic/VulkanDynamicBarrierBatch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    int failureCount = 0;
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            ++failureCount;
+        }
+    }
+
+    struct Emitted
+    {
+        bool synchronization2;
+        VkDependencyFlags dependencyFlags;
+        ::std::vector<VkMemoryBarrier2KHR> memoryBarriers;
+        ::std::vector<VkBufferMemoryBarrier2KHR> bufferBarriers;
+        ::std::vector<VkImageMemoryBarrier2KHR> imageBarriers;
+    };
+
+    ::std::vector<Emitted> emitted;
+
+    // Legacy calls are widened with the call's stage masks on every barrier.
+    VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+        uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+        uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+    {
+        Emitted call{ false, dependencyFlags, {}, {}, {} };
+        for (uint32_t index = 0; index < memoryBarrierCount; ++index)
+        {
+            const VkMemoryBarrier& barrier = pMemoryBarriers[index];
+            call.memoryBarriers.push_back(VkMemoryBarrier2KHR{ VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR, barrier.pNext, srcStageMask, barrier.srcAccessMask, dstStageMask, barrier.dstAccessMask });
+        }
+
+        for (uint32_t index = 0; index < bufferMemoryBarrierCount; ++index)
+        {
+            const VkBufferMemoryBarrier& barrier = pBufferMemoryBarriers[index];
+            call.bufferBarriers.push_back(VkBufferMemoryBarrier2KHR{ VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR, barrier.pNext, srcStageMask, barrier.srcAccessMask, dstStageMask,
+                barrier.dstAccessMask, barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex, barrier.buffer, barrier.offset, barrier.size });
+        }
+
+        for (uint32_t index = 0; index < imageMemoryBarrierCount; ++index)
+        {
+            const VkImageMemoryBarrier& barrier = pImageMemoryBarriers[index];
+            call.imageBarriers.push_back(VkImageMemoryBarrier2KHR{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR, barrier.pNext, srcStageMask, barrier.srcAccessMask, dstStageMask,
+                barrier.dstAccessMask, barrier.oldLayout, barrier.newLayout, barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex, barrier.image, barrier.subresourceRange });
+        }
+
+        emitted.push_back(call);
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(VkCommandBuffer, const VkDependencyInfoKHR* pDependencyInfo)
+    {
+        const VkDependencyInfoKHR& info = *pDependencyInfo;
+        emitted.push_back(Emitted{ true, info.dependencyFlags,
+            ::std::vector<VkMemoryBarrier2KHR>(info.pMemoryBarriers, info.pMemoryBarriers + info.memoryBarrierCount),
+            ::std::vector<VkBufferMemoryBarrier2KHR>(info.pBufferMemoryBarriers, info.pBufferMemoryBarriers + info.bufferMemoryBarrierCount),
+            ::std::vector<VkImageMemoryBarrier2KHR>(info.pImageMemoryBarriers, info.pImageMemoryBarriers + info.imageMemoryBarrierCount) });
+    }
+
+    template<typename Handle>
+    Handle MakeHandle(::uintptr_t value)
+    {
+        return reinterpret_cast<Handle>(value);
+    }
+
+    VkCommandBuffer CommandBuffer()
+    {
+        return MakeHandle<VkCommandBuffer>(0x10);
+    }
+
+    VkMemoryBarrier MemoryBarrier(VkAccessFlags srcAccessMask, VkAccessFlags dstAccessMask)
+    {
+        return VkMemoryBarrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER, nullptr, srcAccessMask, dstAccessMask };
+    }
+
+    VkBufferMemoryBarrier BufferBarrier(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size, VkAccessFlags srcAccessMask, VkAccessFlags dstAccessMask)
+    {
+        return VkBufferMemoryBarrier{ VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER, nullptr, srcAccessMask, dstAccessMask, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, buffer, offset, size };
+    }
+
+    VkImageMemoryBarrier ImageBarrier(VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout, ::uint32_t baseMipLevel = 0, ::uint32_t levelCount = 1)
+    {
+        return VkImageMemoryBarrier{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, oldLayout, newLayout,
+            VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, image, VkImageSubresourceRange{ VK_IMAGE_ASPECT_COLOR_BIT, baseMipLevel, levelCount, 0, 1 } };
+    }
+
+    void MergesMemoryBarriers(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        emitted.clear();
+        ::VulkanDynamic::BarrierBatch batch{ CommandBuffer(), dispatch };
+
+        const VkMemoryBarrier first = MemoryBarrier(VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
+        const VkMemoryBarrier second = MemoryBarrier(VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
+        batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 1, &first, 0, nullptr, 0, nullptr);
+        batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 1, &second, 0, nullptr, 0, nullptr);
+        Check(emitted.empty(), "barriers held until flushed");
+
+        batch.Flush();
+        Check(emitted.size() == 1 && !emitted[0].synchronization2 && emitted[0].memoryBarriers.size() == 1, "memory barriers emitted as one legacy barrier");
+        if (emitted.size() == 1 && emitted[0].memoryBarriers.size() == 1)
+        {
+            const VkMemoryBarrier2KHR& barrier = emitted[0].memoryBarriers[0];
+            Check(barrier.srcStageMask == (VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT), "source stages merged");
+            Check(barrier.srcAccessMask == (VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT), "source accesses merged");
+            Check(barrier.dstStageMask == VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT && barrier.dstAccessMask == VK_ACCESS_SHADER_READ_BIT, "destination scopes kept");
+        }
+
+        batch.Flush();
+        Check(emitted.size() == 1, "empty flush emits nothing");
+
+        const ::VulkanDynamic::BarrierBatchStatistics& statistics = batch.Statistics();
+        Check(statistics.batchedCallCount == 2 && statistics.emittedCallCount == 1 && statistics.mergedBarrierCount == 1, "memory barrier statistics");
+    }
+
+    void MergesOverlappingBufferRanges(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        emitted.clear();
+        ::VulkanDynamic::BarrierBatch batch{ CommandBuffer(), dispatch };
+
+        const VkBuffer buffer = MakeHandle<VkBuffer>(1);
+        const VkBufferMemoryBarrier barriers[] =
+        {
+            BufferBarrier(buffer, 0, 64, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT),
+            BufferBarrier(buffer, 32, 96, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT),
+            BufferBarrier(MakeHandle<VkBuffer>(2), 0, VK_WHOLE_SIZE, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT),
+        };
+
+        batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 1, &barriers[0], 0, nullptr);
+        batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 2, &barriers[1], 0, nullptr);
+        batch.Flush();
+
+        Check(emitted.size() == 1 && emitted[0].bufferBarriers.size() == 2, "overlapping buffer ranges merged");
+        if (emitted.size() == 1 && emitted[0].bufferBarriers.size() == 2)
+        {
+            Check(emitted[0].bufferBarriers[0].offset == 0 && emitted[0].bufferBarriers[0].size == 128, "merged range covers both ranges");
+            Check(emitted[0].bufferBarriers[1].size == VK_WHOLE_SIZE, "other buffer kept");
+        }
+    }
+
+    void CollapsesLayoutTransitions(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        emitted.clear();
+        ::VulkanDynamic::BarrierBatch batch{ CommandBuffer(), dispatch };
+
+        const VkImage image = MakeHandle<VkImage>(1);
+        const VkImageMemoryBarrier toTransfer = ImageBarrier(image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        const VkImageMemoryBarrier toShader = ImageBarrier(image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &toTransfer);
+        batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &toShader);
+        batch.Flush();
+
+        Check(emitted.size() == 1 && emitted[0].imageBarriers.size() == 1, "consecutive transitions merged");
+        if (emitted.size() == 1 && emitted[0].imageBarriers.size() == 1)
+        {
+            const VkImageMemoryBarrier2KHR& barrier = emitted[0].imageBarriers[0];
+            Check(barrier.oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && barrier.newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, "intermediate layout dropped");
+        }
+
+        Check(batch.Statistics().droppedTransitionCount == 1, "dropped transition counted");
+    }
+
+    // Barriers of one call are unordered, so overlapping barriers that cannot merge split
+    // the batch in order.
+    void SplitsConflictingBarriers(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        emitted.clear();
+        ::VulkanDynamic::BarrierBatch batch{ CommandBuffer(), dispatch };
+
+        const VkImage image = MakeHandle<VkImage>(1);
+        const VkImageMemoryBarrier whole = ImageBarrier(image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, 4);
+        const VkImageMemoryBarrier mip = ImageBarrier(image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, 1, 1);
+        batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &whole);
+        batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &mip);
+        batch.Flush();
+
+        Check(emitted.size() == 2, "partially overlapping transition splits the batch");
+        if (emitted.size() == 2)
+        {
+            Check(emitted[0].imageBarriers.size() == 1 && emitted[0].imageBarriers[0].subresourceRange.levelCount == 4, "earlier transition emitted first");
+            Check(emitted[1].imageBarriers.size() == 1 && emitted[1].imageBarriers[0].subresourceRange.baseMipLevel == 1, "later transition emitted second");
+        }
+
+        emitted.clear();
+        batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 0, nullptr);
+        batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_DEPENDENCY_BY_REGION_BIT, 0, nullptr, 0, nullptr, 0, nullptr);
+        batch.Flush();
+        Check(emitted.size() == 2 && emitted[0].dependencyFlags == 0 && emitted[1].dependencyFlags == VK_DEPENDENCY_BY_REGION_BIT, "dependency flag change splits the batch");
+    }
+
+    // A later barrier whose source stages the earlier one's destination reaches takes over
+    // its source scopes, so the single barrier still orders the earlier accesses.
+    void ChainsDependentBarriers(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        emitted.clear();
+        ::VulkanDynamic::BarrierBatch batch{ CommandBuffer(), dispatch };
+
+        const VkBufferMemoryBarrier written = BufferBarrier(MakeHandle<VkBuffer>(1), 0, VK_WHOLE_SIZE, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
+        const VkBufferMemoryBarrier read = BufferBarrier(MakeHandle<VkBuffer>(2), 0, VK_WHOLE_SIZE, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
+        const VkBufferMemoryBarrier unrelated = BufferBarrier(MakeHandle<VkBuffer>(3), 0, VK_WHOLE_SIZE, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
+
+        ::VkBufferMemoryBarrier2KHR barriers[3];
+        const VkBufferMemoryBarrier* sources[] = { &written, &read, &unrelated };
+        const VkPipelineStageFlags2KHR srcStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT };
+        const VkPipelineStageFlags2KHR dstStages[] = { VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT };
+        for (int index = 0; index < 3; ++index)
+        {
+            const VkBufferMemoryBarrier& source = *sources[index];
+            barriers[index] = VkBufferMemoryBarrier2KHR{ VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR, nullptr, srcStages[index], source.srcAccessMask, dstStages[index],
+                source.dstAccessMask, source.srcQueueFamilyIndex, source.dstQueueFamilyIndex, source.buffer, source.offset, source.size };
+
+            VkDependencyInfoKHR dependencyInfo{};
+            dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+            dependencyInfo.bufferMemoryBarrierCount = 1;
+            dependencyInfo.pBufferMemoryBarriers = &barriers[index];
+            batch.CmdPipelineBarrier2KHR(&dependencyInfo);
+        }
+
+        batch.Flush();
+        Check(emitted.size() == 1 && emitted[0].synchronization2 && emitted[0].bufferBarriers.size() == 3, "synchronization2 barriers emitted as one call");
+        if (emitted.size() == 1 && emitted[0].bufferBarriers.size() == 3)
+        {
+            const VkBufferMemoryBarrier2KHR& chained = emitted[0].bufferBarriers[1];
+            Check(chained.srcStageMask == (VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT), "chained barrier inherits source stages");
+            Check(chained.srcAccessMask == (VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT), "chained barrier inherits source accesses");
+
+            const VkBufferMemoryBarrier2KHR& independent = emitted[0].bufferBarriers[2];
+            Check(independent.srcStageMask == VK_PIPELINE_STAGE_VERTEX_SHADER_BIT && independent.srcAccessMask == VK_ACCESS_SHADER_WRITE_BIT, "independent barrier keeps its scopes");
+        }
+    }
+
+    void IssuesChainedBarriersUnbatched(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        emitted.clear();
+        {
+            ::VulkanDynamic::BarrierBatch batch{ CommandBuffer(), dispatch };
+
+            const VkMemoryBarrier plain = MemoryBarrier(VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
+            batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &plain, 0, nullptr, 0, nullptr);
+
+            const VkBaseInStructure extension{};
+            VkMemoryBarrier extended = plain;
+            extended.pNext = &extension;
+            batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &extended, 0, nullptr, 0, nullptr);
+
+            Check(emitted.size() == 2 && !emitted[0].memoryBarriers[0].pNext && emitted[1].memoryBarriers[0].pNext == &extension, "pending barriers flushed before a barrier with a pNext chain");
+
+            batch.CmdPipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &plain, 0, nullptr, 0, nullptr);
+        }
+
+        Check(emitted.size() == 3, "destruction flushes pending barriers");
+    }
+} // namespace
+
+int main()
+{
+    ::VulkanDynamic::DeviceDispatch dispatch{};
+    dispatch.CmdPipelineBarrier = &CmdPipelineBarrier;
+    dispatch.CmdPipelineBarrier2KHR = &CmdPipelineBarrier2KHR;
+
+    MergesMemoryBarriers(dispatch);
+    MergesOverlappingBufferRanges(dispatch);
+    CollapsesLayoutTransitions(dispatch);
+    SplitsConflictingBarriers(dispatch);
+    ChainsDependentBarriers(dispatch);
+    IssuesChainedBarriersUnbatched(dispatch);
+
+    return failureCount == 0 ? 0 : 1;
+}
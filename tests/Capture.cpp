@@ -0,0 +1,219 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// API call capture against a stand-in device table that logs what it is called with.
+// Captured calls are forwarded to the same table, so the log is cleared before replay.
+
+#include <VulkanDynamic/VulkanDynamicCapture.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    int failureCount = 0;
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            ++failureCount;
+        }
+    }
+
+    constexpr const char* CaptureFileName = "VulkanDynamic.Tests.Capture.vkdc";
+
+    struct Submit
+    {
+        ::std::vector<::uint64_t> signalValues;
+        ::std::vector<::uint32_t> commandBufferDeviceMasks;
+    };
+
+    ::std::mutex logMutex;
+    ::std::vector<::uint32_t> drawLog;
+    ::std::vector<Submit> submitLog;
+
+    VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer, uint32_t vertexCount, uint32_t, uint32_t, uint32_t)
+    {
+        const ::std::lock_guard<::std::mutex> lock{ logMutex };
+        drawLog.push_back(vertexCount);
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence)
+    {
+        const ::std::lock_guard<::std::mutex> lock{ logMutex };
+        for (uint32_t index = 0; index < submitCount; ++index)
+        {
+            Submit submit;
+            for (const VkBaseInStructure* next = static_cast<const VkBaseInStructure*>(pSubmits[index].pNext); next; next = next->pNext)
+            {
+                if (next->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+                {
+                    const VkTimelineSemaphoreSubmitInfo* timeline = reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(next);
+                    submit.signalValues.assign(timeline->pSignalSemaphoreValues, timeline->pSignalSemaphoreValues + timeline->signalSemaphoreValueCount);
+                }
+                else if (next->sType == VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO)
+                {
+                    const VkDeviceGroupSubmitInfo* deviceGroup = reinterpret_cast<const VkDeviceGroupSubmitInfo*>(next);
+                    submit.commandBufferDeviceMasks.assign(deviceGroup->pCommandBufferDeviceMasks, deviceGroup->pCommandBufferDeviceMasks + deviceGroup->commandBufferCount);
+                }
+            }
+
+            submitLog.push_back(submit);
+        }
+
+        return VK_SUCCESS;
+    }
+
+    void ClearLogs()
+    {
+        const ::std::lock_guard<::std::mutex> lock{ logMutex };
+        drawLog.clear();
+        submitLog.clear();
+    }
+
+    VkCommandBuffer CommandBuffer()
+    {
+        return reinterpret_cast<VkCommandBuffer>(static_cast<::uintptr_t>(0x10));
+    }
+
+    // Two threads take strict turns, so the threads' records reach the file in two chunks
+    // that only the sequence numbers put back in call order.
+    void ReplaysThreadsInCallOrder(const VulkanDynamicDeviceDispatch& standIn, const VulkanDynamicDeviceDispatch& captured)
+    {
+        constexpr ::uint32_t DrawCount = 200;
+
+        ClearLogs();
+        Check(VulkanDynamicBeginCapture(CaptureFileName) == VK_SUCCESS, "begin capture");
+
+        ::std::mutex turnMutex;
+        ::std::condition_variable turnChanged;
+        ::uint32_t turn = 0;
+
+        auto draw = [&](::uint32_t first)
+        {
+            for (::uint32_t vertexCount = first; vertexCount < DrawCount; vertexCount += 2)
+            {
+                ::std::unique_lock<::std::mutex> lock{ turnMutex };
+                turnChanged.wait(lock, [&] { return turn == vertexCount; });
+                captured.CmdDraw(CommandBuffer(), vertexCount, 1, 0, 0);
+                ++turn;
+                turnChanged.notify_all();
+            }
+        };
+
+        ::std::thread even{ draw, 0u };
+        ::std::thread odd{ draw, 1u };
+        even.join();
+        odd.join();
+
+        Check(VulkanDynamicEndCapture() == VK_SUCCESS, "end capture");
+
+        ClearLogs();
+        VulkanDynamicReplayStatistics statistics;
+        Check(VulkanDynamicReplayCapture(CaptureFileName, &standIn, 1, &statistics) == VK_SUCCESS, "replay capture");
+        Check(statistics.callCount == DrawCount && statistics.skippedCallCount == 0, "every draw replayed");
+
+        bool ordered = drawLog.size() == DrawCount;
+        for (::uint32_t index = 0; ordered && index < DrawCount; ++index)
+        {
+            ordered = drawLog[index] == index;
+        }
+
+        Check(ordered, "draws of both threads replayed in call order");
+    }
+
+    void ReplaysKnownStructures(const VulkanDynamicDeviceDispatch& standIn, const VulkanDynamicDeviceDispatch& captured)
+    {
+        const ::uint64_t signalValues[] = { 7, 9 };
+        const ::uint32_t deviceMasks[] = { 1 };
+        const VkCommandBuffer commandBuffer = CommandBuffer();
+        const VkSemaphore semaphores[] = { VK_NULL_HANDLE, VK_NULL_HANDLE };
+
+        VkDeviceGroupSubmitInfo deviceGroup{};
+        deviceGroup.sType = VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO;
+        deviceGroup.commandBufferCount = 1;
+        deviceGroup.pCommandBufferDeviceMasks = deviceMasks;
+
+        VkTimelineSemaphoreSubmitInfo timeline{};
+        timeline.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timeline.pNext = &deviceGroup;
+        timeline.signalSemaphoreValueCount = 2;
+        timeline.pSignalSemaphoreValues = signalValues;
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext = &timeline;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+        submitInfo.signalSemaphoreCount = 2;
+        submitInfo.pSignalSemaphores = semaphores;
+
+        Check(VulkanDynamicBeginCapture(CaptureFileName) == VK_SUCCESS, "begin capture");
+        captured.QueueSubmit(VK_NULL_HANDLE, 1, &submitInfo, VK_NULL_HANDLE);
+        Check(VulkanDynamicEndCapture() == VK_SUCCESS, "end capture of known structures");
+
+        ClearLogs();
+        VulkanDynamicReplayStatistics statistics;
+        Check(VulkanDynamicReplayCapture(CaptureFileName, &standIn, 1, &statistics) == VK_SUCCESS, "replay capture");
+        Check(submitLog.size() == 1, "submit replayed");
+        Check(submitLog.size() == 1 && submitLog[0].signalValues == ::std::vector<::uint64_t>{ 7, 9 }, "timeline values replayed");
+        Check(submitLog.size() == 1 && submitLog[0].commandBufferDeviceMasks == ::std::vector<::uint32_t>{ 1 }, "device group masks replayed");
+    }
+
+    // A call that lost part of its chain is not replayed, and the capture says so.
+    void SkipsCallsWithUnknownStructures(const VulkanDynamicDeviceDispatch& standIn, const VulkanDynamicDeviceDispatch& captured)
+    {
+        VkBaseInStructure unknown{};
+        unknown.sType = static_cast<VkStructureType>(1000999000);
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext = &unknown;
+
+        Check(VulkanDynamicBeginCapture(CaptureFileName) == VK_SUCCESS, "begin capture");
+        captured.QueueSubmit(VK_NULL_HANDLE, 1, &submitInfo, VK_NULL_HANDLE);
+        captured.CmdDraw(CommandBuffer(), 3, 1, 0, 0);
+        Check(VulkanDynamicEndCapture() == VK_INCOMPLETE, "end capture reports dropped structures");
+
+        ClearLogs();
+        VulkanDynamicReplayStatistics statistics;
+        Check(VulkanDynamicReplayCapture(CaptureFileName, &standIn, 1, &statistics) == VK_SUCCESS, "replay capture");
+        Check(statistics.callCount == 1 && statistics.skippedCallCount == 1, "submit with an unknown structure skipped");
+        Check(submitLog.empty() && drawLog.size() == 1, "only the draw replayed");
+    }
+} // namespace
+
+int main()
+{
+    VulkanDynamicDeviceDispatch standIn{};
+    standIn.CmdDraw = &CmdDraw;
+    standIn.QueueSubmit = &QueueSubmit;
+
+    VulkanDynamicDeviceDispatch captured{};
+    Check(VulkanDynamicCaptureDeviceDispatch(&standIn, &captured) == VK_SUCCESS, "capture device dispatch");
+
+    ReplaysThreadsInCallOrder(standIn, captured);
+    ReplaysKnownStructures(standIn, captured);
+    SkipsCallsWithUnknownStructures(standIn, captured);
+
+    ::remove(CaptureFileName);
+
+    return failureCount == 0 ? 0 : 1;
+}
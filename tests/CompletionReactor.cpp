@@ -0,0 +1,140 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Completion reactor against a stand-in device table whose exported sync files are
+// eventfds: writing to an eventfd signals the object exported from it.
+
+#include <VulkanDynamic/VulkanDynamicReactor.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace
+{
+    // Fence handles are one-based indices into this table. Handles past its end export -1,
+    // as a driver does for a fence that already signaled.
+    ::std::vector<int> eventFds;
+
+    int failureCount = 0;
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            ++failureCount;
+        }
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL GetFenceFd(VkDevice, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd)
+    {
+        const ::size_t index = static_cast<::size_t>(reinterpret_cast<::uintptr_t>(pGetFdInfo->fence)) - 1;
+        *pFd = index < eventFds.size() ? ::dup(eventFds[index]) : -1;
+        return VK_SUCCESS;
+    }
+
+    VkFence Fence(::size_t index)
+    {
+        return reinterpret_cast<VkFence>(static_cast<::uintptr_t>(index + 1));
+    }
+
+    void Signal(::size_t index)
+    {
+        const ::uint64_t value = 1;
+        Check(::write(eventFds[index], &value, sizeof(value)) == sizeof(value), "eventfd write");
+    }
+
+    struct Completions
+    {
+        ::uint32_t successCount = 0;
+        ::uint32_t notReadyCount = 0;
+        ::uint32_t otherCount = 0;
+    };
+
+    VKAPI_ATTR void VKAPI_CALL Completed(void* userData, VkResult result)
+    {
+        Completions* completions = static_cast<Completions*>(userData);
+        if (result == VK_SUCCESS)
+        {
+            ++completions->successCount;
+        }
+        else if (result == VK_NOT_READY)
+        {
+            ++completions->notReadyCount;
+        }
+        else
+        {
+            ++completions->otherCount;
+        }
+    }
+
+    // More signaled objects than one poll returns, behind the notification of an object
+    // that was already signaled when watched: one dispatch must complete them all.
+    void DispatchesEveryBatch(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        constexpr ::size_t SignaledCount = 150;
+        constexpr ::size_t PendingCount = 10;
+
+        eventFds.clear();
+        for (::size_t index = 0; index < SignaledCount + PendingCount; ++index)
+        {
+            eventFds.push_back(::eventfd(0, EFD_CLOEXEC));
+        }
+
+        VulkanDynamicCompletionReactor reactor = VK_NULL_HANDLE;
+        Check(VulkanDynamicCreateCompletionReactor(&dispatch, VK_NULL_HANDLE, &reactor) == VK_SUCCESS, "create reactor");
+
+        Completions completions;
+        Check(VulkanDynamicWatchFence(reactor, Fence(eventFds.size()), &Completed, &completions) == VK_SUCCESS, "watch signaled fence");
+        for (::size_t index = 0; index < eventFds.size(); ++index)
+        {
+            Check(VulkanDynamicWatchFence(reactor, Fence(index), &Completed, &completions) == VK_SUCCESS, "watch fence");
+        }
+
+        Check(VulkanDynamicDispatchCompletions(reactor) == 1, "only the signaled fence completes before any signal");
+
+        Check(VulkanDynamicWatchFence(reactor, Fence(eventFds.size()), &Completed, &completions) == VK_SUCCESS, "watch signaled fence");
+        for (::size_t index = 0; index < SignaledCount; ++index)
+        {
+            Signal(index);
+        }
+
+        Check(VulkanDynamicDispatchCompletions(reactor) == SignaledCount + 1, "one dispatch completes every signaled fence");
+        Check(VulkanDynamicDispatchCompletions(reactor) == 0, "nothing left to dispatch");
+        Check(completions.successCount == SignaledCount + 2, "signaled fences complete with VK_SUCCESS");
+
+        VulkanDynamicDestroyCompletionReactor(reactor);
+        Check(completions.notReadyCount == PendingCount, "pending fences complete with VK_NOT_READY on destruction");
+        Check(completions.otherCount == 0, "no other results");
+
+        for (int fd : eventFds)
+        {
+            ::close(fd);
+        }
+    }
+} // namespace
+
+int main()
+{
+    VulkanDynamicDeviceDispatch dispatch{};
+    dispatch.GetFenceFdKHR = &GetFenceFd;
+
+    DispatchesEveryBatch(dispatch);
+
+    return failureCount == 0 ? 0 : 1;
+}
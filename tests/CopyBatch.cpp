@@ -0,0 +1,228 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Copy batching against a stand-in device table that keeps a copy of every copy call it
+// receives and through which entry point.
+
+#include <VulkanDynamic/VulkanDynamicCopyBatch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    int failureCount = 0;
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            ++failureCount;
+        }
+    }
+
+    enum class Entry
+    {
+        CopyBuffer,
+        CopyBufferToImage,
+        CopyBuffer2,
+    };
+
+    struct Emitted
+    {
+        Entry entry;
+        VkBuffer srcBuffer;
+        ::uint64_t dst;
+        ::std::vector<VkBufferCopy> bufferRegions;
+        ::std::vector<VkBufferImageCopy> imageRegions;
+    };
+
+    ::std::vector<Emitted> emitted;
+
+    VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions)
+    {
+        emitted.push_back(Emitted{ Entry::CopyBuffer, srcBuffer, reinterpret_cast<::uint64_t>(dstBuffer), ::std::vector<VkBufferCopy>(pRegions, pRegions + regionCount), {} });
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+    {
+        emitted.push_back(Emitted{ Entry::CopyBufferToImage, srcBuffer, reinterpret_cast<::uint64_t>(dstImage), {}, ::std::vector<VkBufferImageCopy>(pRegions, pRegions + regionCount) });
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(VkCommandBuffer, const VkCopyBufferInfo2KHR* pCopyBufferInfo)
+    {
+        emitted.push_back(Emitted{ Entry::CopyBuffer2, pCopyBufferInfo->srcBuffer, reinterpret_cast<::uint64_t>(pCopyBufferInfo->dstBuffer), {}, {} });
+    }
+
+    template<typename Handle>
+    Handle MakeHandle(::uintptr_t value)
+    {
+        return reinterpret_cast<Handle>(value);
+    }
+
+    VkCommandBuffer CommandBuffer()
+    {
+        return MakeHandle<VkCommandBuffer>(0x10);
+    }
+
+    bool SameRegion(const VkBufferCopy& region, VkDeviceSize srcOffset, VkDeviceSize dstOffset, VkDeviceSize size)
+    {
+        return region.srcOffset == srcOffset && region.dstOffset == dstOffset && region.size == size;
+    }
+
+    void MergesTouchingAndOverlappingRegions(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        emitted.clear();
+        ::VulkanDynamic::CopyBatch batch{ CommandBuffer(), dispatch };
+
+        const VkBuffer src = MakeHandle<VkBuffer>(1);
+        const VkBuffer dst = MakeHandle<VkBuffer>(2);
+
+        // Recorded out of order: the touching, overlapping and contained regions share the
+        // source to destination distance 256; the last one does not.
+        const VkBufferCopy regions[] = { { 320, 64, 64 }, { 256, 0, 64 }, { 352, 96, 64 }, { 384, 128, 16 }, { 0, 512, 64 } };
+        for (const VkBufferCopy& region : regions)
+        {
+            batch.CmdCopyBuffer(src, dst, 1, &region);
+        }
+
+        Check(emitted.empty(), "copies held until flushed");
+
+        batch.Flush();
+        Check(emitted.size() == 1 && emitted[0].entry == Entry::CopyBuffer && emitted[0].bufferRegions.size() == 2, "copies between one pair emitted as one call");
+        if (emitted.size() == 1 && emitted[0].bufferRegions.size() == 2)
+        {
+            const VkBufferCopy* merged = &emitted[0].bufferRegions[0];
+            const VkBufferCopy* other = &emitted[0].bufferRegions[1];
+            if (merged->srcOffset == 0)
+            {
+                ::std::swap(merged, other);
+            }
+
+            Check(SameRegion(*merged, 256, 0, 160), "touching and overlapping regions merged");
+            Check(SameRegion(*other, 0, 512, 64), "region at another distance kept");
+        }
+
+        const ::VulkanDynamic::CopyBatchStatistics& statistics = batch.Statistics();
+        Check(statistics.batchedCallCount == 5 && statistics.emittedCallCount == 1 && statistics.batchedRegionCount == 5 && statistics.emittedRegionCount == 2, "buffer copy statistics");
+    }
+
+    void EmitsOneCallPerPair(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        emitted.clear();
+        {
+            ::VulkanDynamic::CopyBatch batch{ CommandBuffer(), dispatch };
+
+            const VkBuffer src = MakeHandle<VkBuffer>(1);
+            const VkBufferCopy first{ 0, 0, 64 };
+            const VkBufferCopy second{ 64, 64, 64 };
+            batch.CmdCopyBuffer(src, MakeHandle<VkBuffer>(2), 1, &first);
+            batch.CmdCopyBuffer(src, MakeHandle<VkBuffer>(3), 1, &first);
+            batch.CmdCopyBuffer(src, MakeHandle<VkBuffer>(2), 1, &second);
+
+            // The copy_commands2 variant batches with the core one.
+            VkBufferCopy2KHR region{};
+            region.sType = VK_STRUCTURE_TYPE_BUFFER_COPY_2_KHR;
+            region.srcOffset = 64;
+            region.dstOffset = 64;
+            region.size = 64;
+
+            VkCopyBufferInfo2KHR info{};
+            info.sType = VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2_KHR;
+            info.srcBuffer = src;
+            info.dstBuffer = MakeHandle<VkBuffer>(3);
+            info.regionCount = 1;
+            info.pRegions = &region;
+            batch.CmdCopyBuffer2KHR(&info);
+
+            Check(emitted.empty(), "copies held until destruction");
+        }
+
+        Check(emitted.size() == 2, "one call per source and destination pair");
+        for (const Emitted& call : emitted)
+        {
+            Check(call.entry == Entry::CopyBuffer && call.bufferRegions.size() == 1 && call.bufferRegions[0].size == 128, "regions of each pair merged");
+        }
+    }
+
+    void IssuesUnbatchableCopiesDirectly(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        emitted.clear();
+        ::VulkanDynamic::CopyBatch batch{ CommandBuffer(), dispatch };
+
+        const VkBuffer buffer = MakeHandle<VkBuffer>(1);
+        const VkBufferCopy region{ 0, 256, 64 };
+        batch.CmdCopyBuffer(buffer, buffer, 1, &region);
+        Check(emitted.size() == 1 && emitted[0].entry == Entry::CopyBuffer, "copy within one buffer issued directly");
+
+        const VkBaseInStructure extension{};
+        VkBufferCopy2KHR region2{};
+        region2.sType = VK_STRUCTURE_TYPE_BUFFER_COPY_2_KHR;
+        region2.pNext = &extension;
+        region2.size = 64;
+
+        VkCopyBufferInfo2KHR info{};
+        info.sType = VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2_KHR;
+        info.srcBuffer = buffer;
+        info.dstBuffer = MakeHandle<VkBuffer>(2);
+        info.regionCount = 1;
+        info.pRegions = &region2;
+        batch.CmdCopyBuffer2KHR(&info);
+        Check(emitted.size() == 2 && emitted[1].entry == Entry::CopyBuffer2, "region with a pNext chain issued directly");
+
+        batch.Flush();
+        Check(emitted.size() == 2, "nothing left to flush");
+    }
+
+    void DropsDuplicateImageRegions(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        emitted.clear();
+        ::VulkanDynamic::CopyBatch batch{ CommandBuffer(), dispatch };
+
+        const VkBuffer src = MakeHandle<VkBuffer>(1);
+        const VkImage image = MakeHandle<VkImage>(2);
+        const VkImageSubresourceLayers subresource{ VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+        const VkBufferImageCopy high{ 4096, 0, 0, subresource, { 16, 0, 0 }, { 16, 16, 1 } };
+        const VkBufferImageCopy low{ 0, 0, 0, subresource, { 0, 0, 0 }, { 16, 16, 1 } };
+
+        batch.CmdCopyBufferToImage(src, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &high);
+        batch.CmdCopyBufferToImage(src, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &low);
+        batch.CmdCopyBufferToImage(src, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &high);
+        batch.Flush();
+
+        Check(emitted.size() == 1 && emitted[0].entry == Entry::CopyBufferToImage && emitted[0].imageRegions.size() == 2, "duplicate image region dropped");
+        if (emitted.size() == 1 && emitted[0].imageRegions.size() == 2)
+        {
+            Check(emitted[0].imageRegions[0].bufferOffset == 0 && emitted[0].imageRegions[1].bufferOffset == 4096, "image regions sorted by buffer offset");
+        }
+    }
+} // namespace
+
+int main()
+{
+    ::VulkanDynamic::DeviceDispatch dispatch{};
+    dispatch.CmdCopyBuffer = &CmdCopyBuffer;
+    dispatch.CmdCopyBufferToImage = &CmdCopyBufferToImage;
+    dispatch.CmdCopyBuffer2KHR = &CmdCopyBuffer2KHR;
+
+    MergesTouchingAndOverlappingRegions(dispatch);
+    EmitsOneCallPerPair(dispatch);
+    IssuesUnbatchableCopiesDirectly(dispatch);
+    DropsDuplicateImageRegions(dispatch);
+
+    return failureCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Deferred operation scheduler against a stand-in device table whose deferred operations
+// are counters of work units that joined threads take one at a time. Callbacks mark their
+// operation destroyed, and any later use of it counts as a failure.
+
+#include <VulkanDynamic/VulkanDynamicDeferredOperations.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    ::std::atomic<int> failureCount{ 0 };
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            failureCount.fetch_add(1);
+        }
+    }
+
+    struct DeferredOperation
+    {
+        ::int32_t unitCount = 0;
+        ::std::atomic<::int32_t> takenCount{ 0 };
+        ::std::atomic<::int32_t> doneCount{ 0 };
+        // Joins that report VK_THREAD_IDLE_KHR before any work is handed out.
+        ::std::atomic<::int32_t> idleJoinCount{ 0 };
+        bool failJoins = false;
+        // Set for operations that report VK_THREAD_DONE_KHR from every join while another
+        // thread completes them.
+        bool finishedElsewhere = false;
+        ::std::atomic<::uint32_t> joinCount{ 0 };
+        ::std::atomic<bool> destroyed{ false };
+        ::std::atomic<::uint32_t> callbackCount{ 0 };
+        ::std::atomic<VkResult> callbackResult{ VK_NOT_READY };
+    };
+
+    DeferredOperation& Use(VkDeferredOperationKHR operation)
+    {
+        DeferredOperation& deferred = *reinterpret_cast<DeferredOperation*>(operation);
+        Check(!deferred.destroyed.load(), "operation used after its callback");
+        return deferred;
+    }
+
+    VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrency(VkDevice, VkDeferredOperationKHR operation)
+    {
+        DeferredOperation& deferred = Use(operation);
+        const ::int32_t remaining = deferred.unitCount - deferred.takenCount.load();
+        return remaining > 0 ? static_cast<::uint32_t>(remaining < 4 ? remaining : 4) : 0;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL DeferredOperationJoin(VkDevice, VkDeferredOperationKHR operation)
+    {
+        DeferredOperation& deferred = Use(operation);
+        deferred.joinCount.fetch_add(1);
+        if (deferred.finishedElsewhere)
+        {
+            return VK_THREAD_DONE_KHR;
+        }
+
+        if (deferred.failJoins)
+        {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+
+        if (deferred.idleJoinCount.fetch_sub(1) > 0)
+        {
+            return VK_THREAD_IDLE_KHR;
+        }
+
+        while (deferred.takenCount.fetch_add(1) < deferred.unitCount)
+        {
+            ::std::this_thread::yield();
+            if (deferred.doneCount.fetch_add(1) + 1 == deferred.unitCount)
+            {
+                return VK_SUCCESS;
+            }
+        }
+
+        return VK_THREAD_DONE_KHR;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL GetDeferredOperationResult(VkDevice, VkDeferredOperationKHR operation)
+    {
+        DeferredOperation& deferred = Use(operation);
+        return deferred.doneCount.load() == deferred.unitCount ? VK_SUCCESS : VK_NOT_READY;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL Completed(void*, VkDeferredOperationKHR operation, VkResult result)
+    {
+        DeferredOperation& deferred = Use(operation);
+        deferred.callbackResult.store(result);
+        deferred.callbackCount.fetch_add(1);
+        deferred.destroyed.store(true);
+    }
+
+    VkDeferredOperationKHR Handle(DeferredOperation& deferred)
+    {
+        return reinterpret_cast<VkDeferredOperationKHR>(&deferred);
+    }
+
+    // Many short operations on a few threads, so that queue entries often outlive their
+    // operation; every tenth operation idles first and every fiftieth fails to join.
+    void CompletesEveryOperationOnce(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        constexpr ::size_t OperationCount = 2000;
+
+        ::std::vector<::std::unique_ptr<DeferredOperation>> operations;
+        for (::size_t index = 0; index < OperationCount; ++index)
+        {
+            operations.emplace_back(new DeferredOperation{});
+            operations.back()->unitCount = 1 + static_cast<::int32_t>(index % 8);
+            operations.back()->idleJoinCount.store(index % 10 == 0 ? 3 : 0);
+            operations.back()->failJoins = index % 50 == 0;
+        }
+
+        VulkanDynamicDeferredOperationScheduler scheduler = VK_NULL_HANDLE;
+        Check(VulkanDynamicCreateDeferredOperationScheduler(&dispatch, VK_NULL_HANDLE, 4, &scheduler) == VK_SUCCESS, "create scheduler");
+
+        for (const ::std::unique_ptr<DeferredOperation>& operation : operations)
+        {
+            Check(VulkanDynamicScheduleDeferredOperation(scheduler, Handle(*operation), &Completed, nullptr) == VK_SUCCESS, "schedule operation");
+        }
+
+        VulkanDynamicDestroyDeferredOperationScheduler(scheduler);
+
+        for (::size_t index = 0; index < OperationCount; ++index)
+        {
+            const DeferredOperation& operation = *operations[index];
+            Check(operation.callbackCount.load() == 1, "callback called once");
+            Check(operation.callbackResult.load() == (operation.failJoins ? VK_ERROR_OUT_OF_HOST_MEMORY : VK_SUCCESS), "callback receives the operation's result");
+            Check(operation.failJoins || operation.doneCount.load() == operation.unitCount, "every unit of work done");
+        }
+    }
+    // Rejoining an operation that finishes elsewhere finds no work, so it is backed off
+    // like an idle one instead of rejoined at once.
+    void BacksOffOperationsFinishingElsewhere(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        DeferredOperation operation;
+        operation.unitCount = 1;
+        operation.finishedElsewhere = true;
+
+        VulkanDynamicDeferredOperationScheduler scheduler = VK_NULL_HANDLE;
+        VulkanDynamicCreateDeferredOperationScheduler(&dispatch, VK_NULL_HANDLE, 4, &scheduler);
+        VulkanDynamicScheduleDeferredOperation(scheduler, Handle(operation), &Completed, nullptr);
+
+        ::std::this_thread::sleep_for(::std::chrono::milliseconds{ 50 });
+        operation.doneCount.store(1);
+        VulkanDynamicDestroyDeferredOperationScheduler(scheduler);
+
+        Check(operation.callbackCount.load() == 1 && operation.callbackResult.load() == VK_SUCCESS, "operation finished elsewhere completes");
+        Check(operation.joinCount.load() < 1000, "operation finishing elsewhere not rejoined in a loop");
+    }
+} // namespace
+
+int main()
+{
+    VulkanDynamicDeviceDispatch dispatch{};
+    dispatch.GetDeferredOperationMaxConcurrencyKHR = &GetDeferredOperationMaxConcurrency;
+    dispatch.DeferredOperationJoinKHR = &DeferredOperationJoin;
+    dispatch.GetDeferredOperationResultKHR = &GetDeferredOperationResult;
+
+    CompletesEveryOperationOnce(dispatch);
+    BacksOffOperationsFinishingElsewhere(dispatch);
+
+    return failureCount.load() == 0 ? 0 : 1;
+}
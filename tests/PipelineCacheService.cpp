@@ -0,0 +1,475 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Pipeline cache server and clients against a stand-in device table whose pipeline caches
+// are byte strings: the pipeline cache header followed by the entries merged into it.
+
+#include <VulkanDynamic/VulkanDynamicPipelineCacheService.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr ::uint32_t HeaderSize = 16 + VK_UUID_SIZE;
+
+    // The service's requests and replies, laid out as it lays them out in memory.
+    struct Message
+    {
+        ::uint32_t magic;
+        ::uint32_t operation;
+        ::int32_t result;
+        ::uint32_t vendorID;
+        ::uint32_t deviceID;
+        ::uint32_t driverVersion;
+        ::uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+        ::uint64_t size;
+    };
+
+    constexpr ::uint32_t MessageMagic = 0x43504456u;
+    constexpr ::uint32_t OperationPublish = 2;
+
+    int failureCount = 0;
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            ++failureCount;
+        }
+    }
+
+    struct PipelineCache
+    {
+        ::std::vector<unsigned char> data;
+    };
+
+    VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(VkPhysicalDevice, VkPhysicalDeviceProperties* pProperties)
+    {
+        *pProperties = VkPhysicalDeviceProperties{};
+        pProperties->vendorID = 0x1234;
+        pProperties->deviceID = 0x5678;
+        pProperties->driverVersion = 1;
+        for (::uint32_t index = 0; index < VK_UUID_SIZE; ++index)
+        {
+            pProperties->pipelineCacheUUID[index] = static_cast<::uint8_t>(index);
+        }
+    }
+
+    ::std::vector<unsigned char> Header()
+    {
+        VkPhysicalDeviceProperties properties;
+        GetPhysicalDeviceProperties(VK_NULL_HANDLE, &properties);
+
+        const ::uint32_t fields[4] = { HeaderSize, VK_PIPELINE_CACHE_HEADER_VERSION_ONE, properties.vendorID, properties.deviceID };
+        ::std::vector<unsigned char> header(HeaderSize);
+        ::std::memcpy(header.data(), fields, sizeof(fields));
+        ::std::memcpy(header.data() + sizeof(fields), properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+        return header;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(VkDevice, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkPipelineCache* pPipelineCache)
+    {
+        PipelineCache* cache = new PipelineCache{ Header() };
+        if (pCreateInfo->initialDataSize > HeaderSize)
+        {
+            const unsigned char* initialData = static_cast<const unsigned char*>(pCreateInfo->pInitialData);
+            cache->data.insert(cache->data.end(), initialData + HeaderSize, initialData + pCreateInfo->initialDataSize);
+        }
+
+        *pPipelineCache = reinterpret_cast<VkPipelineCache>(cache);
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(VkDevice, VkPipelineCache pipelineCache, const VkAllocationCallbacks*)
+    {
+        delete reinterpret_cast<PipelineCache*>(pipelineCache);
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(VkDevice, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches)
+    {
+        PipelineCache* destination = reinterpret_cast<PipelineCache*>(dstCache);
+        for (::uint32_t index = 0; index < srcCacheCount; ++index)
+        {
+            const PipelineCache* source = reinterpret_cast<const PipelineCache*>(pSrcCaches[index]);
+            destination->data.insert(destination->data.end(), source->data.begin() + HeaderSize, source->data.end());
+        }
+
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData)
+    {
+        const PipelineCache* cache = reinterpret_cast<const PipelineCache*>(pipelineCache);
+        if (!pData)
+        {
+            *pDataSize = cache->data.size();
+            return VK_SUCCESS;
+        }
+
+        const ::size_t size = *pDataSize < cache->data.size() ? *pDataSize : cache->data.size();
+        ::std::memcpy(pData, cache->data.data(), size);
+        *pDataSize = size;
+        return size < cache->data.size() ? VK_INCOMPLETE : VK_SUCCESS;
+    }
+
+    struct StandIn
+    {
+        VulkanDynamicPhysicalDeviceDispatch physicalDeviceDispatch{};
+        VulkanDynamicDeviceDispatch deviceDispatch{};
+        VulkanDynamicPipelineCacheServerDevice serverDevice{};
+
+        StandIn()
+        {
+            physicalDeviceDispatch.GetPhysicalDeviceProperties = &GetPhysicalDeviceProperties;
+            deviceDispatch.CreatePipelineCache = &CreatePipelineCache;
+            deviceDispatch.DestroyPipelineCache = &DestroyPipelineCache;
+            deviceDispatch.MergePipelineCaches = &MergePipelineCaches;
+            deviceDispatch.GetPipelineCacheData = &GetPipelineCacheData;
+
+            serverDevice.physicalDeviceDispatch = &physicalDeviceDispatch;
+            serverDevice.deviceDispatch = &deviceDispatch;
+        }
+
+        VulkanDynamicPipelineCacheServer CreateServer(const ::std::string& path, VkResult* pResult = nullptr) const
+        {
+            VulkanDynamicPipelineCacheServer server = VK_NULL_HANDLE;
+            const VkResult result = VulkanDynamicCreatePipelineCacheServer(path.c_str(), 1, &serverDevice, &server);
+            if (pResult)
+            {
+                *pResult = result;
+            }
+
+            return result == VK_SUCCESS ? server : VK_NULL_HANDLE;
+        }
+
+        VkResult Publish(const ::std::string& path, const char* entry) const
+        {
+            VkPipelineCacheCreateInfo createInfo{};
+            createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+
+            VkPipelineCache cache;
+            CreatePipelineCache(VK_NULL_HANDLE, &createInfo, nullptr, &cache);
+            PipelineCache* standInCache = reinterpret_cast<PipelineCache*>(cache);
+            standInCache->data.insert(standInCache->data.end(), entry, entry + ::strlen(entry));
+
+            const VkResult result = VulkanDynamicPublishPipelineCache(path.c_str(), &physicalDeviceDispatch, VK_NULL_HANDLE, &deviceDispatch, VK_NULL_HANDLE, cache);
+            DestroyPipelineCache(VK_NULL_HANDLE, cache, nullptr);
+            return result;
+        }
+
+        // The entries of the cache created from the server's data.
+        ::std::string Fetch(const ::std::string& path) const
+        {
+            VkPipelineCacheCreateInfo createInfo{};
+            createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+
+            VkPipelineCache cache = VK_NULL_HANDLE;
+            if (VulkanDynamicCreateSharedPipelineCache(path.c_str(), &physicalDeviceDispatch, VK_NULL_HANDLE, &deviceDispatch, VK_NULL_HANDLE, &createInfo, nullptr, &cache) != VK_SUCCESS)
+            {
+                return "<failed>";
+            }
+
+            const PipelineCache* standInCache = reinterpret_cast<const PipelineCache*>(cache);
+            const ::std::string entries{ standInCache->data.begin() + HeaderSize, standInCache->data.end() };
+            DestroyPipelineCache(VK_NULL_HANDLE, cache, nullptr);
+            return entries;
+        }
+    };
+
+    // A connected socket that sends nothing, or -1.
+    int ConnectIdle(const ::std::string& path)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        ::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && ::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+        {
+            ::close(fd);
+            return -1;
+        }
+
+        return fd;
+    }
+
+    // Retries for up to two seconds, as the server handles connections on its own threads.
+    template<typename Condition>
+    bool Eventually(Condition condition)
+    {
+        const auto deadline = ::std::chrono::steady_clock::now() + ::std::chrono::seconds{ 2 };
+        while (!condition())
+        {
+            if (::std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+
+            ::usleep(10000);
+        }
+
+        return true;
+    }
+
+    // Leaves a socket file at the path, as a process that exited without closing does.
+    void BindStale(const ::std::string& path)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        ::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        Check(fd >= 0 && ::bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0, "bind stale socket");
+        ::close(fd);
+    }
+
+    void SharesPublishedCaches(const StandIn& standIn, const ::std::string& path)
+    {
+        VulkanDynamicPipelineCacheServer server = standIn.CreateServer(path);
+        Check(server != VK_NULL_HANDLE, "create server");
+
+        struct stat status;
+        Check(::stat(path.c_str(), &status) == 0 && (status.st_mode & 0777) == 0600, "socket is only accessible to its owner");
+
+        Check(standIn.Fetch(path).empty(), "nothing is shared before a publish");
+        Check(standIn.Publish(path, "first") == VK_SUCCESS, "publish first");
+        Check(standIn.Publish(path, "second") == VK_SUCCESS, "publish second");
+        Check(standIn.Fetch(path) == "firstsecond", "fetch merged entries");
+
+        VulkanDynamicPipelineCacheServerStatistics statistics{};
+        VulkanDynamicGetPipelineCacheServerStatistics(server, &statistics);
+        Check(statistics.publishCount == 2 && statistics.fetchCount == 2, "statistics count publishes and fetches");
+
+        VulkanDynamicDestroyPipelineCacheServer(server);
+        Check(::access(path.c_str(), F_OK) != 0, "socket file removed on destruction");
+        Check(standIn.Publish(path, "late") == VK_ERROR_INITIALIZATION_FAILED, "publish without a server fails");
+        Check(standIn.Fetch(path).empty(), "fetch without a server falls back to an empty cache");
+    }
+
+    void KeepsLiveServersPath(const StandIn& standIn, const ::std::string& path)
+    {
+        VulkanDynamicPipelineCacheServer server = standIn.CreateServer(path);
+
+        VkResult result = VK_SUCCESS;
+        Check(standIn.CreateServer(path, &result) == VK_NULL_HANDLE && result == VK_ERROR_FEATURE_NOT_PRESENT, "second server on a live path fails");
+        Check(standIn.Publish(path, "kept") == VK_SUCCESS, "first server still serves");
+
+        const auto start = ::std::chrono::steady_clock::now();
+        VulkanDynamicDestroyPipelineCacheServer(server);
+        Check(::std::chrono::steady_clock::now() - start < ::std::chrono::seconds{ 2 }, "destruction wakes the server at once");
+    }
+
+    void ReplacesStaleSockets(const StandIn& standIn, const ::std::string& path)
+    {
+        BindStale(path);
+
+        VulkanDynamicPipelineCacheServer server = standIn.CreateServer(path);
+        Check(server != VK_NULL_HANDLE, "server replaces a stale socket file");
+        VulkanDynamicDestroyPipelineCacheServer(server);
+    }
+
+    void KeepsOtherFiles(const StandIn& standIn, const ::std::string& path)
+    {
+        ::FILE* file = ::fopen(path.c_str(), "w");
+        Check(file != nullptr, "create regular file");
+        if (file)
+        {
+            ::fclose(file);
+        }
+
+        VkResult result = VK_SUCCESS;
+        Check(standIn.CreateServer(path, &result) == VK_NULL_HANDLE && result == VK_ERROR_FEATURE_NOT_PRESENT, "server fails on a regular file");
+        Check(::access(path.c_str(), F_OK) == 0, "regular file kept");
+        ::unlink(path.c_str());
+    }
+
+    // Clients that connect and send nothing must not hold up the others.
+    void ServesPastIdleClients(const StandIn& standIn, const ::std::string& path)
+    {
+        VulkanDynamicPipelineCacheServer server = standIn.CreateServer(path);
+
+        int idle[4];
+        for (int& fd : idle)
+        {
+            fd = ConnectIdle(path);
+            Check(fd >= 0, "connect idle client");
+        }
+
+        const auto start = ::std::chrono::steady_clock::now();
+        Check(standIn.Publish(path, "busy") == VK_SUCCESS, "publish next to idle clients");
+        Check(standIn.Fetch(path) == "busy", "fetch next to idle clients");
+        Check(::std::chrono::steady_clock::now() - start < ::std::chrono::seconds{ 2 }, "idle clients do not delay others");
+
+        for (int fd : idle)
+        {
+            ::close(fd);
+        }
+
+        VulkanDynamicDestroyPipelineCacheServer(server);
+    }
+    // A client announcing the largest publish and sending none of it holds what the server
+    // may receive at once, so others are turned away until it disconnects.
+    void BoundsWhatPeersHold(const StandIn& standIn, const ::std::string& path)
+    {
+        VulkanDynamicPipelineCacheServer server = standIn.CreateServer(path);
+
+        const int fd = ConnectIdle(path);
+        Message request{};
+        request.magic = MessageMagic;
+        request.operation = OperationPublish;
+        request.size = 1ull << 30;
+        Check(fd >= 0 && ::send(fd, &request, sizeof(request), 0) == static_cast<::ssize_t>(sizeof(request)), "announce a large publish");
+
+        Check(Eventually([&] { return standIn.Publish(path, "refused") == VK_ERROR_INITIALIZATION_FAILED; }), "publish refused while the server holds its limit");
+
+        ::close(fd);
+        Check(Eventually([&] { return standIn.Publish(path, "accepted") == VK_SUCCESS; }), "publish accepted once the holder disconnects");
+
+        VulkanDynamicDestroyPipelineCacheServer(server);
+    }
+
+    // Serves every fetch with the given entries to whoever connects, until killed.
+    void ServeForged(int listener, const char* entry)
+    {
+        for (;;)
+        {
+            const int fd = ::accept(listener, nullptr, nullptr);
+            if (fd < 0)
+            {
+                continue;
+            }
+
+            Message message{};
+            if (::recv(fd, &message, sizeof(message), MSG_WAITALL) == static_cast<::ssize_t>(sizeof(message)))
+            {
+                ::std::vector<unsigned char> data = Header();
+                data.insert(data.end(), entry, entry + ::strlen(entry));
+
+                message.result = VK_SUCCESS;
+                message.size = data.size();
+                ::send(fd, &message, sizeof(message), MSG_NOSIGNAL);
+                ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+            }
+
+            ::close(fd);
+        }
+    }
+
+    // A process of another user listening at the path first must not get to hand out cache
+    // data. Running the listener as another user takes root, so the check is skipped
+    // otherwise.
+    void RefusesServersOfOtherUsers(const StandIn& standIn)
+    {
+        constexpr ::uid_t OtherUser = 65534;
+        if (::geteuid() != 0)
+        {
+            return;
+        }
+
+        char directory[] = "/tmp/VulkanDynamic.Tests.Other.XXXXXX";
+        if (!::mkdtemp(directory) || ::chown(directory, OtherUser, OtherUser) != 0)
+        {
+            Check(false, "create a directory for the other user");
+            return;
+        }
+
+        const ::std::string path = ::std::string{ directory } + "/other.sock";
+
+        int ready[2];
+        Check(::pipe(ready) == 0, "create pipe");
+
+        const ::pid_t child = ::fork();
+        if (child == 0)
+        {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            ::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+            const int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (::setgid(OtherUser) != 0 || ::setuid(OtherUser) != 0 || listener < 0
+                || ::bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || ::chmod(path.c_str(), 0666) != 0
+                || ::listen(listener, 16) != 0)
+            {
+                ::_exit(1);
+            }
+
+            const char byte = 1;
+            if (::write(ready[1], &byte, 1) != 1)
+            {
+                ::_exit(1);
+            }
+
+            ServeForged(listener, "forged");
+        }
+
+        ::close(ready[1]);
+
+        char byte = 0;
+        Check(child > 0 && ::read(ready[0], &byte, 1) == 1, "other user listens");
+        ::close(ready[0]);
+
+        Check(standIn.Fetch(path).empty(), "data from another user's server ignored");
+        Check(standIn.Publish(path, "kept") == VK_ERROR_INITIALIZATION_FAILED, "publish to another user's server refused");
+
+        if (child > 0)
+        {
+            ::kill(child, SIGKILL);
+            ::waitpid(child, nullptr, 0);
+        }
+
+        ::unlink(path.c_str());
+        ::rmdir(directory);
+    }
+} // namespace
+
+int main()
+{
+    char directory[] = "/tmp/VulkanDynamic.Tests.XXXXXX";
+    if (!::mkdtemp(directory))
+    {
+        ::fprintf(stderr, "FAILED: create temporary directory\n");
+        return 1;
+    }
+
+    const ::std::string path = ::std::string{ directory } + "/service.sock";
+    const StandIn standIn;
+
+    SharesPublishedCaches(standIn, path);
+    KeepsLiveServersPath(standIn, path);
+    ReplacesStaleSockets(standIn, path);
+    KeepsOtherFiles(standIn, path);
+    ServesPastIdleClients(standIn, path);
+    BoundsWhatPeersHold(standIn, path);
+    RefusesServersOfOtherUsers(standIn);
+
+    ::unlink(path.c_str());
+    ::rmdir(directory);
+
+    return failureCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,358 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Pipeline compilers against a stand-in device table whose pipelines are the subpass
+// numbers of their create infos, and whose pipeline caches list the pipelines created with
+// them. A gate pipeline holds the compiler thread until the test has queued what follows.
+
+#include <VulkanDynamic/VulkanDynamicPipelineCompiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    ::std::atomic<int> failureCount{ 0 };
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            failureCount.fetch_add(1);
+        }
+    }
+
+    constexpr ::uint32_t GatePipeline = 1000;
+    constexpr ::uint32_t FailingPipeline = 2000;
+
+    struct PipelineCache
+    {
+        ::std::vector<::uint32_t> pipelines;
+    };
+
+    struct CreateCall
+    {
+        ::std::vector<::uint32_t> pipelines;
+        VkPipelineCache cache;
+    };
+
+    ::std::mutex mutex;
+    ::std::condition_variable gateChanged;
+    bool gateOpen = false;
+    ::std::vector<CreateCall> createCalls;
+    ::uint32_t initialDataCacheCount = 0;
+
+    void OpenGate()
+    {
+        const ::std::lock_guard<::std::mutex> lock{ mutex };
+        gateOpen = true;
+        gateChanged.notify_all();
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(VkDevice, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkPipelineCache* pPipelineCache)
+    {
+        PipelineCache* cache = new PipelineCache{};
+        if (pCreateInfo->initialDataSize)
+        {
+            const ::uint32_t* pipelines = static_cast<const ::uint32_t*>(pCreateInfo->pInitialData);
+            cache->pipelines.assign(pipelines, pipelines + pCreateInfo->initialDataSize / sizeof(::uint32_t));
+
+            const ::std::lock_guard<::std::mutex> lock{ mutex };
+            ++initialDataCacheCount;
+        }
+
+        *pPipelineCache = reinterpret_cast<VkPipelineCache>(cache);
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(VkDevice, VkPipelineCache pipelineCache, const VkAllocationCallbacks*)
+    {
+        delete reinterpret_cast<PipelineCache*>(pipelineCache);
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData)
+    {
+        const PipelineCache* cache = reinterpret_cast<const PipelineCache*>(pipelineCache);
+        const ::size_t size = cache->pipelines.size() * sizeof(::uint32_t);
+        if (pData)
+        {
+            ::std::memcpy(pData, cache->pipelines.data(), *pDataSize < size ? *pDataSize : size);
+        }
+
+        const VkResult result = pData && *pDataSize < size ? VK_INCOMPLETE : VK_SUCCESS;
+        *pDataSize = pData && *pDataSize < size ? *pDataSize : size;
+        return result;
+    }
+
+    // Merges are made once the compiler threads are idle, so the caches need no lock.
+    VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(VkDevice, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches)
+    {
+        PipelineCache* destination = reinterpret_cast<PipelineCache*>(dstCache);
+        for (uint32_t index = 0; index < srcCacheCount; ++index)
+        {
+            const PipelineCache* source = reinterpret_cast<const PipelineCache*>(pSrcCaches[index]);
+            for (::uint32_t pipeline : source->pipelines)
+            {
+                if (::std::find(destination->pipelines.begin(), destination->pipelines.end(), pipeline) == destination->pipelines.end())
+                {
+                    destination->pipelines.push_back(pipeline);
+                }
+            }
+        }
+
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks*, VkPipeline* pPipelines)
+    {
+        ::std::unique_lock<::std::mutex> lock{ mutex };
+
+        CreateCall call{ {}, pipelineCache };
+        VkResult result = VK_SUCCESS;
+        for (uint32_t index = 0; index < createInfoCount; ++index)
+        {
+            const ::uint32_t pipeline = pCreateInfos[index].subpass;
+            call.pipelines.push_back(pipeline);
+
+            if (pipeline == GatePipeline)
+            {
+                gateChanged.wait(lock, [] { return gateOpen; });
+            }
+
+            if (pipeline == FailingPipeline)
+            {
+                pPipelines[index] = VK_NULL_HANDLE;
+                result = VK_PIPELINE_COMPILE_REQUIRED_EXT;
+                continue;
+            }
+
+            pPipelines[index] = reinterpret_cast<VkPipeline>(static_cast<::uintptr_t>(pipeline));
+            if (pipelineCache != VK_NULL_HANDLE)
+            {
+                reinterpret_cast<PipelineCache*>(pipelineCache)->pipelines.push_back(pipeline);
+            }
+        }
+
+        createCalls.push_back(call);
+        return result;
+    }
+
+    ::std::vector<VkGraphicsPipelineCreateInfo> CreateInfos(::std::vector<::uint32_t> pipelines)
+    {
+        ::std::vector<VkGraphicsPipelineCreateInfo> createInfos(pipelines.size());
+        for (::size_t index = 0; index < pipelines.size(); ++index)
+        {
+            createInfos[index].sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+            createInfos[index].subpass = pipelines[index];
+            createInfos[index].basePipelineIndex = -1;
+        }
+
+        return createInfos;
+    }
+
+    void Reset()
+    {
+        const ::std::lock_guard<::std::mutex> lock{ mutex };
+        gateOpen = false;
+        createCalls.clear();
+        initialDataCacheCount = 0;
+    }
+
+    struct Completion
+    {
+        ::std::vector<VkResult> results;
+        ::std::atomic<::uint32_t> count{ 0 };
+    };
+
+    void VKAPI_CALL Complete(void* userData, uint32_t index, VkResult result)
+    {
+        Completion& completion = *static_cast<Completion*>(userData);
+        completion.results[index] = result;
+        completion.count.fetch_add(1);
+    }
+
+    void CompilesInPriorityOrder(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        Reset();
+
+        VulkanDynamicPipelineCompiler compiler = VK_NULL_HANDLE;
+        Check(VulkanDynamicCreatePipelineCompiler(&dispatch, VK_NULL_HANDLE, 1, VK_NULL_HANDLE, &compiler) == VK_SUCCESS, "create compiler");
+
+        ::std::vector<VkGraphicsPipelineCreateInfo> gate = CreateInfos({ GatePipeline });
+        ::std::vector<VkGraphicsPipelineCreateInfo> low = CreateInfos({ 1, 2 });
+        ::std::vector<VkGraphicsPipelineCreateInfo> high = CreateInfos({ 3, 4 });
+        ::std::vector<VkGraphicsPipelineCreateInfo> middle = CreateInfos({ 5, 6 });
+        ::std::vector<VkGraphicsPipelineCreateInfo> laterHigh = CreateInfos({ 7 });
+
+        // Pipelines 9 and 10 derive from pipeline 8 of their batch.
+        ::std::vector<VkGraphicsPipelineCreateInfo> derived = CreateInfos({ 8, 9, 10 });
+        derived[0].flags = VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT;
+        derived[1].flags = VK_PIPELINE_CREATE_DERIVATIVE_BIT;
+        derived[1].basePipelineIndex = 0;
+        derived[2].flags = VK_PIPELINE_CREATE_DERIVATIVE_BIT;
+        derived[2].basePipelineIndex = 0;
+
+        VkPipeline pipelines[6][3] = {};
+        Completion completion;
+        completion.results.assign(3, VK_INCOMPLETE);
+
+        VulkanDynamicCompileGraphicsPipelines(compiler, 10, 1, gate.data(), pipelines[0], nullptr, nullptr);
+        VulkanDynamicCompileGraphicsPipelines(compiler, 0, 2, low.data(), pipelines[1], nullptr, nullptr);
+        VulkanDynamicCompileGraphicsPipelines(compiler, 5, 2, high.data(), pipelines[2], nullptr, nullptr);
+        VulkanDynamicCompileGraphicsPipelines(compiler, 2, 2, middle.data(), pipelines[3], nullptr, nullptr);
+        VulkanDynamicCompileGraphicsPipelines(compiler, 5, 1, laterHigh.data(), pipelines[4], nullptr, nullptr);
+        VulkanDynamicCompileGraphicsPipelines(compiler, 1, 3, derived.data(), pipelines[5], &Complete, &completion);
+
+        OpenGate();
+        Check(VulkanDynamicWaitPipelineCompilerIdle(compiler) == VK_SUCCESS, "wait idle");
+
+        ::std::vector<::std::vector<::uint32_t>> order;
+        for (const CreateCall& call : createCalls)
+        {
+            order.push_back(call.pipelines);
+        }
+
+        const ::std::vector<::std::vector<::uint32_t>> expected = { { GatePipeline }, { 3 }, { 4 }, { 7 }, { 5 }, { 6 }, { 8, 9, 10 }, { 1 }, { 2 } };
+        Check(order == expected, "higher priorities first, then in the order passed, derivatives in one call");
+
+        Check(pipelines[2][0] == reinterpret_cast<VkPipeline>(::uintptr_t{ 3 }) && pipelines[5][2] == reinterpret_cast<VkPipeline>(::uintptr_t{ 10 }), "pipelines written");
+        Check(completion.count.load() == 3 && completion.results == ::std::vector<VkResult>(3, VK_SUCCESS), "callback per pipeline of a derivative batch");
+
+        VulkanDynamicPipelineCompilerStatistics statistics{};
+        VulkanDynamicGetPipelineCompilerStatistics(compiler, &statistics);
+        Check(statistics.compiledCount == 11 && statistics.failedCount == 0, "compiled pipelines counted");
+
+        VulkanDynamicDestroyPipelineCompiler(compiler);
+    }
+
+    void ReportsEachPipeline(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        Reset();
+        OpenGate();
+
+        VulkanDynamicPipelineCompiler compiler = VK_NULL_HANDLE;
+        VulkanDynamicCreatePipelineCompiler(&dispatch, VK_NULL_HANDLE, 2, VK_NULL_HANDLE, &compiler);
+
+        const ::std::vector<VkGraphicsPipelineCreateInfo> createInfos = CreateInfos({ 1, FailingPipeline, 3 });
+        ::std::vector<::std::future<::VulkanDynamic::CompiledPipeline>> futures = ::VulkanDynamic::CompilePipelinesAsync(compiler, 0, 3, createInfos.data());
+        Check(futures.size() == 3, "future per pipeline");
+
+        if (futures.size() == 3)
+        {
+            const ::VulkanDynamic::CompiledPipeline first = futures[0].get();
+            const ::VulkanDynamic::CompiledPipeline failed = futures[1].get();
+            const ::VulkanDynamic::CompiledPipeline last = futures[2].get();
+            Check(first.result == VK_SUCCESS && first.pipeline == reinterpret_cast<VkPipeline>(::uintptr_t{ 1 }), "first pipeline compiled");
+            Check(failed.result == VK_PIPELINE_COMPILE_REQUIRED_EXT && failed.pipeline == VK_NULL_HANDLE, "failed pipeline reports its result");
+            Check(last.result == VK_SUCCESS && last.pipeline == reinterpret_cast<VkPipeline>(::uintptr_t{ 3 }), "last pipeline compiled");
+        }
+
+        VulkanDynamicPipelineCompilerStatistics statistics{};
+        VulkanDynamicGetPipelineCompilerStatistics(compiler, &statistics);
+        Check(statistics.compiledCount == 2 && statistics.failedCount == 1, "failed pipelines counted");
+
+        VulkanDynamicDestroyPipelineCompiler(compiler);
+    }
+
+    void MergesThreadCaches(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        Reset();
+        OpenGate();
+
+        VkPipelineCacheCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+
+        VkPipelineCache pipelineCache = VK_NULL_HANDLE;
+        CreatePipelineCache(VK_NULL_HANDLE, &createInfo, nullptr, &pipelineCache);
+        PipelineCache& cache = *reinterpret_cast<PipelineCache*>(pipelineCache);
+        cache.pipelines.push_back(99);
+
+        VulkanDynamicPipelineCompiler compiler = VK_NULL_HANDLE;
+        VulkanDynamicCreatePipelineCompiler(&dispatch, VK_NULL_HANDLE, 2, pipelineCache, &compiler);
+        Check(initialDataCacheCount == 2, "thread caches start with the compiler's cache");
+
+        const ::std::vector<VkGraphicsPipelineCreateInfo> first = CreateInfos({ 1, 2, 3 });
+        VkPipeline firstPipelines[3] = {};
+        VulkanDynamicCompileGraphicsPipelines(compiler, 0, 3, first.data(), firstPipelines, nullptr, nullptr);
+        VulkanDynamicWaitPipelineCompilerIdle(compiler);
+
+        bool threadCaches = true;
+        for (const CreateCall& call : createCalls)
+        {
+            threadCaches = threadCaches && call.cache != VK_NULL_HANDLE && call.cache != pipelineCache;
+        }
+
+        Check(threadCaches, "pipelines compiled into thread caches");
+        Check(cache.pipelines.size() == 4, "thread caches merged when idle");
+
+        const ::std::vector<VkGraphicsPipelineCreateInfo> second = CreateInfos({ 4, 5 });
+        VkPipeline secondPipelines[2] = {};
+        VulkanDynamicCompileGraphicsPipelines(compiler, 0, 2, second.data(), secondPipelines, nullptr, nullptr);
+        VulkanDynamicDestroyPipelineCompiler(compiler);
+
+        Check(cache.pipelines.size() == 6 && secondPipelines[1] != VK_NULL_HANDLE, "outstanding pipelines compiled and merged on destruction");
+
+        DestroyPipelineCache(VK_NULL_HANDLE, pipelineCache, nullptr);
+    }
+
+    void CompilesWithoutCacheEntryPoints(VulkanDynamicDeviceDispatch dispatch)
+    {
+        Reset();
+        OpenGate();
+
+        dispatch.CreatePipelineCache = nullptr;
+        dispatch.MergePipelineCaches = nullptr;
+
+        VulkanDynamicPipelineCompiler compiler = VK_NULL_HANDLE;
+        Check(VulkanDynamicCreatePipelineCompiler(&dispatch, VK_NULL_HANDLE, 2, VK_NULL_HANDLE, &compiler) == VK_SUCCESS, "create compiler without cache entry points");
+
+        const ::std::vector<VkGraphicsPipelineCreateInfo> createInfos = CreateInfos({ 1, 2 });
+        VkPipeline pipelines[2] = {};
+        VulkanDynamicCompileGraphicsPipelines(compiler, 0, 2, createInfos.data(), pipelines, nullptr, nullptr);
+        Check(VulkanDynamicWaitPipelineCompilerIdle(compiler) == VK_SUCCESS, "wait idle without merges");
+        Check(pipelines[0] != VK_NULL_HANDLE && pipelines[1] != VK_NULL_HANDLE, "pipelines compiled without thread caches");
+        Check(createCalls.size() == 2 && createCalls[0].cache == VK_NULL_HANDLE, "no cache passed");
+
+        VkComputePipelineCreateInfo compute{};
+        compute.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        Check(VulkanDynamicCompileComputePipelines(compiler, 0, 1, &compute, pipelines, nullptr, nullptr) == VK_ERROR_EXTENSION_NOT_PRESENT, "missing create entry point refused");
+
+        VulkanDynamicDestroyPipelineCompiler(compiler);
+    }
+} // namespace
+
+int main()
+{
+    VulkanDynamicDeviceDispatch dispatch{};
+    dispatch.CreatePipelineCache = &CreatePipelineCache;
+    dispatch.DestroyPipelineCache = &DestroyPipelineCache;
+    dispatch.GetPipelineCacheData = &GetPipelineCacheData;
+    dispatch.MergePipelineCaches = &MergePipelineCaches;
+    dispatch.CreateGraphicsPipelines = &CreateGraphicsPipelines;
+
+    CompilesInPriorityOrder(dispatch);
+    ReportsEachPipeline(dispatch);
+    MergesThreadCaches(dispatch);
+    CompilesWithoutCacheEntryPoints(dispatch);
+
+    return failureCount.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,274 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Redundant state filtering against a stand-in device table that logs every call the
+// recorder forwards, with the range it was forwarded with.
+
+#include <VulkanDynamic/VulkanDynamicStateFilter.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+    int failureCount = 0;
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            ++failureCount;
+        }
+    }
+
+    struct Call
+    {
+        ::std::string name;
+        ::uint32_t first;
+        ::uint32_t count;
+    };
+
+    ::std::vector<Call> calls;
+
+    bool Forwarded(const char* name, ::uint32_t first = 0, ::uint32_t count = 0)
+    {
+        const bool forwarded = calls.size() == 1 && calls[0].name == name && calls[0].first == first && calls[0].count == count;
+        calls.clear();
+        return forwarded;
+    }
+
+    bool Elided()
+    {
+        const bool elided = calls.empty();
+        calls.clear();
+        return elided;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer, VkPipelineBindPoint, VkPipeline)
+    {
+        calls.push_back(Call{ "CmdBindPipeline", 0, 0 });
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport*)
+    {
+        calls.push_back(Call{ "CmdSetViewport", firstViewport, viewportCount });
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D*)
+    {
+        calls.push_back(Call{ "CmdSetScissor", firstScissor, scissorCount });
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer, VkPipelineBindPoint, VkPipelineLayout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet*, uint32_t, const uint32_t*)
+    {
+        calls.push_back(Call{ "CmdBindDescriptorSets", firstSet, descriptorSetCount });
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer*, const VkDeviceSize*)
+    {
+        calls.push_back(Call{ "CmdBindVertexBuffers", firstBinding, bindingCount });
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer, uint32_t commandBufferCount, const VkCommandBuffer*)
+    {
+        calls.push_back(Call{ "CmdExecuteCommands", 0, commandBufferCount });
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(VkCommandBuffer, VkPipelineBindPoint, VkPipelineLayout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet*)
+    {
+        calls.push_back(Call{ "CmdPushDescriptorSetKHR", set, descriptorWriteCount });
+    }
+
+    VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(VkCommandBuffer, VkCullModeFlags)
+    {
+        calls.push_back(Call{ "CmdSetCullModeEXT", 0, 0 });
+    }
+
+    template<typename Handle>
+    Handle MakeHandle(::uintptr_t value)
+    {
+        return reinterpret_cast<Handle>(value);
+    }
+
+    VkViewport MakeViewport(float width)
+    {
+        return VkViewport{ 0.0f, 0.0f, width, 1.0f, 0.0f, 1.0f };
+    }
+
+    ::VulkanDynamic::FilteringCommandBufferRecorder MakeRecorder(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        calls.clear();
+        return ::VulkanDynamic::FilteringCommandBufferRecorder{ MakeHandle<VkCommandBuffer>(0x10), dispatch };
+    }
+
+    void TrimsPartialRanges(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        ::VulkanDynamic::FilteringCommandBufferRecorder recorder = MakeRecorder(dispatch);
+
+        VkViewport viewports[] = { MakeViewport(1.0f), MakeViewport(2.0f), MakeViewport(3.0f) };
+        recorder.CmdSetViewport(0, 3, viewports);
+        Check(Forwarded("CmdSetViewport", 0, 3), "first viewports forwarded");
+
+        viewports[1] = MakeViewport(4.0f);
+        recorder.CmdSetViewport(0, 3, viewports);
+        Check(Forwarded("CmdSetViewport", 1, 1), "viewport update trimmed to the changed viewport");
+
+        recorder.CmdSetViewport(0, 3, viewports);
+        Check(Elided(), "unchanged viewports elided");
+
+        VkBuffer buffers[] = { MakeHandle<VkBuffer>(1), MakeHandle<VkBuffer>(2), MakeHandle<VkBuffer>(3), MakeHandle<VkBuffer>(4) };
+        VkDeviceSize offsets[] = { 0, 0, 0, 0 };
+        recorder.CmdBindVertexBuffers(0, 4, buffers, offsets);
+        Check(Forwarded("CmdBindVertexBuffers", 0, 4), "first vertex buffers forwarded");
+
+        offsets[2] = 64;
+        buffers[3] = MakeHandle<VkBuffer>(5);
+        recorder.CmdBindVertexBuffers(0, 4, buffers, offsets);
+        Check(Forwarded("CmdBindVertexBuffers", 2, 2), "vertex buffer update trimmed to the changed bindings");
+
+        recorder.CmdBindVertexBuffers(1, 2, buffers + 1, offsets + 1);
+        Check(Elided(), "unchanged vertex buffer subrange elided");
+
+        Check(recorder.ElidedCallCount(VULKANDYNAMIC_COMMAND_BUFFER_FUNCTION_ID_CmdSetViewport) == 1, "elided viewport calls counted");
+        Check(recorder.ElidedCallCount() == 2, "elided calls counted");
+    }
+
+    void ResetsDynamicStateOnGraphicsPipelineBinds(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        ::VulkanDynamic::FilteringCommandBufferRecorder recorder = MakeRecorder(dispatch);
+
+        const VkViewport viewport = MakeViewport(1.0f);
+        recorder.CmdSetViewport(0, 1, &viewport);
+        recorder.CmdSetCullModeEXT(VK_CULL_MODE_BACK_BIT);
+        calls.clear();
+
+        recorder.CmdBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, MakeHandle<VkPipeline>(1));
+        Check(Forwarded("CmdBindPipeline"), "pipeline bind forwarded");
+
+        recorder.CmdSetCullModeEXT(VK_CULL_MODE_BACK_BIT);
+        Check(Forwarded("CmdSetCullModeEXT"), "cull mode forwarded after a graphics pipeline bind");
+
+        recorder.CmdSetViewport(0, 1, &viewport);
+        Check(Forwarded("CmdSetViewport", 0, 1), "viewport forwarded after a graphics pipeline bind");
+
+        recorder.CmdBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, MakeHandle<VkPipeline>(1));
+        Check(Elided(), "rebinding the bound pipeline elided");
+
+        recorder.CmdSetCullModeEXT(VK_CULL_MODE_BACK_BIT);
+        Check(Elided(), "an elided pipeline bind keeps the dynamic state");
+
+        recorder.CmdBindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, MakeHandle<VkPipeline>(2));
+        Check(Forwarded("CmdBindPipeline"), "compute pipeline bind forwarded");
+
+        recorder.CmdSetViewport(0, 1, &viewport);
+        Check(Elided(), "a compute pipeline bind keeps the graphics dynamic state");
+    }
+
+    void ForgetsDescriptorSetsOnPushDescriptors(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        ::VulkanDynamic::FilteringCommandBufferRecorder recorder = MakeRecorder(dispatch);
+
+        const VkPipelineLayout layout = MakeHandle<VkPipelineLayout>(1);
+        const VkDescriptorSet sets[] = { MakeHandle<VkDescriptorSet>(1), MakeHandle<VkDescriptorSet>(2) };
+
+        recorder.CmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 2, sets, 0, nullptr);
+        recorder.CmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, layout, 0, 2, sets, 0, nullptr);
+        calls.clear();
+
+        recorder.CmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 2, sets, 0, nullptr);
+        Check(Elided(), "rebinding bound descriptor sets elided");
+
+        const ::uint32_t dynamicOffset = 0;
+        recorder.CmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 1, sets, 1, &dynamicOffset);
+        Check(Forwarded("CmdBindDescriptorSets", 0, 1), "binds with dynamic offsets forwarded");
+
+        recorder.CmdPushDescriptorSetKHR(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 1, 0, nullptr);
+        Check(Forwarded("CmdPushDescriptorSetKHR", 1, 0), "push descriptors forwarded");
+
+        recorder.CmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 2, sets, 0, nullptr);
+        Check(Forwarded("CmdBindDescriptorSets", 0, 2), "descriptor sets forwarded after push descriptors");
+
+        recorder.CmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, layout, 0, 2, sets, 0, nullptr);
+        Check(Elided(), "push descriptors keep the sets of other bind points");
+
+        recorder.CmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, MakeHandle<VkPipelineLayout>(2), 1, 1, sets + 1, 0, nullptr);
+        Check(Forwarded("CmdBindDescriptorSets", 1, 1), "set bound with another layout forwarded");
+
+        recorder.CmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, layout, 0, 1, sets, 0, nullptr);
+        Check(Forwarded("CmdBindDescriptorSets", 0, 1), "sets of a replaced layout forgotten");
+    }
+
+    void InvalidatesEverythingOnExecuteCommands(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        ::VulkanDynamic::FilteringCommandBufferRecorder recorder = MakeRecorder(dispatch);
+
+        const VkPipeline pipeline = MakeHandle<VkPipeline>(1);
+        const VkPipelineLayout layout = MakeHandle<VkPipelineLayout>(1);
+        const VkDescriptorSet set = MakeHandle<VkDescriptorSet>(1);
+        const VkBuffer buffer = MakeHandle<VkBuffer>(1);
+        const VkDeviceSize offset = 0;
+        const VkViewport viewport = MakeViewport(1.0f);
+        const VkRect2D scissor{ { 0, 0 }, { 1, 1 } };
+
+        auto bindAll = [&]
+        {
+            recorder.CmdBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+            recorder.CmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 1, &set, 0, nullptr);
+            recorder.CmdBindVertexBuffers(0, 1, &buffer, &offset);
+            recorder.CmdSetViewport(0, 1, &viewport);
+            recorder.CmdSetScissor(0, 1, &scissor);
+            recorder.CmdSetCullModeEXT(VK_CULL_MODE_BACK_BIT);
+        };
+
+        bindAll();
+        Check(calls.size() == 6, "first binds forwarded");
+        calls.clear();
+
+        bindAll();
+        Check(Elided(), "repeated binds elided");
+
+        const VkCommandBuffer secondary = MakeHandle<VkCommandBuffer>(0x20);
+        recorder.CmdExecuteCommands(1, &secondary);
+        Check(Forwarded("CmdExecuteCommands", 0, 1), "execute commands forwarded");
+
+        bindAll();
+        Check(calls.size() == 6, "binds after execute commands forwarded");
+        calls.clear();
+
+        Check(recorder.ElidedCallCount() == 6, "elided calls counted");
+    }
+} // namespace
+
+int main()
+{
+    ::VulkanDynamic::DeviceDispatch dispatch{};
+    dispatch.CmdBindPipeline = &CmdBindPipeline;
+    dispatch.CmdSetViewport = &CmdSetViewport;
+    dispatch.CmdSetScissor = &CmdSetScissor;
+    dispatch.CmdBindDescriptorSets = &CmdBindDescriptorSets;
+    dispatch.CmdBindVertexBuffers = &CmdBindVertexBuffers;
+    dispatch.CmdExecuteCommands = &CmdExecuteCommands;
+    dispatch.CmdPushDescriptorSetKHR = &CmdPushDescriptorSetKHR;
+    dispatch.CmdSetCullModeEXT = &CmdSetCullModeEXT;
+
+    TrimsPartialRanges(dispatch);
+    ResetsDynamicStateOnGraphicsPipelineBinds(dispatch);
+    ForgetsDescriptorSetsOnPushDescriptors(dispatch);
+    InvalidatesEverythingOnExecuteCommands(dispatch);
+
+    return failureCount == 0 ? 0 : 1;
+}
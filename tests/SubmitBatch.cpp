@@ -0,0 +1,320 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Submit batching against a stand-in device table that logs every queue operation it
+// receives: the command buffers and semaphores of each batch and the fence.
+
+#include <VulkanDynamic/VulkanDynamicSubmitBatch.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    int failureCount = 0;
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            ++failureCount;
+        }
+    }
+
+    template<typename Handle>
+    ::uintptr_t Id(Handle handle)
+    {
+        return reinterpret_cast<::uintptr_t>(handle);
+    }
+
+    template<typename Handle>
+    Handle MakeHandle(::uintptr_t value)
+    {
+        return reinterpret_cast<Handle>(value);
+    }
+
+    struct Batch
+    {
+        ::std::vector<::uintptr_t> commandBuffers;
+        ::std::vector<::uintptr_t> waitSemaphores;
+        ::std::vector<::uint64_t> signalValues;
+        const void* next;
+    };
+
+    enum class Operation
+    {
+        Submit,
+        Submit2,
+        WaitIdle,
+    };
+
+    struct Call
+    {
+        Operation operation;
+        ::std::vector<Batch> batches;
+        ::uintptr_t fence;
+    };
+
+    ::std::vector<Call> calls;
+    VkResult submitResult = VK_SUCCESS;
+
+    VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
+    {
+        Call call{ Operation::Submit, {}, Id(fence) };
+        for (uint32_t index = 0; index < submitCount; ++index)
+        {
+            const VkSubmitInfo& submit = pSubmits[index];
+
+            Batch batch{ {}, {}, {}, submit.pNext };
+            for (uint32_t commandBuffer = 0; commandBuffer < submit.commandBufferCount; ++commandBuffer)
+            {
+                batch.commandBuffers.push_back(Id(submit.pCommandBuffers[commandBuffer]));
+            }
+
+            for (uint32_t semaphore = 0; semaphore < submit.waitSemaphoreCount; ++semaphore)
+            {
+                batch.waitSemaphores.push_back(Id(submit.pWaitSemaphores[semaphore]));
+            }
+
+            const VkBaseInStructure* next = static_cast<const VkBaseInStructure*>(submit.pNext);
+            if (next && next->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+            {
+                const VkTimelineSemaphoreSubmitInfo* values = reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(next);
+                batch.signalValues.assign(values->pSignalSemaphoreValues, values->pSignalSemaphoreValues + values->signalSemaphoreValueCount);
+            }
+
+            call.batches.push_back(batch);
+        }
+
+        calls.push_back(call);
+        return submitResult;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(VkQueue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits, VkFence fence)
+    {
+        Call call{ Operation::Submit2, {}, Id(fence) };
+        for (uint32_t index = 0; index < submitCount; ++index)
+        {
+            const VkSubmitInfo2KHR& submit = pSubmits[index];
+
+            Batch batch{ {}, {}, {}, submit.pNext };
+            for (uint32_t commandBuffer = 0; commandBuffer < submit.commandBufferInfoCount; ++commandBuffer)
+            {
+                batch.commandBuffers.push_back(Id(submit.pCommandBufferInfos[commandBuffer].commandBuffer));
+            }
+
+            for (uint32_t semaphore = 0; semaphore < submit.signalSemaphoreInfoCount; ++semaphore)
+            {
+                batch.signalValues.push_back(submit.pSignalSemaphoreInfos[semaphore].value);
+            }
+
+            call.batches.push_back(batch);
+        }
+
+        calls.push_back(call);
+        return submitResult;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue)
+    {
+        calls.push_back(Call{ Operation::WaitIdle, {}, 0 });
+        return VK_SUCCESS;
+    }
+
+    VkQueue Queue()
+    {
+        return MakeHandle<VkQueue>(0x10);
+    }
+
+    // Never flushed by time: only the counts and explicit flush points apply.
+    constexpr ::std::chrono::steady_clock::duration NoDelay = ::std::chrono::hours{ 1 };
+
+    VkSubmitInfo SubmitInfo(const VkCommandBuffer& commandBuffer)
+    {
+        VkSubmitInfo submit{};
+        submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit.commandBufferCount = 1;
+        submit.pCommandBuffers = &commandBuffer;
+        return submit;
+    }
+
+    void KeepsBatchesInOrder(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        calls.clear();
+        ::VulkanDynamic::SubmitBatch batch{ Queue(), dispatch, 64, NoDelay };
+
+        const VkCommandBuffer commandBuffers[] = { MakeHandle<VkCommandBuffer>(1), MakeHandle<VkCommandBuffer>(2), MakeHandle<VkCommandBuffer>(3) };
+        const VkSemaphore semaphore = MakeHandle<VkSemaphore>(7);
+        const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        const ::uint64_t signalValue = 42;
+
+        // The middle batch waits for what the first signals, with a timeline value.
+        VkSubmitInfo first = SubmitInfo(commandBuffers[0]);
+        first.signalSemaphoreCount = 1;
+        first.pSignalSemaphores = &semaphore;
+
+        VkTimelineSemaphoreSubmitInfo values{};
+        values.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        values.signalSemaphoreValueCount = 1;
+        values.pSignalSemaphoreValues = &signalValue;
+
+        VkSubmitInfo second = SubmitInfo(commandBuffers[1]);
+        second.pNext = &values;
+        second.waitSemaphoreCount = 1;
+        second.pWaitSemaphores = &semaphore;
+        second.pWaitDstStageMask = &waitStage;
+
+        const VkSubmitInfo third = SubmitInfo(commandBuffers[2]);
+
+        Check(batch.QueueSubmit(1, &first, VK_NULL_HANDLE) == VK_SUCCESS, "first submit");
+        Check(batch.QueueSubmit(1, &second, VK_NULL_HANDLE) == VK_SUCCESS, "second submit");
+        Check(batch.QueueSubmit(1, &third, VK_NULL_HANDLE) == VK_SUCCESS, "third submit");
+        Check(calls.empty(), "submits held until flushed");
+
+        Check(batch.Flush() == VK_SUCCESS, "flush");
+        Check(calls.size() == 1 && calls[0].operation == Operation::Submit && calls[0].batches.size() == 3, "submits emitted as one call");
+        if (calls.size() == 1 && calls[0].batches.size() == 3)
+        {
+            const ::std::vector<Batch>& batches = calls[0].batches;
+            Check(batches[0].commandBuffers == ::std::vector<::uintptr_t>{ 1 } && batches[1].commandBuffers == ::std::vector<::uintptr_t>{ 2 }
+                && batches[2].commandBuffers == ::std::vector<::uintptr_t>{ 3 }, "batches keep their order");
+            Check(batches[1].waitSemaphores == ::std::vector<::uintptr_t>{ 7 }, "wait semaphores kept");
+            Check(batches[1].signalValues == ::std::vector<::uint64_t>{ 42 }, "timeline values kept");
+            Check(!batches[0].next && !batches[2].next, "no timeline values where none were given");
+        }
+
+        const ::VulkanDynamic::SubmitBatchStatistics& statistics = batch.Statistics();
+        Check(statistics.submitCallCount == 3 && statistics.emittedCallCount == 1 && statistics.batchCount == 3, "submit statistics");
+    }
+
+    void FlushesAtFencesAndThresholds(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        const VkCommandBuffer commandBuffer = MakeHandle<VkCommandBuffer>(1);
+        const VkSubmitInfo submit = SubmitInfo(commandBuffer);
+
+        calls.clear();
+        {
+            ::VulkanDynamic::SubmitBatch batch{ Queue(), dispatch, 64, NoDelay };
+            batch.QueueSubmit(1, &submit, VK_NULL_HANDLE);
+            batch.QueueSubmit(1, &submit, MakeHandle<VkFence>(9));
+            Check(calls.size() == 1 && calls[0].batches.size() == 2 && calls[0].fence == 9, "fence flushes and covers the pending batches");
+        }
+
+        calls.clear();
+        {
+            ::VulkanDynamic::SubmitBatch batch{ Queue(), dispatch, 2, NoDelay };
+            batch.QueueSubmit(1, &submit, VK_NULL_HANDLE);
+            Check(calls.empty(), "below the batch count");
+            batch.QueueSubmit(1, &submit, VK_NULL_HANDLE);
+            Check(calls.size() == 1 && calls[0].batches.size() == 2, "batch count flushes");
+        }
+
+        calls.clear();
+        {
+            ::VulkanDynamic::SubmitBatch batch{ Queue(), dispatch, 64, ::std::chrono::steady_clock::duration::zero() };
+            batch.QueueSubmit(1, &submit, VK_NULL_HANDLE);
+            Check(calls.size() == 1, "expired delay flushes");
+        }
+
+        calls.clear();
+        {
+            ::VulkanDynamic::SubmitBatch batch{ Queue(), dispatch, 64, NoDelay };
+            batch.QueueSubmit(1, &submit, VK_NULL_HANDLE);
+            Check(batch.QueueWaitIdle() == VK_SUCCESS, "wait idle");
+            Check(calls.size() == 2 && calls[0].operation == Operation::Submit && calls[1].operation == Operation::WaitIdle, "wait idle flushes first");
+
+            batch.QueueSubmit(1, &submit, VK_NULL_HANDLE);
+        }
+
+        Check(calls.size() == 3 && calls[2].operation == Operation::Submit, "destruction flushes");
+    }
+
+    void ForwardsUnbatchableSubmits(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        calls.clear();
+        ::VulkanDynamic::SubmitBatch batch{ Queue(), dispatch, 64, NoDelay };
+
+        const VkCommandBuffer commandBuffer = MakeHandle<VkCommandBuffer>(1);
+        const VkSubmitInfo plain = SubmitInfo(commandBuffer);
+        batch.QueueSubmit(1, &plain, VK_NULL_HANDLE);
+
+        const VkBaseInStructure extension{ static_cast<VkStructureType>(1000999000), nullptr };
+        VkSubmitInfo extended = SubmitInfo(commandBuffer);
+        extended.pNext = &extension;
+        batch.QueueSubmit(1, &extended, VK_NULL_HANDLE);
+
+        Check(calls.size() == 2 && calls[0].batches.size() == 1 && !calls[0].batches[0].next, "pending batches flushed first");
+        Check(calls.size() == 2 && calls[1].batches.size() == 1 && calls[1].batches[0].next == &extension, "submit with another structure issued as it is");
+
+        // Synchronization2 submits batch together, and a legacy submit flushes them first.
+        calls.clear();
+        VkCommandBufferSubmitInfoKHR commandBufferInfo{};
+        commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR;
+        commandBufferInfo.commandBuffer = commandBuffer;
+
+        VkSemaphoreSubmitInfoKHR signalInfo{};
+        signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR;
+        signalInfo.semaphore = MakeHandle<VkSemaphore>(7);
+        signalInfo.value = 5;
+
+        VkSubmitInfo2KHR submit2{};
+        submit2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
+        submit2.commandBufferInfoCount = 1;
+        submit2.pCommandBufferInfos = &commandBufferInfo;
+        submit2.signalSemaphoreInfoCount = 1;
+        submit2.pSignalSemaphoreInfos = &signalInfo;
+
+        batch.QueueSubmit2KHR(1, &submit2, VK_NULL_HANDLE);
+        batch.QueueSubmit2KHR(1, &submit2, VK_NULL_HANDLE);
+        batch.QueueSubmit(1, &plain, VK_NULL_HANDLE);
+
+        Check(calls.size() == 2 && calls[0].operation == Operation::Submit2 && calls[0].batches.size() == 2, "synchronization2 submits batched");
+        Check(calls.size() == 2 && calls[0].batches[1].signalValues == ::std::vector<::uint64_t>{ 5 }, "semaphore infos kept");
+        Check(calls.size() == 2 && calls[1].operation == Operation::Submit && calls[1].batches.size() == 1, "legacy submit after synchronization2 ones issued alone");
+    }
+
+    void ReturnsFlushErrors(const ::VulkanDynamic::DeviceDispatch& dispatch)
+    {
+        calls.clear();
+        ::VulkanDynamic::SubmitBatch batch{ Queue(), dispatch, 64, NoDelay };
+
+        const VkCommandBuffer commandBuffer = MakeHandle<VkCommandBuffer>(1);
+        const VkSubmitInfo submit = SubmitInfo(commandBuffer);
+        batch.QueueSubmit(1, &submit, VK_NULL_HANDLE);
+
+        submitResult = VK_ERROR_DEVICE_LOST;
+        Check(batch.QueueSubmit(1, &submit, MakeHandle<VkFence>(9)) == VK_ERROR_DEVICE_LOST, "error of the flushing call returned");
+        submitResult = VK_SUCCESS;
+
+        Check(batch.Flush() == VK_SUCCESS && calls.size() == 1, "failed batches dropped");
+    }
+} // namespace
+
+int main()
+{
+    ::VulkanDynamic::DeviceDispatch dispatch{};
+    dispatch.QueueSubmit = &QueueSubmit;
+    dispatch.QueueSubmit2KHR = &QueueSubmit2KHR;
+    dispatch.QueueWaitIdle = &QueueWaitIdle;
+
+    KeepsBatchesInOrder(dispatch);
+    FlushesAtFencesAndThresholds(dispatch);
+    ForwardsUnbatchableSubmits(dispatch);
+    ReturnsFlushErrors(dispatch);
+
+    return failureCount == 0 ? 0 : 1;
+}
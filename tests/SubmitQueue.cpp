@@ -0,0 +1,266 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Submit queues against a stand-in device table that logs the command buffers, presented
+// images and issuing thread of every call, from producers enqueueing concurrently.
+
+#include <VulkanDynamic/VulkanDynamicSubmit.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    ::std::atomic<int> failureCount{ 0 };
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            failureCount.fetch_add(1);
+        }
+    }
+
+    template<typename Handle>
+    ::uintptr_t Id(Handle handle)
+    {
+        return reinterpret_cast<::uintptr_t>(handle);
+    }
+
+    template<typename Handle>
+    Handle MakeHandle(::uintptr_t value)
+    {
+        return reinterpret_cast<Handle>(value);
+    }
+
+    constexpr ::uintptr_t PresentBit = ::uintptr_t{ 1 } << 30;
+    constexpr ::uintptr_t LostBit = ::uintptr_t{ 1 } << 29;
+
+    // Only the submit thread writes these, and the main thread reads them after waiting for
+    // the queue to go idle.
+    ::std::vector<::uintptr_t> issued;
+    ::std::vector<::std::thread::id> issuingThreads;
+    bool presentResultsWritten = false;
+
+    VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence)
+    {
+        Check(Id(queue) == 0x10, "submits issued to the owned queue");
+
+        VkResult result = VK_SUCCESS;
+        for (uint32_t index = 0; index < submitCount; ++index)
+        {
+            for (uint32_t commandBuffer = 0; commandBuffer < pSubmits[index].commandBufferCount; ++commandBuffer)
+            {
+                const ::uintptr_t id = Id(pSubmits[index].pCommandBuffers[commandBuffer]);
+                issued.push_back(id);
+                result = (id & LostBit) ? VK_ERROR_DEVICE_LOST : result;
+            }
+        }
+
+        issuingThreads.push_back(::std::this_thread::get_id());
+        return result;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue, const VkPresentInfoKHR* pPresentInfo)
+    {
+        for (uint32_t index = 0; index < pPresentInfo->swapchainCount; ++index)
+        {
+            issued.push_back(PresentBit | pPresentInfo->pImageIndices[index]);
+        }
+
+        presentResultsWritten = presentResultsWritten || pPresentInfo->pResults;
+        issuingThreads.push_back(::std::this_thread::get_id());
+        return VK_SUBOPTIMAL_KHR;
+    }
+
+    struct Callback
+    {
+        ::std::atomic<::uint32_t> count{ 0 };
+        ::std::atomic<VkResult> result{ VK_NOT_READY };
+    };
+
+    void VKAPI_CALL Record(void* userData, VkResult result)
+    {
+        Callback& callback = *static_cast<Callback*>(userData);
+        callback.result.store(result);
+        callback.count.fetch_add(1);
+    }
+
+    VkResult EnqueueCommandBuffer(VulkanDynamicSubmitQueue submitQueue, ::uintptr_t id, Callback* callback = nullptr)
+    {
+        const VkCommandBuffer commandBuffer = MakeHandle<VkCommandBuffer>(id);
+
+        VkSubmitInfo submit{};
+        submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit.commandBufferCount = 1;
+        submit.pCommandBuffers = &commandBuffer;
+
+        return VulkanDynamicEnqueueSubmit(submitQueue, 1, &submit, VK_NULL_HANDLE, callback ? &Record : nullptr, callback);
+    }
+
+    void KeepsEachProducersOrder(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        issued.clear();
+        issuingThreads.clear();
+
+        VulkanDynamicSubmitQueue submitQueue = VK_NULL_HANDLE;
+        Check(VulkanDynamicCreateSubmitQueue(&dispatch, MakeHandle<VkQueue>(0x10), &submitQueue) == VK_SUCCESS, "create submit queue");
+
+        constexpr ::uintptr_t ProducerCount = 4;
+        constexpr ::uintptr_t RequestCount = 500;
+
+        ::std::vector<::std::thread> producers;
+        for (::uintptr_t producer = 0; producer < ProducerCount; ++producer)
+        {
+            producers.emplace_back([=]
+            {
+                for (::uintptr_t request = 0; request < RequestCount; ++request)
+                {
+                    Check(EnqueueCommandBuffer(submitQueue, (producer + 1) << 16 | request) == VK_SUCCESS, "enqueue submit");
+                }
+            });
+        }
+
+        for (::std::thread& producer : producers)
+        {
+            producer.join();
+        }
+
+        VulkanDynamicWaitSubmitQueueIdle(submitQueue);
+
+        Check(issued.size() == ProducerCount * RequestCount, "every request issued once");
+
+        ::uintptr_t next[ProducerCount] = {};
+        for (::uintptr_t id : issued)
+        {
+            const ::uintptr_t producer = (id >> 16) - 1;
+            Check(producer < ProducerCount && (id & 0xFFFF) == next[producer]++, "requests of a producer issued in order");
+        }
+
+        bool oneThread = !issuingThreads.empty() && issuingThreads[0] != ::std::this_thread::get_id();
+        for (const ::std::thread::id& thread : issuingThreads)
+        {
+            oneThread = oneThread && thread == issuingThreads[0];
+        }
+
+        Check(oneThread, "every call issued on the submit thread");
+
+        VulkanDynamicSubmitQueueStatistics statistics{};
+        VulkanDynamicGetSubmitQueueStatistics(submitQueue, &statistics);
+        Check(statistics.enqueuedCount == ProducerCount * RequestCount && statistics.issuedCount == ProducerCount * RequestCount && statistics.failedCount == 0, "queue statistics");
+
+        VulkanDynamicDestroySubmitQueue(submitQueue);
+    }
+
+    void IssuesCopiesInOrder(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        issued.clear();
+        issuingThreads.clear();
+
+        VulkanDynamicSubmitQueue submitQueue = VK_NULL_HANDLE;
+        VulkanDynamicCreateSubmitQueue(&dispatch, MakeHandle<VkQueue>(0x10), &submitQueue);
+
+        // The caller's array is overwritten right after the enqueue returns.
+        VkCommandBuffer commandBuffers[] = { MakeHandle<VkCommandBuffer>(1), MakeHandle<VkCommandBuffer>(2) };
+
+        VkSubmitInfo submit{};
+        submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit.commandBufferCount = 2;
+        submit.pCommandBuffers = commandBuffers;
+
+        Check(VulkanDynamicEnqueueSubmit(submitQueue, 1, &submit, VK_NULL_HANDLE, nullptr, nullptr) == VK_SUCCESS, "enqueue submit");
+        commandBuffers[0] = MakeHandle<VkCommandBuffer>(7);
+        commandBuffers[1] = MakeHandle<VkCommandBuffer>(7);
+
+        const VkSwapchainKHR swapchain = MakeHandle<VkSwapchainKHR>(0x20);
+        const uint32_t imageIndex = 3;
+        VkResult presentResult = VK_NOT_READY;
+
+        VkPresentInfoKHR present{};
+        present.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        present.swapchainCount = 1;
+        present.pSwapchains = &swapchain;
+        present.pImageIndices = &imageIndex;
+        present.pResults = &presentResult;
+
+        Callback presented;
+        Check(VulkanDynamicEnqueuePresentKHR(submitQueue, &present, &Record, &presented) == VK_SUCCESS, "enqueue present");
+
+        Callback lost;
+        EnqueueCommandBuffer(submitQueue, LostBit | 4, &lost);
+
+        VulkanDynamicWaitSubmitQueueIdle(submitQueue);
+
+        Check(issued == ::std::vector<::uintptr_t>{ 1, 2, PresentBit | 3, LostBit | 4 }, "present issued between the submits around it");
+        Check(!presentResultsWritten && presentResult == VK_NOT_READY, "present results left alone");
+        Check(presented.count.load() == 1 && presented.result.load() == VK_SUBOPTIMAL_KHR, "present callback gets the driver's result");
+        Check(lost.count.load() == 1 && lost.result.load() == VK_ERROR_DEVICE_LOST, "submit callback gets the driver's error");
+
+        VulkanDynamicSubmitQueueStatistics statistics{};
+        VulkanDynamicGetSubmitQueueStatistics(submitQueue, &statistics);
+        Check(statistics.issuedCount == 3 && statistics.failedCount == 1, "failed requests counted");
+
+        VulkanDynamicDestroySubmitQueue(submitQueue);
+    }
+
+    void RefusesWhatCannotBeIssued(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        issued.clear();
+        issuingThreads.clear();
+
+        VulkanDynamicSubmitQueue submitQueue = VK_NULL_HANDLE;
+        VulkanDynamicCreateSubmitQueue(&dispatch, MakeHandle<VkQueue>(0x10), &submitQueue);
+
+        const VkCommandBuffer commandBuffer = MakeHandle<VkCommandBuffer>(1);
+        const VkBaseInStructure extension{ static_cast<VkStructureType>(1000999000), nullptr };
+
+        VkSubmitInfo submit{};
+        submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit.pNext = &extension;
+        submit.commandBufferCount = 1;
+        submit.pCommandBuffers = &commandBuffer;
+
+        Check(VulkanDynamicEnqueueSubmit(submitQueue, 1, &submit, VK_NULL_HANDLE, nullptr, nullptr) == VK_ERROR_FEATURE_NOT_PRESENT, "submit with a structure that cannot be copied refused");
+
+        VkSubmitInfo2KHR submit2{};
+        submit2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
+        Check(VulkanDynamicEnqueueSubmit2KHR(submitQueue, 1, &submit2, VK_NULL_HANDLE, nullptr, nullptr) == VK_ERROR_EXTENSION_NOT_PRESENT, "submit without an entry point refused");
+
+        // Requests still enqueued are issued before the queue is destroyed.
+        for (::uintptr_t request = 0; request < 100; ++request)
+        {
+            EnqueueCommandBuffer(submitQueue, request);
+        }
+
+        VulkanDynamicDestroySubmitQueue(submitQueue);
+        Check(issued.size() == 100, "destruction issues pending requests");
+    }
+} // namespace
+
+int main()
+{
+    VulkanDynamicDeviceDispatch dispatch{};
+    dispatch.QueueSubmit = &QueueSubmit;
+    dispatch.QueuePresentKHR = &QueuePresentKHR;
+
+    KeepsEachProducersOrder(dispatch);
+    IssuesCopiesInOrder(dispatch);
+    RefusesWhatCannotBeIssued(dispatch);
+
+    return failureCount.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Sync pools against a stand-in device table whose fences and semaphores are counted live
+// objects, used from threads that exit while the pool lives on.
+
+#include <VulkanDynamic/VulkanDynamicSyncPool.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    ::std::atomic<int> failureCount{ 0 };
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            failureCount.fetch_add(1);
+        }
+    }
+
+    ::std::atomic<::uintptr_t> nextHandle{ 1 };
+    ::std::atomic<::int64_t> liveFences{ 0 };
+    ::std::atomic<::int64_t> liveSemaphores{ 0 };
+    ::std::atomic<::uint64_t> resetFenceCount{ 0 };
+
+    VKAPI_ATTR VkResult VKAPI_CALL CreateFence(VkDevice, const VkFenceCreateInfo*, const VkAllocationCallbacks*, VkFence* pFence)
+    {
+        *pFence = reinterpret_cast<VkFence>(nextHandle.fetch_add(1));
+        liveFences.fetch_add(1);
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice, VkFence, const VkAllocationCallbacks*)
+    {
+        liveFences.fetch_sub(1);
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice, uint32_t fenceCount, const VkFence*)
+    {
+        resetFenceCount.fetch_add(fenceCount);
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*, VkSemaphore* pSemaphore)
+    {
+        *pSemaphore = reinterpret_cast<VkSemaphore>(nextHandle.fetch_add(1));
+        liveSemaphores.fetch_add(1);
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice, VkSemaphore, const VkAllocationCallbacks*)
+    {
+        liveSemaphores.fetch_sub(1);
+    }
+
+    constexpr ::uint32_t ObjectCount = 8;
+
+    void CycleObjects(VulkanDynamicSyncPool pool)
+    {
+        VkFence fences[ObjectCount] = {};
+        VkSemaphore semaphores[ObjectCount] = {};
+        for (::uint32_t index = 0; index < ObjectCount; ++index)
+        {
+            Check(VulkanDynamicAcquireFence(pool, &fences[index]) == VK_SUCCESS, "acquire fence");
+            Check(VulkanDynamicAcquireSemaphore(pool, &semaphores[index]) == VK_SUCCESS, "acquire semaphore");
+        }
+
+        for (::uint32_t index = 0; index < ObjectCount; ++index)
+        {
+            VulkanDynamicReleaseFence(pool, fences[index]);
+            VulkanDynamicReleaseSemaphore(pool, semaphores[index]);
+        }
+    }
+
+    void ReclaimsListsOfExitedThreads(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        VulkanDynamicSyncPool pool = VK_NULL_HANDLE;
+        Check(VulkanDynamicCreateSyncPool(&dispatch, VK_NULL_HANDLE, nullptr, &pool) == VK_SUCCESS, "create sync pool");
+
+        // Each thread creates its objects and releases them to its own lists before exiting.
+        for (int round = 0; round < 4; ++round)
+        {
+            ::std::thread{ [=] { CycleObjects(pool); } }.join();
+        }
+
+        VulkanDynamicSyncPoolStatistics statistics{};
+        VulkanDynamicGetSyncPoolStatistics(pool, &statistics);
+        Check(statistics.fences.createdCount == ObjectCount && statistics.fences.reusedCount == 3 * ObjectCount, "later threads reuse the fences of exited ones");
+        Check(statistics.semaphores.createdCount == ObjectCount && statistics.semaphores.reusedCount == 3 * ObjectCount, "later threads reuse the semaphores of exited ones");
+        Check(statistics.fences.releasedCount == 4 * ObjectCount && statistics.semaphores.releasedCount == 4 * ObjectCount, "counters of exited threads kept");
+        Check(resetFenceCount.load() == 4 * ObjectCount, "fences released by exiting threads reset");
+
+        CycleObjects(pool);
+        VulkanDynamicGetSyncPoolStatistics(pool, &statistics);
+        Check(statistics.fences.createdCount == ObjectCount, "this thread reuses them too");
+
+        VulkanDynamicDestroySyncPool(pool);
+        Check(liveFences.load() == 0 && liveSemaphores.load() == 0, "pool destroys what it holds");
+    }
+
+    void TellsReplacedPoolsApart(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        // A pool allocated where the previous one was must not find that pool's lists.
+        for (int round = 0; round < 8; ++round)
+        {
+            VulkanDynamicSyncPool pool = VK_NULL_HANDLE;
+            VulkanDynamicCreateSyncPool(&dispatch, VK_NULL_HANDLE, nullptr, &pool);
+
+            VkFence fence = VK_NULL_HANDLE;
+            VulkanDynamicAcquireFence(pool, &fence);
+            VulkanDynamicReleaseFence(pool, fence);
+
+            VulkanDynamicSyncPoolStatistics statistics{};
+            VulkanDynamicGetSyncPoolStatistics(pool, &statistics);
+            Check(statistics.fences.createdCount == 1 && statistics.fences.releasedCount == 1, "new pool starts with new lists");
+
+            VulkanDynamicDestroySyncPool(pool);
+        }
+
+        Check(liveFences.load() == 0, "replaced pools destroy their fences");
+    }
+} // namespace
+
+int main()
+{
+    VulkanDynamicDeviceDispatch dispatch{};
+    dispatch.CreateFence = &CreateFence;
+    dispatch.DestroyFence = &DestroyFence;
+    dispatch.ResetFences = &ResetFences;
+    dispatch.CreateSemaphore = &CreateSemaphore;
+    dispatch.DestroySemaphore = &DestroySemaphore;
+
+    ReclaimsListsOfExitedThreads(dispatch);
+    TellsReplacedPoolsApart(dispatch);
+
+    return failureCount.load() == 0 ? 0 : 1;
+}
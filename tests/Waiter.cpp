@@ -0,0 +1,290 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Waiters against a stand-in device table whose fences are flags and whose timeline
+// semaphores are counters, both set from the test thread while the waiter blocks on them.
+
+#include <VulkanDynamic/VulkanDynamicWait.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+    ::std::atomic<int> failureCount{ 0 };
+
+    void Check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            ::fprintf(stderr, "FAILED: %s\n", message);
+            failureCount.fetch_add(1);
+        }
+    }
+
+    struct Fence
+    {
+        ::std::atomic<bool> signaled{ false };
+    };
+
+    struct Semaphore
+    {
+        ::std::atomic<::uint64_t> value{ 0 };
+    };
+
+    Fence* ToFence(VkFence fence)
+    {
+        return reinterpret_cast<Fence*>(fence);
+    }
+
+    VkFence ToHandle(Fence& fence)
+    {
+        return reinterpret_cast<VkFence>(&fence);
+    }
+
+    Semaphore* ToSemaphore(VkSemaphore semaphore)
+    {
+        return reinterpret_cast<Semaphore*>(semaphore);
+    }
+
+    VkSemaphore ToHandle(Semaphore& semaphore)
+    {
+        return reinterpret_cast<VkSemaphore>(&semaphore);
+    }
+
+    ::std::atomic<VkResult> fenceWaitResult{ VK_SUCCESS };
+    ::std::atomic<::uint64_t> shortestFenceTimeout{ UINT64_MAX };
+    ::std::atomic<::int32_t> liveSemaphores{ 0 };
+
+    // Polls in short steps, so a wait sees flags set while it blocks.
+    template<typename Ready>
+    VkResult Block(::uint64_t timeout, Ready ready)
+    {
+        const ::std::chrono::steady_clock::time_point deadline = timeout >= UINT64_MAX / 2
+            ? ::std::chrono::steady_clock::time_point::max()
+            : ::std::chrono::steady_clock::now() + ::std::chrono::nanoseconds{ timeout };
+        while (!ready())
+        {
+            if (::std::chrono::steady_clock::now() >= deadline)
+            {
+                return VK_TIMEOUT;
+            }
+
+            ::std::this_thread::sleep_for(::std::chrono::microseconds{ 50 });
+        }
+
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout)
+    {
+        Check(waitAll == VK_FALSE, "fences waited for any");
+
+        ::uint64_t shortest = shortestFenceTimeout.load();
+        while (timeout < shortest && !shortestFenceTimeout.compare_exchange_weak(shortest, timeout))
+        {
+        }
+
+        if (fenceWaitResult.load() != VK_SUCCESS)
+        {
+            return fenceWaitResult.load();
+        }
+
+        return Block(timeout, [&]
+        {
+            for (uint32_t index = 0; index < fenceCount; ++index)
+            {
+                if (ToFence(pFences[index])->signaled.load())
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        });
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(VkDevice, VkFence fence)
+    {
+        return ToFence(fence)->signaled.load() ? VK_SUCCESS : VK_NOT_READY;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*, VkSemaphore* pSemaphore)
+    {
+        liveSemaphores.fetch_add(1);
+        *pSemaphore = ToHandle(*new Semaphore{});
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice, VkSemaphore semaphore, const VkAllocationCallbacks*)
+    {
+        liveSemaphores.fetch_sub(1);
+        delete ToSemaphore(semaphore);
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(VkDevice, VkSemaphore semaphore, uint64_t* pValue)
+    {
+        *pValue = ToSemaphore(semaphore)->value.load();
+        return VK_SUCCESS;
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(VkDevice, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout)
+    {
+        Check(pWaitInfo->flags == VK_SEMAPHORE_WAIT_ANY_BIT, "semaphores waited for any");
+
+        return Block(timeout, [&]
+        {
+            for (uint32_t index = 0; index < pWaitInfo->semaphoreCount; ++index)
+            {
+                if (ToSemaphore(pWaitInfo->pSemaphores[index])->value.load() >= pWaitInfo->pValues[index])
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        });
+    }
+
+    VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(VkDevice, const VkSemaphoreSignalInfo* pSignalInfo)
+    {
+        ToSemaphore(pSignalInfo->semaphore)->value.store(pSignalInfo->value);
+        return VK_SUCCESS;
+    }
+
+    struct Completion
+    {
+        ::std::atomic<::uint32_t> count{ 0 };
+        ::std::atomic<VkResult> result{ VK_INCOMPLETE };
+    };
+
+    void VKAPI_CALL Complete(void* userData, VkResult result)
+    {
+        Completion& completion = *static_cast<Completion*>(userData);
+        completion.result.store(result);
+        completion.count.fetch_add(1);
+    }
+
+    bool Completed(const Completion& completion)
+    {
+        return Block(5000000000ull, [&] { return completion.count.load() != 0; }) == VK_SUCCESS;
+    }
+
+    void CompletesFencesAndSemaphores(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        // A zero timeout would spin on outstanding fences, so it is raised.
+        VulkanDynamicWaiter waiter = VK_NULL_HANDLE;
+        Check(VulkanDynamicCreateWaiter(&dispatch, VK_NULL_HANDLE, 0, &waiter) == VK_SUCCESS, "create waiter");
+
+        Fence fences[2];
+        Completion fenceCompletions[2];
+        for (int index = 0; index < 2; ++index)
+        {
+            Check(VulkanDynamicWaitForFenceAsync(waiter, ToHandle(fences[index]), &Complete, &fenceCompletions[index]) == VK_SUCCESS, "wait for fence");
+        }
+
+        // Semaphore values complete while fences are still outstanding.
+        Semaphore semaphore;
+        Completion semaphoreCompletion;
+        Check(VulkanDynamicWaitForSemaphoreAsync(waiter, ToHandle(semaphore), 3, &Complete, &semaphoreCompletion) == VK_SUCCESS, "wait for semaphore");
+        semaphore.value.store(2);
+        ::std::this_thread::sleep_for(::std::chrono::milliseconds{ 5 });
+        Check(semaphoreCompletion.count.load() == 0, "semaphore below its value pending");
+
+        semaphore.value.store(3);
+        Check(Completed(semaphoreCompletion) && semaphoreCompletion.result.load() == VK_SUCCESS, "semaphore completes during fence waits");
+
+        fences[1].signaled.store(true);
+        Check(Completed(fenceCompletions[1]) && fenceCompletions[1].result.load() == VK_SUCCESS, "signaled fence completes");
+        Check(fenceCompletions[0].count.load() == 0, "unsignaled fence pending");
+
+        fences[0].signaled.store(true);
+        Check(Completed(fenceCompletions[0]) && fenceCompletions[0].count.load() == 1, "fence completes once");
+
+        Check(shortestFenceTimeout.load() >= 1000000, "fence wait timeout raised");
+
+        // With no fences left, a new wait wakes the semaphore wait in progress.
+        Semaphore later;
+        Completion laterCompletion;
+        ::std::this_thread::sleep_for(::std::chrono::milliseconds{ 5 });
+        VulkanDynamicWaitForSemaphoreAsync(waiter, ToHandle(later), 1, &Complete, &laterCompletion);
+        later.value.store(1);
+        Check(Completed(laterCompletion), "semaphore waits woken by new waits");
+
+        VulkanDynamicWaiterStatistics statistics{};
+        VulkanDynamicGetWaiterStatistics(waiter, &statistics);
+        Check(statistics.completedCount == 4, "completed waits counted");
+
+        VulkanDynamicDestroyWaiter(waiter);
+        Check(liveSemaphores.load() == 0, "wake semaphore destroyed");
+    }
+
+    void ReportsErrorsAndDestruction(const VulkanDynamicDeviceDispatch& dispatch)
+    {
+        VulkanDynamicWaiter waiter = VK_NULL_HANDLE;
+        VulkanDynamicCreateWaiter(&dispatch, VK_NULL_HANDLE, 1000000, &waiter);
+
+        Fence pending;
+        Completion pendingCompletion;
+        VulkanDynamicWaitForFenceAsync(waiter, ToHandle(pending), &Complete, &pendingCompletion);
+        VulkanDynamicDestroyWaiter(waiter);
+        Check(pendingCompletion.count.load() == 1 && pendingCompletion.result.load() == VK_NOT_READY, "destruction completes outstanding waits");
+
+        VulkanDynamicCreateWaiter(&dispatch, VK_NULL_HANDLE, 1000000, &waiter);
+        fenceWaitResult.store(VK_ERROR_DEVICE_LOST);
+
+        Fence lost;
+        Completion lostCompletion;
+        VulkanDynamicWaitForFenceAsync(waiter, ToHandle(lost), &Complete, &lostCompletion);
+        Check(Completed(lostCompletion) && lostCompletion.result.load() == VK_ERROR_DEVICE_LOST, "failed fence wait reported");
+
+        fenceWaitResult.store(VK_SUCCESS);
+        VulkanDynamicDestroyWaiter(waiter);
+    }
+
+    void RefusesSemaphoresWithoutTimelines(VulkanDynamicDeviceDispatch dispatch)
+    {
+        dispatch.WaitSemaphores = nullptr;
+
+        VulkanDynamicWaiter waiter = VK_NULL_HANDLE;
+        VulkanDynamicCreateWaiter(&dispatch, VK_NULL_HANDLE, 1000000, &waiter);
+
+        Semaphore semaphore;
+        Completion completion;
+        Check(VulkanDynamicWaitForSemaphoreAsync(waiter, ToHandle(semaphore), 1, &Complete, &completion) == VK_ERROR_EXTENSION_NOT_PRESENT, "semaphore waits refused");
+
+        VulkanDynamicDestroyWaiter(waiter);
+    }
+} // namespace
+
+int main()
+{
+    VulkanDynamicDeviceDispatch dispatch{};
+    dispatch.WaitForFences = &WaitForFences;
+    dispatch.GetFenceStatus = &GetFenceStatus;
+    dispatch.CreateSemaphore = &CreateSemaphore;
+    dispatch.DestroySemaphore = &DestroySemaphore;
+    dispatch.GetSemaphoreCounterValue = &GetSemaphoreCounterValue;
+    dispatch.WaitSemaphores = &WaitSemaphores;
+    dispatch.SignalSemaphore = &SignalSemaphore;
+
+    CompletesFencesAndSemaphores(dispatch);
+    ReportsErrorsAndDestruction(dispatch);
+    RefusesSemaphoresWithoutTimelines(dispatch);
+
+    return failureCount.load() == 0 ? 0 : 1;
+}
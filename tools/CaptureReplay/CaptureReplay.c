@@ -0,0 +1,186 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicCapture.h>
+#include <VulkanDynamic/VulkanDynamicInstrument.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Replays a capture written by VulkanDynamicBeginCapture/EndCapture and reports the cost
+// per call. Captured handles are replayed unchanged, which only a stand-in driver that
+// never dereferences them survives, so calls go to a device only with --stand-in: the
+// device is created on the first physical device of the installed Vulkan loader, which
+// has to be pointed at the stand-in driver (e.g. with VK_DRIVER_FILES). --decode-only
+// measures decoding alone; --instrument replays through an instrumented table to measure
+// the instrumentation wrappers.
+
+typedef struct Device
+{
+    VulkanDynamicLoader loader;
+    VulkanDynamicInstanceDispatch instanceDispatch;
+    VkInstance instance;
+    VkDevice device;
+} Device;
+
+static int CreateDevice(Device* device, VulkanDynamicDeviceDispatch* deviceDispatch)
+{
+    memset(device, 0, sizeof(Device));
+    if (VulkanDynamicCreateLoader(&device->loader) != VK_SUCCESS)
+    {
+        return 0;
+    }
+
+    VulkanDynamicLoaderDispatch loaderDispatch;
+    VulkanDynamicGetLoaderDispatch(device->loader, &loaderDispatch);
+
+    VkApplicationInfo applicationInfo;
+    memset(&applicationInfo, 0, sizeof(VkApplicationInfo));
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_0;
+
+    VkInstanceCreateInfo instanceCreateInfo;
+    memset(&instanceCreateInfo, 0, sizeof(VkInstanceCreateInfo));
+    instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+
+    if (loaderDispatch.CreateInstance(&instanceCreateInfo, NULL, &device->instance) != VK_SUCCESS)
+    {
+        return 0;
+    }
+
+    VulkanDynamicGetInstanceDispatch(device->instance, &loaderDispatch, &device->instanceDispatch);
+
+    uint32_t physicalDeviceCount = 1;
+    VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+    device->instanceDispatch.EnumeratePhysicalDevices(device->instance, &physicalDeviceCount, &physicalDevice);
+    if (physicalDeviceCount == 0)
+    {
+        return 0;
+    }
+
+    const float queuePriority = 1.0f;
+    VkDeviceQueueCreateInfo queueCreateInfo;
+    memset(&queueCreateInfo, 0, sizeof(VkDeviceQueueCreateInfo));
+    queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueCount = 1;
+    queueCreateInfo.pQueuePriorities = &queuePriority;
+
+    VkDeviceCreateInfo deviceCreateInfo;
+    memset(&deviceCreateInfo, 0, sizeof(VkDeviceCreateInfo));
+    deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+
+    if (device->instanceDispatch.CreateDevice(physicalDevice, &deviceCreateInfo, NULL, &device->device) != VK_SUCCESS)
+    {
+        return 0;
+    }
+
+    return VulkanDynamicGetDeviceDispatch(device->device, &device->instanceDispatch, deviceDispatch) == VK_SUCCESS;
+}
+
+static void DestroyDevice(Device* device, const VulkanDynamicDeviceDispatch* deviceDispatch)
+{
+    if (device->device)
+    {
+        deviceDispatch->DestroyDevice(device->device, NULL);
+    }
+
+    if (device->instance)
+    {
+        device->instanceDispatch.DestroyInstance(device->instance, NULL);
+    }
+
+    if (device->loader)
+    {
+        VulkanDynamicDestroyLoader(device->loader);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const char* fileName = NULL;
+    uint32_t iterations = 1;
+    int decodeOnly = 0;
+    int standIn = 0;
+    int instrument = 0;
+
+    for (int index = 1; index < argc; ++index)
+    {
+        if (strcmp(argv[index], "--decode-only") == 0)
+        {
+            decodeOnly = 1;
+        }
+        else if (strcmp(argv[index], "--stand-in") == 0)
+        {
+            standIn = 1;
+        }
+        else if (strcmp(argv[index], "--instrument") == 0)
+        {
+            instrument = 1;
+        }
+        else if (strcmp(argv[index], "--iterations") == 0 && index + 1 < argc)
+        {
+            iterations = (uint32_t)strtoul(argv[++index], NULL, 10);
+        }
+        else
+        {
+            fileName = argv[index];
+        }
+    }
+
+    if (!fileName || iterations == 0 || decodeOnly == standIn)
+    {
+        fprintf(stderr, "Usage: %s <capture file> --decode-only|--stand-in [--iterations N] [--instrument]\n", argv[0]);
+        fprintf(stderr, "Captured handles are replayed unchanged: --stand-in requires a loader pointed at a stand-in driver\n");
+        return -1;
+    }
+
+    Device device;
+    memset(&device, 0, sizeof(Device));
+
+    VulkanDynamicDeviceDispatch deviceDispatch;
+    memset(&deviceDispatch, 0, sizeof(VulkanDynamicDeviceDispatch));
+    if (!decodeOnly && !CreateDevice(&device, &deviceDispatch))
+    {
+        fprintf(stderr, "Failed to create a Vulkan device on the stand-in driver, use --decode-only to replay without one\n");
+        DestroyDevice(&device, &deviceDispatch);
+        return -1;
+    }
+
+    VulkanDynamicDeviceDispatch replayDispatch = deviceDispatch;
+    if (instrument)
+    {
+        VulkanDynamicInstrumentDeviceDispatch(&deviceDispatch, 1, &replayDispatch);
+    }
+
+    VulkanDynamicReplayStatistics statistics;
+    const VkResult result = VulkanDynamicReplayCapture(fileName, &replayDispatch, iterations, &statistics);
+    if (result != VK_SUCCESS)
+    {
+        fprintf(stderr, "Replay of '%s' failed: %d\n", fileName, (int)result);
+    }
+
+    const uint64_t recordCount = statistics.callCount + statistics.skippedCallCount;
+    printf("Replayed %" PRIu64 " records (%" PRIu64 " calls, %" PRIu64 " skipped) in %" PRIu64 " ns, %.1f ns per record\n",
+        recordCount, statistics.callCount, statistics.skippedCallCount, statistics.nanoseconds,
+        recordCount ? (double)statistics.nanoseconds / (double)recordCount : 0.0);
+
+    DestroyDevice(&device, &deviceDispatch);
+
+    return result == VK_SUCCESS ? 0 : -1;
+}
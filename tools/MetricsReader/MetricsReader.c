@@ -0,0 +1,106 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicMetrics.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static const char* TierNames[VULKANDYNAMIC_TIER_COUNT] = { "Loader", "Instance", "PhysicalDevice", "Device", "CommandBuffer" };
+
+// The segment is written by another process: its offsets and counts are checked against
+// the snapshot size before any function entry is read.
+static int FunctionsInBounds(size_t dataSize, uint32_t functionOffset, uint32_t functionCount)
+{
+    return functionOffset >= sizeof(VulkanDynamicMetricsHeader) && functionOffset <= dataSize
+        && (uint64_t)functionCount <= (dataSize - functionOffset) / sizeof(VulkanDynamicMetricsFunction);
+}
+
+static void PrintFunctions(const char* title, const VulkanDynamicMetricsFunction* functions, uint32_t functionCount)
+{
+    printf("%s\n", title);
+    for (uint32_t functionId = 0; functionId < functionCount; ++functionId)
+    {
+        const VulkanDynamicMetricsFunction* function = &functions[functionId];
+        if (function->callCount == 0)
+        {
+            continue;
+        }
+
+        const uint64_t averageNanoseconds = function->sampledCallCount ? function->sampledNanoseconds / function->sampledCallCount : 0;
+        printf("    %-48.*s calls %12" PRIu64 "  sampled %10" PRIu64 "  avg %10" PRIu64 " ns\n", VULKANDYNAMIC_METRICS_NAME_SIZE, function->name, function->callCount, function->sampledCallCount, averageNanoseconds);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <segment name>\n", argv[0]);
+        return -1;
+    }
+
+    VulkanDynamicMetricsSegment segment = VK_NULL_HANDLE;
+    if (VulkanDynamicOpenMetricsSegment(argv[1], &segment) != VK_SUCCESS)
+    {
+        fprintf(stderr, "Failed to open metrics segment '%s'\n", argv[1]);
+        return -1;
+    }
+
+    size_t dataSize = 0;
+    VulkanDynamicReadMetrics(segment, &dataSize, NULL);
+
+    unsigned char* data = (unsigned char*)malloc(dataSize);
+    if (!data || VulkanDynamicReadMetrics(segment, &dataSize, data) != VK_SUCCESS || dataSize < sizeof(VulkanDynamicMetricsHeader))
+    {
+        fprintf(stderr, "Failed to read metrics segment '%s'\n", argv[1]);
+        free(data);
+        VulkanDynamicDestroyMetricsSegment(segment);
+        return -1;
+    }
+
+    const VulkanDynamicMetricsHeader* header = (const VulkanDynamicMetricsHeader*)data;
+    printf("Segment %s: version %u, %" PRIu64 " bytes, published %" PRIu64 " times, last at %" PRIu64 " ns\n",
+        argv[1], header->version, header->size, header->publishCount, header->timestampNanoseconds);
+
+    printf("Resolution\n");
+    for (uint32_t tier = 0; tier < VULKANDYNAMIC_TIER_COUNT; ++tier)
+    {
+        const VulkanDynamicResolutionStatistics* resolution = &header->resolution[tier];
+        printf("    %-16s resolves %8" PRIu64 "  total %12" PRIu64 " ns  functions %" PRIu64 "/%" PRIu64 "\n",
+            TierNames[tier], resolution->resolveCount, resolution->resolveNanoseconds, resolution->resolvedFunctionCount, resolution->functionCount);
+    }
+
+    printf("Fence waits (device instrumentation only)\n");
+    printf("    calls %" PRIu64 "  sampled %" PRIu64 "  sampled total %" PRIu64 " ns\n",
+        header->fenceWaitCount, header->fenceWaitSampledCount, header->fenceWaitSampledNanoseconds);
+
+    if (!FunctionsInBounds(dataSize, header->instanceFunctionOffset, header->instanceFunctionCount)
+        || !FunctionsInBounds(dataSize, header->deviceFunctionOffset, header->deviceFunctionCount))
+    {
+        fprintf(stderr, "Metrics segment '%s' has function tables outside the segment\n", argv[1]);
+        free(data);
+        VulkanDynamicDestroyMetricsSegment(segment);
+        return -1;
+    }
+
+    PrintFunctions("Instance functions", (const VulkanDynamicMetricsFunction*)(data + header->instanceFunctionOffset), header->instanceFunctionCount);
+    PrintFunctions("Device functions", (const VulkanDynamicMetricsFunction*)(data + header->deviceFunctionOffset), header->deviceFunctionCount);
+
+    free(data);
+    VulkanDynamicDestroyMetricsSegment(segment);
+
+    return 0;
+}
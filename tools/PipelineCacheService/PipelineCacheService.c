@@ -0,0 +1,187 @@
+// Copyright 2021 Fedir Melnichenko
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <VulkanDynamic/VulkanDynamicPipelineCacheService.h>
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+
+// Shares pipeline caches between the processes of this machine until interrupted. One
+// device, without queues in use, is created per physical device of the installed Vulkan
+// loader, and the pipeline cache data processes publish is merged on the device that
+// matches it. Processes create their caches with VulkanDynamicCreateSharedPipelineCache.
+
+#define MAX_DEVICE_COUNT 16
+
+typedef struct Service
+{
+    VulkanDynamicLoader loader;
+    VulkanDynamicInstanceDispatch instanceDispatch;
+    VulkanDynamicPhysicalDeviceDispatch physicalDeviceDispatch;
+    VkInstance instance;
+    uint32_t deviceCount;
+    VkPhysicalDevice physicalDevices[MAX_DEVICE_COUNT];
+    VkDevice devices[MAX_DEVICE_COUNT];
+    VulkanDynamicDeviceDispatch deviceDispatches[MAX_DEVICE_COUNT];
+} Service;
+
+static int CreateDevices(Service* service)
+{
+    if (VulkanDynamicCreateLoader(&service->loader) != VK_SUCCESS)
+    {
+        return 0;
+    }
+
+    VulkanDynamicLoaderDispatch loaderDispatch;
+    VulkanDynamicGetLoaderDispatch(service->loader, &loaderDispatch);
+
+    VkApplicationInfo applicationInfo;
+    memset(&applicationInfo, 0, sizeof(VkApplicationInfo));
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_0;
+
+    VkInstanceCreateInfo instanceCreateInfo;
+    memset(&instanceCreateInfo, 0, sizeof(VkInstanceCreateInfo));
+    instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+
+    if (loaderDispatch.CreateInstance(&instanceCreateInfo, NULL, &service->instance) != VK_SUCCESS)
+    {
+        return 0;
+    }
+
+    VulkanDynamicGetInstanceDispatch(service->instance, &loaderDispatch, &service->instanceDispatch);
+    VulkanDynamicGetPhysicalDeviceDispatch(service->instance, service->loader, &service->instanceDispatch, &service->physicalDeviceDispatch);
+
+    uint32_t physicalDeviceCount = MAX_DEVICE_COUNT;
+    if (service->instanceDispatch.EnumeratePhysicalDevices(service->instance, &physicalDeviceCount, service->physicalDevices) < 0)
+    {
+        return 0;
+    }
+
+    const float queuePriority = 1.0f;
+    VkDeviceQueueCreateInfo queueCreateInfo;
+    memset(&queueCreateInfo, 0, sizeof(VkDeviceQueueCreateInfo));
+    queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueCount = 1;
+    queueCreateInfo.pQueuePriorities = &queuePriority;
+
+    VkDeviceCreateInfo deviceCreateInfo;
+    memset(&deviceCreateInfo, 0, sizeof(VkDeviceCreateInfo));
+    deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+
+    // Devices that cannot be created are left out rather than failing the service.
+    for (uint32_t index = 0; index < physicalDeviceCount; ++index)
+    {
+        const uint32_t deviceIndex = service->deviceCount;
+        service->physicalDevices[deviceIndex] = service->physicalDevices[index];
+        if (service->instanceDispatch.CreateDevice(service->physicalDevices[deviceIndex], &deviceCreateInfo, NULL, &service->devices[deviceIndex]) != VK_SUCCESS)
+        {
+            continue;
+        }
+
+        VulkanDynamicGetDeviceDispatch(service->devices[deviceIndex], &service->instanceDispatch, &service->deviceDispatches[deviceIndex]);
+        ++service->deviceCount;
+    }
+
+    return service->deviceCount > 0;
+}
+
+static void DestroyDevices(Service* service)
+{
+    for (uint32_t index = 0; index < service->deviceCount; ++index)
+    {
+        service->deviceDispatches[index].DestroyDevice(service->devices[index], NULL);
+    }
+
+    if (service->instance)
+    {
+        service->instanceDispatch.DestroyInstance(service->instance, NULL);
+    }
+
+    if (service->loader)
+    {
+        VulkanDynamicDestroyLoader(service->loader);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <socket path>\n", argv[0]);
+        return -1;
+    }
+
+    // Blocked before the server's thread starts, so that only sigwait receives them.
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+    Service service;
+    memset(&service, 0, sizeof(Service));
+    if (!CreateDevices(&service))
+    {
+        fprintf(stderr, "Failed to create a Vulkan device\n");
+        DestroyDevices(&service);
+        return -1;
+    }
+
+    VulkanDynamicPipelineCacheServerDevice serverDevices[MAX_DEVICE_COUNT];
+    for (uint32_t index = 0; index < service.deviceCount; ++index)
+    {
+        VkPhysicalDeviceProperties properties;
+        service.physicalDeviceDispatch.GetPhysicalDeviceProperties(service.physicalDevices[index], &properties);
+        printf("Serving %s (vendor %04x, device %04x, driver %08x)\n", properties.deviceName, properties.vendorID, properties.deviceID, properties.driverVersion);
+
+        serverDevices[index].physicalDeviceDispatch = &service.physicalDeviceDispatch;
+        serverDevices[index].physicalDevice = service.physicalDevices[index];
+        serverDevices[index].deviceDispatch = &service.deviceDispatches[index];
+        serverDevices[index].device = service.devices[index];
+    }
+
+    VulkanDynamicPipelineCacheServer server;
+    const VkResult result = VulkanDynamicCreatePipelineCacheServer(argv[1], service.deviceCount, serverDevices, &server);
+    if (result != VK_SUCCESS)
+    {
+        fprintf(stderr, "Failed to listen on '%s': %d\n", argv[1], (int)result);
+        DestroyDevices(&service);
+        return -1;
+    }
+
+    printf("Listening on %s\n", argv[1]);
+    fflush(stdout);
+
+    int received;
+    sigwait(&signals, &received);
+
+    VulkanDynamicPipelineCacheServerStatistics statistics;
+    VulkanDynamicGetPipelineCacheServerStatistics(server, &statistics);
+    VulkanDynamicDestroyPipelineCacheServer(server);
+
+    printf("Merged %" PRIu64 " caches (%" PRIu64 " rejected), served %" PRIu64 " caches with %" PRIu64 " bytes\n",
+        statistics.publishCount, statistics.rejectedPublishCount, statistics.fetchCount, statistics.servedSize);
+
+    DestroyDevices(&service);
+
+    return 0;
+}